@@ -27,6 +27,9 @@ int main(void) {
 #if defined(__VPCLMULQDQ__)
 	printf("VPCLMULQDQ;");
 #endif
+#if defined(__VAES__)
+	printf("VAES;");
+#endif
 #if defined(__BMI__)
 	printf("BMI1;");
 #endif
@@ -51,6 +54,9 @@ int main(void) {
 #if defined(__SSE3__)
 	printf("SSE3;");
 #endif
+#if defined(__SHA__) && defined(__SSSE3__) && defined(__SSE4_1__)
+	printf("SHA_NI;");
+#endif
 #if defined(__ARM_FEATURE_AES)
 	printf("ARM_AES;");
 #endif
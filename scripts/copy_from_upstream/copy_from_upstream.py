@@ -123,6 +123,16 @@ def replacer_contextual(destination_file_path, template_file_path, delimiter, fa
     contents = preamble + identifier_start + jinja2.Template(template).render(f) + postamble
     file_put_contents(destination_file_path, contents)
 
+# Implementations listed under a family's 'local_implementations' are maintained
+# in this repository, in src/{type}/{family}/local_{pqclean_scheme}_{name}; their
+# entries take the form of an implementation in an upstream META.yml
+def add_local_implementations(family, scheme):
+    for imp in family.get('local_implementations', []):
+        imp = copy.deepcopy(imp)
+        imp['upstream'] = {'name': 'local'}
+        scheme['metadata']['implementations'].append(imp)
+
+
 def load_instructions(file='copy_from_upstream.yml'):
     instructions = file_get_contents(
         os.path.join(os.environ['LIBOQS_DIR'], 'scripts', 'copy_from_upstream', file),
@@ -265,6 +275,7 @@ def load_instructions(file='copy_from_upstream.yml'):
                             raise RuntimeError("Found duplicate arch {} in scheme {}".format(arch, scheme))
                         scheme['scheme_paths'][arch] = (os.path.join('repos', location,
                                                                     upstreams[location]['kem_scheme_path'].format_map(scheme)))
+            add_local_implementations(family, scheme)
             scheme['metadata']['ind_cca'] = 'true' if (
                     scheme['metadata']['claimed-security'] == "IND-CCA2") else 'false'
             scheme['pqclean_scheme_c'] = scheme['pqclean_scheme'].replace('-', '')
@@ -365,6 +376,7 @@ def load_instructions(file='copy_from_upstream.yml'):
                             raise RuntimeError("Found duplicate arch {} in scheme {}".format(arch, scheme))
                         scheme['scheme_paths'][arch] = (os.path.join('repos', location,
                                                                     upstreams[location]['sig_scheme_path'].format_map(scheme)))
+            add_local_implementations(family, scheme)
             scheme['metadata']['euf_cma'] = 'true'
             scheme['pqclean_scheme_c'] = scheme['pqclean_scheme'].replace('-', '')
             scheme['scheme_c'] = scheme['scheme'].replace('-', '')
@@ -458,7 +470,11 @@ def handle_implementation(impl, family, scheme, dst_basedir):
         print("Obtain files for implementation %s" % (impl))
         print("Obtain files for %s" % (scheme))
 
-    if 'upstream_location' in scheme:
+    if i['upstream']['name'] == 'local':
+        # maintained in this repository: there is nothing to copy
+        srcfolder = os.path.join(os.environ['LIBOQS_DIR'], 'src', family['type'], family['name'],
+                                 'local_{}_{}'.format(scheme['pqclean_scheme'], impl))
+    elif 'upstream_location' in scheme:
         # determine origin folder of (may be renamed via 'folder_name'):
         if 'folder_name' in i:
             of = i['folder_name']
@@ -756,6 +772,8 @@ def verify_from_upstream():
             else:
                 # If no scheme['implementation'] given, get the list from META.yml and add all implementations
                 for impl in scheme['metadata']['implementations']:
+                    if impl['upstream']['name'] == 'local':
+                        continue
                     oqsdir = os.path.join(os.environ['LIBOQS_DIR'], 'src', family['type'], family['name'],
                                           '{}_{}_{}'.format(impl['upstream']['name'], scheme['pqclean_scheme'],
                                                             impl['name']))
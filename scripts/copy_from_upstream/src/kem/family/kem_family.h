@@ -5,25 +5,80 @@
 
 #include <oqs/oqs.h>
 
+{% set kem_extensions = extensions|default([])|map(attribute='name')|list -%}
 {% for scheme in schemes -%}
 #if defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['scheme'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['alias_scheme'] }}){%- endif %}
 #define OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_public_key {{ scheme['metadata']['length-public-key'] }}
 #define OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_secret_key {{ scheme['metadata']['length-secret-key'] }}
 #define OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_ciphertext {{ scheme['metadata']['length-ciphertext'] }}
 #define OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_shared_secret {{ scheme['metadata']['length-shared-secret'] }}
+{%- if 'expanded_public_key' in kem_extensions %}
+#define OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_expanded_public_key {{ scheme['length_expanded_public_key'] }}
+{%- endif %}
+{%- if 'expanded_secret_key' in kem_extensions %}
+#define OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_expanded_secret_key {{ scheme['length_expanded_secret_key'] }}
+{%- endif %}
 OQS_KEM *OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_new(void);
 OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+{%- if 'keypair_batch' in kem_extensions %}
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_keypair_batch(uint8_t *public_keys, uint8_t *secret_keys, size_t count);
+{%- endif %}
+{%- if 'batch' in kem_extensions %}
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_encaps_batch(uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_key, size_t count);
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_decaps_batch(uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_key, size_t count);
+{%- endif %}
+{%- if 'expanded_public_key' in kem_extensions %}
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_encaps_expanded(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *expanded_public_key);
+{%- endif %}
+{%- if 'expanded_secret_key' in kem_extensions %}
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_decaps_expanded(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *expanded_secret_key);
+{%- endif %}
+{%- if 'stream' in kem_extensions %}
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_encaps_stream(uint8_t *ciphertext, uint8_t *shared_secret, OQS_KEM_public_key_reader read_public_key, void *context);
+{%- endif %}
+{%- if 'parallel' in kem_extensions %}
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_keypair_parallel(uint8_t *public_key, uint8_t *secret_key, OQS_THREADPOOL *pool);
+{%- endif %}
 {% if 'alias_scheme' in scheme %}
 #define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_length_public_key OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_public_key
 #define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_length_secret_key OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_secret_key
 #define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_length_ciphertext OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_ciphertext
 #define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_length_shared_secret OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_shared_secret
+{%- if 'expanded_public_key' in kem_extensions %}
+#define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_length_expanded_public_key OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_expanded_public_key
+{%- endif %}
+{%- if 'expanded_secret_key' in kem_extensions %}
+#define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_length_expanded_secret_key OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_expanded_secret_key
+{%- endif %}
 OQS_KEM *OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_new(void);
 #define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_keypair OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_keypair
 #define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_encaps OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_encaps
 #define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_decaps OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_decaps
+{%- if 'keypair_batch' in kem_extensions %}
+#define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_keypair_batch OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_keypair_batch
+{%- endif %}
+{%- if 'batch' in kem_extensions %}
+#define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_encaps_batch OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_encaps_batch
+#define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_decaps_batch OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_decaps_batch
+{%- endif %}
+{%- if 'expanded_public_key' in kem_extensions %}
+#define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_public_key_expand OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_public_key_expand
+#define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_encaps_expanded OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_encaps_expanded
+{%- endif %}
+{%- if 'expanded_secret_key' in kem_extensions %}
+#define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_secret_key_expand OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_secret_key_expand
+#define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_decaps_expanded OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_decaps_expanded
+{%- endif %}
+{%- if 'stream' in kem_extensions %}
+#define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_encaps_stream OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_encaps_stream
+{%- endif %}
+{%- if 'parallel' in kem_extensions %}
+#define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_keypair_parallel OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_keypair_parallel
+{%- endif %}
 {% endif -%}
 #endif
 
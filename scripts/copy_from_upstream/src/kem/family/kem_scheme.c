@@ -4,6 +4,112 @@
 
 #include <oqs/kem_{{ family }}.h>
 
+{#- Families list their additional entry points under 'extensions' in
+    copy_from_upstream.yml, each with the implementations that provide it; the
+    other implementations fall back to the default one (or, for the batched
+    entry points, to a loop over the single operation). The upstream symbol of
+    an entry point is the keypair symbol of the implementation with 'keypair'
+    replaced by the suffix passed to these macros. #}
+{%- set kem_extensions = {} %}
+{%- for extension in extensions|default([]) %}
+{%- set _ = kem_extensions.update({extension['name']: extension['implementations']}) %}
+{%- endfor %}
+
+{%- macro symbol_prefix(scheme, impl) -%}
+{%- if impl['signature_keypair'] -%}
+{{ impl['signature_keypair'][:-7] }}
+{%- else -%}
+PQCLEAN_{{ scheme['pqclean_scheme_c']|upper }}_{{ impl['name']|upper }}_crypto_kem_
+{%- endif -%}
+{%- endmacro %}
+
+{%- macro enabled(scheme, impl_name) -%}
+defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['scheme'] }}_{{ impl_name }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_{{ impl_name }}){%- endif %}
+{%- endmacro %}
+
+{%- macro dispatch(scheme, extension, suffix, args) -%}
+{%- set default = scheme['metadata']['implementations']|selectattr('name', 'equalto', scheme['default_implementation'])|first %}
+{%- set others = scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|selectattr('name', 'in', kem_extensions[extension])|list %}
+{%- for impl in others %}
+{%- if loop.first %}
+#if {{ enabled(scheme, impl['name']) }}
+{%- else %}
+#elif {{ enabled(scheme, impl['name']) }}
+{%- endif %}
+{%- if 'required_flags' in impl and impl['required_flags'] %}
+#if defined(OQS_DIST_BUILD)
+	if ({%- for flag in impl['required_flags'] -%}OQS_CPU_has_extension(OQS_CPU_EXT_{{ flag|upper }}){%- if not loop.last %} && {% endif -%}{%- endfor -%}) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) {{ symbol_prefix(scheme, impl) }}{{ suffix }}({{ args }});
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) {{ symbol_prefix(scheme, default) }}{{ suffix }}({{ args }});
+	}
+#endif /* OQS_DIST_BUILD */
+{%- else %}
+	return (OQS_STATUS) {{ symbol_prefix(scheme, impl) }}{{ suffix }}({{ args }});
+{%- endif %}
+{%- endfor %}
+{%- if others %}
+#else
+{%- endif %}
+	return (OQS_STATUS) {{ symbol_prefix(scheme, default) }}{{ suffix }}({{ args }});
+{%- if others %}
+#endif
+{%- endif %}
+{%- endmacro %}
+
+{#- Enabled implementations without a batched entry point: libjade, and those
+    not listed for the extension #}
+{%- macro batch_fallback(scheme, extension) -%}
+{%- set conditions = [] %}
+{%- if libjade_implementation is defined and scheme['libjade_implementation'] %}
+{%- set _ = conditions.append('(defined(OQS_LIBJADE_BUILD) && defined(OQS_ENABLE_LIBJADE_KEM_' + family + '_' + scheme['scheme'] + '))') %}
+{%- endif %}
+{%- for impl in scheme['metadata']['implementations'] if impl['name'] not in kem_extensions[extension] %}
+{%- set _ = conditions.append(enabled(scheme, impl['name'])) %}
+{%- endfor %}
+{{- conditions|join(' || ') }}
+{%- endmacro %}
+
+{%- macro extension_externs(scheme, impl) %}
+{%- if impl['name'] in kem_extensions['keypair_batch']|default([]) %}
+extern int {{ symbol_prefix(scheme, impl) }}keypair_batch(uint8_t *pk, uint8_t *sk, size_t count);
+{%- endif %}
+{%- if impl['name'] in kem_extensions['batch']|default([]) %}
+extern int {{ symbol_prefix(scheme, impl) }}enc_batch(uint8_t *ct, uint8_t *ss, const uint8_t *pk, size_t count);
+extern int {{ symbol_prefix(scheme, impl) }}dec_batch(uint8_t *ss, const uint8_t *ct, const uint8_t *sk, size_t count);
+{%- endif %}
+{%- if impl['name'] in kem_extensions['expanded_public_key']|default([]) %}
+extern int {{ symbol_prefix(scheme, impl) }}expand_pk(uint8_t *epk, const uint8_t *pk);
+extern int {{ symbol_prefix(scheme, impl) }}enc_expanded(uint8_t *ct, uint8_t *ss, const uint8_t *epk);
+{%- endif %}
+{%- if impl['name'] in kem_extensions['expanded_secret_key']|default([]) %}
+extern int {{ symbol_prefix(scheme, impl) }}expand_sk(uint8_t *esk, const uint8_t *sk);
+extern int {{ symbol_prefix(scheme, impl) }}dec_expanded(uint8_t *ss, const uint8_t *ct, const uint8_t *esk);
+{%- endif %}
+{%- if impl['name'] in kem_extensions['stream']|default([]) %}
+extern int {{ symbol_prefix(scheme, impl) }}enc_stream(uint8_t *ct, uint8_t *ss, int (*read_pk)(void *ctx, uint8_t *buf, size_t len), void *ctx);
+{%- endif %}
+{%- if impl['name'] in kem_extensions['parallel']|default([]) %}
+extern int {{ symbol_prefix(scheme, impl) }}keypair_tasks(uint8_t *pk, uint8_t *sk, void (*run_tasks)(void *executor, void (*task)(void *arg, size_t index), void *arg, size_t count), void *executor, size_t candidates);
+{%- endif %}
+{%- endmacro %}
+
+{%- macro extension_slots(name) %}
+	kem->keypair_batch = {% if 'keypair_batch' in kem_extensions %}OQS_KEM_{{ family }}_{{ name }}_keypair_batch{% else %}NULL{% endif %};
+	kem->encaps_batch = {% if 'batch' in kem_extensions %}OQS_KEM_{{ family }}_{{ name }}_encaps_batch{% else %}NULL{% endif %};
+	kem->decaps_batch = {% if 'batch' in kem_extensions %}OQS_KEM_{{ family }}_{{ name }}_decaps_batch{% else %}NULL{% endif %};
+	kem->length_expanded_public_key = {% if 'expanded_public_key' in kem_extensions %}OQS_KEM_{{ family }}_{{ name }}_length_expanded_public_key{% else %}0{% endif %};
+	kem->public_key_expand = {% if 'expanded_public_key' in kem_extensions %}OQS_KEM_{{ family }}_{{ name }}_public_key_expand{% else %}NULL{% endif %};
+	kem->encaps_expanded = {% if 'expanded_public_key' in kem_extensions %}OQS_KEM_{{ family }}_{{ name }}_encaps_expanded{% else %}NULL{% endif %};
+	kem->length_expanded_secret_key = {% if 'expanded_secret_key' in kem_extensions %}OQS_KEM_{{ family }}_{{ name }}_length_expanded_secret_key{% else %}0{% endif %};
+	kem->secret_key_expand = {% if 'expanded_secret_key' in kem_extensions %}OQS_KEM_{{ family }}_{{ name }}_secret_key_expand{% else %}NULL{% endif %};
+	kem->decaps_expanded = {% if 'expanded_secret_key' in kem_extensions %}OQS_KEM_{{ family }}_{{ name }}_decaps_expanded{% else %}NULL{% endif %};
+	kem->encaps_stream = {% if 'stream' in kem_extensions %}OQS_KEM_{{ family }}_{{ name }}_encaps_stream{% else %}NULL{% endif %};
+	kem->keypair_parallel = {% if 'parallel' in kem_extensions %}OQS_KEM_{{ family }}_{{ name }}_keypair_parallel{% else %}NULL{% endif %};
+{%- endmacro %}
+
 {% for scheme in schemes -%}
 #if defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['scheme'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['alias_scheme'] }}){%- endif %}
 {% if 'alias_scheme' in scheme %}
@@ -29,6 +135,7 @@ OQS_KEM *OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_new(void) {
 	kem->keypair = OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_keypair;
 	kem->encaps = OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_encaps;
 	kem->decaps = OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_decaps;
+	{{- extension_slots(scheme['scheme']) }}
 
 	return kem;
 }
@@ -60,6 +167,7 @@ OQS_KEM *OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_new(void) {
 	kem->keypair = OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_keypair;
 	kem->encaps = OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_encaps;
 	kem->decaps = OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_decaps;
+	{{- extension_slots(scheme['alias_scheme']) }}
 
 	return kem;
 }
@@ -89,6 +197,7 @@ extern int {{ scheme['metadata']['default_enc_signature'] }}(uint8_t *ct, uint8_
            {%- set cleandec = scheme['metadata'].update({'default_dec_signature': "PQCLEAN_"+scheme['pqclean_scheme_c']|upper+"_"+scheme['default_implementation']|upper+"_crypto_kem_dec"}) -%}
         {%- endif %}
 extern int {{ scheme['metadata']['default_dec_signature']  }}(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+{{- extension_externs(scheme, impl) }}
 
     {%- endfor %}
 
@@ -112,6 +221,7 @@ extern int {{ impl['signature_dec'] }}(uint8_t *ss, const uint8_t *ct, const uin
         {%- else %}
 extern int PQCLEAN_{{ scheme['pqclean_scheme_c']|upper }}_{{ impl['name']|upper }}_crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
         {%- endif %}
+        {{- extension_externs(scheme, impl) }}
 #endif
     {%- endfor %}
 
@@ -349,6 +459,115 @@ OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_decaps(uint8_t *s
 #endif /* OQS_LIBJADE_BUILD */
 {%- endif %}
 }
+{%- if 'keypair_batch' in kem_extensions %}
+{%- set fallback = batch_fallback(scheme, 'keypair_batch') %}
+
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_keypair_batch(uint8_t *public_keys, uint8_t *secret_keys, size_t count) {
+{%- if fallback %}
+#if {{ fallback }}
+	for (size_t i = 0; i < count; i++) {
+		if (OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_keypair(public_keys + i * OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_public_key, secret_keys + i * OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_secret_key) != OQS_SUCCESS) {
+			return OQS_ERROR;
+		}
+	}
+	return OQS_SUCCESS;
+#else
+{%- endif %}
+{{- dispatch(scheme, 'keypair_batch', 'keypair_batch', 'public_keys, secret_keys, count') }}
+{%- if fallback %}
+#endif
+{%- endif %}
+}
+{%- endif %}
+{%- if 'batch' in kem_extensions %}
+{%- set fallback = batch_fallback(scheme, 'batch') %}
+
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_encaps_batch(uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_key, size_t count) {
+{%- if fallback %}
+#if {{ fallback }}
+	for (size_t i = 0; i < count; i++) {
+		if (OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_encaps(ciphertexts + i * OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_ciphertext, shared_secrets + i * OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_shared_secret, public_key) != OQS_SUCCESS) {
+			return OQS_ERROR;
+		}
+	}
+	return OQS_SUCCESS;
+#else
+{%- endif %}
+{{- dispatch(scheme, 'batch', 'enc_batch', 'ciphertexts, shared_secrets, public_key, count') }}
+{%- if fallback %}
+#endif
+{%- endif %}
+}
+
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_decaps_batch(uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_key, size_t count) {
+{%- if fallback %}
+#if {{ fallback }}
+	for (size_t i = 0; i < count; i++) {
+		if (OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_decaps(shared_secrets + i * OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_shared_secret, ciphertexts + i * OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_ciphertext, secret_key) != OQS_SUCCESS) {
+			return OQS_ERROR;
+		}
+	}
+	return OQS_SUCCESS;
+#else
+{%- endif %}
+{{- dispatch(scheme, 'batch', 'dec_batch', 'shared_secrets, ciphertexts, secret_key, count') }}
+{%- if fallback %}
+#endif
+{%- endif %}
+}
+{%- endif %}
+{%- if 'expanded_public_key' in kem_extensions %}
+
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key) {
+{{- dispatch(scheme, 'expanded_public_key', 'expand_pk', 'expanded_public_key, public_key') }}
+}
+
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_encaps_expanded(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *expanded_public_key) {
+{{- dispatch(scheme, 'expanded_public_key', 'enc_expanded', 'ciphertext, shared_secret, expanded_public_key') }}
+}
+{%- endif %}
+{%- if 'expanded_secret_key' in kem_extensions %}
+
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key) {
+{{- dispatch(scheme, 'expanded_secret_key', 'expand_sk', 'expanded_secret_key, secret_key') }}
+}
+
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_decaps_expanded(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *expanded_secret_key) {
+{{- dispatch(scheme, 'expanded_secret_key', 'dec_expanded', 'shared_secret, ciphertext, expanded_secret_key') }}
+}
+{%- endif %}
+{%- if 'stream' in kem_extensions %}
+
+/* Adapts an OQS_KEM_public_key_reader to the callback taken by the implementations */
+typedef struct {
+	OQS_KEM_public_key_reader read_public_key;
+	void *context;
+} public_key_reader;
+
+static int read_public_key_rows(void *ctx, uint8_t *buf, size_t len) {
+	const public_key_reader *reader = ctx;
+	return reader->read_public_key(reader->context, buf, len) == OQS_SUCCESS ? 0 : -1;
+}
+
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_encaps_stream(uint8_t *ciphertext, uint8_t *shared_secret, OQS_KEM_public_key_reader read_public_key, void *context) {
+	public_key_reader reader = { read_public_key, context };
+{{- dispatch(scheme, 'stream', 'enc_stream', 'ciphertext, shared_secret, read_public_key_rows, &reader') }}
+}
+{%- endif %}
+{%- if 'parallel' in kem_extensions %}
+
+/* Hands the candidate seeds of crypto_kem_keypair_tasks to an OQS_THREADPOOL */
+static void run_keygen_tasks(void *executor, void (*task)(void *arg, size_t index), void *arg, size_t count) {
+	OQS_THREADPOOL_run((OQS_THREADPOOL *)executor, task, arg, count);
+}
+
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_keypair_parallel(uint8_t *public_key, uint8_t *secret_key, OQS_THREADPOOL *pool) {
+	if (OQS_THREADPOOL_concurrency(pool) <= 1) {
+		return OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_keypair(public_key, secret_key);
+	}
+{{- dispatch(scheme, 'parallel', 'keypair_tasks', 'public_key, secret_key, run_keygen_tasks, pool, OQS_THREADPOOL_concurrency(pool)') }}
+}
+{%- endif %}
 
 #endif
 {% endfor -%}
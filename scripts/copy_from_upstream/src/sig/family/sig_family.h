@@ -5,24 +5,86 @@
 
 #include <oqs/oqs.h>
 
+{% set sig_extensions = {} -%}
+{% for extension in extensions|default([]) -%}
+{% set _ = sig_extensions.update({extension['name']: extension}) -%}
+{% endfor -%}
 {% for scheme in schemes -%}
 #if defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}){%- endif %}
 #define OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_public_key {{ scheme['metadata']['length-public-key'] }}
 #define OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_secret_key {{ scheme['metadata']['length-secret-key'] }}
 #define OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_signature {{ scheme['metadata']['length-signature'] }}
+{%- if 'expanded_public_key' in sig_extensions %}
+#define OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_expanded_public_key {{ scheme['length_expanded_public_key'] }}
+{%- endif %}
+{%- if 'expanded_secret_key' in sig_extensions %}
+#define OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_expanded_secret_key {{ scheme['length_expanded_secret_key'] }}
+{%- endif %}
 
 OQS_SIG *OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_new(void);
 OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+{%- if 'expanded_public_key' in sig_extensions %}
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify_expanded(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *expanded_public_key);
+{%- endif %}
+{%- if 'expanded_secret_key' in sig_extensions %}
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key);
+{%- endif %}
+{%- if 'stream' in sig_extensions %}
+{%- if not sig_extensions['stream']['verify_only'] %}
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_sign_init(void *state, const uint8_t *secret_key);
+{%- endif %}
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+{%- if not sig_extensions['stream']['verify_only'] %}
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_sign_final(uint8_t *signature, size_t *signature_len, void *state);
+{%- endif %}
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_verify_final(void *state);
+OQS_API void OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_release(void *state);
+{%- endif %}
+{%- if 'parallel' in sig_extensions %}
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign_parallel(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool);
+{%- endif %}
 {% if 'alias_scheme' in scheme %}
 #define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_length_public_key OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_public_key
 #define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_length_secret_key OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_secret_key
 #define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_length_signature OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_signature
+{%- if 'expanded_public_key' in sig_extensions %}
+#define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_length_expanded_public_key OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_expanded_public_key
+{%- endif %}
+{%- if 'expanded_secret_key' in sig_extensions %}
+#define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_length_expanded_secret_key OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_expanded_secret_key
+{%- endif %}
 OQS_SIG *OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_new(void);
 #define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_keypair OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_keypair
 #define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_sign OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign
 #define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_verify OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify
+{%- if 'expanded_public_key' in sig_extensions %}
+#define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_public_key_expand OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_public_key_expand
+#define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_verify_expanded OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify_expanded
+{%- endif %}
+{%- if 'expanded_secret_key' in sig_extensions %}
+#define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_secret_key_expand OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_secret_key_expand
+#define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_sign_expanded OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign_expanded
+{%- endif %}
+{%- if 'stream' in sig_extensions %}
+{%- if not sig_extensions['stream']['verify_only'] %}
+#define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_stream_sign_init OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_sign_init
+{%- endif %}
+#define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_stream_verify_init OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_verify_init
+#define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_stream_update OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_update
+{%- if not sig_extensions['stream']['verify_only'] %}
+#define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_stream_sign_final OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_sign_final
+{%- endif %}
+#define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_stream_verify_final OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_verify_final
+#define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_stream_release OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_release
+{%- endif %}
+{%- if 'parallel' in sig_extensions %}
+#define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_sign_parallel OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign_parallel
+{%- endif %}
 {% endif -%}
 #endif
 
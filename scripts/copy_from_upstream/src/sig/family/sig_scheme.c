@@ -1,11 +1,177 @@
 // SPDX-License-Identifier: MIT
 
+{#- Families list their additional entry points under 'extensions' in
+    copy_from_upstream.yml, each with the implementations that provide it; the
+    other implementations fall back to the default one. The upstream symbol of
+    an entry point is the keypair symbol of the implementation with 'keypair'
+    replaced by the suffix passed to these macros.
+    Schemes that set 'stream_message_hash' (sha256, sha512 or shake256)
+    stream into their message hash H_msg(R, PK, M) in the wrapper and hand
+    the state to the upstream verify_stream; the others use the upstream
+    stream_init_sk and stream_init_pk, which keep a SHAKE256 state.
+    The parallel extension hands the family's task runner from
+    {family}_threads.h to the upstream signature_tasks.
+    An expanded-key extension may list implementations under
+    'unavailable_with': builds enabling one of those leave the expanded-key
+    slots empty, as falling back to the default implementation would be
+    slower than their regular path. #}
+{%- set sig_extensions = {} %}
+{%- for extension in extensions|default([]) %}
+{%- set _ = sig_extensions.update({extension['name']: extension}) %}
+{%- endfor %}
+{%- set stream_hashes = [] %}
+{%- if 'stream' in sig_extensions %}
+{%- for scheme in schemes %}
+{%- set _ = stream_hashes.append(scheme['stream_message_hash']|default('shake256')) %}
+{%- endfor %}
+{%- endif %}
+
+{%- macro symbol_prefix(scheme, impl) -%}
+{%- if impl['signature_keypair'] -%}
+{{ impl['signature_keypair'][:-7] }}
+{%- else -%}
+PQCLEAN_{{ scheme['pqclean_scheme_c']|upper }}_{{ impl['name']|upper }}_crypto_sign_
+{%- endif -%}
+{%- endmacro %}
+
+{%- macro enabled(scheme, impl_name) -%}
+defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl_name }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_{{ impl_name }}){%- endif %}
+{%- endmacro %}
+
+{#- Calls the upstream function of the best enabled implementation; with
+    returns=false the call is a statement rather than the return value #}
+{%- macro dispatch(scheme, extension, suffix, args, returns=true) -%}
+{%- set call = 'return (OQS_STATUS) ' if returns else '' %}
+{%- set default = scheme['metadata']['implementations']|selectattr('name', 'equalto', scheme['default_implementation'])|first %}
+{%- set others = scheme['metadata']['implementations']|rejectattr('name', 'equalto', scheme['default_implementation'])|selectattr('name', 'in', sig_extensions[extension]['implementations'])|list %}
+{%- for impl in others %}
+{%- if loop.first %}
+#if {{ enabled(scheme, impl['name']) }}
+{%- else %}
+#elif {{ enabled(scheme, impl['name']) }}
+{%- endif %}
+{%- if 'required_flags' in impl and impl['required_flags'] %}
+#if defined(OQS_DIST_BUILD)
+	if ({%- for flag in impl['required_flags'] -%}OQS_CPU_has_extension(OQS_CPU_EXT_{{ flag|upper }}){%- if not loop.last %} && {% endif -%}{%- endfor -%}) {
+#endif /* OQS_DIST_BUILD */
+		{{ call }}{{ symbol_prefix(scheme, impl) }}{{ suffix }}({{ args }});
+#if defined(OQS_DIST_BUILD)
+	} else {
+		{{ call }}{{ symbol_prefix(scheme, default) }}{{ suffix }}({{ args }});
+	}
+#endif /* OQS_DIST_BUILD */
+{%- else %}
+	{{ call }}{{ symbol_prefix(scheme, impl) }}{{ suffix }}({{ args }});
+{%- endif %}
+{%- endfor %}
+{%- if others %}
+#else
+{%- endif %}
+	{{ call }}{{ symbol_prefix(scheme, default) }}{{ suffix }}({{ args }});
+{%- if others %}
+#endif
+{%- endif %}
+{%- endmacro %}
+
+{%- macro extension_externs(scheme, impl) %}
+{%- if 'expanded_public_key' in sig_extensions and impl['name'] in sig_extensions['expanded_public_key']['implementations'] %}
+extern int {{ symbol_prefix(scheme, impl) }}expand_pk(uint8_t *epk, const uint8_t *pk);
+extern int {{ symbol_prefix(scheme, impl) }}verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *epk);
+{%- endif %}
+{%- if 'expanded_secret_key' in sig_extensions and impl['name'] in sig_extensions['expanded_secret_key']['implementations'] %}
+extern int {{ symbol_prefix(scheme, impl) }}expand_sk(uint8_t *esk, const uint8_t *sk);
+extern int {{ symbol_prefix(scheme, impl) }}signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk);
+{%- endif %}
+{%- if 'stream' in sig_extensions and impl['name'] in sig_extensions['stream']['implementations'] and 'stream_message_hash' in scheme %}
+extern int {{ symbol_prefix(scheme, impl) }}verify_stream(const uint8_t *sig, size_t siglen, {% if scheme['stream_message_hash'] != 'shake256' %}OQS_SHA2_{{ scheme['stream_message_hash'] }}_ctx{% else %}OQS_SHA3_shake256_inc_ctx{% endif %} *msg_state, const uint8_t *m, size_t mlen, const uint8_t *pk);
+{%- elif 'stream' in sig_extensions and impl['name'] in sig_extensions['stream']['implementations'] %}
+extern void {{ symbol_prefix(scheme, impl) }}stream_init_sk(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sk);
+extern int {{ symbol_prefix(scheme, impl) }}signature_stream(uint8_t *sig, size_t *siglen, OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sk);
+extern void {{ symbol_prefix(scheme, impl) }}stream_init_pk(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *pk);
+extern int {{ symbol_prefix(scheme, impl) }}verify_stream(const uint8_t *sig, size_t siglen, OQS_SHA3_shake256_inc_ctx *state, const uint8_t *pk);
+{%- endif %}
+{%- if 'parallel' in sig_extensions and impl['name'] in sig_extensions['parallel']['implementations'] %}
+extern int {{ symbol_prefix(scheme, impl) }}signature_tasks(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk, OQS_SIG_{{ family }}_task_runner run_tasks, void *executor);
+{%- endif %}
+{%- endmacro %}
+
+{%- macro extension_slots(scheme, name) %}
+{%- set stream_sign = 'stream' in sig_extensions and not sig_extensions['stream']['verify_only'] %}
+{%- for key, verb in [('public', 'verify'), ('secret', 'sign')] %}
+{%- set extension = sig_extensions['expanded_' + key + '_key'] %}
+{%- set unavailable = scheme['metadata']['implementations']|selectattr('name', 'in', extension['unavailable_with']|default([]))|list if extension else [] %}
+{%- if unavailable %}
+#if {% for impl in unavailable %}{{ enabled(scheme, impl['name']) }}{% if not loop.last %} || {% endif %}{% endfor %}
+	/* The {{ unavailable|map(attribute='name')|join('/') }} implementation has no expanded-key {{ 'verification' if verb == 'verify' else 'signing' }}; {{ verb }} with the {{ key }} key */
+	sig->length_expanded_{{ key }}_key = 0;
+	sig->{{ key }}_key_expand = NULL;
+	sig->{{ verb }}_expanded = NULL;
+#else
+{%- endif %}
+	sig->length_expanded_{{ key }}_key = {% if extension %}OQS_SIG_{{ family }}_{{ name }}_length_expanded_{{ key }}_key{% else %}0{% endif %};
+	sig->{{ key }}_key_expand = {% if extension %}OQS_SIG_{{ family }}_{{ name }}_{{ key }}_key_expand{% else %}NULL{% endif %};
+	sig->{{ verb }}_expanded = {% if extension %}OQS_SIG_{{ family }}_{{ name }}_{{ verb }}_expanded{% else %}NULL{% endif %};
+{%- if unavailable %}
+#endif
+{%- endif %}
+{%- endfor %}
+	sig->length_stream_state = {% if 'stream' in sig_extensions %}sizeof(OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_state){% else %}0{% endif %};
+	sig->stream_sign_init = {% if stream_sign %}OQS_SIG_{{ family }}_{{ name }}_stream_sign_init{% else %}NULL{% endif %};
+	sig->stream_verify_init = {% if 'stream' in sig_extensions %}OQS_SIG_{{ family }}_{{ name }}_stream_verify_init{% else %}NULL{% endif %};
+	sig->stream_update = {% if 'stream' in sig_extensions %}OQS_SIG_{{ family }}_{{ name }}_stream_update{% else %}NULL{% endif %};
+	sig->stream_sign_final = {% if stream_sign %}OQS_SIG_{{ family }}_{{ name }}_stream_sign_final{% else %}NULL{% endif %};
+	sig->stream_verify_final = {% if 'stream' in sig_extensions %}OQS_SIG_{{ family }}_{{ name }}_stream_verify_final{% else %}NULL{% endif %};
+	sig->stream_release = {% if 'stream' in sig_extensions %}OQS_SIG_{{ family }}_{{ name }}_stream_release{% else %}NULL{% endif %};
+	sig->sign_parallel = {% if 'parallel' in sig_extensions %}OQS_SIG_{{ family }}_{{ name }}_sign_parallel{% else %}NULL{% endif %};
+{%- endmacro %}
+
 #include <stdlib.h>
+{%- if 'stream' in sig_extensions %}
+#include <string.h>
+{%- endif %}
 
+{% if 'sha256' in stream_hashes or 'sha512' in stream_hashes -%}
+#include <oqs/sha2.h>
+{% endif -%}
+{% if 'shake256' in stream_hashes -%}
+#include <oqs/sha3.h>
+{% endif -%}
 #include <oqs/sig_{{ family }}.h>
+{%- if 'parallel' in sig_extensions %}
+
+#include "{{ family }}_threads.h"
+{%- endif %}
 
 {% for scheme in schemes -%}
 #if defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}){%- endif %}
+{%- if 'stream' in sig_extensions and 'stream_message_hash' in scheme %}
+
+/* State of a streaming verification operation */
+typedef struct {
+	/* H_msg state, absorbing R || PK || M */
+{%- if scheme['stream_message_hash'] != 'shake256' %}
+	OQS_SHA2_{{ scheme['stream_message_hash'] }}_ctx msg_state;
+	/* Input not yet absorbed into msg_state, less than one {{ scheme['stream_message_hash']|replace('sha', 'SHA-') }} block */
+	uint8_t block[{% if scheme['stream_message_hash'] == 'sha256' %}64{% else %}128{% endif %}];
+	size_t block_len;
+{%- else %}
+	OQS_SHA3_shake256_inc_ctx msg_state;
+{%- endif %}
+	uint8_t public_key[OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_public_key];
+	uint8_t signature[OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_signature];
+} OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_state;
+{%- elif 'stream' in sig_extensions %}
+
+/* State of a streaming signing or verification operation */
+typedef struct {
+	/* mu = CRH(tr, msg), absorbing the message */
+	OQS_SHA3_shake256_inc_ctx mu_state;
+	/* Secret key when signing, public key when verifying */
+	uint8_t key[OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_secret_key];
+	/* Signature being verified */
+	uint8_t signature[OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_signature];
+} OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_state;
+{%- endif %}
 {% if 'alias_scheme' in scheme %}
 #if defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }})
 {% endif %}
@@ -28,6 +194,7 @@ OQS_SIG *OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_new(void) {
 	sig->keypair = OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_keypair;
 	sig->sign = OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign;
 	sig->verify = OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify;
+	{{- extension_slots(scheme, scheme['scheme']) }}
 
 	return sig;
 }
@@ -58,6 +225,7 @@ OQS_SIG *OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_new(void) {
 	sig->keypair = OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_keypair;
 	sig->sign = OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign;
 	sig->verify = OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify;
+	{{- extension_slots(scheme, scheme['alias_scheme']) }}
 
 	return sig;
 }
@@ -87,6 +255,7 @@ extern int {{ scheme['metadata']['default_signature_signature'] }}(uint8_t *sig,
            {%- set cleanverify = scheme['metadata'].update({'default_verify_signature': "PQCLEAN_"+scheme['pqclean_scheme_c']|upper+"_"+scheme['default_implementation']|upper+"_crypto_sign_verify"}) -%}
         {%- endif %}
 extern int {{ scheme['metadata']['default_verify_signature']  }}(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+{{- extension_externs(scheme, impl) }}
 
     {%- endfor %}
 
@@ -110,6 +279,7 @@ extern int {{ impl['signature_verify'] }}(const uint8_t *sig, size_t siglen, con
         {%- else %}
 extern int PQCLEAN_{{ scheme['pqclean_scheme_c']|upper }}_{{ impl['name']|upper }}_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
         {%- endif %}
+        {{- extension_externs(scheme, impl) }}
 #endif
     {%- endfor %}
 
@@ -214,6 +384,168 @@ OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify(const uint
 #endif
     {%- endif %}
 }
+{%- if 'expanded_public_key' in sig_extensions %}
+
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key) {
+{{- dispatch(scheme, 'expanded_public_key', 'expand_pk', 'expanded_public_key, public_key') }}
+}
+
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify_expanded(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *expanded_public_key) {
+{{- dispatch(scheme, 'expanded_public_key', 'verify_expanded', 'signature, signature_len, message, message_len, expanded_public_key') }}
+}
+{%- endif %}
+{%- if 'expanded_secret_key' in sig_extensions %}
+
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key) {
+{{- dispatch(scheme, 'expanded_secret_key', 'expand_sk', 'expanded_secret_key, secret_key') }}
+}
+
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key) {
+{{- dispatch(scheme, 'expanded_secret_key', 'signature_expanded', 'signature, signature_len, message, message_len, expanded_secret_key') }}
+}
+{%- endif %}
+{%- if 'stream' in sig_extensions and 'stream_message_hash' in scheme %}
+{%- set state_type = 'OQS_SIG_' + family + '_' + scheme['scheme'] + '_stream_state' %}
+{%- if scheme['stream_message_hash'] != 'shake256' %}
+
+static void OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_absorb({{ state_type }} *stream, const uint8_t *in, size_t inlen) {
+	size_t inblocks;
+
+	if (stream->block_len > 0) {
+		size_t fill = sizeof(stream->block) - stream->block_len;
+		if (fill > inlen) {
+			fill = inlen;
+		}
+		memcpy(stream->block + stream->block_len, in, fill);
+		stream->block_len += fill;
+		in += fill;
+		inlen -= fill;
+		if (stream->block_len < sizeof(stream->block)) {
+			return;
+		}
+		OQS_SHA2_{{ scheme['stream_message_hash'] }}_inc_blocks(&stream->msg_state, stream->block, 1);
+		stream->block_len = 0;
+	}
+	inblocks = inlen / sizeof(stream->block);
+	if (inblocks > 0) {
+		OQS_SHA2_{{ scheme['stream_message_hash'] }}_inc_blocks(&stream->msg_state, in, inblocks);
+	}
+	stream->block_len = inlen - inblocks * sizeof(stream->block);
+	memcpy(stream->block, in + inblocks * sizeof(stream->block), stream->block_len);
+}
+{%- endif %}
+
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	{{ state_type }} *stream = state;
+
+	if (signature_len != OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_signature) {
+		return OQS_ERROR;
+	}
+	memcpy(stream->public_key, public_key, OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_public_key);
+	memcpy(stream->signature, signature, OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_signature);
+
+	/* The signature starts with the n-byte randomizer R; the public key is 2n bytes */
+{%- if scheme['stream_message_hash'] != 'shake256' %}
+	OQS_SHA2_{{ scheme['stream_message_hash'] }}_inc_init(&stream->msg_state);
+	stream->block_len = 0;
+	OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_absorb(stream, signature, OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_public_key / 2);
+	OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_absorb(stream, public_key, OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_public_key);
+{%- else %}
+	OQS_SHA3_shake256_inc_init(&stream->msg_state);
+	OQS_SHA3_shake256_inc_absorb(&stream->msg_state, signature, OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_public_key / 2);
+	OQS_SHA3_shake256_inc_absorb(&stream->msg_state, public_key, OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_public_key);
+{%- endif %}
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_update(void *state, const uint8_t *chunk, size_t chunk_len) {
+	{{ state_type }} *stream = state;
+{# #}
+{%- if scheme['stream_message_hash'] != 'shake256' %}
+	OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_absorb(stream, chunk, chunk_len);
+{%- else %}
+	OQS_SHA3_shake256_inc_absorb(&stream->msg_state, chunk, chunk_len);
+{%- endif %}
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_verify_final(void *state) {
+	{{ state_type }} *stream = state;
+{# #}
+{%- if scheme['stream_message_hash'] != 'shake256' %}
+{{- dispatch(scheme, 'stream', 'verify_stream', 'stream->signature, OQS_SIG_' + family + '_' + scheme['scheme'] + '_length_signature, &stream->msg_state, stream->block, stream->block_len, stream->public_key') }}
+{%- else %}
+{{- dispatch(scheme, 'stream', 'verify_stream', 'stream->signature, OQS_SIG_' + family + '_' + scheme['scheme'] + '_length_signature, &stream->msg_state, NULL, 0, stream->public_key') }}
+{%- endif %}
+}
+
+OQS_API void OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_release(void *state) {
+	{{ state_type }} *stream = state;
+{# #}
+{%- if scheme['stream_message_hash'] != 'shake256' %}
+	OQS_SHA2_{{ scheme['stream_message_hash'] }}_inc_ctx_release(&stream->msg_state);
+{%- else %}
+	OQS_SHA3_shake256_inc_ctx_release(&stream->msg_state);
+{%- endif %}
+}
+{%- elif 'stream' in sig_extensions %}
+
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_sign_init(void *state, const uint8_t *secret_key) {
+	OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_state *stream = state;
+
+	memcpy(stream->key, secret_key, OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_secret_key);
+{{- dispatch(scheme, 'stream', 'stream_init_sk', '&stream->mu_state, secret_key', false) }}
+
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_state *stream = state;
+
+	if (signature_len != OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_signature) {
+		return OQS_ERROR;
+	}
+	memcpy(stream->key, public_key, OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_public_key);
+	memcpy(stream->signature, signature, OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_signature);
+{{- dispatch(scheme, 'stream', 'stream_init_pk', '&stream->mu_state, public_key', false) }}
+
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_update(void *state, const uint8_t *chunk, size_t chunk_len) {
+	OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_state *stream = state;
+
+	OQS_SHA3_shake256_inc_absorb(&stream->mu_state, chunk, chunk_len);
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_sign_final(uint8_t *signature, size_t *signature_len, void *state) {
+	OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_state *stream = state;
+{# #}
+{{- dispatch(scheme, 'stream', 'signature_stream', 'signature, signature_len, &stream->mu_state, stream->key') }}
+}
+
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_verify_final(void *state) {
+	OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_state *stream = state;
+{# #}
+{{- dispatch(scheme, 'stream', 'verify_stream', 'stream->signature, OQS_SIG_' + family + '_' + scheme['scheme'] + '_length_signature, &stream->mu_state, stream->key') }}
+}
+
+OQS_API void OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_release(void *state) {
+	OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_stream_state *stream = state;
+
+	OQS_SHA3_shake256_inc_ctx_release(&stream->mu_state);
+}
+{%- endif %}
+{%- if 'parallel' in sig_extensions %}
+
+OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign_parallel(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool) {
+	if (OQS_THREADPOOL_concurrency(pool) <= 1) {
+		return OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign(signature, signature_len, message, message_len, secret_key);
+	}
+{{- dispatch(scheme, 'parallel', 'signature_tasks', 'signature, signature_len, message, message_len, secret_key, OQS_SIG_' + family + '_run_tasks, pool') }}
+}
+{%- endif %}
 
 #endif
 {% endfor -%}
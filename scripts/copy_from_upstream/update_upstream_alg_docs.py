@@ -171,7 +171,7 @@ def update_upstream_kem_alg_docs(liboqs_root, kems, upstream_info, write_changes
 
                 _upstream_yaml = upstream_yaml
                 for impl_index, impl in enumerate(oqs_scheme_yaml['implementations']):
-                    if impl['upstream'] != 'libjade':
+                    if impl['upstream'] not in ['libjade', 'local']:
                         upstream_yaml = _upstream_yaml
                         if impl['upstream'] in ouis:
                             upstream_name = impl['upstream']
@@ -390,6 +390,8 @@ def update_upstream_sig_alg_docs(liboqs_root, sigs, upstream_info, write_changes
 
                 _upstream_yaml = upstream_yaml
                 for impl_index, impl in enumerate(oqs_scheme_yaml['implementations']):
+                    if impl['upstream'] == 'local':
+                        continue
                     upstream_yaml = _upstream_yaml
                     if impl['upstream'] in ouis:
                         upstream_name = impl['upstream']
@@ -92,6 +92,9 @@ unifdef -k -m \
   -DKeccakP1600times4_useAVX2 \
   {} \;
 
+# The times8 AVX-512 implementation is maintained in liboqs rather than upstream
+cp -Rp "${BASE}/../../src/common/sha3/xkcp_low/KeccakP-1600times8" "${BUILD_XKCP}/"
+
 cp "${BASE}/CMakeLists.txt" "${BUILD_XKCP}/CMakeLists.txt"
 
 # Apply liboqs formatting 
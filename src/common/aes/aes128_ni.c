@@ -11,10 +11,8 @@
 #include <wmmintrin.h>
 #include <tmmintrin.h>
 
-typedef struct {
-	__m128i sk_exp[11];
-	__m128i iv;
-} aes128ctx;
+#include "aes_ni.h"
+
 
 // From crypto_core/aes128ncrypt/dolbeau/aesenc-int
 static inline void aes128ni_setkey_encrypt(const unsigned char *key, __m128i rkeys[11]) {
@@ -132,14 +130,41 @@ static inline void aes128ni_encrypt_x4(const __m128i rkeys[11], __m128i n0,
 	_mm_storeu_si128((__m128i *)(out + 48), temp3);
 }
 
+// 8x interleaved encryption, enough blocks in flight to cover the AESENC latency
+static inline void aes128ni_encrypt_x8(const __m128i rkeys[11], __m128i nv[8], unsigned char *out) {
+	int i, r;
+
+	for (i = 0; i < 8; i++) {
+		nv[i] = _mm_xor_si128(nv[i], rkeys[0]);
+	}
+	for (r = 1; r < 10; r++) {
+		for (i = 0; i < 8; i++) {
+			nv[i] = _mm_aesenc_si128(nv[i], rkeys[r]);
+		}
+	}
+	for (i = 0; i < 8; i++) {
+		nv[i] = _mm_aesenclast_si128(nv[i], rkeys[10]);
+		_mm_storeu_si128((__m128i *)(out + 16 * i), nv[i]);
+	}
+}
+
 void oqs_aes128_enc_sch_block_ni(const uint8_t *plaintext, const void *_schedule, uint8_t *ciphertext) {
 	const __m128i *schedule = ((const aes128ctx *) _schedule)->sk_exp;
 	aes128ni_encrypt(schedule, _mm_loadu_si128((const __m128i *)plaintext), ciphertext);
 }
 
 void oqs_aes128_ecb_enc_sch_ni(const uint8_t *plaintext, const size_t plaintext_len, const void *schedule, uint8_t *ciphertext) {
+	const __m128i *rkeys = ((const aes128ctx *) schedule)->sk_exp;
+	size_t block = 0;
 	assert(plaintext_len % 16 == 0);
-	for (size_t block = 0; block < plaintext_len / 16; block++) {
+	for (; block + 8 <= plaintext_len / 16; block += 8) {
+		__m128i nv[8];
+		for (int i = 0; i < 8; i++) {
+			nv[i] = _mm_loadu_si128((const __m128i *)(plaintext + 16 * (block + i)));
+		}
+		aes128ni_encrypt_x8(rkeys, nv, ciphertext + 16 * block);
+	}
+	for (; block < plaintext_len / 16; block++) {
 		oqs_aes128_enc_sch_block_ni(plaintext + (16 * block), schedule, ciphertext + (16 * block));
 	}
 }
@@ -148,7 +173,17 @@ void oqs_aes128_ctr_enc_sch_upd_blks_ni(void *schedule, uint8_t *out, size_t out
 	aes128ctx *ctx = (aes128ctx *) schedule;
 	const __m128i mask = _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 7, 6, 5, 4, 3, 2, 1, 0);
 
-	while (out_blks >= 4) {
+	while (out_blks >= 8) {
+		__m128i nv[8];
+		for (int i = 0; i < 8; i++) {
+			nv[i] = _mm_shuffle_epi8(_mm_add_epi64(ctx->iv, _mm_set_epi64x(i, 0)), mask);
+		}
+		aes128ni_encrypt_x8(ctx->sk_exp, nv, out);
+		ctx->iv = _mm_add_epi64(ctx->iv, _mm_set_epi64x(8, 0));
+		out += 128;
+		out_blks -= 8;
+	}
+	if (out_blks >= 4) {
 		__m128i nv0 = _mm_shuffle_epi8(ctx->iv, mask);
 		__m128i nv1 = _mm_shuffle_epi8(_mm_add_epi64(ctx->iv, _mm_set_epi64x(1, 0)), mask);
 		__m128i nv2 = _mm_shuffle_epi8(_mm_add_epi64(ctx->iv, _mm_set_epi64x(2, 0)), mask);
@@ -179,7 +214,18 @@ void oqs_aes128_ctr_enc_sch_ni(const uint8_t *iv, const size_t iv_len, const voi
 		exit(EXIT_FAILURE);
 	}
 
-	while (out_len >= 64) {
+	while (out_len >= 128) {
+		__m128i nv[8];
+		__m128i ctr = _mm_shuffle_epi8(block, mask);
+		for (int i = 0; i < 8; i++) {
+			nv[i] = _mm_shuffle_epi8(_mm_add_epi64(ctr, _mm_set_epi64x(i, 0)), mask);
+		}
+		aes128ni_encrypt_x8(((const aes128ctx *) schedule)->sk_exp, nv, out);
+		block = _mm_shuffle_epi8(_mm_add_epi64(ctr, _mm_set_epi64x(8, 0)), mask);
+		out += 128;
+		out_len -= 128;
+	}
+	if (out_len >= 64) {
 		__m128i nv0 = block;
 		__m128i nv1 = _mm_shuffle_epi8(_mm_add_epi64(_mm_shuffle_epi8(block, mask), _mm_set_epi64x(1, 0)), mask);
 		__m128i nv2 = _mm_shuffle_epi8(_mm_add_epi64(_mm_shuffle_epi8(block, mask), _mm_set_epi64x(2, 0)), mask);
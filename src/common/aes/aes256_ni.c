@@ -12,12 +12,10 @@
 #include <wmmintrin.h>
 #include <tmmintrin.h>
 
+#include "aes_ni.h"
+
 #define AES_BLOCKBYTES 16
 
-typedef struct {
-	__m128i sk_exp[15];
-	__m128i iv;
-} aes256ctx;
 
 #define BE_TO_UINT32(n) (uint32_t)((((uint8_t *) &(n))[0] << 24) | (((uint8_t *) &(n))[1] << 16) | (((uint8_t *) &(n))[2] << 8) | (((uint8_t *) &(n))[3] << 0))
 
@@ -166,14 +164,41 @@ static inline void aes256ni_encrypt_x4(const __m128i rkeys[15], __m128i n0, __m1
 	_mm_storeu_si128((__m128i *)(out + 48), temp3);
 }
 
+// 8x interleaved encryption, enough blocks in flight to cover the AESENC latency
+static inline void aes256ni_encrypt_x8(const __m128i rkeys[15], __m128i nv[8], unsigned char *out) {
+	int i, r;
+
+	for (i = 0; i < 8; i++) {
+		nv[i] = _mm_xor_si128(nv[i], rkeys[0]);
+	}
+	for (r = 1; r < 14; r++) {
+		for (i = 0; i < 8; i++) {
+			nv[i] = _mm_aesenc_si128(nv[i], rkeys[r]);
+		}
+	}
+	for (i = 0; i < 8; i++) {
+		nv[i] = _mm_aesenclast_si128(nv[i], rkeys[14]);
+		_mm_storeu_si128((__m128i *)(out + 16 * i), nv[i]);
+	}
+}
+
 void oqs_aes256_enc_sch_block_ni(const uint8_t *plaintext, const void *_schedule, uint8_t *ciphertext) {
 	const __m128i *schedule = ((const aes256ctx *) _schedule)->sk_exp;
 	aes256ni_encrypt(schedule, _mm_loadu_si128((const __m128i *)plaintext), ciphertext);
 }
 
 void oqs_aes256_ecb_enc_sch_ni(const uint8_t *plaintext, const size_t plaintext_len, const void *schedule, uint8_t *ciphertext) {
+	const __m128i *rkeys = ((const aes256ctx *) schedule)->sk_exp;
+	size_t block = 0;
 	assert(plaintext_len % 16 == 0);
-	for (size_t block = 0; block < plaintext_len / 16; block++) {
+	for (; block + 8 <= plaintext_len / 16; block += 8) {
+		__m128i nv[8];
+		for (int i = 0; i < 8; i++) {
+			nv[i] = _mm_loadu_si128((const __m128i *)(plaintext + 16 * (block + i)));
+		}
+		aes256ni_encrypt_x8(rkeys, nv, ciphertext + 16 * block);
+	}
+	for (; block < plaintext_len / 16; block++) {
 		oqs_aes256_enc_sch_block_ni(plaintext + (16 * block), schedule, ciphertext + (16 * block));
 	}
 }
@@ -182,7 +207,17 @@ void oqs_aes256_ctr_enc_sch_upd_blks_ni(void *schedule, uint8_t *out, size_t out
 	aes256ctx *ctx = (aes256ctx *) schedule;
 	const __m128i mask = _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 7, 6, 5, 4, 3, 2, 1, 0);
 
-	while (out_blks >= 4) {
+	while (out_blks >= 8) {
+		__m128i nv[8];
+		for (int i = 0; i < 8; i++) {
+			nv[i] = _mm_shuffle_epi8(_mm_add_epi64(ctx->iv, _mm_set_epi64x(i, 0)), mask);
+		}
+		aes256ni_encrypt_x8(ctx->sk_exp, nv, out);
+		ctx->iv = _mm_add_epi64(ctx->iv, _mm_set_epi64x(8, 0));
+		out += 128;
+		out_blks -= 8;
+	}
+	if (out_blks >= 4) {
 		__m128i nv0 = _mm_shuffle_epi8(ctx->iv, mask);
 		__m128i nv1 = _mm_shuffle_epi8(_mm_add_epi64(ctx->iv, _mm_set_epi64x(1, 0)), mask);
 		__m128i nv2 = _mm_shuffle_epi8(_mm_add_epi64(ctx->iv, _mm_set_epi64x(2, 0)), mask);
@@ -213,7 +248,18 @@ void oqs_aes256_ctr_enc_sch_ni(const uint8_t *iv, const size_t iv_len, const voi
 		exit(EXIT_FAILURE);
 	}
 
-	while (out_len >= 64) {
+	while (out_len >= 128) {
+		__m128i nv[8];
+		__m128i ctr = _mm_shuffle_epi8(block, mask);
+		for (int i = 0; i < 8; i++) {
+			nv[i] = _mm_shuffle_epi8(_mm_add_epi64(ctr, _mm_set_epi64x(i, 0)), mask);
+		}
+		aes256ni_encrypt_x8(((const aes256ctx *) schedule)->sk_exp, nv, out);
+		block = _mm_shuffle_epi8(_mm_add_epi64(ctr, _mm_set_epi64x(8, 0)), mask);
+		out += 128;
+		out_len -= 128;
+	}
+	if (out_len >= 64) {
 		__m128i nv0 = block;
 		__m128i nv1 = _mm_shuffle_epi8(_mm_add_epi64(_mm_shuffle_epi8(block, mask), _mm_set_epi64x(1, 0)), mask);
 		__m128i nv2 = _mm_shuffle_epi8(_mm_add_epi64(_mm_shuffle_epi8(block, mask), _mm_set_epi64x(2, 0)), mask);
@@ -38,6 +38,27 @@
     stmt_c
 #endif
 
+/* Bulk encryption additionally has a VAES path, for x86_64 CPUs with VAES and AVX2.
+ * It shares the AES-NI key schedule, so it also requires AES-NI. */
+#if defined(OQS_DIST_X86_64_BUILD)
+#define C_OR_NI_OR_VAES_OR_ARM(stmt_c, stmt_ni, stmt_vaes, stmt_arm) \
+   do { \
+      if (OQS_CPU_has_extension(OQS_CPU_EXT_VAES) && OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_AES)) { \
+          stmt_vaes; \
+      } else if (OQS_CPU_has_extension(OQS_CPU_EXT_AES)) { \
+          stmt_ni; \
+      } else { \
+          stmt_c; \
+      } \
+   } while(0)
+#elif defined(OQS_USE_AES_INSTRUCTIONS) && defined(OQS_USE_VAES_INSTRUCTIONS) && defined(OQS_USE_AVX2_INSTRUCTIONS)
+#define C_OR_NI_OR_VAES_OR_ARM(stmt_c, stmt_ni, stmt_vaes, stmt_arm) \
+    stmt_vaes
+#else
+#define C_OR_NI_OR_VAES_OR_ARM(stmt_c, stmt_ni, stmt_vaes, stmt_arm) \
+    C_OR_NI_OR_ARM(stmt_c, stmt_ni, stmt_arm)
+#endif
+
 static void AES128_ECB_load_schedule(const uint8_t *key, void **_schedule) {
 	C_OR_NI_OR_ARM(
 	    oqs_aes128_load_schedule_c(key, _schedule),
@@ -120,17 +141,19 @@ static void AES128_ECB_enc(const uint8_t *plaintext, const size_t plaintext_len,
 }
 
 static void AES128_ECB_enc_sch(const uint8_t *plaintext, const size_t plaintext_len, const void *schedule, uint8_t *ciphertext) {
-	C_OR_NI_OR_ARM(
+	C_OR_NI_OR_VAES_OR_ARM(
 	    oqs_aes128_ecb_enc_sch_c(plaintext, plaintext_len, schedule, ciphertext),
 	    oqs_aes128_ecb_enc_sch_ni(plaintext, plaintext_len, schedule, ciphertext),
+	    oqs_aes128_ecb_enc_sch_vaes(plaintext, plaintext_len, schedule, ciphertext),
 	    oqs_aes128_ecb_enc_sch_armv8(plaintext, plaintext_len, schedule, ciphertext)
 	);
 }
 
 static void AES128_CTR_inc_stream_iv(const uint8_t *iv, const size_t iv_len, const void *schedule, uint8_t *out, size_t out_len) {
-	C_OR_NI_OR_ARM(
+	C_OR_NI_OR_VAES_OR_ARM(
 	    oqs_aes128_ctr_enc_sch_c(iv, iv_len, schedule, out, out_len),
 	    oqs_aes128_ctr_enc_sch_ni(iv, iv_len, schedule, out, out_len),
+	    oqs_aes128_ctr_enc_sch_vaes(iv, iv_len, schedule, out, out_len),
 	    oqs_aes128_ctr_enc_sch_armv8(iv, iv_len, schedule, out, out_len)
 	);
 }
@@ -145,25 +168,28 @@ static void AES256_ECB_enc(const uint8_t *plaintext, const size_t plaintext_len,
 }
 
 static void AES256_ECB_enc_sch(const uint8_t *plaintext, const size_t plaintext_len, const void *schedule, uint8_t *ciphertext) {
-	C_OR_NI_OR_ARM(
+	C_OR_NI_OR_VAES_OR_ARM(
 	    oqs_aes256_ecb_enc_sch_c(plaintext, plaintext_len, schedule, ciphertext),
 	    oqs_aes256_ecb_enc_sch_ni(plaintext, plaintext_len, schedule, ciphertext),
+	    oqs_aes256_ecb_enc_sch_vaes(plaintext, plaintext_len, schedule, ciphertext),
 	    oqs_aes256_ecb_enc_sch_armv8(plaintext, plaintext_len, schedule, ciphertext)
 	);
 }
 
 static void AES256_CTR_inc_stream_iv(const uint8_t *iv, const size_t iv_len, const void *schedule, uint8_t *out, size_t out_len) {
-	C_OR_NI_OR_ARM(
+	C_OR_NI_OR_VAES_OR_ARM(
 	    oqs_aes256_ctr_enc_sch_c(iv, iv_len, schedule, out, out_len),
 	    oqs_aes256_ctr_enc_sch_ni(iv, iv_len, schedule, out, out_len),
+	    oqs_aes256_ctr_enc_sch_vaes(iv, iv_len, schedule, out, out_len),
 	    oqs_aes256_ctr_enc_sch_armv8(iv, iv_len, schedule, out, out_len)
 	);
 }
 
 static void AES256_CTR_inc_stream_blks(void *schedule, uint8_t *out, size_t out_blks) {
-	C_OR_NI_OR_ARM(
+	C_OR_NI_OR_VAES_OR_ARM(
 	    oqs_aes256_ctr_enc_sch_upd_blks_c(schedule, out, out_blks),
 	    oqs_aes256_ctr_enc_sch_upd_blks_ni(schedule, out, out_blks),
+	    oqs_aes256_ctr_enc_sch_upd_blks_vaes(schedule, out, out_blks),
 	    oqs_aes256_ctr_enc_sch_upd_blks_armv8(schedule, out, out_blks)
 	);
 }
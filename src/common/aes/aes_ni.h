@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef OQS_AES_NI_H
+#define OQS_AES_NI_H
+
+#include <emmintrin.h>
+
+/*
+ * Key schedules of the AES-NI code, also used by the VAES code. In CTR mode
+ * `iv` is kept with its last 8 bytes, the big-endian block counter,
+ * byte-swapped into the upper 64-bit lane so it can be incremented with
+ * _mm_add_epi64.
+ */
+typedef struct {
+	__m128i sk_exp[11];
+	__m128i iv;
+} aes128ctx;
+
+typedef struct {
+	__m128i sk_exp[15];
+	__m128i iv;
+} aes256ctx;
+
+#endif // OQS_AES_NI_H
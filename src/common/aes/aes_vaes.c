@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: MIT
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <oqs/common.h>
+
+#include <immintrin.h>
+
+#include "aes_ni.h"
+#include "aes_local.h"
+
+/*
+ * AES with the 256-bit VAES instructions: every register holds two blocks and
+ * up to VAES_REGS registers are encrypted interleaved. The key schedules are
+ * those of the AES-NI code (aes_ni.h).
+ */
+#define VAES_REGS 8
+#define VAES_BLOCKS (2 * VAES_REGS)
+
+/* encrypt the first n registers of b in place; rounds is 10 for AES-128, 14 for AES-256 */
+static inline void vaes_encrypt(const __m128i *rkeys, int rounds, __m256i b[VAES_REGS], int n) {
+	__m256i k = _mm256_broadcastsi128_si256(rkeys[0]);
+	int i, r;
+
+	for (i = 0; i < n; i++) {
+		b[i] = _mm256_xor_si256(b[i], k);
+	}
+	for (r = 1; r < rounds; r++) {
+		k = _mm256_broadcastsi128_si256(rkeys[r]);
+		for (i = 0; i < n; i++) {
+			b[i] = _mm256_aesenc_epi128(b[i], k);
+		}
+	}
+	k = _mm256_broadcastsi128_si256(rkeys[rounds]);
+	for (i = 0; i < n; i++) {
+		b[i] = _mm256_aesenclast_epi128(b[i], k);
+	}
+}
+
+static void vaes_ecb(const __m128i *rkeys, int rounds, const uint8_t *in, size_t blks, uint8_t *out) {
+	__m256i b[VAES_REGS];
+	int i, n;
+
+	for (; blks >= VAES_BLOCKS; blks -= VAES_BLOCKS) {
+		for (i = 0; i < VAES_REGS; i++) {
+			b[i] = _mm256_loadu_si256((const __m256i *)(in + 32 * i));
+		}
+		vaes_encrypt(rkeys, rounds, b, VAES_REGS);
+		for (i = 0; i < VAES_REGS; i++) {
+			_mm256_storeu_si256((__m256i *)(out + 32 * i), b[i]);
+		}
+		in += 16 * VAES_BLOCKS;
+		out += 16 * VAES_BLOCKS;
+	}
+	if (blks > 0) {
+		n = (int)(blks / 2);
+		for (i = 0; i < n; i++) {
+			b[i] = _mm256_loadu_si256((const __m256i *)(in + 32 * i));
+		}
+		if (blks % 2 == 1) {
+			b[n] = _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(in + 32 * n)));
+		}
+		vaes_encrypt(rkeys, rounds, b, n + (int)(blks % 2));
+		for (i = 0; i < n; i++) {
+			_mm256_storeu_si256((__m256i *)(out + 32 * i), b[i]);
+		}
+		if (blks % 2 == 1) {
+			_mm_storeu_si128((__m128i *)(out + 32 * n), _mm256_castsi256_si128(b[n]));
+		}
+	}
+}
+
+/* write out_len bytes of keystream starting at the counter block ctr (see aes_ni.h) and advance ctr past them */
+static void vaes_ctr(const __m128i *rkeys, int rounds, __m128i *ctr, uint8_t *out, size_t out_len) {
+	const __m256i mask = _mm256_broadcastsi128_si256(_mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 7, 6, 5, 4, 3, 2, 1, 0));
+	__m256i b[VAES_REGS];
+	__m256i base;
+	uint8_t tmp[16 * VAES_BLOCKS];
+	size_t blks;
+	int i, n;
+
+	for (; out_len >= 16 * VAES_BLOCKS; out_len -= 16 * VAES_BLOCKS) {
+		base = _mm256_broadcastsi128_si256(*ctr);
+		for (i = 0; i < VAES_REGS; i++) {
+			b[i] = _mm256_shuffle_epi8(_mm256_add_epi64(base, _mm256_set_epi64x(2 * i + 1, 0, 2 * i, 0)), mask);
+		}
+		vaes_encrypt(rkeys, rounds, b, VAES_REGS);
+		for (i = 0; i < VAES_REGS; i++) {
+			_mm256_storeu_si256((__m256i *)(out + 32 * i), b[i]);
+		}
+		*ctr = _mm_add_epi64(*ctr, _mm_set_epi64x(VAES_BLOCKS, 0));
+		out += 16 * VAES_BLOCKS;
+	}
+	if (out_len > 0) {
+		blks = (out_len + 15) / 16;
+		n = (int)((blks + 1) / 2);
+		base = _mm256_broadcastsi128_si256(*ctr);
+		for (i = 0; i < n; i++) {
+			b[i] = _mm256_shuffle_epi8(_mm256_add_epi64(base, _mm256_set_epi64x(2 * i + 1, 0, 2 * i, 0)), mask);
+		}
+		vaes_encrypt(rkeys, rounds, b, n);
+		for (i = 0; i < n; i++) {
+			_mm256_storeu_si256((__m256i *)(tmp + 32 * i), b[i]);
+		}
+		memcpy(out, tmp, out_len);
+		OQS_MEM_cleanse(tmp, sizeof(tmp));
+		*ctr = _mm_add_epi64(*ctr, _mm_set_epi64x((long long)blks, 0));
+	}
+}
+
+static __m128i vaes_load_ctr(const uint8_t *iv, size_t iv_len) {
+	uint8_t block[16] = {0};
+	if (iv_len == 12 || iv_len == 16) {
+		memcpy(block, iv, iv_len);
+	} else {
+		exit(EXIT_FAILURE);
+	}
+	return _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)block), _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 7, 6, 5, 4, 3, 2, 1, 0));
+}
+
+void oqs_aes128_ecb_enc_sch_vaes(const uint8_t *plaintext, const size_t plaintext_len, const void *schedule, uint8_t *ciphertext) {
+	assert(plaintext_len % 16 == 0);
+	vaes_ecb(((const aes128ctx *) schedule)->sk_exp, 10, plaintext, plaintext_len / 16, ciphertext);
+}
+
+void oqs_aes128_ctr_enc_sch_vaes(const uint8_t *iv, const size_t iv_len, const void *schedule, uint8_t *out, size_t out_len) {
+	__m128i ctr = vaes_load_ctr(iv, iv_len);
+	vaes_ctr(((const aes128ctx *) schedule)->sk_exp, 10, &ctr, out, out_len);
+}
+
+void oqs_aes128_ctr_enc_sch_upd_blks_vaes(void *schedule, uint8_t *out, size_t out_blks) {
+	aes128ctx *ctx = (aes128ctx *) schedule;
+	vaes_ctr(ctx->sk_exp, 10, &ctx->iv, out, 16 * out_blks);
+}
+
+void oqs_aes256_ecb_enc_sch_vaes(const uint8_t *plaintext, const size_t plaintext_len, const void *schedule, uint8_t *ciphertext) {
+	assert(plaintext_len % 16 == 0);
+	vaes_ecb(((const aes256ctx *) schedule)->sk_exp, 14, plaintext, plaintext_len / 16, ciphertext);
+}
+
+void oqs_aes256_ctr_enc_sch_vaes(const uint8_t *iv, const size_t iv_len, const void *schedule, uint8_t *out, size_t out_len) {
+	__m128i ctr = vaes_load_ctr(iv, iv_len);
+	vaes_ctr(((const aes256ctx *) schedule)->sk_exp, 14, &ctr, out, out_len);
+}
+
+void oqs_aes256_ctr_enc_sch_upd_blks_vaes(void *schedule, uint8_t *out, size_t out_blks) {
+	aes256ctx *ctx = (aes256ctx *) schedule;
+	vaes_ctr(ctx->sk_exp, 14, &ctx->iv, out, 16 * out_blks);
+}
@@ -65,6 +65,8 @@ static void set_available_cpu_extensions(void) {
 	if (has_mask(xcr0_eax, MASK_XMM | MASK_YMM)) {
 		cpu_ext_data[OQS_CPU_EXT_AVX] = is_bit_set(leaf_1.ecx, 28);
 		cpu_ext_data[OQS_CPU_EXT_AVX2] = is_bit_set(leaf_7.ebx, 5);
+		/* the VAES code uses the 256-bit forms only */
+		cpu_ext_data[OQS_CPU_EXT_VAES] = is_bit_set(leaf_7.ecx, 9);
 	}
 	cpu_ext_data[OQS_CPU_EXT_PCLMULQDQ] = is_bit_set(leaf_1.ecx, 1);
 	cpu_ext_data[OQS_CPU_EXT_POPCNT] = is_bit_set(leaf_1.ecx, 23);
@@ -76,6 +78,10 @@ static void set_available_cpu_extensions(void) {
 		cpu_ext_data[OQS_CPU_EXT_SSE] = is_bit_set(leaf_1.edx, 25);
 		cpu_ext_data[OQS_CPU_EXT_SSE2] = is_bit_set(leaf_1.edx, 26);
 		cpu_ext_data[OQS_CPU_EXT_SSE3] = is_bit_set(leaf_1.ecx, 0);
+		/* the SHA-NI code also needs SSSE3 and SSE4.1 for its shuffles and blends */
+		cpu_ext_data[OQS_CPU_EXT_SHA_NI] = is_bit_set(leaf_7.ebx, 29) &&
+		                                   is_bit_set(leaf_1.ecx, 9) &&
+		                                   is_bit_set(leaf_1.ecx, 19);
 	}
 
 	if (has_mask(xcr0_eax, MASK_XMM | MASK_YMM | MASK_MASKREG | MASK_ZMM0_15 | MASK_ZMM16_31)) {
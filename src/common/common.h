@@ -196,6 +196,8 @@ typedef enum {
 	OQS_CPU_EXT_ARM_SHA2,
 	OQS_CPU_EXT_ARM_SHA3,
 	OQS_CPU_EXT_ARM_NEON,
+	OQS_CPU_EXT_SHA_NI,
+	OQS_CPU_EXT_VAES,
 	/* End extension list */
 	OQS_CPU_EXT_COUNT, /* Must be last */
 } OQS_CPU_EXT;
@@ -287,6 +289,115 @@ void *OQS_MEM_aligned_alloc(size_t alignment, size_t size);
  */
 void OQS_MEM_aligned_free(void *ptr);
 
+/**
+ * A task submitted to an OQS_THREADPOOL: it is called once for each `index`
+ * in [0, count), with the `arg` passed to OQS_THREADPOOL_run.
+ */
+typedef void (*OQS_THREADPOOL_task)(void *arg, size_t index);
+
+/**
+ * An application-provided executor backing an OQS_THREADPOOL.
+ *
+ * It must call `task(arg, i)` exactly once for every `i` in [0, count), on
+ * whichever threads it likes (the calling one included), and only return once
+ * all of these calls have returned. Tasks only compute; they never block on
+ * each other, so running them one after the other is always valid.
+ *
+ * @param[in] context The context passed to OQS_THREADPOOL_new_custom.
+ * @param[in] task The task to run.
+ * @param[in] arg The argument to pass to every call of `task`.
+ * @param[in] count The number of calls to make.
+ */
+typedef void (*OQS_THREADPOOL_executor)(void *context, OQS_THREADPOOL_task task, void *arg, size_t count);
+
+/**
+ * A set of threads that algorithms with independent subcomputations (such as
+ * SPHINCS+ signing) submit work to.
+ *
+ * The pool is either backed by the application's own executor (see
+ * OQS_THREADPOOL_new_custom), which keeps the work on the application's
+ * threads and lets it bound the total CPU use of liboqs, or by worker threads
+ * owned by liboqs (see OQS_THREADPOOL_new).
+ */
+typedef struct OQS_THREADPOOL OQS_THREADPOOL;
+
+/**
+ * Creates a thread pool backed by `num_threads - 1` worker threads owned by
+ * liboqs; the thread calling OQS_THREADPOOL_run also works on the tasks.
+ *
+ * If threads are not available (liboqs was built without pthreads, or fewer
+ * threads could be started), the pool uses as many as it has; a pool without
+ * workers runs all tasks in the calling thread.
+ *
+ * @param[in] num_threads The number of threads to use, the calling one included.
+ * @return The new pool, or NULL if memory could not be allocated.
+ */
+OQS_API OQS_THREADPOOL *OQS_THREADPOOL_new(size_t num_threads);
+
+/**
+ * Creates a thread pool that hands all work to an application-provided executor.
+ *
+ * @param[in] executor The executor that runs the tasks.
+ * @param[in] context The context passed to every call of `executor`.
+ * @param[in] concurrency The number of tasks `executor` can run at the same time;
+ *            algorithms may use it to decide whether splitting their work pays off.
+ * @return The new pool, or NULL if memory could not be allocated.
+ */
+OQS_API OQS_THREADPOOL *OQS_THREADPOOL_new_custom(OQS_THREADPOOL_executor executor, void *context, size_t concurrency);
+
+/**
+ * Stops the worker threads of a pool and frees it. The pool must not be in use,
+ * nor be the default pool.
+ *
+ * Can be called with `pool = NULL`, in which case no operation is performed.
+ *
+ * @param[in] pool The pool to free.
+ */
+OQS_API void OQS_THREADPOOL_free(OQS_THREADPOOL *pool);
+
+/**
+ * Returns the number of tasks `pool` can run at the same time, or 1 if `pool` is NULL.
+ *
+ * @param[in] pool The pool.
+ * @return The concurrency of the pool.
+ */
+OQS_API size_t OQS_THREADPOOL_concurrency(const OQS_THREADPOOL *pool);
+
+/**
+ * Calls `task(arg, i)` for every `i` in [0, count) on the threads of `pool`, and
+ * returns once all of these calls have returned.
+ *
+ * If `pool` is NULL the tasks run in the calling thread. A pool created with
+ * OQS_THREADPOOL_new runs one batch at a time: a call made while the pool is busy,
+ * for instance from another thread or from within a task, runs its tasks in the
+ * calling thread instead of waiting.
+ *
+ * @param[in] pool The pool to run the tasks on, or NULL.
+ * @param[in] task The task to run.
+ * @param[in] arg The argument to pass to every call of `task`.
+ * @param[in] count The number of calls to make.
+ */
+OQS_API void OQS_THREADPOOL_run(OQS_THREADPOOL *pool, OQS_THREADPOOL_task task, void *arg, size_t count);
+
+/**
+ * Sets the pool used by algorithms when the caller does not pass one, or clears
+ * it if `pool` is NULL. The pool remains owned by the caller, which must keep it
+ * alive until it is no longer the default.
+ *
+ * This is not thread-safe and should be called during application start-up,
+ * before other threads use liboqs.
+ *
+ * @param[in] pool The new default pool, or NULL.
+ */
+OQS_API void OQS_THREADPOOL_set_default(OQS_THREADPOOL *pool);
+
+/**
+ * Returns the pool set with OQS_THREADPOOL_set_default, or NULL if there is none.
+ *
+ * @return The default pool.
+ */
+OQS_API OQS_THREADPOOL *OQS_THREADPOOL_get_default(void);
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
@@ -35,23 +35,33 @@
 #define sha3_512_inc_ctx_clone OQS_SHA3_sha3_512_inc_ctx_clone
 #define sha3_512_inc_ctx_release OQS_SHA3_sha3_512_inc_ctx_release
 
-#define shake128incctx OQS_SHA3_shake128_inc_ctx
-#define shake128_inc_init OQS_SHA3_shake128_inc_init
-#define shake128_inc_absorb OQS_SHA3_shake128_inc_absorb
-#define shake128_inc_finalize OQS_SHA3_shake128_inc_finalize
-#define shake128_inc_squeeze OQS_SHA3_shake128_inc_squeeze
-#define shake128_inc_ctx_release OQS_SHA3_shake128_inc_ctx_release
-#define shake128_inc_ctx_clone OQS_SHA3_shake128_inc_ctx_clone
-#define shake128_inc_ctx_reset OQS_SHA3_shake128_inc_ctx_reset
-
-#define shake256incctx OQS_SHA3_shake256_inc_ctx
-#define shake256_inc_init OQS_SHA3_shake256_inc_init
-#define shake256_inc_absorb OQS_SHA3_shake256_inc_absorb
-#define shake256_inc_finalize OQS_SHA3_shake256_inc_finalize
-#define shake256_inc_squeeze OQS_SHA3_shake256_inc_squeeze
-#define shake256_inc_ctx_release OQS_SHA3_shake256_inc_ctx_release
-#define shake256_inc_ctx_clone OQS_SHA3_shake256_inc_ctx_clone
-#define shake256_inc_ctx_reset OQS_SHA3_shake256_inc_ctx_reset
+/* The incremental contexts carry their own storage so that the Keccak
+ * state lives wherever the caller declares the context (usually the stack). */
+typedef struct {
+	OQS_SHA3_shake128_inc_ctx ctx;
+	OQS_SHA3_inc_storage storage;
+} shake128incctx;
+
+#define shake128_inc_init(STATE) OQS_SHA3_shake128_inc_init_inplace(&(STATE)->ctx, &(STATE)->storage)
+#define shake128_inc_absorb(STATE, IN, INLEN) OQS_SHA3_shake128_inc_absorb(&(STATE)->ctx, IN, INLEN)
+#define shake128_inc_finalize(STATE) OQS_SHA3_shake128_inc_finalize(&(STATE)->ctx)
+#define shake128_inc_squeeze(OUT, OUTLEN, STATE) OQS_SHA3_shake128_inc_squeeze(OUT, OUTLEN, &(STATE)->ctx)
+#define shake128_inc_ctx_release(STATE) OQS_SHA3_shake128_inc_ctx_release(&(STATE)->ctx)
+#define shake128_inc_ctx_clone(DEST, SRC) OQS_SHA3_shake128_inc_ctx_clone(&(DEST)->ctx, &(SRC)->ctx)
+#define shake128_inc_ctx_reset(STATE) OQS_SHA3_shake128_inc_ctx_reset(&(STATE)->ctx)
+
+typedef struct {
+	OQS_SHA3_shake256_inc_ctx ctx;
+	OQS_SHA3_inc_storage storage;
+} shake256incctx;
+
+#define shake256_inc_init(STATE) OQS_SHA3_shake256_inc_init_inplace(&(STATE)->ctx, &(STATE)->storage)
+#define shake256_inc_absorb(STATE, IN, INLEN) OQS_SHA3_shake256_inc_absorb(&(STATE)->ctx, IN, INLEN)
+#define shake256_inc_finalize(STATE) OQS_SHA3_shake256_inc_finalize(&(STATE)->ctx)
+#define shake256_inc_squeeze(OUT, OUTLEN, STATE) OQS_SHA3_shake256_inc_squeeze(OUT, OUTLEN, &(STATE)->ctx)
+#define shake256_inc_ctx_release(STATE) OQS_SHA3_shake256_inc_ctx_release(&(STATE)->ctx)
+#define shake256_inc_ctx_clone(DEST, SRC) OQS_SHA3_shake256_inc_ctx_clone(&(DEST)->ctx, &(SRC)->ctx)
+#define shake256_inc_ctx_reset(STATE) OQS_SHA3_shake256_inc_ctx_reset(&(STATE)->ctx)
 
 #define shake128_absorb_once OQS_SHA3_shake128_absorb_once
 void OQS_SHA3_shake128_absorb_once(shake128incctx *state, const uint8_t *in, size_t inlen);
@@ -60,9 +70,9 @@ void OQS_SHA3_shake128_absorb_once(shake128incctx *state, const uint8_t *in, siz
 void OQS_SHA3_shake256_absorb_once(shake256incctx *state, const uint8_t *in, size_t inlen);
 
 #define shake128_squeezeblocks(OUT, NBLOCKS, STATE) \
-        OQS_SHA3_shake128_inc_squeeze(OUT, (NBLOCKS)*OQS_SHA3_SHAKE128_RATE, STATE)
+        shake128_inc_squeeze(OUT, (NBLOCKS)*OQS_SHA3_SHAKE128_RATE, STATE)
 
 #define shake256_squeezeblocks(OUT, NBLOCKS, STATE) \
-        OQS_SHA3_shake256_inc_squeeze(OUT, (NBLOCKS)*OQS_SHA3_SHAKE256_RATE, STATE)
+        shake256_inc_squeeze(OUT, (NBLOCKS)*OQS_SHA3_SHAKE256_RATE, STATE)
 
 #endif
@@ -15,23 +15,32 @@
 #define KeccakP1600times4_PermuteAll_24rounds KeccakP1600times4_PermuteAll_24rounds_avx2
 #endif
 
-#define shake128x4incctx OQS_SHA3_shake128_x4_inc_ctx
-#define shake128x4_inc_init OQS_SHA3_shake128_x4_inc_init
-#define shake128x4_inc_absorb OQS_SHA3_shake128_x4_inc_absorb
-#define shake128x4_inc_finalize OQS_SHA3_shake128_x4_inc_finalize
-#define shake128x4_inc_squeeze OQS_SHA3_shake128_x4_inc_squeeze
-#define shake128x4_inc_ctx_release OQS_SHA3_shake128_x4_inc_ctx_release
-#define shake128x4_inc_ctx_clone OQS_SHA3_shake128_x4_inc_ctx_clone
-#define shake128x4_inc_ctx_reset OQS_SHA3_shake128_x4_inc_ctx_reset
-
-#define shake256x4incctx OQS_SHA3_shake256_x4_inc_ctx
-#define shake256x4_inc_init OQS_SHA3_shake256_x4_inc_init
-#define shake256x4_inc_absorb OQS_SHA3_shake256_x4_inc_absorb
-#define shake256x4_inc_finalize OQS_SHA3_shake256_x4_inc_finalize
-#define shake256x4_inc_squeeze OQS_SHA3_shake256_x4_inc_squeeze
-#define shake256x4_inc_ctx_release OQS_SHA3_shake256_x4_inc_ctx_release
-#define shake256x4_inc_ctx_clone OQS_SHA3_shake256_x4_inc_ctx_clone
-#define shake256x4_inc_ctx_reset OQS_SHA3_shake256_x4_inc_ctx_reset
+/* As in fips202.h, the contexts carry their own storage for the Keccak state. */
+typedef struct {
+	OQS_SHA3_shake128_x4_inc_ctx ctx;
+	OQS_SHA3_x4_inc_storage storage;
+} shake128x4incctx;
+
+#define shake128x4_inc_init(STATE) OQS_SHA3_shake128_x4_inc_init_inplace(&(STATE)->ctx, &(STATE)->storage)
+#define shake128x4_inc_absorb(STATE, IN0, IN1, IN2, IN3, INLEN) OQS_SHA3_shake128_x4_inc_absorb(&(STATE)->ctx, IN0, IN1, IN2, IN3, INLEN)
+#define shake128x4_inc_finalize(STATE) OQS_SHA3_shake128_x4_inc_finalize(&(STATE)->ctx)
+#define shake128x4_inc_squeeze(OUT0, OUT1, OUT2, OUT3, OUTLEN, STATE) OQS_SHA3_shake128_x4_inc_squeeze(OUT0, OUT1, OUT2, OUT3, OUTLEN, &(STATE)->ctx)
+#define shake128x4_inc_ctx_release(STATE) OQS_SHA3_shake128_x4_inc_ctx_release(&(STATE)->ctx)
+#define shake128x4_inc_ctx_clone(DEST, SRC) OQS_SHA3_shake128_x4_inc_ctx_clone(&(DEST)->ctx, &(SRC)->ctx)
+#define shake128x4_inc_ctx_reset(STATE) OQS_SHA3_shake128_x4_inc_ctx_reset(&(STATE)->ctx)
+
+typedef struct {
+	OQS_SHA3_shake256_x4_inc_ctx ctx;
+	OQS_SHA3_x4_inc_storage storage;
+} shake256x4incctx;
+
+#define shake256x4_inc_init(STATE) OQS_SHA3_shake256_x4_inc_init_inplace(&(STATE)->ctx, &(STATE)->storage)
+#define shake256x4_inc_absorb(STATE, IN0, IN1, IN2, IN3, INLEN) OQS_SHA3_shake256_x4_inc_absorb(&(STATE)->ctx, IN0, IN1, IN2, IN3, INLEN)
+#define shake256x4_inc_finalize(STATE) OQS_SHA3_shake256_x4_inc_finalize(&(STATE)->ctx)
+#define shake256x4_inc_squeeze(OUT0, OUT1, OUT2, OUT3, OUTLEN, STATE) OQS_SHA3_shake256_x4_inc_squeeze(OUT0, OUT1, OUT2, OUT3, OUTLEN, &(STATE)->ctx)
+#define shake256x4_inc_ctx_release(STATE) OQS_SHA3_shake256_x4_inc_ctx_release(&(STATE)->ctx)
+#define shake256x4_inc_ctx_clone(DEST, SRC) OQS_SHA3_shake256_x4_inc_ctx_clone(&(DEST)->ctx, &(SRC)->ctx)
+#define shake256x4_inc_ctx_reset(STATE) OQS_SHA3_shake256_x4_inc_ctx_reset(&(STATE)->ctx)
 
 #define shake256x4 OQS_SHA3_shake256_x4
 #define shake128x4 OQS_SHA3_shake128_x4
@@ -43,9 +52,9 @@ void OQS_SHA3_shake128_x4_absorb_once(shake128x4incctx *state, const uint8_t *in
 void OQS_SHA3_shake256_x4_absorb_once(shake256x4incctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen);
 
 #define shake128x4_squeezeblocks(OUT0, OUT1, OUT2, OUT3, NBLOCKS, STATE) \
-        OQS_SHA3_shake128_x4_inc_squeeze(OUT0, OUT1, OUT2, OUT3, (NBLOCKS)*OQS_SHA3_SHAKE128_RATE, STATE)
+        shake128x4_inc_squeeze(OUT0, OUT1, OUT2, OUT3, (NBLOCKS)*OQS_SHA3_SHAKE128_RATE, STATE)
 
 #define shake256x4_squeezeblocks(OUT0, OUT1, OUT2, OUT3, NBLOCKS, STATE) \
-        OQS_SHA3_shake256_x4_inc_squeeze(OUT0, OUT1, OUT2, OUT3, (NBLOCKS)*OQS_SHA3_SHAKE256_RATE, STATE)
+        shake256x4_inc_squeeze(OUT0, OUT1, OUT2, OUT3, (NBLOCKS)*OQS_SHA3_SHAKE256_RATE, STATE)
 
 #endif
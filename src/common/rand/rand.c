@@ -18,6 +18,7 @@
 #include <oqs/oqs.h>
 
 void OQS_randombytes_system(uint8_t *random_array, size_t bytes_to_read);
+void OQS_randombytes_buffered(uint8_t *random_array, size_t bytes_to_read);
 #ifdef OQS_USE_OPENSSL
 void OQS_randombytes_openssl(uint8_t *random_array, size_t bytes_to_read);
 #endif
@@ -33,6 +34,9 @@ OQS_API OQS_STATUS OQS_randombytes_switch_algorithm(const char *algorithm) {
 	if (0 == strcasecmp(OQS_RAND_alg_system, algorithm)) {
 		oqs_randombytes_algorithm = &OQS_randombytes_system;
 		return OQS_SUCCESS;
+	} else if (0 == strcasecmp(OQS_RAND_alg_buffered, algorithm)) {
+		oqs_randombytes_algorithm = &OQS_randombytes_buffered;
+		return OQS_SUCCESS;
 	} else if (0 == strcasecmp(OQS_RAND_alg_openssl, algorithm)) {
 #ifdef OQS_USE_OPENSSL
 		oqs_randombytes_algorithm = &OQS_randombytes_openssl;
@@ -22,6 +22,14 @@ extern "C" {
 #define OQS_RAND_alg_system "system"
 /** Algorithm identifier for using OpenSSL's PRNG. */
 #define OQS_RAND_alg_openssl "OpenSSL"
+/**
+ * Algorithm identifier for a per-thread AES-256-CTR generator seeded from the
+ * system PRNG. It only calls the system PRNG to reseed, which it does every
+ * megabyte of output and after fork(), so most calls make no system call.
+ * Every key is erased as soon as the next one has been derived, and each
+ * output byte is wiped from the buffer once it has been returned.
+ */
+#define OQS_RAND_alg_buffered "buffered"
 
 /**
  * Switches OQS_randombytes to use the specified algorithm.
@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: MIT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <oqs/common.h>
+
+#include "../aes/aes.h"
+
+#if defined(OQS_USE_PTHREADS)
+#include <pthread.h>
+#elif !defined(_WIN32)
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#if defined(_MSC_VER)
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL _Thread_local
+#endif
+
+void OQS_randombytes_system(uint8_t *random_array, size_t bytes_to_read);
+void OQS_randombytes_buffered(uint8_t *random_array, size_t bytes_to_read);
+
+/*
+ * Every thread has its own AES-256-CTR generator, seeded from
+ * OQS_randombytes_system. A refill encrypts a zero counter block sequence under
+ * the current key; the first KEY_BYTES of the keystream replace the key and the
+ * rest is handed out, and wiped, as random bytes, so the state of a thread never
+ * reveals bytes it has returned before. The key is reseeded every
+ * RESEED_INTERVAL refills and in the child after a fork.
+ */
+#define KEY_BYTES 32
+#define BUFFER_BYTES 4096
+#define RESEED_INTERVAL 256
+
+typedef struct {
+	uint8_t key[KEY_BYTES];
+	/* the last `available` bytes have not been handed out yet */
+	uint8_t buffer[KEY_BYTES + BUFFER_BYTES];
+	size_t available;
+	/* refills left until the next reseed; 0 before the first one */
+	unsigned int refills_left;
+#if defined(OQS_USE_PTHREADS)
+	unsigned long fork_generation;
+#elif !defined(_WIN32)
+	pid_t pid;
+#endif
+} buffered_state;
+
+static THREAD_LOCAL buffered_state *thread_state = NULL;
+
+#if defined(OQS_USE_PTHREADS)
+
+static pthread_once_t init_once = PTHREAD_ONCE_INIT;
+/* Frees the state of a thread when it exits */
+static pthread_key_t state_key;
+/* Incremented in the child on every fork */
+static volatile unsigned long fork_generation = 0;
+
+static void free_state(void *state) {
+	OQS_MEM_secure_free(state, sizeof(buffered_state));
+	thread_state = NULL;
+}
+
+static void after_fork_in_child(void) {
+	fork_generation++;
+}
+
+static void init_once_fn(void) {
+	if (pthread_key_create(&state_key, free_state) != 0 || pthread_atfork(NULL, NULL, after_fork_in_child) != 0) {
+		fprintf(stderr, "OQS_randombytes_buffered: cannot set up thread-local state\n");
+		exit(EXIT_FAILURE);
+	}
+}
+
+#endif
+
+static buffered_state *get_state(void) {
+	buffered_state *state = thread_state;
+	if (state != NULL) {
+		return state;
+	}
+#if defined(OQS_USE_PTHREADS)
+	pthread_once(&init_once, init_once_fn);
+#endif
+	state = OQS_MEM_calloc(1, sizeof(buffered_state));
+	if (state == NULL) {
+		exit(EXIT_FAILURE); // better to fail than to return bad random data
+	}
+#if defined(OQS_USE_PTHREADS)
+	if (pthread_setspecific(state_key, state) != 0) {
+		exit(EXIT_FAILURE);
+	}
+#endif
+	thread_state = state;
+	return state;
+}
+
+/* Has this process been forked since the state was last seeded? */
+static int forked(const buffered_state *state) {
+#if defined(OQS_USE_PTHREADS)
+	return state->fork_generation != fork_generation;
+#elif !defined(_WIN32)
+	return state->pid != getpid();
+#else
+	(void)state;
+	return 0;
+#endif
+}
+
+static void reseed(buffered_state *state) {
+	uint8_t seed[KEY_BYTES];
+	OQS_randombytes_system(seed, KEY_BYTES);
+	for (size_t i = 0; i < KEY_BYTES; i++) {
+		state->key[i] ^= seed[i];
+	}
+	OQS_MEM_cleanse(seed, KEY_BYTES);
+	state->refills_left = RESEED_INTERVAL;
+#if defined(OQS_USE_PTHREADS)
+	state->fork_generation = fork_generation;
+#elif !defined(_WIN32)
+	state->pid = getpid();
+#endif
+}
+
+static void refill(buffered_state *state) {
+	static const uint8_t iv[16] = {0};
+	void *schedule = NULL;
+
+	if (state->refills_left == 0) {
+		reseed(state);
+	}
+	OQS_AES256_CTR_inc_init(state->key, &schedule);
+	OQS_AES256_CTR_inc_stream_iv(iv, sizeof(iv), schedule, state->buffer, sizeof(state->buffer));
+	OQS_AES256_free_schedule(schedule);
+	memcpy(state->key, state->buffer, KEY_BYTES);
+	OQS_MEM_cleanse(state->buffer, KEY_BYTES);
+	state->available = BUFFER_BYTES;
+	state->refills_left--;
+}
+
+void OQS_randombytes_buffered(uint8_t *random_array, size_t bytes_to_read) {
+	buffered_state *state = get_state();
+	uint8_t *next;
+	size_t n;
+
+	if (forked(state)) {
+		/* the parent may hand out the same bytes: drop them and the key */
+		OQS_MEM_cleanse(state, sizeof(buffered_state));
+	}
+	while (bytes_to_read > 0) {
+		if (state->available == 0) {
+			refill(state);
+		}
+		n = bytes_to_read < state->available ? bytes_to_read : state->available;
+		next = state->buffer + sizeof(state->buffer) - state->available;
+		memcpy(random_array, next, n);
+		OQS_MEM_cleanse(next, n);
+		state->available -= n;
+		random_array += n;
+		bytes_to_read -= n;
+	}
+}
@@ -35,6 +35,58 @@ extern "C" {
  */
 void OQS_SHA2_sha256(uint8_t *output, const uint8_t *input, size_t inplen);
 
+/**
+ * \brief Hash four equal-length messages with SHA-256 in parallel.
+ *
+ * Produces the same output as four calls to OQS_SHA2_sha256, but lets the
+ * implementation process the messages in SIMD lanes.
+ *
+ * \warning Each output array must be at least 32 bytes in length.
+ *
+ * \param out0 The first output byte array
+ * \param out1 The second output byte array
+ * \param out2 The third output byte array
+ * \param out3 The fourth output byte array
+ * \param in0 The first message input byte array
+ * \param in1 The second message input byte array
+ * \param in2 The third message input byte array
+ * \param in3 The fourth message input byte array
+ * \param inlen The number of bytes of each message to process
+ */
+void OQS_SHA2_sha256_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                        const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen);
+
+/**
+ * \brief Hash eight equal-length messages with SHA-256 in parallel.
+ *
+ * Produces the same output as eight calls to OQS_SHA2_sha256, but lets the
+ * implementation process the messages in SIMD lanes.
+ *
+ * \warning Each output array must be at least 32 bytes in length.
+ *
+ * \param out0 The first output byte array
+ * \param out1 The second output byte array
+ * \param out2 The third output byte array
+ * \param out3 The fourth output byte array
+ * \param out4 The fifth output byte array
+ * \param out5 The sixth output byte array
+ * \param out6 The seventh output byte array
+ * \param out7 The eighth output byte array
+ * \param in0 The first message input byte array
+ * \param in1 The second message input byte array
+ * \param in2 The third message input byte array
+ * \param in3 The fourth message input byte array
+ * \param in4 The fifth message input byte array
+ * \param in5 The sixth message input byte array
+ * \param in6 The seventh message input byte array
+ * \param in7 The eighth message input byte array
+ * \param inlen The number of bytes of each message to process
+ */
+void OQS_SHA2_sha256_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                        uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7,
+                        const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                        const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen);
+
 /**
  * \brief Allocate and initialize the state for the SHA-256 incremental hashing API.
  *
@@ -6,8 +6,17 @@
 #include "sha2.h"
 #include "sha2_local.h"
 
-#if defined(OQS_DIST_ARM64_V8_BUILD)
-#define C_OR_ARM(stmt_c, stmt_arm) \
+#if defined(OQS_DIST_X86_64_BUILD)
+#define C_OR_NI_OR_ARM(stmt_c, stmt_ni, stmt_arm) \
+    do { \
+        if (OQS_CPU_has_extension(OQS_CPU_EXT_SHA_NI)) {  \
+            stmt_ni; \
+        } else { \
+            stmt_c; \
+        } \
+    } while(0)
+#elif defined(OQS_DIST_ARM64_V8_BUILD)
+#define C_OR_NI_OR_ARM(stmt_c, stmt_ni, stmt_arm) \
     do { \
         if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_SHA2)) {  \
             stmt_arm; \
@@ -15,11 +24,33 @@
             stmt_c; \
         } \
     } while(0)
+#elif defined(OQS_USE_SHA_NI_INSTRUCTIONS)
+#define C_OR_NI_OR_ARM(stmt_c, stmt_ni, stmt_arm) \
+    stmt_ni
 #elif defined(OQS_USE_ARM_SHA2_INSTRUCTIONS)
-#define C_OR_ARM(stmt_c, stmt_arm) \
+#define C_OR_NI_OR_ARM(stmt_c, stmt_ni, stmt_arm) \
     stmt_arm
 #else
-#define C_OR_ARM(stmt_c, stmt_arm) \
+#define C_OR_NI_OR_ARM(stmt_c, stmt_ni, stmt_arm) \
+    stmt_c
+#endif
+
+/* A single SHA-NI stream outruns the AVX2 lanes, so the multi-lane
+ * functions only use AVX2 on CPUs without SHA-NI. */
+#if defined(OQS_DIST_X86_64_BUILD)
+#define C_OR_AVX2(stmt_c, stmt_avx2) \
+    do { \
+        if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && !OQS_CPU_has_extension(OQS_CPU_EXT_SHA_NI)) {  \
+            stmt_avx2; \
+        } else { \
+            stmt_c; \
+        } \
+    } while(0)
+#elif defined(OQS_USE_AVX2_INSTRUCTIONS) && !defined(OQS_USE_SHA_NI_INSTRUCTIONS)
+#define C_OR_AVX2(stmt_c, stmt_avx2) \
+    stmt_avx2
+#else
+#define C_OR_AVX2(stmt_c, stmt_avx2) \
     stmt_c
 #endif
 
@@ -32,21 +63,27 @@ static void SHA2_sha256_inc_ctx_clone(OQS_SHA2_sha256_ctx *dest, const OQS_SHA2_
 }
 
 static void SHA2_sha256_inc(OQS_SHA2_sha256_ctx *state, const uint8_t *in, size_t len) {
-	C_OR_ARM(
+	C_OR_NI_OR_ARM(
 	    oqs_sha2_sha256_inc_c((sha256ctx *) state, in, len),
+	    oqs_sha2_sha256_inc_shani((sha256ctx *) state, in, len),
 	    oqs_sha2_sha256_inc_armv8((sha256ctx *) state, in, len)
 	);
 }
 
 static void SHA2_sha256_inc_blocks(OQS_SHA2_sha256_ctx *state, const uint8_t *in, size_t inblocks) {
-	C_OR_ARM(
+	C_OR_NI_OR_ARM(
 	    oqs_sha2_sha256_inc_blocks_c((sha256ctx *) state, in, inblocks),
+	    oqs_sha2_sha256_inc_blocks_shani((sha256ctx *) state, in, inblocks),
 	    oqs_sha2_sha256_inc_blocks_armv8((sha256ctx *) state, in, inblocks)
 	);
 }
 
 static void SHA2_sha256_inc_finalize(uint8_t *out, OQS_SHA2_sha256_ctx *state, const uint8_t *in, size_t inlen) {
-	oqs_sha2_sha256_inc_finalize_c(out, (sha256ctx *) state, in, inlen);
+	C_OR_NI_OR_ARM(
+	    oqs_sha2_sha256_inc_finalize_c(out, (sha256ctx *) state, in, inlen),
+	    oqs_sha2_sha256_inc_finalize_shani(out, (sha256ctx *) state, in, inlen),
+	    oqs_sha2_sha256_inc_finalize_c(out, (sha256ctx *) state, in, inlen)
+	);
 }
 
 static void SHA2_sha256_inc_ctx_release(OQS_SHA2_sha256_ctx *state) {
@@ -94,12 +131,36 @@ static void SHA2_sha512_inc_ctx_release(OQS_SHA2_sha512_ctx *state) {
 }
 
 static void SHA2_sha256(uint8_t *out, const uint8_t *in, size_t inlen) {
-	C_OR_ARM (
+	C_OR_NI_OR_ARM (
 	    oqs_sha2_sha256_c(out, in, inlen),
+	    oqs_sha2_sha256_shani(out, in, inlen),
 	    oqs_sha2_sha256_armv8(out, in, inlen)
 	);
 }
 
+static void SHA2_sha256_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                           const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
+	C_OR_AVX2 (
+	    SHA2_sha256(out0, in0, inlen);
+	    SHA2_sha256(out1, in1, inlen);
+	    SHA2_sha256(out2, in2, inlen);
+	    SHA2_sha256(out3, in3, inlen),
+	    oqs_sha2_sha256_x4_avx2(out0, out1, out2, out3, in0, in1, in2, in3, inlen)
+	);
+}
+
+static void SHA2_sha256_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                           uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7,
+                           const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                           const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen) {
+	C_OR_AVX2 (
+	    SHA2_sha256_x4(out0, out1, out2, out3, in0, in1, in2, in3, inlen);
+	    SHA2_sha256_x4(out4, out5, out6, out7, in4, in5, in6, in7, inlen),
+	    oqs_sha2_sha256_x8_avx2(out0, out1, out2, out3, out4, out5, out6, out7,
+	                            in0, in1, in2, in3, in4, in5, in6, in7, inlen)
+	);
+}
+
 static void SHA2_sha384(uint8_t *out, const uint8_t *in, size_t inlen) {
 	oqs_sha2_sha384_c(out, in, inlen);
 }
@@ -128,4 +189,6 @@ struct OQS_SHA2_callbacks sha2_default_callbacks = {
 	SHA2_sha512_inc_blocks,
 	SHA2_sha512_inc_finalize,
 	SHA2_sha512_inc_ctx_release,
+	SHA2_sha256_x4,
+	SHA2_sha256_x8,
 };
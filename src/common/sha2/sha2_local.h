@@ -89,6 +89,23 @@ void oqs_sha2_sha256_c(uint8_t *out, const uint8_t *in, size_t inlen);
 void oqs_sha2_sha384_c(uint8_t *out, const uint8_t *in, size_t inlen);
 void oqs_sha2_sha512_c(uint8_t *out, const uint8_t *in, size_t inlen);
 
+// x86_64 SHA extensions functions
+void oqs_sha2_sha224_inc_blocks_shani(sha224ctx *state, const uint8_t *in, size_t inblocks);
+void oqs_sha2_sha224_inc_finalize_shani(uint8_t *out, sha224ctx *state, const uint8_t *in, size_t inlen);
+void oqs_sha2_sha224_shani(uint8_t *out, const uint8_t *in, size_t inlen);
+void oqs_sha2_sha256_inc_blocks_shani(sha256ctx *state, const uint8_t *in, size_t inblocks);
+void oqs_sha2_sha256_inc_shani(sha256ctx *state, const uint8_t *in, size_t len);
+void oqs_sha2_sha256_inc_finalize_shani(uint8_t *out, sha256ctx *state, const uint8_t *in, size_t inlen);
+void oqs_sha2_sha256_shani(uint8_t *out, const uint8_t *in, size_t inlen);
+
+// x86_64 AVX2 multi-lane functions
+void oqs_sha2_sha256_x4_avx2(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                             const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen);
+void oqs_sha2_sha256_x8_avx2(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                             uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7,
+                             const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                             const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen);
+
 extern struct OQS_SHA2_callbacks sha2_default_callbacks;
 
 #if defined(__cplusplus)
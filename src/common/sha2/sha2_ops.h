@@ -156,6 +156,26 @@ struct OQS_SHA2_callbacks {
 	 * Implementation of function OQS_SHA2_sha512_inc_ctx_release.
 	 */
 	void (*SHA2_sha512_inc_ctx_release)(OQS_SHA2_sha512_ctx *state);
+
+	/**
+	 * Implementation of function OQS_SHA2_sha256_x4.
+	 *
+	 * May be NULL, in which case OQS_SHA2_sha256_x4 hashes each message
+	 * with SHA2_sha256.
+	 */
+	void (*SHA2_sha256_x4)(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+	                       const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen);
+
+	/**
+	 * Implementation of function OQS_SHA2_sha256_x8.
+	 *
+	 * May be NULL, in which case OQS_SHA2_sha256_x8 hashes each message
+	 * with SHA2_sha256.
+	 */
+	void (*SHA2_sha256_x8)(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+	                       uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7,
+	                       const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+	                       const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen);
 };
 
 /**
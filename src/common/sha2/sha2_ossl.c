@@ -173,6 +173,8 @@ struct OQS_SHA2_callbacks sha2_default_callbacks = {
 	SHA2_sha512_inc_blocks,
 	SHA2_sha512_inc_finalize,
 	SHA2_sha512_inc_ctx_release,
+	NULL,
+	NULL,
 };
 
 #endif
@@ -0,0 +1,245 @@
+// SPDX-License-Identifier: MIT
+
+#include <oqs/oqs.h>
+
+#include "sha2_local.h"
+#include <string.h>
+#include <stdint.h>
+#include <immintrin.h>
+
+/* Multi-lane SHA-256 for x86_64 with AVX2.
+ *
+ * Every vector holds the same state or message word of 4 (SSE-width) or
+ * 8 (AVX2-width) independent messages, so one pass over the 64 rounds
+ * compresses a block of each lane. All lanes have the same length, hence
+ * the same number of blocks and the same padding layout. */
+
+static const uint32_t sha256_k[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static const uint32_t sha256_iv[8] = {
+	0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+static uint32_t load_bigendian_32(const uint8_t *x) {
+	return (uint32_t)(x[3]) | (((uint32_t)(x[2])) << 8) |
+	       (((uint32_t)(x[1])) << 16) | (((uint32_t)(x[0])) << 24);
+}
+
+static void store_bigendian_32(uint8_t *x, uint32_t u) {
+	x[3] = (uint8_t) u;
+	u >>= 8;
+	x[2] = (uint8_t) u;
+	u >>= 8;
+	x[1] = (uint8_t) u;
+	u >>= 8;
+	x[0] = (uint8_t) u;
+}
+
+/* Write the one or two padded final blocks of an inlen-byte message into
+ * pad and return how many were written. */
+static size_t sha256_pad_final(uint8_t pad[128], const uint8_t *in, size_t inlen) {
+	size_t tail = inlen & 63;
+	size_t padblocks = (tail < 56) ? 1 : 2;
+	uint64_t bits = (uint64_t) inlen << 3;
+
+	memset(pad, 0, 128);
+	if (tail > 0) {
+		memcpy(pad, in + inlen - tail, tail);
+	}
+	pad[tail] = 0x80;
+	for (size_t i = 0; i < 8; i++) {
+		pad[64 * padblocks - 1 - i] = (uint8_t) (bits >> (8 * i));
+	}
+	return padblocks;
+}
+
+#define ADD4(a, b) _mm_add_epi32(a, b)
+#define ROTR4(x, c) _mm_or_si128(_mm_srli_epi32(x, c), _mm_slli_epi32(x, 32 - (c)))
+#define BSIG0_4(x) _mm_xor_si128(_mm_xor_si128(ROTR4(x, 2), ROTR4(x, 13)), ROTR4(x, 22))
+#define BSIG1_4(x) _mm_xor_si128(_mm_xor_si128(ROTR4(x, 6), ROTR4(x, 11)), ROTR4(x, 25))
+#define SSIG0_4(x) _mm_xor_si128(_mm_xor_si128(ROTR4(x, 7), ROTR4(x, 18)), _mm_srli_epi32(x, 3))
+#define SSIG1_4(x) _mm_xor_si128(_mm_xor_si128(ROTR4(x, 17), ROTR4(x, 19)), _mm_srli_epi32(x, 10))
+#define CH4(x, y, z) _mm_xor_si128(_mm_and_si128(x, y), _mm_andnot_si128(x, z))
+#define MAJ4(x, y, z) _mm_xor_si128(_mm_xor_si128(_mm_and_si128(x, y), _mm_and_si128(x, z)), _mm_and_si128(y, z))
+
+#define ADD8(a, b) _mm256_add_epi32(a, b)
+#define ROTR8(x, c) _mm256_or_si256(_mm256_srli_epi32(x, c), _mm256_slli_epi32(x, 32 - (c)))
+#define BSIG0_8(x) _mm256_xor_si256(_mm256_xor_si256(ROTR8(x, 2), ROTR8(x, 13)), ROTR8(x, 22))
+#define BSIG1_8(x) _mm256_xor_si256(_mm256_xor_si256(ROTR8(x, 6), ROTR8(x, 11)), ROTR8(x, 25))
+#define SSIG0_8(x) _mm256_xor_si256(_mm256_xor_si256(ROTR8(x, 7), ROTR8(x, 18)), _mm256_srli_epi32(x, 3))
+#define SSIG1_8(x) _mm256_xor_si256(_mm256_xor_si256(ROTR8(x, 17), ROTR8(x, 19)), _mm256_srli_epi32(x, 10))
+#define CH8(x, y, z) _mm256_xor_si256(_mm256_and_si256(x, y), _mm256_andnot_si256(x, z))
+#define MAJ8(x, y, z) _mm256_xor_si256(_mm256_xor_si256(_mm256_and_si256(x, y), _mm256_and_si256(x, z)), _mm256_and_si256(y, z))
+
+static void sha256_compress_x4(__m128i s[8], const uint8_t *blk[4]) {
+	__m128i w[16];
+	__m128i a = s[0], b = s[1], c = s[2], d = s[3];
+	__m128i e = s[4], f = s[5], g = s[6], h = s[7];
+	uint32_t lanes[4];
+
+	for (size_t t = 0; t < 16; t++) {
+		for (size_t l = 0; l < 4; l++) {
+			lanes[l] = load_bigendian_32(blk[l] + 4 * t);
+		}
+		w[t] = _mm_loadu_si128((const __m128i *) lanes);
+	}
+
+	for (size_t t = 0; t < 64; t++) {
+		__m128i t1, t2;
+		if (t >= 16) {
+			w[t & 15] = ADD4(ADD4(SSIG1_4(w[(t - 2) & 15]), w[(t - 7) & 15]),
+			                 ADD4(SSIG0_4(w[(t - 15) & 15]), w[t & 15]));
+		}
+		t1 = ADD4(ADD4(h, BSIG1_4(e)), ADD4(CH4(e, f, g), ADD4(_mm_set1_epi32((int) sha256_k[t]), w[t & 15])));
+		t2 = ADD4(BSIG0_4(a), MAJ4(a, b, c));
+		h = g;
+		g = f;
+		f = e;
+		e = ADD4(d, t1);
+		d = c;
+		c = b;
+		b = a;
+		a = ADD4(t1, t2);
+	}
+
+	s[0] = ADD4(s[0], a);
+	s[1] = ADD4(s[1], b);
+	s[2] = ADD4(s[2], c);
+	s[3] = ADD4(s[3], d);
+	s[4] = ADD4(s[4], e);
+	s[5] = ADD4(s[5], f);
+	s[6] = ADD4(s[6], g);
+	s[7] = ADD4(s[7], h);
+}
+
+static void sha256_compress_x8(__m256i s[8], const uint8_t *blk[8]) {
+	__m256i w[16];
+	__m256i a = s[0], b = s[1], c = s[2], d = s[3];
+	__m256i e = s[4], f = s[5], g = s[6], h = s[7];
+	uint32_t lanes[8];
+
+	for (size_t t = 0; t < 16; t++) {
+		for (size_t l = 0; l < 8; l++) {
+			lanes[l] = load_bigendian_32(blk[l] + 4 * t);
+		}
+		w[t] = _mm256_loadu_si256((const __m256i *) lanes);
+	}
+
+	for (size_t t = 0; t < 64; t++) {
+		__m256i t1, t2;
+		if (t >= 16) {
+			w[t & 15] = ADD8(ADD8(SSIG1_8(w[(t - 2) & 15]), w[(t - 7) & 15]),
+			                 ADD8(SSIG0_8(w[(t - 15) & 15]), w[t & 15]));
+		}
+		t1 = ADD8(ADD8(h, BSIG1_8(e)), ADD8(CH8(e, f, g), ADD8(_mm256_set1_epi32((int) sha256_k[t]), w[t & 15])));
+		t2 = ADD8(BSIG0_8(a), MAJ8(a, b, c));
+		h = g;
+		g = f;
+		f = e;
+		e = ADD8(d, t1);
+		d = c;
+		c = b;
+		b = a;
+		a = ADD8(t1, t2);
+	}
+
+	s[0] = ADD8(s[0], a);
+	s[1] = ADD8(s[1], b);
+	s[2] = ADD8(s[2], c);
+	s[3] = ADD8(s[3], d);
+	s[4] = ADD8(s[4], e);
+	s[5] = ADD8(s[5], f);
+	s[6] = ADD8(s[6], g);
+	s[7] = ADD8(s[7], h);
+}
+
+void oqs_sha2_sha256_x4_avx2(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                             const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
+	uint8_t *out[4] = {out0, out1, out2, out3};
+	const uint8_t *in[4] = {in0, in1, in2, in3};
+	const uint8_t *blk[4];
+	uint8_t pad[4][128];
+	uint32_t words[8][4];
+	__m128i s[8];
+	size_t inblocks = inlen >> 6;
+	size_t padblocks = 0;
+
+	for (size_t i = 0; i < 8; i++) {
+		s[i] = _mm_set1_epi32((int) sha256_iv[i]);
+	}
+	for (size_t i = 0; i < inblocks; i++) {
+		for (size_t l = 0; l < 4; l++) {
+			blk[l] = in[l] + 64 * i;
+		}
+		sha256_compress_x4(s, blk);
+	}
+	for (size_t l = 0; l < 4; l++) {
+		padblocks = sha256_pad_final(pad[l], in[l], inlen);
+	}
+	for (size_t i = 0; i < padblocks; i++) {
+		for (size_t l = 0; l < 4; l++) {
+			blk[l] = pad[l] + 64 * i;
+		}
+		sha256_compress_x4(s, blk);
+	}
+
+	for (size_t i = 0; i < 8; i++) {
+		_mm_storeu_si128((__m128i *) words[i], s[i]);
+	}
+	for (size_t l = 0; l < 4; l++) {
+		for (size_t i = 0; i < 8; i++) {
+			store_bigendian_32(out[l] + 4 * i, words[i][l]);
+		}
+	}
+}
+
+void oqs_sha2_sha256_x8_avx2(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                             uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7,
+                             const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                             const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen) {
+	uint8_t *out[8] = {out0, out1, out2, out3, out4, out5, out6, out7};
+	const uint8_t *in[8] = {in0, in1, in2, in3, in4, in5, in6, in7};
+	const uint8_t *blk[8];
+	uint8_t pad[8][128];
+	uint32_t words[8][8];
+	__m256i s[8];
+	size_t inblocks = inlen >> 6;
+	size_t padblocks = 0;
+
+	for (size_t i = 0; i < 8; i++) {
+		s[i] = _mm256_set1_epi32((int) sha256_iv[i]);
+	}
+	for (size_t i = 0; i < inblocks; i++) {
+		for (size_t l = 0; l < 8; l++) {
+			blk[l] = in[l] + 64 * i;
+		}
+		sha256_compress_x8(s, blk);
+	}
+	for (size_t l = 0; l < 8; l++) {
+		padblocks = sha256_pad_final(pad[l], in[l], inlen);
+	}
+	for (size_t i = 0; i < padblocks; i++) {
+		for (size_t l = 0; l < 8; l++) {
+			blk[l] = pad[l] + 64 * i;
+		}
+		sha256_compress_x8(s, blk);
+	}
+
+	for (size_t i = 0; i < 8; i++) {
+		_mm256_storeu_si256((__m256i *) words[i], s[i]);
+	}
+	for (size_t l = 0; l < 8; l++) {
+		for (size_t i = 0; i < 8; i++) {
+			store_bigendian_32(out[l] + 4 * i, words[i][l]);
+		}
+	}
+}
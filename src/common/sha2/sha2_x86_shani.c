@@ -0,0 +1,299 @@
+// SPDX-License-Identifier: Public domain
+
+#include <oqs/oqs.h>
+
+#include "sha2_local.h"
+#include <string.h>
+#include <stdint.h>
+#include <immintrin.h>
+/* Based on the public domain SHA-NI implementation
+ * sha256-x86.c from https://github.com/noloader/SHA-Intrinsics
+ * by Jeffrey Walton, and on sha2_armv8.c */
+
+static uint64_t load_bigendian_64(const uint8_t *x) {
+	return (uint64_t)(x[7]) | (((uint64_t)(x[6])) << 8) |
+	       (((uint64_t)(x[5])) << 16) | (((uint64_t)(x[4])) << 24) |
+	       (((uint64_t)(x[3])) << 32) | (((uint64_t)(x[2])) << 40) |
+	       (((uint64_t)(x[1])) << 48) | (((uint64_t)(x[0])) << 56);
+}
+
+static void store_bigendian_64(uint8_t *x, uint64_t u) {
+	x[7] = (uint8_t)u;
+	u >>= 8;
+	x[6] = (uint8_t)u;
+	u >>= 8;
+	x[5] = (uint8_t)u;
+	u >>= 8;
+	x[4] = (uint8_t)u;
+	u >>= 8;
+	x[3] = (uint8_t)u;
+	u >>= 8;
+	x[2] = (uint8_t)u;
+	u >>= 8;
+	x[1] = (uint8_t)u;
+	u >>= 8;
+	x[0] = (uint8_t)u;
+}
+
+static size_t crypto_hashblocks_sha256_shani(uint8_t *statebytes,
+        const uint8_t *data, size_t length) {
+	static const uint32_t s256cst[64] = {
+		0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+		0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+		0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+		0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+		0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+		0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+		0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+		0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+		0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+		0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+		0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+		0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+		0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+		0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+		0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+		0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+	};
+	/* byte-swaps each 32-bit word */
+	const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+	__m128i state0, state1, tmp, msg, abef_save, cdgh_save;
+	__m128i m[4];
+
+	/* load big-endian state and rearrange it into ABEF/CDGH */
+	tmp = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(statebytes + 0)), mask);
+	state1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(statebytes + 16)), mask);
+	tmp = _mm_shuffle_epi32(tmp, 0xB1);               /* CDAB */
+	state1 = _mm_shuffle_epi32(state1, 0x1B);         /* EFGH */
+	state0 = _mm_alignr_epi8(tmp, state1, 8);         /* ABEF */
+	state1 = _mm_blend_epi16(state1, tmp, 0xF0);      /* CDGH */
+
+	while (length >= 64) {
+		abef_save = state0;
+		cdgh_save = state1;
+
+		/* load one block as big-endian words */
+		for (size_t i = 0; i < 4; i++) {
+			m[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16 * i)), mask);
+		}
+
+		/*
+		 * Four rounds per iteration. The message schedule for the
+		 * words four rounds ahead is finished with sha256msg2 and
+		 * the one for twelve rounds ahead is started with sha256msg1.
+		 */
+		for (size_t i = 0; i < 16; i++) {
+			__m128i cur = m[i & 3];
+			msg = _mm_add_epi32(cur, _mm_loadu_si128((const __m128i *)(s256cst + 4 * i)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			if (i >= 3 && i <= 14) {
+				tmp = _mm_alignr_epi8(cur, m[(i - 1) & 3], 4);
+				m[(i + 1) & 3] = _mm_sha256msg2_epu32(_mm_add_epi32(m[(i + 1) & 3], tmp), cur);
+			}
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+			if (i >= 1 && i <= 12) {
+				m[(i - 1) & 3] = _mm_sha256msg1_epu32(m[(i - 1) & 3], cur);
+			}
+		}
+
+		state0 = _mm_add_epi32(state0, abef_save);
+		state1 = _mm_add_epi32(state1, cdgh_save);
+
+		length -= 64;
+		data += 64;
+	}
+
+	/* rearrange ABEF/CDGH back and store big-endian */
+	tmp = _mm_shuffle_epi32(state0, 0x1B);            /* FEBA */
+	state1 = _mm_shuffle_epi32(state1, 0xB1);         /* DCHG */
+	state0 = _mm_blend_epi16(tmp, state1, 0xF0);      /* DCBA */
+	state1 = _mm_alignr_epi8(state1, tmp, 8);         /* HGFE */
+	_mm_storeu_si128((__m128i *)(statebytes + 0), _mm_shuffle_epi8(state0, mask));
+	_mm_storeu_si128((__m128i *)(statebytes + 16), _mm_shuffle_epi8(state1, mask));
+
+	return length;
+}
+
+void oqs_sha2_sha256_inc_finalize_shani(uint8_t *out, sha256ctx *state, const uint8_t *in, size_t inlen) {
+	uint8_t padded[128];
+
+	size_t new_inlen = state->data_len + inlen;
+	size_t tmp_len = new_inlen;
+	const uint8_t *new_in;
+	uint8_t *tmp_in = NULL;
+
+	if (new_inlen == inlen) {
+		new_in = in;
+	} else {
+		// Combine incremental data with final input
+		tmp_in = OQS_MEM_malloc(tmp_len);
+		OQS_EXIT_IF_NULLPTR(tmp_in, "SHA2");
+		memcpy(tmp_in, state->data, state->data_len);
+		if (in && inlen) {
+			memcpy(tmp_in + state->data_len, in, inlen);
+		}
+		new_in = tmp_in;
+		state->data_len = 0;
+	}
+
+	uint64_t bytes = load_bigendian_64(state->ctx + 32) + new_inlen;
+
+	crypto_hashblocks_sha256_shani(state->ctx, new_in, new_inlen);
+	new_in += new_inlen;
+	new_inlen &= 63;
+	new_in -= new_inlen;
+
+	for (size_t i = 0; i < new_inlen; ++i) {
+		padded[i] = new_in[i];
+	}
+	padded[new_inlen] = 0x80;
+
+	if (new_inlen < 56) {
+		for (size_t i = new_inlen + 1; i < 56; ++i) {
+			padded[i] = 0;
+		}
+		padded[56] = (uint8_t)(bytes >> 53);
+		padded[57] = (uint8_t)(bytes >> 45);
+		padded[58] = (uint8_t)(bytes >> 37);
+		padded[59] = (uint8_t)(bytes >> 29);
+		padded[60] = (uint8_t)(bytes >> 21);
+		padded[61] = (uint8_t)(bytes >> 13);
+		padded[62] = (uint8_t)(bytes >> 5);
+		padded[63] = (uint8_t)(bytes << 3);
+		crypto_hashblocks_sha256_shani(state->ctx, padded, 64);
+	} else {
+		for (size_t i = new_inlen + 1; i < 120; ++i) {
+			padded[i] = 0;
+		}
+		padded[120] = (uint8_t)(bytes >> 53);
+		padded[121] = (uint8_t)(bytes >> 45);
+		padded[122] = (uint8_t)(bytes >> 37);
+		padded[123] = (uint8_t)(bytes >> 29);
+		padded[124] = (uint8_t)(bytes >> 21);
+		padded[125] = (uint8_t)(bytes >> 13);
+		padded[126] = (uint8_t)(bytes >> 5);
+		padded[127] = (uint8_t)(bytes << 3);
+		crypto_hashblocks_sha256_shani(state->ctx, padded, 128);
+	}
+
+	for (size_t i = 0; i < 32; ++i) {
+		out[i] = state->ctx[i];
+	}
+	oqs_sha2_sha256_inc_ctx_release_c(state);
+	OQS_MEM_secure_free(tmp_in, tmp_len);
+}
+
+void oqs_sha2_sha224_inc_finalize_shani(uint8_t *out, sha224ctx *state, const uint8_t *in, size_t inlen) {
+	uint8_t tmp[32];
+	oqs_sha2_sha256_inc_finalize_shani(tmp, (sha256ctx *)state, in, inlen);
+
+	for (size_t i = 0; i < 28; ++i) {
+		out[i] = tmp[i];
+	}
+}
+
+void oqs_sha2_sha256_inc_blocks_shani(sha256ctx *state, const uint8_t *in, size_t inblocks) {
+	uint64_t bytes = load_bigendian_64(state->ctx + 32);
+	const uint8_t *new_in;
+	size_t buf_len = 64 * inblocks;
+	uint8_t *tmp_in = NULL;
+
+	/* Process any existing incremental data first */
+	if (state->data_len) {
+		tmp_in = OQS_MEM_malloc(buf_len);
+		OQS_EXIT_IF_NULLPTR(tmp_in, "SHA2");
+		memcpy(tmp_in, state->data, state->data_len);
+		memcpy(tmp_in + state->data_len, in, buf_len - state->data_len);
+
+		/* store the reminder input as incremental data */
+		memcpy(state->data, in + (buf_len - state->data_len), state->data_len);
+		new_in = tmp_in;
+	} else {
+		new_in = in;
+	}
+
+	crypto_hashblocks_sha256_shani(state->ctx, new_in, 64 * inblocks);
+	bytes += 64 * inblocks;
+
+	store_bigendian_64(state->ctx + 32, bytes);
+	OQS_MEM_secure_free(tmp_in, buf_len);
+}
+
+void oqs_sha2_sha256_inc_shani(sha256ctx *state, const uint8_t *in, size_t len) {
+	while (len) {
+		size_t incr = 64 - state->data_len;
+		if (incr > len) {
+			incr = len;
+		}
+
+		memcpy(state->data + state->data_len, in, incr);
+		state->data_len += incr;
+		in += incr;
+
+		if (state->data_len < 64) {
+			break;
+		}
+
+		/*
+		 * Process a complete block now
+		 */
+		uint64_t bytes = load_bigendian_64(state->ctx + 32) + 64;
+		crypto_hashblocks_sha256_shani(state->ctx, state->data, 64);
+		store_bigendian_64(state->ctx + 32, bytes);
+
+		/*
+		 * update the remaining input
+		 */
+		len -= incr;
+		state->data_len = 0;
+	}
+}
+
+void oqs_sha2_sha224_inc_blocks_shani(sha224ctx *state, const uint8_t *in, size_t inblocks) {
+	oqs_sha2_sha256_inc_blocks_shani((sha256ctx *)state, in, inblocks);
+}
+
+static const uint8_t iv_224[32] = {
+	0xc1, 0x05, 0x9e, 0xd8, 0x36, 0x7c, 0xd5, 0x07,
+	0x30, 0x70, 0xdd, 0x17, 0xf7, 0x0e, 0x59, 0x39,
+	0xff, 0xc0, 0x0b, 0x31, 0x68, 0x58, 0x15, 0x11,
+	0x64, 0xf9, 0x8f, 0xa7, 0xbe, 0xfa, 0x4f, 0xa4
+};
+
+static const uint8_t iv_256[32] = {
+	0x6a, 0x09, 0xe6, 0x67, 0xbb, 0x67, 0xae, 0x85,
+	0x3c, 0x6e, 0xf3, 0x72, 0xa5, 0x4f, 0xf5, 0x3a,
+	0x51, 0x0e, 0x52, 0x7f, 0x9b, 0x05, 0x68, 0x8c,
+	0x1f, 0x83, 0xd9, 0xab, 0x5b, 0xe0, 0xcd, 0x19
+};
+
+/* One-shot hashing keeps the state on the stack instead of going
+ * through the heap-allocated incremental context. */
+static void sha256_oneshot_shani(uint8_t *out, size_t outlen, const uint8_t iv[32], const uint8_t *in, size_t inlen) {
+	uint8_t statebytes[32];
+	uint8_t padded[128];
+	size_t tail = inlen & 63;
+	size_t padlen = (tail < 56) ? 64 : 128;
+
+	memcpy(statebytes, iv, 32);
+	crypto_hashblocks_sha256_shani(statebytes, in, inlen);
+
+	memset(padded, 0, padlen);
+	if (tail > 0) {
+		memcpy(padded, in + inlen - tail, tail);
+	}
+	padded[tail] = 0x80;
+	store_bigendian_64(padded + padlen - 8, (uint64_t) inlen << 3);
+	crypto_hashblocks_sha256_shani(statebytes, padded, padlen);
+
+	memcpy(out, statebytes, outlen);
+}
+
+void oqs_sha2_sha256_shani(uint8_t *out, const uint8_t *in, size_t inlen) {
+	sha256_oneshot_shani(out, 32, iv_256, in, inlen);
+}
+
+void oqs_sha2_sha224_shani(uint8_t *out, const uint8_t *in, size_t inlen) {
+	sha256_oneshot_shani(out, 28, iv_224, in, inlen);
+}
@@ -46,6 +46,12 @@ static void SHA3_sha3_256_inc_init(OQS_SHA3_sha3_256_inc_ctx *state) {
 	OSSL_FUNC(EVP_DigestInit_ex)(s, oqs_sha3_256(), NULL);
 }
 
+/* OpenSSL manages its own digest context, so the caller storage is not used. */
+static void SHA3_sha3_256_inc_init_inplace(OQS_SHA3_sha3_256_inc_ctx *state, OQS_SHA3_inc_storage *storage) {
+	(void)storage;
+	SHA3_sha3_256_inc_init(state);
+}
+
 static void SHA3_sha3_256_inc_absorb(OQS_SHA3_sha3_256_inc_ctx *state, const uint8_t *input, size_t inplen) {
 	OSSL_FUNC(EVP_DigestUpdate)((EVP_MD_CTX *)state->ctx, input, inplen);
 }
@@ -80,6 +86,11 @@ static void SHA3_sha3_384_inc_init(OQS_SHA3_sha3_384_inc_ctx *state) {
 	OSSL_FUNC(EVP_DigestInit_ex)((EVP_MD_CTX *)state->ctx, oqs_sha3_384(), NULL);
 }
 
+static void SHA3_sha3_384_inc_init_inplace(OQS_SHA3_sha3_384_inc_ctx *state, OQS_SHA3_inc_storage *storage) {
+	(void)storage;
+	SHA3_sha3_384_inc_init(state);
+}
+
 static void SHA3_sha3_384_inc_absorb(OQS_SHA3_sha3_384_inc_ctx *state, const uint8_t *input, size_t inplen) {
 	OSSL_FUNC(EVP_DigestUpdate)((EVP_MD_CTX *)state->ctx, input, inplen);
 }
@@ -115,6 +126,11 @@ static void SHA3_sha3_512_inc_init(OQS_SHA3_sha3_512_inc_ctx *state) {
 	OSSL_FUNC(EVP_DigestInit_ex)((EVP_MD_CTX *)state->ctx, oqs_sha3_512(), NULL);
 }
 
+static void SHA3_sha3_512_inc_init_inplace(OQS_SHA3_sha3_512_inc_ctx *state, OQS_SHA3_inc_storage *storage) {
+	(void)storage;
+	SHA3_sha3_512_inc_init(state);
+}
+
 static void SHA3_sha3_512_inc_absorb(OQS_SHA3_sha3_512_inc_ctx *state, const uint8_t *input, size_t inplen) {
 	OSSL_FUNC(EVP_DigestUpdate)((EVP_MD_CTX *)state->ctx, input, inplen);
 }
@@ -176,6 +192,11 @@ static void SHA3_shake128_inc_init(OQS_SHA3_shake128_inc_ctx *state) {
 	OSSL_FUNC(EVP_DigestInit_ex)(s->mdctx, oqs_shake128(), NULL);
 }
 
+static void SHA3_shake128_inc_init_inplace(OQS_SHA3_shake128_inc_ctx *state, OQS_SHA3_inc_storage *storage) {
+	(void)storage;
+	SHA3_shake128_inc_init(state);
+}
+
 static void SHA3_shake128_inc_absorb(OQS_SHA3_shake128_inc_ctx *state, const uint8_t *input, size_t inplen) {
 	intrn_shake128_inc_ctx *s = (intrn_shake128_inc_ctx *)state->ctx;
 	OSSL_FUNC(EVP_DigestUpdate)(s->mdctx, input, inplen);
@@ -251,6 +272,11 @@ static void SHA3_shake256_inc_init(OQS_SHA3_shake256_inc_ctx *state) {
 	OSSL_FUNC(EVP_DigestInit_ex)(s->mdctx, oqs_shake256(), NULL);
 }
 
+static void SHA3_shake256_inc_init_inplace(OQS_SHA3_shake256_inc_ctx *state, OQS_SHA3_inc_storage *storage) {
+	(void)storage;
+	SHA3_shake256_inc_init(state);
+}
+
 static void SHA3_shake256_inc_absorb(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *input, size_t inplen) {
 	intrn_shake256_inc_ctx *s = (intrn_shake256_inc_ctx *)state->ctx;
 	OSSL_FUNC(EVP_DigestUpdate)(s->mdctx, input, inplen);
@@ -344,6 +370,11 @@ struct OQS_SHA3_callbacks sha3_default_callbacks = {
 	SHA3_shake256_inc_ctx_release,
 	SHA3_shake256_inc_ctx_clone,
 	SHA3_shake256_inc_ctx_reset,
+	SHA3_sha3_256_inc_init_inplace,
+	SHA3_sha3_384_inc_init_inplace,
+	SHA3_sha3_512_inc_init_inplace,
+	SHA3_shake128_inc_init_inplace,
+	SHA3_shake256_inc_init_inplace,
 };
 
 #endif
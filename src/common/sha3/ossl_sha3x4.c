@@ -47,6 +47,12 @@ static void SHA3_shake128_x4_inc_init(OQS_SHA3_shake128_x4_inc_ctx *state) {
 	s->n_out = 0;
 }
 
+/* OpenSSL manages its own digest context, so the caller storage is not used. */
+static void SHA3_shake128_x4_inc_init_inplace(OQS_SHA3_shake128_x4_inc_ctx *state, OQS_SHA3_x4_inc_storage *storage) {
+	(void)storage;
+	SHA3_shake128_x4_inc_init(state);
+}
+
 static void SHA3_shake128_x4_inc_absorb(OQS_SHA3_shake128_x4_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inplen) {
 	intrn_shake128_x4_inc_ctx *s = (intrn_shake128_x4_inc_ctx *)state->ctx;
 	OSSL_FUNC(EVP_DigestUpdate)(s->mdctx0, in0, inplen);
@@ -169,6 +175,11 @@ static void SHA3_shake256_x4_inc_init(OQS_SHA3_shake256_x4_inc_ctx *state) {
 	s->n_out = 0;
 }
 
+static void SHA3_shake256_x4_inc_init_inplace(OQS_SHA3_shake256_x4_inc_ctx *state, OQS_SHA3_x4_inc_storage *storage) {
+	(void)storage;
+	SHA3_shake256_x4_inc_init(state);
+}
+
 static void SHA3_shake256_x4_inc_absorb(OQS_SHA3_shake256_x4_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inplen) {
 	intrn_shake256_x4_inc_ctx *s = (intrn_shake256_x4_inc_ctx *)state->ctx;
 	OSSL_FUNC(EVP_DigestUpdate)(s->mdctx0, in0, inplen);
@@ -275,6 +286,10 @@ struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks = {
 	SHA3_shake256_x4_inc_ctx_release,
 	SHA3_shake256_x4_inc_ctx_clone,
 	SHA3_shake256_x4_inc_ctx_reset,
+	SHA3_shake128_x4_inc_init_inplace,
+	SHA3_shake256_x4_inc_init_inplace,
+	NULL,
+	NULL,
 };
 
 #endif
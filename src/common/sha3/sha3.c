@@ -20,6 +20,14 @@ void OQS_SHA3_sha3_256_inc_init(OQS_SHA3_sha3_256_inc_ctx *state) {
 	callbacks->SHA3_sha3_256_inc_init(state);
 }
 
+void OQS_SHA3_sha3_256_inc_init_inplace(OQS_SHA3_sha3_256_inc_ctx *state, OQS_SHA3_inc_storage *storage) {
+	if (callbacks->SHA3_sha3_256_inc_init_inplace == NULL) {
+		callbacks->SHA3_sha3_256_inc_init(state);
+		return;
+	}
+	callbacks->SHA3_sha3_256_inc_init_inplace(state, storage);
+}
+
 void OQS_SHA3_sha3_256_inc_absorb(OQS_SHA3_sha3_256_inc_ctx *state, const uint8_t *input, size_t inlen) {
 	callbacks->SHA3_sha3_256_inc_absorb(state, input, inlen);
 }
@@ -48,6 +56,14 @@ void OQS_SHA3_sha3_384_inc_init(OQS_SHA3_sha3_384_inc_ctx *state) {
 	callbacks->SHA3_sha3_384_inc_init(state);
 }
 
+void OQS_SHA3_sha3_384_inc_init_inplace(OQS_SHA3_sha3_384_inc_ctx *state, OQS_SHA3_inc_storage *storage) {
+	if (callbacks->SHA3_sha3_384_inc_init_inplace == NULL) {
+		callbacks->SHA3_sha3_384_inc_init(state);
+		return;
+	}
+	callbacks->SHA3_sha3_384_inc_init_inplace(state, storage);
+}
+
 void OQS_SHA3_sha3_384_inc_absorb(OQS_SHA3_sha3_384_inc_ctx *state, const uint8_t *input, size_t inlen) {
 	callbacks->SHA3_sha3_384_inc_absorb(state, input, inlen);
 }
@@ -76,6 +92,14 @@ void OQS_SHA3_sha3_512_inc_init(OQS_SHA3_sha3_512_inc_ctx *state) {
 	callbacks->SHA3_sha3_512_inc_init(state);
 }
 
+void OQS_SHA3_sha3_512_inc_init_inplace(OQS_SHA3_sha3_512_inc_ctx *state, OQS_SHA3_inc_storage *storage) {
+	if (callbacks->SHA3_sha3_512_inc_init_inplace == NULL) {
+		callbacks->SHA3_sha3_512_inc_init(state);
+		return;
+	}
+	callbacks->SHA3_sha3_512_inc_init_inplace(state, storage);
+}
+
 void OQS_SHA3_sha3_512_inc_absorb(OQS_SHA3_sha3_512_inc_ctx *state, const uint8_t *input, size_t inlen) {
 	callbacks->SHA3_sha3_512_inc_absorb(state, input, inlen);
 }
@@ -104,6 +128,14 @@ void OQS_SHA3_shake128_inc_init(OQS_SHA3_shake128_inc_ctx *state) {
 	callbacks->SHA3_shake128_inc_init(state);
 }
 
+void OQS_SHA3_shake128_inc_init_inplace(OQS_SHA3_shake128_inc_ctx *state, OQS_SHA3_inc_storage *storage) {
+	if (callbacks->SHA3_shake128_inc_init_inplace == NULL) {
+		callbacks->SHA3_shake128_inc_init(state);
+		return;
+	}
+	callbacks->SHA3_shake128_inc_init_inplace(state, storage);
+}
+
 void OQS_SHA3_shake128_inc_absorb(OQS_SHA3_shake128_inc_ctx *state, const uint8_t *input, size_t inlen) {
 	callbacks->SHA3_shake128_inc_absorb(state, input, inlen);
 }
@@ -136,6 +168,14 @@ void OQS_SHA3_shake256_inc_init(OQS_SHA3_shake256_inc_ctx *state) {
 	callbacks->SHA3_shake256_inc_init(state);
 }
 
+void OQS_SHA3_shake256_inc_init_inplace(OQS_SHA3_shake256_inc_ctx *state, OQS_SHA3_inc_storage *storage) {
+	if (callbacks->SHA3_shake256_inc_init_inplace == NULL) {
+		callbacks->SHA3_shake256_inc_init(state);
+		return;
+	}
+	callbacks->SHA3_shake256_inc_init_inplace(state, storage);
+}
+
 void OQS_SHA3_shake256_inc_absorb(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *input, size_t inlen) {
 	callbacks->SHA3_shake256_inc_absorb(state, input, inlen);
 }
@@ -50,6 +50,20 @@ void OQS_SHA3_sha3_256(uint8_t *output, const uint8_t *input, size_t inplen);
  */
 void OQS_SHA3_sha3_256_inc_init(OQS_SHA3_sha3_256_inc_ctx *state);
 
+/**
+ * \brief Initialize the state for the incremental SHA3-256 API using caller-provided storage.
+ *
+ * Equivalent to OQS_SHA3_sha3_256_inc_init, except that the internal state is placed in
+ * storage instead of being allocated on the heap. The storage must outlive the state.
+ *
+ * \warning Caller is responsible for releasing state by calling
+ * OQS_SHA3_sha3_256_inc_ctx_release.
+ *
+ * \param state The function state to be initialized.
+ * \param storage The storage backing the function state.
+ */
+void OQS_SHA3_sha3_256_inc_init_inplace(OQS_SHA3_sha3_256_inc_ctx *state, OQS_SHA3_inc_storage *storage);
+
 /**
  * \brief The SHA3-256 absorb function.
  * Absorb an input into the state.
@@ -119,6 +133,20 @@ void OQS_SHA3_sha3_384(uint8_t *output, const uint8_t *input, size_t inplen);
  */
 void OQS_SHA3_sha3_384_inc_init(OQS_SHA3_sha3_384_inc_ctx *state);
 
+/**
+ * \brief Initialize the state for the incremental SHA3-384 API using caller-provided storage.
+ *
+ * Equivalent to OQS_SHA3_sha3_384_inc_init, except that the internal state is placed in
+ * storage instead of being allocated on the heap. The storage must outlive the state.
+ *
+ * \warning Caller is responsible for releasing state by calling
+ * OQS_SHA3_sha3_384_inc_ctx_release.
+ *
+ * \param state The function state to be initialized.
+ * \param storage The storage backing the function state.
+ */
+void OQS_SHA3_sha3_384_inc_init_inplace(OQS_SHA3_sha3_384_inc_ctx *state, OQS_SHA3_inc_storage *storage);
+
 /**
  * \brief The SHA3-384 absorb function.
  * Absorb an input into the state.
@@ -188,6 +216,20 @@ void OQS_SHA3_sha3_512(uint8_t *output, const uint8_t *input, size_t inplen);
  */
 void OQS_SHA3_sha3_512_inc_init(OQS_SHA3_sha3_512_inc_ctx *state);
 
+/**
+ * \brief Initialize the state for the incremental SHA3-512 API using caller-provided storage.
+ *
+ * Equivalent to OQS_SHA3_sha3_512_inc_init, except that the internal state is placed in
+ * storage instead of being allocated on the heap. The storage must outlive the state.
+ *
+ * \warning Caller is responsible for releasing state by calling
+ * OQS_SHA3_sha3_512_inc_ctx_release.
+ *
+ * \param state The function state to be initialized.
+ * \param storage The storage backing the function state.
+ */
+void OQS_SHA3_sha3_512_inc_init_inplace(OQS_SHA3_sha3_512_inc_ctx *state, OQS_SHA3_inc_storage *storage);
+
 /**
  * \brief The SHA3-512 absorb function.
  * Absorb an input into the state.
@@ -260,6 +302,20 @@ void OQS_SHA3_shake128(uint8_t *output, size_t outlen, const uint8_t *input, siz
  */
 void OQS_SHA3_shake128_inc_init(OQS_SHA3_shake128_inc_ctx *state);
 
+/**
+ * \brief Initialize the state for the incremental SHAKE-128 API using caller-provided storage.
+ *
+ * Equivalent to OQS_SHA3_shake128_inc_init, except that the internal state is placed in
+ * storage instead of being allocated on the heap. The storage must outlive the state.
+ *
+ * \warning Caller is responsible for releasing state by calling
+ * OQS_SHA3_shake128_inc_ctx_release.
+ *
+ * \param state The function state to be initialized.
+ * \param storage The storage backing the function state.
+ */
+void OQS_SHA3_shake128_inc_init_inplace(OQS_SHA3_shake128_inc_ctx *state, OQS_SHA3_inc_storage *storage);
+
 /**
  * \brief The SHAKE-128 absorb function.
  * Absorb an input into the state.
@@ -338,6 +394,20 @@ void OQS_SHA3_shake256(uint8_t *output, size_t outlen, const uint8_t *input, siz
  */
 void OQS_SHA3_shake256_inc_init(OQS_SHA3_shake256_inc_ctx *state);
 
+/**
+ * \brief Initialize the state for the incremental SHAKE-256 API using caller-provided storage.
+ *
+ * Equivalent to OQS_SHA3_shake256_inc_init, except that the internal state is placed in
+ * storage instead of being allocated on the heap. The storage must outlive the state.
+ *
+ * \warning Caller is responsible for releasing state by calling
+ * OQS_SHA3_shake256_inc_ctx_release.
+ *
+ * \param state The function state to be initialized.
+ * \param storage The storage backing the function state.
+ */
+void OQS_SHA3_shake256_inc_init_inplace(OQS_SHA3_shake256_inc_ctx *state, OQS_SHA3_inc_storage *storage);
+
 /**
  * \brief The SHAKE-256 absorb function.
  * Absorb an input message array directly into the state.
@@ -49,6 +49,29 @@ typedef struct {
 	void *ctx;
 } OQS_SHA3_shake256_inc_ctx;
 
+/** Alignment in bytes of the caller-provided storage for the incremental SHA3 and SHAKE APIs. */
+#define OQS_SHA3_INC_STORAGE_ALIGNMENT 32
+
+/** Size in bytes of the caller-provided storage for the incremental SHA3 and SHAKE APIs. */
+#define OQS_SHA3_INC_STORAGE_BYTES 224
+
+#if defined(_MSC_VER)
+#define OQS_SHA3_INC_STORAGE_ALIGNAS __declspec(align(OQS_SHA3_INC_STORAGE_ALIGNMENT))
+#else
+#define OQS_SHA3_INC_STORAGE_ALIGNAS __attribute__((aligned(OQS_SHA3_INC_STORAGE_ALIGNMENT)))
+#endif
+
+/**
+ * Caller-provided storage for the state of the incremental SHA3 and SHAKE APIs.
+ *
+ * Passed to the `_inc_init_inplace` functions so that the state can live on the
+ * stack (or inside another structure) instead of being allocated on the heap.
+ */
+typedef struct {
+	/** Internal state. */
+	OQS_SHA3_INC_STORAGE_ALIGNAS uint64_t buf[OQS_SHA3_INC_STORAGE_BYTES / sizeof(uint64_t)];
+} OQS_SHA3_inc_storage;
+
 /** Data structure implemented by cryptographic provider for SHA-3 operations.
  */
 struct OQS_SHA3_callbacks {
@@ -236,6 +259,31 @@ struct OQS_SHA3_callbacks {
 	 * Implementation of function OQS_SHA3_shake256_inc_ctx_reset.
 	 */
 	void (*SHA3_shake256_inc_ctx_reset)(OQS_SHA3_shake256_inc_ctx *state);
+
+	/**
+	 * Implementation of function OQS_SHA3_sha3_256_inc_init_inplace.
+	 */
+	void (*SHA3_sha3_256_inc_init_inplace)(OQS_SHA3_sha3_256_inc_ctx *state, OQS_SHA3_inc_storage *storage);
+
+	/**
+	 * Implementation of function OQS_SHA3_sha3_384_inc_init_inplace.
+	 */
+	void (*SHA3_sha3_384_inc_init_inplace)(OQS_SHA3_sha3_384_inc_ctx *state, OQS_SHA3_inc_storage *storage);
+
+	/**
+	 * Implementation of function OQS_SHA3_sha3_512_inc_init_inplace.
+	 */
+	void (*SHA3_sha3_512_inc_init_inplace)(OQS_SHA3_sha3_512_inc_ctx *state, OQS_SHA3_inc_storage *storage);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake128_inc_init_inplace.
+	 */
+	void (*SHA3_shake128_inc_init_inplace)(OQS_SHA3_shake128_inc_ctx *state, OQS_SHA3_inc_storage *storage);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake256_inc_init_inplace.
+	 */
+	void (*SHA3_shake256_inc_init_inplace)(OQS_SHA3_shake256_inc_ctx *state, OQS_SHA3_inc_storage *storage);
 };
 
 /**
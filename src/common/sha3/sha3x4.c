@@ -20,6 +20,14 @@ void OQS_SHA3_shake128_x4_inc_init(OQS_SHA3_shake128_x4_inc_ctx *state) {
 	callbacks->SHA3_shake128_x4_inc_init(state);
 }
 
+void OQS_SHA3_shake128_x4_inc_init_inplace(OQS_SHA3_shake128_x4_inc_ctx *state, OQS_SHA3_x4_inc_storage *storage) {
+	if (callbacks->SHA3_shake128_x4_inc_init_inplace == NULL) {
+		callbacks->SHA3_shake128_x4_inc_init(state);
+		return;
+	}
+	callbacks->SHA3_shake128_x4_inc_init_inplace(state, storage);
+}
+
 void OQS_SHA3_shake128_x4_inc_absorb(OQS_SHA3_shake128_x4_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
 	callbacks->SHA3_shake128_x4_inc_absorb(state, in0, in1, in2, in3, inlen);
 }
@@ -52,6 +60,14 @@ void OQS_SHA3_shake256_x4_inc_init(OQS_SHA3_shake256_x4_inc_ctx *state) {
 	callbacks->SHA3_shake256_x4_inc_init(state);
 }
 
+void OQS_SHA3_shake256_x4_inc_init_inplace(OQS_SHA3_shake256_x4_inc_ctx *state, OQS_SHA3_x4_inc_storage *storage) {
+	if (callbacks->SHA3_shake256_x4_inc_init_inplace == NULL) {
+		callbacks->SHA3_shake256_x4_inc_init(state);
+		return;
+	}
+	callbacks->SHA3_shake256_x4_inc_init_inplace(state, storage);
+}
+
 void OQS_SHA3_shake256_x4_inc_absorb(OQS_SHA3_shake256_x4_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
 	callbacks->SHA3_shake256_x4_inc_absorb(state, in0, in1, in2, in3, inlen);
 }
@@ -75,3 +91,167 @@ void OQS_SHA3_shake256_x4_inc_ctx_clone(OQS_SHA3_shake256_x4_inc_ctx *dest, cons
 void OQS_SHA3_shake256_x4_inc_ctx_reset(OQS_SHA3_shake256_x4_inc_ctx *state) {
 	callbacks->SHA3_shake256_x4_inc_ctx_reset(state);
 }
+
+void OQS_SHA3_shake128_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen) {
+	if (callbacks->SHA3_shake128_x8 == NULL) {
+		callbacks->SHA3_shake128_x4(out0, out1, out2, out3, outlen, in0, in1, in2, in3, inlen);
+		callbacks->SHA3_shake128_x4(out4, out5, out6, out7, outlen, in4, in5, in6, in7, inlen);
+		return;
+	}
+	callbacks->SHA3_shake128_x8(out0, out1, out2, out3, out4, out5, out6, out7, outlen, in0, in1, in2, in3, in4, in5, in6, in7, inlen);
+}
+
+/* The eight-way incremental API of a provider without eight-way callbacks
+ * runs on two four-way states. */
+static OQS_SHA3_shake128_x4_inc_ctx *shake128_x8_halves(const OQS_SHA3_shake128_x8_inc_ctx *state) {
+	return (OQS_SHA3_shake128_x4_inc_ctx *)state->ctx;
+}
+
+void OQS_SHA3_shake128_x8_inc_init(OQS_SHA3_shake128_x8_inc_ctx *state) {
+	if (callbacks->SHA3_shake128_x8_inc_init == NULL) {
+		OQS_SHA3_shake128_x4_inc_ctx *halves = OQS_MEM_malloc(2 * sizeof(OQS_SHA3_shake128_x4_inc_ctx));
+		OQS_EXIT_IF_NULLPTR(halves, "SHA3x8");
+		callbacks->SHA3_shake128_x4_inc_init(&halves[0]);
+		callbacks->SHA3_shake128_x4_inc_init(&halves[1]);
+		state->ctx = halves;
+		return;
+	}
+	callbacks->SHA3_shake128_x8_inc_init(state);
+}
+
+void OQS_SHA3_shake128_x8_inc_absorb(OQS_SHA3_shake128_x8_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen) {
+	if (callbacks->SHA3_shake128_x8_inc_init == NULL) {
+		callbacks->SHA3_shake128_x4_inc_absorb(&shake128_x8_halves(state)[0], in0, in1, in2, in3, inlen);
+		callbacks->SHA3_shake128_x4_inc_absorb(&shake128_x8_halves(state)[1], in4, in5, in6, in7, inlen);
+		return;
+	}
+	callbacks->SHA3_shake128_x8_inc_absorb(state, in0, in1, in2, in3, in4, in5, in6, in7, inlen);
+}
+
+void OQS_SHA3_shake128_x8_inc_finalize(OQS_SHA3_shake128_x8_inc_ctx *state) {
+	if (callbacks->SHA3_shake128_x8_inc_init == NULL) {
+		callbacks->SHA3_shake128_x4_inc_finalize(&shake128_x8_halves(state)[0]);
+		callbacks->SHA3_shake128_x4_inc_finalize(&shake128_x8_halves(state)[1]);
+		return;
+	}
+	callbacks->SHA3_shake128_x8_inc_finalize(state);
+}
+
+void OQS_SHA3_shake128_x8_inc_squeeze(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, OQS_SHA3_shake128_x8_inc_ctx *state) {
+	if (callbacks->SHA3_shake128_x8_inc_init == NULL) {
+		callbacks->SHA3_shake128_x4_inc_squeeze(out0, out1, out2, out3, outlen, &shake128_x8_halves(state)[0]);
+		callbacks->SHA3_shake128_x4_inc_squeeze(out4, out5, out6, out7, outlen, &shake128_x8_halves(state)[1]);
+		return;
+	}
+	callbacks->SHA3_shake128_x8_inc_squeeze(out0, out1, out2, out3, out4, out5, out6, out7, outlen, state);
+}
+
+void OQS_SHA3_shake128_x8_inc_ctx_release(OQS_SHA3_shake128_x8_inc_ctx *state) {
+	if (callbacks->SHA3_shake128_x8_inc_init == NULL) {
+		callbacks->SHA3_shake128_x4_inc_ctx_release(&shake128_x8_halves(state)[0]);
+		callbacks->SHA3_shake128_x4_inc_ctx_release(&shake128_x8_halves(state)[1]);
+		OQS_MEM_insecure_free(state->ctx);
+		return;
+	}
+	callbacks->SHA3_shake128_x8_inc_ctx_release(state);
+}
+
+void OQS_SHA3_shake128_x8_inc_ctx_clone(OQS_SHA3_shake128_x8_inc_ctx *dest, const OQS_SHA3_shake128_x8_inc_ctx *src) {
+	if (callbacks->SHA3_shake128_x8_inc_init == NULL) {
+		callbacks->SHA3_shake128_x4_inc_ctx_clone(&shake128_x8_halves(dest)[0], &shake128_x8_halves(src)[0]);
+		callbacks->SHA3_shake128_x4_inc_ctx_clone(&shake128_x8_halves(dest)[1], &shake128_x8_halves(src)[1]);
+		return;
+	}
+	callbacks->SHA3_shake128_x8_inc_ctx_clone(dest, src);
+}
+
+void OQS_SHA3_shake128_x8_inc_ctx_reset(OQS_SHA3_shake128_x8_inc_ctx *state) {
+	if (callbacks->SHA3_shake128_x8_inc_init == NULL) {
+		callbacks->SHA3_shake128_x4_inc_ctx_reset(&shake128_x8_halves(state)[0]);
+		callbacks->SHA3_shake128_x4_inc_ctx_reset(&shake128_x8_halves(state)[1]);
+		return;
+	}
+	callbacks->SHA3_shake128_x8_inc_ctx_reset(state);
+}
+
+void OQS_SHA3_shake256_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen) {
+	if (callbacks->SHA3_shake256_x8 == NULL) {
+		callbacks->SHA3_shake256_x4(out0, out1, out2, out3, outlen, in0, in1, in2, in3, inlen);
+		callbacks->SHA3_shake256_x4(out4, out5, out6, out7, outlen, in4, in5, in6, in7, inlen);
+		return;
+	}
+	callbacks->SHA3_shake256_x8(out0, out1, out2, out3, out4, out5, out6, out7, outlen, in0, in1, in2, in3, in4, in5, in6, in7, inlen);
+}
+
+/* The eight-way incremental API of a provider without eight-way callbacks
+ * runs on two four-way states. */
+static OQS_SHA3_shake256_x4_inc_ctx *shake256_x8_halves(const OQS_SHA3_shake256_x8_inc_ctx *state) {
+	return (OQS_SHA3_shake256_x4_inc_ctx *)state->ctx;
+}
+
+void OQS_SHA3_shake256_x8_inc_init(OQS_SHA3_shake256_x8_inc_ctx *state) {
+	if (callbacks->SHA3_shake256_x8_inc_init == NULL) {
+		OQS_SHA3_shake256_x4_inc_ctx *halves = OQS_MEM_malloc(2 * sizeof(OQS_SHA3_shake256_x4_inc_ctx));
+		OQS_EXIT_IF_NULLPTR(halves, "SHA3x8");
+		callbacks->SHA3_shake256_x4_inc_init(&halves[0]);
+		callbacks->SHA3_shake256_x4_inc_init(&halves[1]);
+		state->ctx = halves;
+		return;
+	}
+	callbacks->SHA3_shake256_x8_inc_init(state);
+}
+
+void OQS_SHA3_shake256_x8_inc_absorb(OQS_SHA3_shake256_x8_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen) {
+	if (callbacks->SHA3_shake256_x8_inc_init == NULL) {
+		callbacks->SHA3_shake256_x4_inc_absorb(&shake256_x8_halves(state)[0], in0, in1, in2, in3, inlen);
+		callbacks->SHA3_shake256_x4_inc_absorb(&shake256_x8_halves(state)[1], in4, in5, in6, in7, inlen);
+		return;
+	}
+	callbacks->SHA3_shake256_x8_inc_absorb(state, in0, in1, in2, in3, in4, in5, in6, in7, inlen);
+}
+
+void OQS_SHA3_shake256_x8_inc_finalize(OQS_SHA3_shake256_x8_inc_ctx *state) {
+	if (callbacks->SHA3_shake256_x8_inc_init == NULL) {
+		callbacks->SHA3_shake256_x4_inc_finalize(&shake256_x8_halves(state)[0]);
+		callbacks->SHA3_shake256_x4_inc_finalize(&shake256_x8_halves(state)[1]);
+		return;
+	}
+	callbacks->SHA3_shake256_x8_inc_finalize(state);
+}
+
+void OQS_SHA3_shake256_x8_inc_squeeze(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, OQS_SHA3_shake256_x8_inc_ctx *state) {
+	if (callbacks->SHA3_shake256_x8_inc_init == NULL) {
+		callbacks->SHA3_shake256_x4_inc_squeeze(out0, out1, out2, out3, outlen, &shake256_x8_halves(state)[0]);
+		callbacks->SHA3_shake256_x4_inc_squeeze(out4, out5, out6, out7, outlen, &shake256_x8_halves(state)[1]);
+		return;
+	}
+	callbacks->SHA3_shake256_x8_inc_squeeze(out0, out1, out2, out3, out4, out5, out6, out7, outlen, state);
+}
+
+void OQS_SHA3_shake256_x8_inc_ctx_release(OQS_SHA3_shake256_x8_inc_ctx *state) {
+	if (callbacks->SHA3_shake256_x8_inc_init == NULL) {
+		callbacks->SHA3_shake256_x4_inc_ctx_release(&shake256_x8_halves(state)[0]);
+		callbacks->SHA3_shake256_x4_inc_ctx_release(&shake256_x8_halves(state)[1]);
+		OQS_MEM_insecure_free(state->ctx);
+		return;
+	}
+	callbacks->SHA3_shake256_x8_inc_ctx_release(state);
+}
+
+void OQS_SHA3_shake256_x8_inc_ctx_clone(OQS_SHA3_shake256_x8_inc_ctx *dest, const OQS_SHA3_shake256_x8_inc_ctx *src) {
+	if (callbacks->SHA3_shake256_x8_inc_init == NULL) {
+		callbacks->SHA3_shake256_x4_inc_ctx_clone(&shake256_x8_halves(dest)[0], &shake256_x8_halves(src)[0]);
+		callbacks->SHA3_shake256_x4_inc_ctx_clone(&shake256_x8_halves(dest)[1], &shake256_x8_halves(src)[1]);
+		return;
+	}
+	callbacks->SHA3_shake256_x8_inc_ctx_clone(dest, src);
+}
+
+void OQS_SHA3_shake256_x8_inc_ctx_reset(OQS_SHA3_shake256_x8_inc_ctx *state) {
+	if (callbacks->SHA3_shake256_x8_inc_init == NULL) {
+		callbacks->SHA3_shake256_x4_inc_ctx_reset(&shake256_x8_halves(state)[0]);
+		callbacks->SHA3_shake256_x4_inc_ctx_reset(&shake256_x8_halves(state)[1]);
+		return;
+	}
+	callbacks->SHA3_shake256_x8_inc_ctx_reset(state);
+}
@@ -59,6 +59,17 @@ void OQS_SHA3_shake128_x4(
  */
 void OQS_SHA3_shake128_x4_inc_init(OQS_SHA3_shake128_x4_inc_ctx *state);
 
+/**
+ * \brief Initialize the state for four-way parallel incremental SHAKE-128 API using caller-provided storage.
+ *
+ * Equivalent to OQS_SHA3_shake128_x4_inc_init, except that the internal state is placed in
+ * storage instead of being allocated on the heap. The storage must outlive the state.
+ *
+ * \param state The function state to be initialized
+ * \param storage The storage backing the function state
+ */
+void OQS_SHA3_shake128_x4_inc_init_inplace(OQS_SHA3_shake128_x4_inc_ctx *state, OQS_SHA3_x4_inc_storage *storage);
+
 /**
  * \brief Four-way parallel SHAKE-128 absorb function.
  * Absorb four input messages of the same length into four parallel states.
@@ -170,6 +181,17 @@ void OQS_SHA3_shake256_x4(
  */
 void OQS_SHA3_shake256_x4_inc_init(OQS_SHA3_shake256_x4_inc_ctx *state);
 
+/**
+ * \brief Initialize the state for four-way parallel incremental SHAKE-256 API using caller-provided storage.
+ *
+ * Equivalent to OQS_SHA3_shake256_x4_inc_init, except that the internal state is placed in
+ * storage instead of being allocated on the heap. The storage must outlive the state.
+ *
+ * \param state The function state to be initialized
+ * \param storage The storage backing the function state
+ */
+void OQS_SHA3_shake256_x4_inc_init_inplace(OQS_SHA3_shake256_x4_inc_ctx *state, OQS_SHA3_x4_inc_storage *storage);
+
 /**
  * \brief Four-way parallel SHAKE-256 absorb function.
  * Absorb four input messages of the same length into four parallel states.
@@ -245,6 +267,294 @@ void OQS_SHA3_shake256_x4_inc_ctx_clone(
  */
 void OQS_SHA3_shake256_x4_inc_ctx_reset(OQS_SHA3_shake256_x4_inc_ctx *state);
 
+/* Eight-way parallel SHAKE */
+
+/**
+ * \brief Seed 8 parallel SHAKE-128 instances, and generate 8 arrays of pseudo-random bytes.
+ *
+ * Uses a vectorized (AVX-512) implementation of SHAKE-128 if available, and
+ * otherwise two calls to OQS_SHA3_shake128_x4.
+ *
+ * \warning The output array length must not be zero.
+ *
+ * \param out0 The first output byte array
+ * \param out1 The second output byte array
+ * \param out2 The third output byte array
+ * \param out3 The fourth output byte array
+ * \param out4 The fifth output byte array
+ * \param out5 The sixth output byte array
+ * \param out6 The seventh output byte array
+ * \param out7 The eighth output byte array
+ * \param outlen The number of output bytes to generate in every output array
+ * \param in0 The first input seed byte array
+ * \param in1 The second input seed byte array
+ * \param in2 The third input seed byte array
+ * \param in3 The fourth input seed byte array
+ * \param in4 The fifth input seed byte array
+ * \param in5 The sixth input seed byte array
+ * \param in6 The seventh input seed byte array
+ * \param in7 The eighth input seed byte array
+ * \param inlen The number of seed bytes to process from every input array
+ */
+void OQS_SHA3_shake128_x8(
+    uint8_t *out0,
+    uint8_t *out1,
+    uint8_t *out2,
+    uint8_t *out3,
+    uint8_t *out4,
+    uint8_t *out5,
+    uint8_t *out6,
+    uint8_t *out7,
+    size_t outlen,
+    const uint8_t *in0,
+    const uint8_t *in1,
+    const uint8_t *in2,
+    const uint8_t *in3,
+    const uint8_t *in4,
+    const uint8_t *in5,
+    const uint8_t *in6,
+    const uint8_t *in7,
+    size_t inlen);
+
+/**
+ * \brief Initialize the state for eight-way parallel incremental SHAKE-128 API.
+ *
+ * \param state The function state to be initialized; must be allocated
+ */
+void OQS_SHA3_shake128_x8_inc_init(OQS_SHA3_shake128_x8_inc_ctx *state);
+
+/**
+ * \brief Eight-way parallel SHAKE-128 absorb function.
+ * Absorb eight input messages of the same length into eight parallel states.
+ *
+ * \warning State must be initialized by the caller.
+ *
+ * \param state The function state; must be initialized
+ * \param in0 The input to be absorbed into the first instance
+ * \param in1 The input to be absorbed into the second instance
+ * \param in2 The input to be absorbed into the third instance
+ * \param in3 The input to be absorbed into the fourth instance
+ * \param in4 The input to be absorbed into the fifth instance
+ * \param in5 The input to be absorbed into the sixth instance
+ * \param in6 The input to be absorbed into the seventh instance
+ * \param in7 The input to be absorbed into the eighth instance
+ * \param inlen The number of bytes to process from each input array
+ */
+void OQS_SHA3_shake128_x8_inc_absorb(
+    OQS_SHA3_shake128_x8_inc_ctx *state,
+    const uint8_t *in0,
+    const uint8_t *in1,
+    const uint8_t *in2,
+    const uint8_t *in3,
+    const uint8_t *in4,
+    const uint8_t *in5,
+    const uint8_t *in6,
+    const uint8_t *in7,
+    size_t inlen);
+
+/**
+ * \brief Eight-way parallel SHAKE-128 finalize function.
+ * Prepares the states for squeezing.
+ *
+ * \param state The function state; must be initialized
+ */
+void OQS_SHA3_shake128_x8_inc_finalize(OQS_SHA3_shake128_x8_inc_ctx *state);
+
+/**
+ * \brief Eight-way parallel SHAKE-128 squeeze function.
+ * Extracts from eight parallel states into eight output buffers
+ *
+ * \param out0 output buffer for the first instance
+ * \param out1 output buffer for the second instance
+ * \param out2 output buffer for the third instance
+ * \param out3 output buffer for the fourth instance
+ * \param out4 output buffer for the fifth instance
+ * \param out5 output buffer for the sixth instance
+ * \param out6 output buffer for the seventh instance
+ * \param out7 output buffer for the eighth instance
+ * \param outlen bytes of output buffer
+ * \param state The function state; must be initialized and finalized
+ */
+void OQS_SHA3_shake128_x8_inc_squeeze(
+    uint8_t *out0,
+    uint8_t *out1,
+    uint8_t *out2,
+    uint8_t *out3,
+    uint8_t *out4,
+    uint8_t *out5,
+    uint8_t *out6,
+    uint8_t *out7,
+    size_t outlen,
+    OQS_SHA3_shake128_x8_inc_ctx *state);
+
+/**
+ * \brief Frees the state for the eight-way parallel incremental SHAKE-128 API.
+ *
+ * \param state The state to free
+ */
+void OQS_SHA3_shake128_x8_inc_ctx_release(OQS_SHA3_shake128_x8_inc_ctx *state);
+
+/**
+ * \brief Copies the state for the eight-way parallel incremental SHAKE-128 API.
+ *
+ * \param dest The state to copy into; must be initialized
+ * \param src The state to copy from; must be initialized
+ */
+void OQS_SHA3_shake128_x8_inc_ctx_clone(
+    OQS_SHA3_shake128_x8_inc_ctx *dest,
+    const OQS_SHA3_shake128_x8_inc_ctx *src);
+
+/**
+ * \brief Resets the state for the eight-way parallel incremental SHAKE-128 API.
+ * Allows a context to be re-used without free and init calls.
+ *
+ * \param state The function state; must be initialized
+ */
+void OQS_SHA3_shake128_x8_inc_ctx_reset(OQS_SHA3_shake128_x8_inc_ctx *state);
+
+/**
+ * \brief Seed 8 parallel SHAKE-256 instances, and generate 8 arrays of pseudo-random bytes.
+ *
+ * Uses a vectorized (AVX-512) implementation of SHAKE-256 if available, and
+ * otherwise two calls to OQS_SHA3_shake256_x4.
+ *
+ * \warning The output array length must not be zero.
+ *
+ * \param out0 The first output byte array
+ * \param out1 The second output byte array
+ * \param out2 The third output byte array
+ * \param out3 The fourth output byte array
+ * \param out4 The fifth output byte array
+ * \param out5 The sixth output byte array
+ * \param out6 The seventh output byte array
+ * \param out7 The eighth output byte array
+ * \param outlen The number of output bytes to generate in every output array
+ * \param in0 The first input seed byte array
+ * \param in1 The second input seed byte array
+ * \param in2 The third input seed byte array
+ * \param in3 The fourth input seed byte array
+ * \param in4 The fifth input seed byte array
+ * \param in5 The sixth input seed byte array
+ * \param in6 The seventh input seed byte array
+ * \param in7 The eighth input seed byte array
+ * \param inlen The number of seed bytes to process from every input array
+ */
+void OQS_SHA3_shake256_x8(
+    uint8_t *out0,
+    uint8_t *out1,
+    uint8_t *out2,
+    uint8_t *out3,
+    uint8_t *out4,
+    uint8_t *out5,
+    uint8_t *out6,
+    uint8_t *out7,
+    size_t outlen,
+    const uint8_t *in0,
+    const uint8_t *in1,
+    const uint8_t *in2,
+    const uint8_t *in3,
+    const uint8_t *in4,
+    const uint8_t *in5,
+    const uint8_t *in6,
+    const uint8_t *in7,
+    size_t inlen);
+
+/**
+ * \brief Initialize the state for eight-way parallel incremental SHAKE-256 API.
+ *
+ * \param state The function state to be initialized; must be allocated
+ */
+void OQS_SHA3_shake256_x8_inc_init(OQS_SHA3_shake256_x8_inc_ctx *state);
+
+/**
+ * \brief Eight-way parallel SHAKE-256 absorb function.
+ * Absorb eight input messages of the same length into eight parallel states.
+ *
+ * \warning State must be initialized by the caller.
+ *
+ * \param state The function state; must be initialized
+ * \param in0 The input to be absorbed into the first instance
+ * \param in1 The input to be absorbed into the second instance
+ * \param in2 The input to be absorbed into the third instance
+ * \param in3 The input to be absorbed into the fourth instance
+ * \param in4 The input to be absorbed into the fifth instance
+ * \param in5 The input to be absorbed into the sixth instance
+ * \param in6 The input to be absorbed into the seventh instance
+ * \param in7 The input to be absorbed into the eighth instance
+ * \param inlen The number of bytes to process from each input array
+ */
+void OQS_SHA3_shake256_x8_inc_absorb(
+    OQS_SHA3_shake256_x8_inc_ctx *state,
+    const uint8_t *in0,
+    const uint8_t *in1,
+    const uint8_t *in2,
+    const uint8_t *in3,
+    const uint8_t *in4,
+    const uint8_t *in5,
+    const uint8_t *in6,
+    const uint8_t *in7,
+    size_t inlen);
+
+/**
+ * \brief Eight-way parallel SHAKE-256 finalize function.
+ * Prepares the states for squeezing.
+ *
+ * \param state The function state; must be initialized
+ */
+void OQS_SHA3_shake256_x8_inc_finalize(OQS_SHA3_shake256_x8_inc_ctx *state);
+
+/**
+ * \brief Eight-way parallel SHAKE-256 squeeze function.
+ * Extracts from eight parallel states into eight output buffers
+ *
+ * \param out0 output buffer for the first instance
+ * \param out1 output buffer for the second instance
+ * \param out2 output buffer for the third instance
+ * \param out3 output buffer for the fourth instance
+ * \param out4 output buffer for the fifth instance
+ * \param out5 output buffer for the sixth instance
+ * \param out6 output buffer for the seventh instance
+ * \param out7 output buffer for the eighth instance
+ * \param outlen bytes of output buffer
+ * \param state The function state; must be initialized and finalized
+ */
+void OQS_SHA3_shake256_x8_inc_squeeze(
+    uint8_t *out0,
+    uint8_t *out1,
+    uint8_t *out2,
+    uint8_t *out3,
+    uint8_t *out4,
+    uint8_t *out5,
+    uint8_t *out6,
+    uint8_t *out7,
+    size_t outlen,
+    OQS_SHA3_shake256_x8_inc_ctx *state);
+
+/**
+ * \brief Frees the state for the eight-way parallel incremental SHAKE-256 API.
+ *
+ * \param state The state to free
+ */
+void OQS_SHA3_shake256_x8_inc_ctx_release(OQS_SHA3_shake256_x8_inc_ctx *state);
+
+/**
+ * \brief Copies the state for the eight-way parallel incremental SHAKE-256 API.
+ *
+ * \param dest The state to copy into; must be initialized
+ * \param src The state to copy from; must be initialized
+ */
+void OQS_SHA3_shake256_x8_inc_ctx_clone(
+    OQS_SHA3_shake256_x8_inc_ctx *dest,
+    const OQS_SHA3_shake256_x8_inc_ctx *src);
+
+/**
+ * \brief Resets the state for the eight-way parallel incremental SHAKE-256 API.
+ * Allows a context to be re-used without free and init calls.
+ *
+ * \param state The function state; must be initialized
+ */
+void OQS_SHA3_shake256_x8_inc_ctx_reset(OQS_SHA3_shake256_x8_inc_ctx *state);
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
@@ -14,6 +14,7 @@
 #include <stdint.h>
 
 #include <oqs/common.h>
+#include <oqs/sha3_ops.h>
 
 #if defined(__cplusplus)
 extern "C" {
@@ -31,6 +32,32 @@ typedef struct {
 	void *ctx;
 } OQS_SHA3_shake256_x4_inc_ctx;
 
+/** Data structure for the state of the eight-way parallel incremental SHAKE-128 API. */
+typedef struct {
+	/** Internal state. */
+	void *ctx;
+} OQS_SHA3_shake128_x8_inc_ctx;
+
+/** Data structure for the state of the eight-way parallel incremental SHAKE-256 API. */
+typedef struct {
+	/** Internal state. */
+	void *ctx;
+} OQS_SHA3_shake256_x8_inc_ctx;
+
+/** Size in bytes of the caller-provided storage for the four-way parallel incremental SHAKE APIs. */
+#define OQS_SHA3_X4_INC_STORAGE_BYTES 832
+
+/**
+ * Caller-provided storage for the state of the four-way parallel incremental SHAKE APIs.
+ *
+ * Passed to the `_inc_init_inplace` functions so that the state can live on the
+ * stack (or inside another structure) instead of being allocated on the heap.
+ */
+typedef struct {
+	/** Internal state. */
+	OQS_SHA3_INC_STORAGE_ALIGNAS uint64_t buf[OQS_SHA3_X4_INC_STORAGE_BYTES / sizeof(uint64_t)];
+} OQS_SHA3_x4_inc_storage;
+
 /** Data structure implemented by cryptographic provider for the
  * four-way parallel incremental SHAKE-256 operations.
  */
@@ -162,6 +189,106 @@ struct OQS_SHA3_x4_callbacks {
 	 * Implementation of function OQS_SHA3_shake256_x4_inc_ctx_reset.
 	 */
 	void (*SHA3_shake256_x4_inc_ctx_reset)(OQS_SHA3_shake256_x4_inc_ctx *state);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake128_x4_inc_init_inplace.
+	 */
+	void (*SHA3_shake128_x4_inc_init_inplace)(OQS_SHA3_shake128_x4_inc_ctx *state, OQS_SHA3_x4_inc_storage *storage);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake256_x4_inc_init_inplace.
+	 */
+	void (*SHA3_shake256_x4_inc_init_inplace)(OQS_SHA3_shake256_x4_inc_ctx *state, OQS_SHA3_x4_inc_storage *storage);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake128_x8.
+	 * May be NULL, in which case two calls to SHA3_shake128_x4 are made.
+	 */
+	void (*SHA3_shake128_x8)(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake256_x8.
+	 * May be NULL, in which case two calls to SHA3_shake256_x4 are made.
+	 */
+	void (*SHA3_shake256_x8)(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake128_x8_inc_init.
+	 * May be NULL, together with the other SHA3_shake128_x8_inc functions, in which
+	 * case the eight-way incremental API runs on two four-way states.
+	 */
+	void (*SHA3_shake128_x8_inc_init)(OQS_SHA3_shake128_x8_inc_ctx *state);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake128_x8_inc_absorb.
+	 */
+	void (*SHA3_shake128_x8_inc_absorb)(OQS_SHA3_shake128_x8_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake128_x8_inc_finalize.
+	 */
+	void (*SHA3_shake128_x8_inc_finalize)(OQS_SHA3_shake128_x8_inc_ctx *state);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake128_x8_inc_squeeze.
+	 */
+	void (*SHA3_shake128_x8_inc_squeeze)(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, OQS_SHA3_shake128_x8_inc_ctx *state);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake128_x8_inc_ctx_release.
+	 */
+	void (*SHA3_shake128_x8_inc_ctx_release)(OQS_SHA3_shake128_x8_inc_ctx *state);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake128_x8_inc_ctx_clone.
+	 */
+	void (*SHA3_shake128_x8_inc_ctx_clone)(
+	    OQS_SHA3_shake128_x8_inc_ctx *dest,
+	    const OQS_SHA3_shake128_x8_inc_ctx *src);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake128_x8_inc_ctx_reset.
+	 */
+	void (*SHA3_shake128_x8_inc_ctx_reset)(OQS_SHA3_shake128_x8_inc_ctx *state);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake256_x8_inc_init.
+	 * May be NULL, together with the other SHA3_shake256_x8_inc functions, in which
+	 * case the eight-way incremental API runs on two four-way states.
+	 */
+	void (*SHA3_shake256_x8_inc_init)(OQS_SHA3_shake256_x8_inc_ctx *state);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake256_x8_inc_absorb.
+	 */
+	void (*SHA3_shake256_x8_inc_absorb)(OQS_SHA3_shake256_x8_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake256_x8_inc_finalize.
+	 */
+	void (*SHA3_shake256_x8_inc_finalize)(OQS_SHA3_shake256_x8_inc_ctx *state);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake256_x8_inc_squeeze.
+	 */
+	void (*SHA3_shake256_x8_inc_squeeze)(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, OQS_SHA3_shake256_x8_inc_ctx *state);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake256_x8_inc_ctx_release.
+	 */
+	void (*SHA3_shake256_x8_inc_ctx_release)(OQS_SHA3_shake256_x8_inc_ctx *state);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake256_x8_inc_ctx_clone.
+	 */
+	void (*SHA3_shake256_x8_inc_ctx_clone)(
+	    OQS_SHA3_shake256_x8_inc_ctx *dest,
+	    const OQS_SHA3_shake256_x8_inc_ctx *src);
+
+	/**
+	 * Implementation of function OQS_SHA3_shake256_x8_inc_ctx_reset.
+	 */
+	void (*SHA3_shake256_x8_inc_ctx_reset)(OQS_SHA3_shake256_x8_inc_ctx *state);
 };
 
 /**
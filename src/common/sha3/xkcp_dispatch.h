@@ -79,4 +79,29 @@ KeccakP1600times4_ExtractBytes, \
 KeccakP1600times4_ExtractBytes_serial, \
 KeccakP1600times4_ExtractBytes_avx2;
 
+typedef void KeccakX8InitFn(void *);
+extern KeccakX8InitFn \
+KeccakP1600times8_InitializeAll, \
+KeccakP1600times8_InitializeAll_avx512;
+
+typedef void KeccakX8AddByteFn(void *, unsigned int, unsigned char, unsigned int);
+extern KeccakX8AddByteFn \
+KeccakP1600times8_AddByte, \
+KeccakP1600times8_AddByte_avx512;
+
+typedef void KeccakX8AddBytesFn(void *, unsigned int, const unsigned char *, unsigned int, unsigned int);
+extern KeccakX8AddBytesFn \
+KeccakP1600times8_AddBytes, \
+KeccakP1600times8_AddBytes_avx512;
+
+typedef void KeccakX8PermuteFn(void *);
+extern KeccakX8PermuteFn \
+KeccakP1600times8_PermuteAll_24rounds, \
+KeccakP1600times8_PermuteAll_24rounds_avx512;
+
+typedef void KeccakX8ExtractBytesFn(const void *, unsigned int, unsigned char *, unsigned int, unsigned int);
+extern KeccakX8ExtractBytesFn \
+KeccakP1600times8_ExtractBytes, \
+KeccakP1600times8_ExtractBytes_avx512;
+
 #endif // OQS_SHA3_XKCP_DISPATCH_H
@@ -0,0 +1,261 @@
+/*
+The Keccak-p permutations, designed by Guido Bertoni, Joan Daemen, Michaël Peeters and Gilles Van Assche.
+
+For more information, feedback or questions, please refer to the Keccak Team website:
+https://keccak.team/
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+---
+
+This file implements Keccak-p[1600]×8 in a PlSnP-compatible way, with one
+instance in each 64-bit element of a 512-bit AVX-512 register. The state of
+lane (x, y) of all eight instances is stored contiguously, as in the 256-bit
+times4 implementation.
+
+This implementation comes with KeccakP-1600-times8-SnP.h in the same folder.
+*/
+
+#include <immintrin.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "KeccakP-1600-times8-SnP.h"
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#error Expecting a little-endian platform
+#endif
+
+typedef __m512i V512;
+
+#define laneIndex(instanceIndex, lanePosition) ((lanePosition)*8 + instanceIndex)
+
+#define SnP_laneLengthInBytes 8
+
+#define CONST512_64(a)          _mm512_set1_epi64((long long)(a))
+#define LOAD512u(a)             _mm512_loadu_si512((const void *)&(a))
+#define STORE512u(a, b)         _mm512_storeu_si512((void *)&(a), b)
+#define XOR(a, b)               _mm512_xor_si512(a, b)
+#define XOR3(a, b, c)           _mm512_ternarylogic_epi64(a, b, c, 0x96)
+#define ROL(a, o)               _mm512_rol_epi64(a, o)
+/* a ^ (~b & c) */
+#define CHI(a, b, c)            _mm512_ternarylogic_epi64(a, b, c, 0xD2)
+
+static const uint64_t KeccakF1600RoundConstants[24] = {
+	0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+	0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+	0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+	0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+	0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+	0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+	0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+	0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+void KeccakP1600times8_InitializeAll(void *states) {
+	memset(states, 0, KeccakP1600times8_statesSizeInBytes_avx512);
+}
+
+void KeccakP1600times8_AddByte(void *states, unsigned int instanceIndex, unsigned char byte, unsigned int offset) {
+	((unsigned char *)states)[instanceIndex * 8 + (offset / 8) * 8 * 8 + offset % 8] ^= byte;
+}
+
+void KeccakP1600times8_AddBytes(void *states, unsigned int instanceIndex, const unsigned char *data, unsigned int offset, unsigned int length) {
+	unsigned int sizeLeft = length;
+	unsigned int lanePosition = offset / SnP_laneLengthInBytes;
+	unsigned int offsetInLane = offset % SnP_laneLengthInBytes;
+	unsigned int bytesInLane;
+	const unsigned char *curData = data;
+	uint64_t *statesAsLanes = (uint64_t *)states;
+	uint64_t lane;
+
+	if ((sizeLeft > 0) && (offsetInLane != 0)) {
+		bytesInLane = SnP_laneLengthInBytes - offsetInLane;
+		if (bytesInLane > sizeLeft) {
+			bytesInLane = sizeLeft;
+		}
+		lane = 0;
+		memcpy((unsigned char *)&lane + offsetInLane, curData, bytesInLane);
+		statesAsLanes[laneIndex(instanceIndex, lanePosition)] ^= lane;
+		sizeLeft -= bytesInLane;
+		lanePosition++;
+		curData += bytesInLane;
+	}
+
+	while (sizeLeft >= SnP_laneLengthInBytes) {
+		memcpy(&lane, curData, SnP_laneLengthInBytes);
+		statesAsLanes[laneIndex(instanceIndex, lanePosition)] ^= lane;
+		sizeLeft -= SnP_laneLengthInBytes;
+		lanePosition++;
+		curData += SnP_laneLengthInBytes;
+	}
+
+	if (sizeLeft > 0) {
+		lane = 0;
+		memcpy(&lane, curData, sizeLeft);
+		statesAsLanes[laneIndex(instanceIndex, lanePosition)] ^= lane;
+	}
+}
+
+void KeccakP1600times8_PermuteAll_24rounds(void *states) {
+	V512 *statesAsLanes = (V512 *)states;
+	V512 A00, A01, A02, A03, A04, A05, A06, A07, A08, A09, A10, A11, A12;
+	V512 A13, A14, A15, A16, A17, A18, A19, A20, A21, A22, A23, A24;
+	V512 B00, B01, B02, B03, B04, B05, B06, B07, B08, B09, B10, B11, B12;
+	V512 B13, B14, B15, B16, B17, B18, B19, B20, B21, B22, B23, B24;
+	V512 C0, C1, C2, C3, C4, D0, D1, D2, D3, D4;
+	unsigned int i;
+
+	A00 = LOAD512u(statesAsLanes[0]);
+	A01 = LOAD512u(statesAsLanes[1]);
+	A02 = LOAD512u(statesAsLanes[2]);
+	A03 = LOAD512u(statesAsLanes[3]);
+	A04 = LOAD512u(statesAsLanes[4]);
+	A05 = LOAD512u(statesAsLanes[5]);
+	A06 = LOAD512u(statesAsLanes[6]);
+	A07 = LOAD512u(statesAsLanes[7]);
+	A08 = LOAD512u(statesAsLanes[8]);
+	A09 = LOAD512u(statesAsLanes[9]);
+	A10 = LOAD512u(statesAsLanes[10]);
+	A11 = LOAD512u(statesAsLanes[11]);
+	A12 = LOAD512u(statesAsLanes[12]);
+	A13 = LOAD512u(statesAsLanes[13]);
+	A14 = LOAD512u(statesAsLanes[14]);
+	A15 = LOAD512u(statesAsLanes[15]);
+	A16 = LOAD512u(statesAsLanes[16]);
+	A17 = LOAD512u(statesAsLanes[17]);
+	A18 = LOAD512u(statesAsLanes[18]);
+	A19 = LOAD512u(statesAsLanes[19]);
+	A20 = LOAD512u(statesAsLanes[20]);
+	A21 = LOAD512u(statesAsLanes[21]);
+	A22 = LOAD512u(statesAsLanes[22]);
+	A23 = LOAD512u(statesAsLanes[23]);
+	A24 = LOAD512u(statesAsLanes[24]);
+
+	for (i = 0; i < 24; i++) {
+		C0 = XOR3(XOR3(A00, A05, A10), A15, A20);
+		C1 = XOR3(XOR3(A01, A06, A11), A16, A21);
+		C2 = XOR3(XOR3(A02, A07, A12), A17, A22);
+		C3 = XOR3(XOR3(A03, A08, A13), A18, A23);
+		C4 = XOR3(XOR3(A04, A09, A14), A19, A24);
+		D0 = XOR(C4, ROL(C1, 1));
+		D1 = XOR(C0, ROL(C2, 1));
+		D2 = XOR(C1, ROL(C3, 1));
+		D3 = XOR(C2, ROL(C4, 1));
+		D4 = XOR(C3, ROL(C0, 1));
+		B00 = XOR(A00, D0);
+		B10 = ROL(XOR(A01, D1), 1);
+		B20 = ROL(XOR(A02, D2), 62);
+		B05 = ROL(XOR(A03, D3), 28);
+		B15 = ROL(XOR(A04, D4), 27);
+		B16 = ROL(XOR(A05, D0), 36);
+		B01 = ROL(XOR(A06, D1), 44);
+		B11 = ROL(XOR(A07, D2), 6);
+		B21 = ROL(XOR(A08, D3), 55);
+		B06 = ROL(XOR(A09, D4), 20);
+		B07 = ROL(XOR(A10, D0), 3);
+		B17 = ROL(XOR(A11, D1), 10);
+		B02 = ROL(XOR(A12, D2), 43);
+		B12 = ROL(XOR(A13, D3), 25);
+		B22 = ROL(XOR(A14, D4), 39);
+		B23 = ROL(XOR(A15, D0), 41);
+		B08 = ROL(XOR(A16, D1), 45);
+		B18 = ROL(XOR(A17, D2), 15);
+		B03 = ROL(XOR(A18, D3), 21);
+		B13 = ROL(XOR(A19, D4), 8);
+		B14 = ROL(XOR(A20, D0), 18);
+		B24 = ROL(XOR(A21, D1), 2);
+		B09 = ROL(XOR(A22, D2), 61);
+		B19 = ROL(XOR(A23, D3), 56);
+		B04 = ROL(XOR(A24, D4), 14);
+		A00 = CHI(B00, B01, B02);
+		A01 = CHI(B01, B02, B03);
+		A02 = CHI(B02, B03, B04);
+		A03 = CHI(B03, B04, B00);
+		A04 = CHI(B04, B00, B01);
+		A05 = CHI(B05, B06, B07);
+		A06 = CHI(B06, B07, B08);
+		A07 = CHI(B07, B08, B09);
+		A08 = CHI(B08, B09, B05);
+		A09 = CHI(B09, B05, B06);
+		A10 = CHI(B10, B11, B12);
+		A11 = CHI(B11, B12, B13);
+		A12 = CHI(B12, B13, B14);
+		A13 = CHI(B13, B14, B10);
+		A14 = CHI(B14, B10, B11);
+		A15 = CHI(B15, B16, B17);
+		A16 = CHI(B16, B17, B18);
+		A17 = CHI(B17, B18, B19);
+		A18 = CHI(B18, B19, B15);
+		A19 = CHI(B19, B15, B16);
+		A20 = CHI(B20, B21, B22);
+		A21 = CHI(B21, B22, B23);
+		A22 = CHI(B22, B23, B24);
+		A23 = CHI(B23, B24, B20);
+		A24 = CHI(B24, B20, B21);
+		A00 = XOR(A00, CONST512_64(KeccakF1600RoundConstants[i]));
+	}
+
+	STORE512u(statesAsLanes[0], A00);
+	STORE512u(statesAsLanes[1], A01);
+	STORE512u(statesAsLanes[2], A02);
+	STORE512u(statesAsLanes[3], A03);
+	STORE512u(statesAsLanes[4], A04);
+	STORE512u(statesAsLanes[5], A05);
+	STORE512u(statesAsLanes[6], A06);
+	STORE512u(statesAsLanes[7], A07);
+	STORE512u(statesAsLanes[8], A08);
+	STORE512u(statesAsLanes[9], A09);
+	STORE512u(statesAsLanes[10], A10);
+	STORE512u(statesAsLanes[11], A11);
+	STORE512u(statesAsLanes[12], A12);
+	STORE512u(statesAsLanes[13], A13);
+	STORE512u(statesAsLanes[14], A14);
+	STORE512u(statesAsLanes[15], A15);
+	STORE512u(statesAsLanes[16], A16);
+	STORE512u(statesAsLanes[17], A17);
+	STORE512u(statesAsLanes[18], A18);
+	STORE512u(statesAsLanes[19], A19);
+	STORE512u(statesAsLanes[20], A20);
+	STORE512u(statesAsLanes[21], A21);
+	STORE512u(statesAsLanes[22], A22);
+	STORE512u(statesAsLanes[23], A23);
+	STORE512u(statesAsLanes[24], A24);
+}
+
+void KeccakP1600times8_ExtractBytes(const void *states, unsigned int instanceIndex, unsigned char *data, unsigned int offset, unsigned int length) {
+	unsigned int sizeLeft = length;
+	unsigned int lanePosition = offset / SnP_laneLengthInBytes;
+	unsigned int offsetInLane = offset % SnP_laneLengthInBytes;
+	unsigned int bytesInLane;
+	unsigned char *curData = data;
+	const uint64_t *statesAsLanes = (const uint64_t *)states;
+	uint64_t lane;
+
+	if ((sizeLeft > 0) && (offsetInLane != 0)) {
+		bytesInLane = SnP_laneLengthInBytes - offsetInLane;
+		if (bytesInLane > sizeLeft) {
+			bytesInLane = sizeLeft;
+		}
+		lane = statesAsLanes[laneIndex(instanceIndex, lanePosition)];
+		memcpy(curData, (const unsigned char *)&lane + offsetInLane, bytesInLane);
+		sizeLeft -= bytesInLane;
+		lanePosition++;
+		curData += bytesInLane;
+	}
+
+	while (sizeLeft >= SnP_laneLengthInBytes) {
+		lane = statesAsLanes[laneIndex(instanceIndex, lanePosition)];
+		memcpy(curData, &lane, SnP_laneLengthInBytes);
+		sizeLeft -= SnP_laneLengthInBytes;
+		lanePosition++;
+		curData += SnP_laneLengthInBytes;
+	}
+
+	if (sizeLeft > 0) {
+		lane = statesAsLanes[laneIndex(instanceIndex, lanePosition)];
+		memcpy(curData, &lane, sizeLeft);
+	}
+}
@@ -26,6 +26,11 @@
 #define KECCAK_CTX_BYTES (KECCAK_CTX_ALIGNMENT * \
   ((_KECCAK_CTX_BYTES + KECCAK_CTX_ALIGNMENT - 1)/KECCAK_CTX_ALIGNMENT))
 
+/* The padding after the Keccak state records whether the context was
+ * allocated by inc_init (and must be freed) or lives in caller storage. */
+#define KECCAK_CTX_INPLACE_FLAG 26
+#define KECCAK_CTX_INPLACE 0x5053
+
 #if OQS_USE_PTHREADS
 static pthread_once_t dispatch_once_control = PTHREAD_ONCE_INIT;
 #endif
@@ -188,21 +193,64 @@ static void keccak_inc_squeeze(uint8_t *h, size_t outlen,
 	s[25] -= outlen;
 }
 
+/*************************************************
+ * Name:        keccak_inc_ctx_new
+ *
+ * Description: Sets up the incremental Keccak state, either in
+ *              caller-provided storage or on the heap.
+ *
+ * Arguments:   - OQS_SHA3_inc_storage *storage: caller storage, or NULL
+ *                to allocate the state
+ *
+ * Returns pointer to the initialized incremental state.
+ **************************************************/
+static uint64_t *keccak_inc_ctx_new(OQS_SHA3_inc_storage *storage) {
+	uint64_t *s;
+	if (storage == NULL) {
+		s = OQS_MEM_aligned_alloc(KECCAK_CTX_ALIGNMENT, KECCAK_CTX_BYTES);
+		OQS_EXIT_IF_NULLPTR(s, "SHA3");
+		s[KECCAK_CTX_INPLACE_FLAG] = 0;
+	} else {
+		s = storage->buf;
+		s[KECCAK_CTX_INPLACE_FLAG] = KECCAK_CTX_INPLACE;
+	}
+	keccak_inc_reset(s);
+	return s;
+}
+
+/*************************************************
+ * Name:        keccak_inc_ctx_free
+ *
+ * Description: Releases an incremental Keccak state set up by
+ *              keccak_inc_ctx_new. Caller storage is zeroized, not freed.
+ *
+ * Arguments:   - uint64_t *s: pointer to incremental state
+ **************************************************/
+static void keccak_inc_ctx_free(uint64_t *s) {
+	if (s[KECCAK_CTX_INPLACE_FLAG] == KECCAK_CTX_INPLACE) {
+		OQS_MEM_cleanse(s, KECCAK_CTX_BYTES);
+	} else {
+		OQS_MEM_aligned_free(s);
+	}
+}
+
 /* SHA3-256 */
 
 static void SHA3_sha3_256(uint8_t *output, const uint8_t *input, size_t inlen) {
 	OQS_SHA3_sha3_256_inc_ctx s;
-	OQS_SHA3_sha3_256_inc_init(&s);
+	OQS_SHA3_inc_storage storage;
+	OQS_SHA3_sha3_256_inc_init_inplace(&s, &storage);
 	OQS_SHA3_sha3_256_inc_absorb(&s, input, inlen);
 	OQS_SHA3_sha3_256_inc_finalize(output, &s);
 	OQS_SHA3_sha3_256_inc_ctx_release(&s);
 }
 
 static void SHA3_sha3_256_inc_init(OQS_SHA3_sha3_256_inc_ctx *state) {
-	state->ctx = OQS_MEM_aligned_alloc(KECCAK_CTX_ALIGNMENT, KECCAK_CTX_BYTES);
+	state->ctx = keccak_inc_ctx_new(NULL);
+}
 
-	OQS_EXIT_IF_NULLPTR(state->ctx, "SHA3");
-	keccak_inc_reset((uint64_t *)state->ctx);
+static void SHA3_sha3_256_inc_init_inplace(OQS_SHA3_sha3_256_inc_ctx *state, OQS_SHA3_inc_storage *storage) {
+	state->ctx = keccak_inc_ctx_new(storage);
 }
 
 static void SHA3_sha3_256_inc_absorb(OQS_SHA3_sha3_256_inc_ctx *state, const uint8_t *input, size_t inlen) {
@@ -215,11 +263,11 @@ static void SHA3_sha3_256_inc_finalize(uint8_t *output, OQS_SHA3_sha3_256_inc_ct
 }
 
 static void SHA3_sha3_256_inc_ctx_release(OQS_SHA3_sha3_256_inc_ctx *state) {
-	OQS_MEM_aligned_free(state->ctx);
+	keccak_inc_ctx_free((uint64_t *)state->ctx);
 }
 
 static void SHA3_sha3_256_inc_ctx_clone(OQS_SHA3_sha3_256_inc_ctx *dest, const OQS_SHA3_sha3_256_inc_ctx *src) {
-	memcpy(dest->ctx, src->ctx, KECCAK_CTX_BYTES);
+	memcpy(dest->ctx, src->ctx, _KECCAK_CTX_BYTES);
 }
 
 static void SHA3_sha3_256_inc_ctx_reset(OQS_SHA3_sha3_256_inc_ctx *state) {
@@ -230,16 +278,19 @@ static void SHA3_sha3_256_inc_ctx_reset(OQS_SHA3_sha3_256_inc_ctx *state) {
 
 static void SHA3_sha3_384(uint8_t *output, const uint8_t *input, size_t inlen) {
 	OQS_SHA3_sha3_384_inc_ctx s;
-	OQS_SHA3_sha3_384_inc_init(&s);
+	OQS_SHA3_inc_storage storage;
+	OQS_SHA3_sha3_384_inc_init_inplace(&s, &storage);
 	OQS_SHA3_sha3_384_inc_absorb(&s, input, inlen);
 	OQS_SHA3_sha3_384_inc_finalize(output, &s);
 	OQS_SHA3_sha3_384_inc_ctx_release(&s);
 }
 
 static void SHA3_sha3_384_inc_init(OQS_SHA3_sha3_384_inc_ctx *state) {
-	state->ctx = OQS_MEM_aligned_alloc(KECCAK_CTX_ALIGNMENT, KECCAK_CTX_BYTES);
-	OQS_EXIT_IF_NULLPTR(state->ctx, "SHA3");
-	keccak_inc_reset((uint64_t *)state->ctx);
+	state->ctx = keccak_inc_ctx_new(NULL);
+}
+
+static void SHA3_sha3_384_inc_init_inplace(OQS_SHA3_sha3_384_inc_ctx *state, OQS_SHA3_inc_storage *storage) {
+	state->ctx = keccak_inc_ctx_new(storage);
 }
 static void SHA3_sha3_384_inc_absorb(OQS_SHA3_sha3_384_inc_ctx *state, const uint8_t *input, size_t inlen) {
 	keccak_inc_absorb((uint64_t *)state->ctx, OQS_SHA3_SHA3_384_RATE, input, inlen);
@@ -251,11 +302,11 @@ static void SHA3_sha3_384_inc_finalize(uint8_t *output, OQS_SHA3_sha3_384_inc_ct
 }
 
 static void SHA3_sha3_384_inc_ctx_release(OQS_SHA3_sha3_384_inc_ctx *state) {
-	OQS_MEM_aligned_free(state->ctx);
+	keccak_inc_ctx_free((uint64_t *)state->ctx);
 }
 
 static void SHA3_sha3_384_inc_ctx_clone(OQS_SHA3_sha3_384_inc_ctx *dest, const OQS_SHA3_sha3_384_inc_ctx *src) {
-	memcpy(dest->ctx, src->ctx, KECCAK_CTX_BYTES);
+	memcpy(dest->ctx, src->ctx, _KECCAK_CTX_BYTES);
 }
 
 static void SHA3_sha3_384_inc_ctx_reset(OQS_SHA3_sha3_384_inc_ctx *state) {
@@ -266,16 +317,19 @@ static void SHA3_sha3_384_inc_ctx_reset(OQS_SHA3_sha3_384_inc_ctx *state) {
 
 static void SHA3_sha3_512(uint8_t *output, const uint8_t *input, size_t inlen) {
 	OQS_SHA3_sha3_512_inc_ctx s;
-	OQS_SHA3_sha3_512_inc_init(&s);
+	OQS_SHA3_inc_storage storage;
+	OQS_SHA3_sha3_512_inc_init_inplace(&s, &storage);
 	OQS_SHA3_sha3_512_inc_absorb(&s, input, inlen);
 	OQS_SHA3_sha3_512_inc_finalize(output, &s);
 	OQS_SHA3_sha3_512_inc_ctx_release(&s);
 }
 
 static void SHA3_sha3_512_inc_init(OQS_SHA3_sha3_512_inc_ctx *state) {
-	state->ctx = OQS_MEM_aligned_alloc(KECCAK_CTX_ALIGNMENT, KECCAK_CTX_BYTES);
-	OQS_EXIT_IF_NULLPTR(state->ctx, "SHA3");
-	keccak_inc_reset((uint64_t *)state->ctx);
+	state->ctx = keccak_inc_ctx_new(NULL);
+}
+
+static void SHA3_sha3_512_inc_init_inplace(OQS_SHA3_sha3_512_inc_ctx *state, OQS_SHA3_inc_storage *storage) {
+	state->ctx = keccak_inc_ctx_new(storage);
 }
 
 static void SHA3_sha3_512_inc_absorb(OQS_SHA3_sha3_512_inc_ctx *state, const uint8_t *input, size_t inlen) {
@@ -288,11 +342,11 @@ static void SHA3_sha3_512_inc_finalize(uint8_t *output, OQS_SHA3_sha3_512_inc_ct
 }
 
 static void SHA3_sha3_512_inc_ctx_release(OQS_SHA3_sha3_512_inc_ctx *state) {
-	OQS_MEM_aligned_free(state->ctx);
+	keccak_inc_ctx_free((uint64_t *)state->ctx);
 }
 
 static void SHA3_sha3_512_inc_ctx_clone(OQS_SHA3_sha3_512_inc_ctx *dest, const OQS_SHA3_sha3_512_inc_ctx *src) {
-	memcpy(dest->ctx, src->ctx, KECCAK_CTX_BYTES);
+	memcpy(dest->ctx, src->ctx, _KECCAK_CTX_BYTES);
 }
 
 static void SHA3_sha3_512_inc_ctx_reset(OQS_SHA3_sha3_512_inc_ctx *state) {
@@ -303,7 +357,8 @@ static void SHA3_sha3_512_inc_ctx_reset(OQS_SHA3_sha3_512_inc_ctx *state) {
 
 static void SHA3_shake128(uint8_t *output, size_t outlen, const uint8_t *input, size_t inlen) {
 	OQS_SHA3_shake128_inc_ctx s;
-	OQS_SHA3_shake128_inc_init(&s);
+	OQS_SHA3_inc_storage storage;
+	OQS_SHA3_shake128_inc_init_inplace(&s, &storage);
 	OQS_SHA3_shake128_inc_absorb(&s, input, inlen);
 	OQS_SHA3_shake128_inc_finalize(&s);
 	OQS_SHA3_shake128_inc_squeeze(output, outlen, &s);
@@ -313,9 +368,11 @@ static void SHA3_shake128(uint8_t *output, size_t outlen, const uint8_t *input,
 /* SHAKE128 incremental */
 
 static void SHA3_shake128_inc_init(OQS_SHA3_shake128_inc_ctx *state) {
-	state->ctx = OQS_MEM_aligned_alloc(KECCAK_CTX_ALIGNMENT, KECCAK_CTX_BYTES);
-	OQS_EXIT_IF_NULLPTR(state->ctx, "SHA3");
-	keccak_inc_reset((uint64_t *)state->ctx);
+	state->ctx = keccak_inc_ctx_new(NULL);
+}
+
+static void SHA3_shake128_inc_init_inplace(OQS_SHA3_shake128_inc_ctx *state, OQS_SHA3_inc_storage *storage) {
+	state->ctx = keccak_inc_ctx_new(storage);
 }
 
 static void SHA3_shake128_inc_absorb(OQS_SHA3_shake128_inc_ctx *state, const uint8_t *input, size_t inlen) {
@@ -331,11 +388,11 @@ static void SHA3_shake128_inc_squeeze(uint8_t *output, size_t outlen, OQS_SHA3_s
 }
 
 static void SHA3_shake128_inc_ctx_clone(OQS_SHA3_shake128_inc_ctx *dest, const OQS_SHA3_shake128_inc_ctx *src) {
-	memcpy(dest->ctx, src->ctx, KECCAK_CTX_BYTES);
+	memcpy(dest->ctx, src->ctx, _KECCAK_CTX_BYTES);
 }
 
 static void SHA3_shake128_inc_ctx_release(OQS_SHA3_shake128_inc_ctx *state) {
-	OQS_MEM_aligned_free(state->ctx);
+	keccak_inc_ctx_free((uint64_t *)state->ctx);
 }
 
 static void SHA3_shake128_inc_ctx_reset(OQS_SHA3_shake128_inc_ctx *state) {
@@ -346,7 +403,8 @@ static void SHA3_shake128_inc_ctx_reset(OQS_SHA3_shake128_inc_ctx *state) {
 
 static void SHA3_shake256(uint8_t *output, size_t outlen, const uint8_t *input, size_t inlen) {
 	OQS_SHA3_shake256_inc_ctx s;
-	OQS_SHA3_shake256_inc_init(&s);
+	OQS_SHA3_inc_storage storage;
+	OQS_SHA3_shake256_inc_init_inplace(&s, &storage);
 	OQS_SHA3_shake256_inc_absorb(&s, input, inlen);
 	OQS_SHA3_shake256_inc_finalize(&s);
 	OQS_SHA3_shake256_inc_squeeze(output, outlen, &s);
@@ -356,9 +414,11 @@ static void SHA3_shake256(uint8_t *output, size_t outlen, const uint8_t *input,
 /* SHAKE256 incremental */
 
 static void SHA3_shake256_inc_init(OQS_SHA3_shake256_inc_ctx *state) {
-	state->ctx = OQS_MEM_aligned_alloc(KECCAK_CTX_ALIGNMENT, KECCAK_CTX_BYTES);
-	OQS_EXIT_IF_NULLPTR(state->ctx, "SHA3");
-	keccak_inc_reset((uint64_t *)state->ctx);
+	state->ctx = keccak_inc_ctx_new(NULL);
+}
+
+static void SHA3_shake256_inc_init_inplace(OQS_SHA3_shake256_inc_ctx *state, OQS_SHA3_inc_storage *storage) {
+	state->ctx = keccak_inc_ctx_new(storage);
 }
 
 static void SHA3_shake256_inc_absorb(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *input, size_t inlen) {
@@ -374,11 +434,11 @@ static void SHA3_shake256_inc_squeeze(uint8_t *output, size_t outlen, OQS_SHA3_s
 }
 
 static void SHA3_shake256_inc_ctx_release(OQS_SHA3_shake256_inc_ctx *state) {
-	OQS_MEM_aligned_free(state->ctx);
+	keccak_inc_ctx_free((uint64_t *)state->ctx);
 }
 
 static void SHA3_shake256_inc_ctx_clone(OQS_SHA3_shake256_inc_ctx *dest, const OQS_SHA3_shake256_inc_ctx *src) {
-	memcpy(dest->ctx, src->ctx, KECCAK_CTX_BYTES);
+	memcpy(dest->ctx, src->ctx, _KECCAK_CTX_BYTES);
 }
 
 static void SHA3_shake256_inc_ctx_reset(OQS_SHA3_shake256_inc_ctx *state) {
@@ -425,4 +485,9 @@ struct OQS_SHA3_callbacks sha3_default_callbacks = {
 	SHA3_shake256_inc_ctx_release,
 	SHA3_shake256_inc_ctx_clone,
 	SHA3_shake256_inc_ctx_reset,
+	SHA3_sha3_256_inc_init_inplace,
+	SHA3_sha3_384_inc_init_inplace,
+	SHA3_sha3_512_inc_init_inplace,
+	SHA3_shake128_inc_init_inplace,
+	SHA3_shake256_inc_init_inplace,
 };
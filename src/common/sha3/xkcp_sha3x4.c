@@ -21,16 +21,43 @@
 #define KECCAK_X4_CTX_BYTES (KECCAK_X4_CTX_ALIGNMENT * \
   ((_KECCAK_X4_CTX_BYTES + KECCAK_X4_CTX_ALIGNMENT - 1)/KECCAK_X4_CTX_ALIGNMENT))
 
+#define KECCAK_X4_CTX_WORDS (KECCAK_X4_CTX_BYTES / sizeof(uint64_t))
+
+/* An eight-way context holds the eight-way Keccak state (1600 bytes) followed
+ * by the absorb/squeeze position, or, when no eight-way permutation is
+ * available, two four-way contexts; the latter is the larger of the two. */
+#define KECCAK_X8_CTX_ALIGNMENT 64
+#define KECCAK_X8_CTX_BYTES (2*KECCAK_X4_CTX_BYTES)
+
+/* The padding after the Keccak state records whether the context was
+ * allocated by inc_init (and must be freed) or lives in caller storage. */
+#define KECCAK_X4_CTX_INPLACE_FLAG 101
+#define KECCAK_X4_CTX_INPLACE 0x5053
+
 #if OQS_USE_PTHREADS
 static pthread_once_t dispatch_once_control = PTHREAD_ONCE_INIT;
 #endif
 
+#if OQS_USE_PTHREADS
+static pthread_once_t dispatch_x8_once_control = PTHREAD_ONCE_INIT;
+#else
+static int dispatch_x8_done = 0;
+#endif
+
 static KeccakX4InitFn *Keccak_X4_Initialize_ptr = NULL;
 static KeccakX4AddByteFn *Keccak_X4_AddByte_ptr = NULL;
 static KeccakX4AddBytesFn *Keccak_X4_AddBytes_ptr = NULL;
 static KeccakX4PermuteFn *Keccak_X4_Permute_ptr = NULL;
 static KeccakX4ExtractBytesFn *Keccak_X4_ExtractBytes_ptr = NULL;
 
+/* The eight-way functions stay NULL when no eight-way backend is usable; the
+ * x8 API then falls back to two calls to the four-way code. */
+static KeccakX8InitFn *Keccak_X8_Initialize_ptr = NULL;
+static KeccakX8AddByteFn *Keccak_X8_AddByte_ptr = NULL;
+static KeccakX8AddBytesFn *Keccak_X8_AddBytes_ptr = NULL;
+static KeccakX8PermuteFn *Keccak_X8_Permute_ptr = NULL;
+static KeccakX8ExtractBytesFn *Keccak_X8_ExtractBytes_ptr = NULL;
+
 static void Keccak_X4_Dispatch(void) {
 // TODO: Simplify this when we have a Windows-compatible AVX2 implementation of SHA3
 #if defined(OQS_DIST_X86_64_BUILD)
@@ -64,6 +91,29 @@ static void Keccak_X4_Dispatch(void) {
 #endif
 }
 
+static void Keccak_X8_Dispatch(void) {
+#if defined(OQS_ENABLE_SHA3_xkcp_low_avx512)
+#if defined(OQS_DIST_X86_64_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX512)) {
+		Keccak_X8_Initialize_ptr = &KeccakP1600times8_InitializeAll_avx512;
+		Keccak_X8_AddByte_ptr = &KeccakP1600times8_AddByte_avx512;
+		Keccak_X8_AddBytes_ptr = &KeccakP1600times8_AddBytes_avx512;
+		Keccak_X8_Permute_ptr = &KeccakP1600times8_PermuteAll_24rounds_avx512;
+		Keccak_X8_ExtractBytes_ptr = &KeccakP1600times8_ExtractBytes_avx512;
+	}
+#else
+	Keccak_X8_Initialize_ptr = &KeccakP1600times8_InitializeAll;
+	Keccak_X8_AddByte_ptr = &KeccakP1600times8_AddByte;
+	Keccak_X8_AddBytes_ptr = &KeccakP1600times8_AddBytes;
+	Keccak_X8_Permute_ptr = &KeccakP1600times8_PermuteAll_24rounds;
+	Keccak_X8_ExtractBytes_ptr = &KeccakP1600times8_ExtractBytes;
+#endif
+#endif
+#if !OQS_USE_PTHREADS
+	dispatch_x8_done = 1;
+#endif
+}
+
 static void keccak_x4_inc_reset(uint64_t *s) {
 #if OQS_USE_PTHREADS
 	pthread_once(&dispatch_once_control, Keccak_X4_Dispatch);
@@ -76,6 +126,28 @@ static void keccak_x4_inc_reset(uint64_t *s) {
 	s[100] = 0;
 }
 
+static uint64_t *keccak_x4_inc_ctx_new(OQS_SHA3_x4_inc_storage *storage) {
+	uint64_t *s;
+	if (storage == NULL) {
+		s = OQS_MEM_aligned_alloc(KECCAK_X4_CTX_ALIGNMENT, KECCAK_X4_CTX_BYTES);
+		OQS_EXIT_IF_NULLPTR(s, "SHA3x4");
+		s[KECCAK_X4_CTX_INPLACE_FLAG] = 0;
+	} else {
+		s = storage->buf;
+		s[KECCAK_X4_CTX_INPLACE_FLAG] = KECCAK_X4_CTX_INPLACE;
+	}
+	keccak_x4_inc_reset(s);
+	return s;
+}
+
+static void keccak_x4_inc_ctx_free(uint64_t *s) {
+	if (s[KECCAK_X4_CTX_INPLACE_FLAG] == KECCAK_X4_CTX_INPLACE) {
+		OQS_MEM_cleanse(s, KECCAK_X4_CTX_BYTES);
+	} else {
+		OQS_MEM_aligned_free(s);
+	}
+}
+
 static void keccak_x4_inc_absorb(uint64_t *s, uint32_t r,
                                  const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
 	uint64_t c = r - s[100];
@@ -157,7 +229,8 @@ static void keccak_x4_inc_squeeze(uint8_t *out0, uint8_t *out1, uint8_t *out2, u
 
 static void SHA3_shake128_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
 	OQS_SHA3_shake128_x4_inc_ctx s;
-	OQS_SHA3_shake128_x4_inc_init(&s);
+	OQS_SHA3_x4_inc_storage storage;
+	OQS_SHA3_shake128_x4_inc_init_inplace(&s, &storage);
 	OQS_SHA3_shake128_x4_inc_absorb(&s, in0, in1, in2, in3, inlen);
 	OQS_SHA3_shake128_x4_inc_finalize(&s);
 	OQS_SHA3_shake128_x4_inc_squeeze(out0, out1, out2, out3, outlen, &s);
@@ -167,10 +240,13 @@ static void SHA3_shake128_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_
 /* SHAKE128 incremental */
 
 static void SHA3_shake128_x4_inc_init(OQS_SHA3_shake128_x4_inc_ctx *state) {
-	state->ctx = OQS_MEM_aligned_alloc(KECCAK_X4_CTX_ALIGNMENT, KECCAK_X4_CTX_BYTES);
-	OQS_EXIT_IF_NULLPTR(state->ctx, "SHA3x4");
-	keccak_x4_inc_reset((uint64_t *)state->ctx);
+	state->ctx = keccak_x4_inc_ctx_new(NULL);
+}
+
+static void SHA3_shake128_x4_inc_init_inplace(OQS_SHA3_shake128_x4_inc_ctx *state, OQS_SHA3_x4_inc_storage *storage) {
+	state->ctx = keccak_x4_inc_ctx_new(storage);
 }
+
 static void SHA3_shake128_x4_inc_absorb(OQS_SHA3_shake128_x4_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
 	keccak_x4_inc_absorb((uint64_t *)state->ctx, OQS_SHA3_SHAKE128_RATE, in0, in1, in2, in3, inlen);
 }
@@ -184,11 +260,11 @@ static void SHA3_shake128_x4_inc_squeeze(uint8_t *out0, uint8_t *out1, uint8_t *
 }
 
 static void SHA3_shake128_x4_inc_ctx_clone(OQS_SHA3_shake128_x4_inc_ctx *dest, const OQS_SHA3_shake128_x4_inc_ctx *src) {
-	memcpy(dest->ctx, src->ctx, KECCAK_X4_CTX_BYTES);
+	memcpy(dest->ctx, src->ctx, _KECCAK_X4_CTX_BYTES);
 }
 
 static void SHA3_shake128_x4_inc_ctx_release(OQS_SHA3_shake128_x4_inc_ctx *state) {
-	OQS_MEM_aligned_free(state->ctx);
+	keccak_x4_inc_ctx_free((uint64_t *)state->ctx);
 }
 
 static void SHA3_shake128_x4_inc_ctx_reset(OQS_SHA3_shake128_x4_inc_ctx *state) {
@@ -199,7 +275,8 @@ static void SHA3_shake128_x4_inc_ctx_reset(OQS_SHA3_shake128_x4_inc_ctx *state)
 
 static void SHA3_shake256_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
 	OQS_SHA3_shake256_x4_inc_ctx s;
-	OQS_SHA3_shake256_x4_inc_init(&s);
+	OQS_SHA3_x4_inc_storage storage;
+	OQS_SHA3_shake256_x4_inc_init_inplace(&s, &storage);
 	OQS_SHA3_shake256_x4_inc_absorb(&s, in0, in1, in2, in3, inlen);
 	OQS_SHA3_shake256_x4_inc_finalize(&s);
 	OQS_SHA3_shake256_x4_inc_squeeze(out0, out1, out2, out3, outlen, &s);
@@ -209,9 +286,11 @@ static void SHA3_shake256_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_
 /* SHAKE256 incremental */
 
 static void SHA3_shake256_x4_inc_init(OQS_SHA3_shake256_x4_inc_ctx *state) {
-	state->ctx = OQS_MEM_aligned_alloc(KECCAK_X4_CTX_ALIGNMENT, KECCAK_X4_CTX_BYTES);
-	OQS_EXIT_IF_NULLPTR(state->ctx, "SHA3x4");
-	keccak_x4_inc_reset((uint64_t *)state->ctx);
+	state->ctx = keccak_x4_inc_ctx_new(NULL);
+}
+
+static void SHA3_shake256_x4_inc_init_inplace(OQS_SHA3_shake256_x4_inc_ctx *state, OQS_SHA3_x4_inc_storage *storage) {
+	state->ctx = keccak_x4_inc_ctx_new(storage);
 }
 
 static void SHA3_shake256_x4_inc_absorb(OQS_SHA3_shake256_x4_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
@@ -227,17 +306,260 @@ static void SHA3_shake256_x4_inc_squeeze(uint8_t *out0, uint8_t *out1, uint8_t *
 }
 
 static void SHA3_shake256_x4_inc_ctx_clone(OQS_SHA3_shake256_x4_inc_ctx *dest, const OQS_SHA3_shake256_x4_inc_ctx *src) {
-	memcpy(dest->ctx, src->ctx, KECCAK_X4_CTX_BYTES);
+	memcpy(dest->ctx, src->ctx, _KECCAK_X4_CTX_BYTES);
 }
 
 static void SHA3_shake256_x4_inc_ctx_release(OQS_SHA3_shake256_x4_inc_ctx *state) {
-	OQS_MEM_aligned_free(state->ctx);
+	keccak_x4_inc_ctx_free((uint64_t *)state->ctx);
 }
 
 static void SHA3_shake256_x4_inc_ctx_reset(OQS_SHA3_shake256_x4_inc_ctx *state) {
 	keccak_x4_inc_reset((uint64_t *)state->ctx);
 }
 
+/********** Eight-way one-shot SHAKE ***********/
+
+#define KECCAK_X8_STATE_WORDS 200
+
+/* Returns 0 if no eight-way permutation is available on this platform. */
+static int keccak_x8_available(void) {
+#if OQS_USE_PTHREADS
+	pthread_once(&dispatch_x8_once_control, Keccak_X8_Dispatch);
+#else
+	if (!dispatch_x8_done) {
+		Keccak_X8_Dispatch();
+	}
+#endif
+	return Keccak_X8_Permute_ptr != NULL;
+}
+
+static void keccak_x8_absorb_once(uint64_t *s, uint32_t r, const uint8_t *in[8], size_t inlen, uint8_t p) {
+	unsigned int i;
+
+	(*Keccak_X8_Initialize_ptr)(s);
+	while (inlen >= r) {
+		for (i = 0; i < 8; i++) {
+			(*Keccak_X8_AddBytes_ptr)(s, i, in[i], 0, r);
+			in[i] += r;
+		}
+		(*Keccak_X8_Permute_ptr)(s);
+		inlen -= r;
+	}
+
+	for (i = 0; i < 8; i++) {
+		(*Keccak_X8_AddBytes_ptr)(s, i, in[i], 0, (unsigned int)inlen);
+		(*Keccak_X8_AddByte_ptr)(s, i, p, (unsigned int)inlen);
+		(*Keccak_X8_AddByte_ptr)(s, i, 0x80, r - 1);
+	}
+}
+
+static void keccak_x8_squeeze(uint8_t *out[8], size_t outlen, uint64_t *s, uint32_t r) {
+	unsigned int i;
+	size_t len;
+
+	while (outlen > 0) {
+		(*Keccak_X8_Permute_ptr)(s);
+		len = outlen < r ? outlen : r;
+		for (i = 0; i < 8; i++) {
+			(*Keccak_X8_ExtractBytes_ptr)(s, i, out[i], 0, (unsigned int)len);
+			out[i] += len;
+		}
+		outlen -= len;
+	}
+}
+
+static void SHA3_shake128_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen) {
+	uint64_t s[KECCAK_X8_STATE_WORDS];
+	const uint8_t *in[8] = {in0, in1, in2, in3, in4, in5, in6, in7};
+	uint8_t *out[8] = {out0, out1, out2, out3, out4, out5, out6, out7};
+
+	if (!keccak_x8_available()) {
+		SHA3_shake128_x4(out0, out1, out2, out3, outlen, in0, in1, in2, in3, inlen);
+		SHA3_shake128_x4(out4, out5, out6, out7, outlen, in4, in5, in6, in7, inlen);
+		return;
+	}
+	keccak_x8_absorb_once(s, OQS_SHA3_SHAKE128_RATE, in, inlen, 0x1F);
+	keccak_x8_squeeze(out, outlen, s, OQS_SHA3_SHAKE128_RATE);
+	OQS_MEM_cleanse(s, sizeof(s));
+}
+
+static void SHA3_shake256_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen) {
+	uint64_t s[KECCAK_X8_STATE_WORDS];
+	const uint8_t *in[8] = {in0, in1, in2, in3, in4, in5, in6, in7};
+	uint8_t *out[8] = {out0, out1, out2, out3, out4, out5, out6, out7};
+
+	if (!keccak_x8_available()) {
+		SHA3_shake256_x4(out0, out1, out2, out3, outlen, in0, in1, in2, in3, inlen);
+		SHA3_shake256_x4(out4, out5, out6, out7, outlen, in4, in5, in6, in7, inlen);
+		return;
+	}
+	keccak_x8_absorb_once(s, OQS_SHA3_SHAKE256_RATE, in, inlen, 0x1F);
+	keccak_x8_squeeze(out, outlen, s, OQS_SHA3_SHAKE256_RATE);
+	OQS_MEM_cleanse(s, sizeof(s));
+}
+
+/********** Eight-way incremental SHAKE ***********/
+
+static void keccak_x8_inc_reset(uint64_t *s) {
+	if (!keccak_x8_available()) {
+		keccak_x4_inc_reset(s);
+		keccak_x4_inc_reset(s + KECCAK_X4_CTX_WORDS);
+		return;
+	}
+	(*Keccak_X8_Initialize_ptr)(s);
+	s[200] = 0;
+}
+
+static uint64_t *keccak_x8_inc_ctx_new(void) {
+	uint64_t *s = OQS_MEM_aligned_alloc(KECCAK_X8_CTX_ALIGNMENT, KECCAK_X8_CTX_BYTES);
+	OQS_EXIT_IF_NULLPTR(s, "SHA3x8");
+	keccak_x8_inc_reset(s);
+	return s;
+}
+
+static void keccak_x8_inc_absorb(uint64_t *s, uint32_t r, const uint8_t *in[8], size_t inlen) {
+	unsigned int i;
+	uint64_t c;
+
+	if (!keccak_x8_available()) {
+		keccak_x4_inc_absorb(s, r, in[0], in[1], in[2], in[3], inlen);
+		keccak_x4_inc_absorb(s + KECCAK_X4_CTX_WORDS, r, in[4], in[5], in[6], in[7], inlen);
+		return;
+	}
+
+	c = r - s[200];
+	if (s[200] && inlen >= c) {
+		for (i = 0; i < 8; i++) {
+			(*Keccak_X8_AddBytes_ptr)(s, i, in[i], (unsigned int)s[200], (unsigned int)c);
+			in[i] += c;
+		}
+		(*Keccak_X8_Permute_ptr)(s);
+		inlen -= c;
+		s[200] = 0;
+	}
+
+	while (inlen >= r) {
+		for (i = 0; i < 8; i++) {
+			(*Keccak_X8_AddBytes_ptr)(s, i, in[i], 0, r);
+			in[i] += r;
+		}
+		(*Keccak_X8_Permute_ptr)(s);
+		inlen -= r;
+	}
+
+	for (i = 0; i < 8; i++) {
+		(*Keccak_X8_AddBytes_ptr)(s, i, in[i], (unsigned int)s[200], (unsigned int)inlen);
+	}
+	s[200] += inlen;
+}
+
+static void keccak_x8_inc_finalize(uint64_t *s, uint32_t r, uint8_t p) {
+	unsigned int i;
+
+	if (!keccak_x8_available()) {
+		keccak_x4_inc_finalize(s, r, p);
+		keccak_x4_inc_finalize(s + KECCAK_X4_CTX_WORDS, r, p);
+		return;
+	}
+
+	for (i = 0; i < 8; i++) {
+		(*Keccak_X8_AddByte_ptr)(s, i, p, (unsigned int)s[200]);
+		(*Keccak_X8_AddByte_ptr)(s, i, 0x80, r - 1);
+	}
+	s[200] = 0;
+}
+
+static void keccak_x8_inc_squeeze(uint8_t *out[8], size_t outlen, uint64_t *s, uint32_t r) {
+	unsigned int i;
+
+	if (!keccak_x8_available()) {
+		keccak_x4_inc_squeeze(out[0], out[1], out[2], out[3], outlen, s, r);
+		keccak_x4_inc_squeeze(out[4], out[5], out[6], out[7], outlen, s + KECCAK_X4_CTX_WORDS, r);
+		return;
+	}
+
+	while (outlen > s[200]) {
+		for (i = 0; i < 8; i++) {
+			(*Keccak_X8_ExtractBytes_ptr)(s, i, out[i], (unsigned int)(r - s[200]), (unsigned int)s[200]);
+			out[i] += s[200];
+		}
+		(*Keccak_X8_Permute_ptr)(s);
+		outlen -= s[200];
+		s[200] = r;
+	}
+
+	for (i = 0; i < 8; i++) {
+		(*Keccak_X8_ExtractBytes_ptr)(s, i, out[i], (unsigned int)(r - s[200]), (unsigned int)outlen);
+	}
+	s[200] -= outlen;
+}
+
+/* SHAKE128 eight-way incremental */
+
+static void SHA3_shake128_x8_inc_init(OQS_SHA3_shake128_x8_inc_ctx *state) {
+	state->ctx = keccak_x8_inc_ctx_new();
+}
+
+static void SHA3_shake128_x8_inc_absorb(OQS_SHA3_shake128_x8_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen) {
+	const uint8_t *in[8] = {in0, in1, in2, in3, in4, in5, in6, in7};
+	keccak_x8_inc_absorb((uint64_t *)state->ctx, OQS_SHA3_SHAKE128_RATE, in, inlen);
+}
+
+static void SHA3_shake128_x8_inc_finalize(OQS_SHA3_shake128_x8_inc_ctx *state) {
+	keccak_x8_inc_finalize((uint64_t *)state->ctx, OQS_SHA3_SHAKE128_RATE, 0x1F);
+}
+
+static void SHA3_shake128_x8_inc_squeeze(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, OQS_SHA3_shake128_x8_inc_ctx *state) {
+	uint8_t *out[8] = {out0, out1, out2, out3, out4, out5, out6, out7};
+	keccak_x8_inc_squeeze(out, outlen, (uint64_t *)state->ctx, OQS_SHA3_SHAKE128_RATE);
+}
+
+static void SHA3_shake128_x8_inc_ctx_clone(OQS_SHA3_shake128_x8_inc_ctx *dest, const OQS_SHA3_shake128_x8_inc_ctx *src) {
+	memcpy(dest->ctx, src->ctx, KECCAK_X8_CTX_BYTES);
+}
+
+static void SHA3_shake128_x8_inc_ctx_release(OQS_SHA3_shake128_x8_inc_ctx *state) {
+	OQS_MEM_cleanse(state->ctx, KECCAK_X8_CTX_BYTES);
+	OQS_MEM_aligned_free(state->ctx);
+}
+
+static void SHA3_shake128_x8_inc_ctx_reset(OQS_SHA3_shake128_x8_inc_ctx *state) {
+	keccak_x8_inc_reset((uint64_t *)state->ctx);
+}
+
+/* SHAKE256 eight-way incremental */
+
+static void SHA3_shake256_x8_inc_init(OQS_SHA3_shake256_x8_inc_ctx *state) {
+	state->ctx = keccak_x8_inc_ctx_new();
+}
+
+static void SHA3_shake256_x8_inc_absorb(OQS_SHA3_shake256_x8_inc_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen) {
+	const uint8_t *in[8] = {in0, in1, in2, in3, in4, in5, in6, in7};
+	keccak_x8_inc_absorb((uint64_t *)state->ctx, OQS_SHA3_SHAKE256_RATE, in, inlen);
+}
+
+static void SHA3_shake256_x8_inc_finalize(OQS_SHA3_shake256_x8_inc_ctx *state) {
+	keccak_x8_inc_finalize((uint64_t *)state->ctx, OQS_SHA3_SHAKE256_RATE, 0x1F);
+}
+
+static void SHA3_shake256_x8_inc_squeeze(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, OQS_SHA3_shake256_x8_inc_ctx *state) {
+	uint8_t *out[8] = {out0, out1, out2, out3, out4, out5, out6, out7};
+	keccak_x8_inc_squeeze(out, outlen, (uint64_t *)state->ctx, OQS_SHA3_SHAKE256_RATE);
+}
+
+static void SHA3_shake256_x8_inc_ctx_clone(OQS_SHA3_shake256_x8_inc_ctx *dest, const OQS_SHA3_shake256_x8_inc_ctx *src) {
+	memcpy(dest->ctx, src->ctx, KECCAK_X8_CTX_BYTES);
+}
+
+static void SHA3_shake256_x8_inc_ctx_release(OQS_SHA3_shake256_x8_inc_ctx *state) {
+	OQS_MEM_cleanse(state->ctx, KECCAK_X8_CTX_BYTES);
+	OQS_MEM_aligned_free(state->ctx);
+}
+
+static void SHA3_shake256_x8_inc_ctx_reset(OQS_SHA3_shake256_x8_inc_ctx *state) {
+	keccak_x8_inc_reset((uint64_t *)state->ctx);
+}
+
 extern struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks;
 
 struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks = {
@@ -257,4 +579,22 @@ struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks = {
 	SHA3_shake256_x4_inc_ctx_release,
 	SHA3_shake256_x4_inc_ctx_clone,
 	SHA3_shake256_x4_inc_ctx_reset,
+	SHA3_shake128_x4_inc_init_inplace,
+	SHA3_shake256_x4_inc_init_inplace,
+	SHA3_shake128_x8,
+	SHA3_shake256_x8,
+	SHA3_shake128_x8_inc_init,
+	SHA3_shake128_x8_inc_absorb,
+	SHA3_shake128_x8_inc_finalize,
+	SHA3_shake128_x8_inc_squeeze,
+	SHA3_shake128_x8_inc_ctx_release,
+	SHA3_shake128_x8_inc_ctx_clone,
+	SHA3_shake128_x8_inc_ctx_reset,
+	SHA3_shake256_x8_inc_init,
+	SHA3_shake256_x8_inc_absorb,
+	SHA3_shake256_x8_inc_finalize,
+	SHA3_shake256_x8_inc_squeeze,
+	SHA3_shake256_x8_inc_ctx_release,
+	SHA3_shake256_x8_inc_ctx_clone,
+	SHA3_shake256_x8_inc_ctx_reset,
 };
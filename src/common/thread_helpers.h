@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: MIT
+#ifndef OQS_THREAD_HELPERS_H
+#define OQS_THREAD_HELPERS_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#if defined(OQS_USE_PTHREADS)
+#include <pthread.h>
+
+/* Tasks such as Classic McEliece key generation keep megabytes on the stack */
+#define OQS_THREAD_STACK_SIZE (8 * 1024 * 1024)
+
+/* Initializes attr for a library-owned thread, with a stack of at least
+ * OQS_THREAD_STACK_SIZE bytes. Returns 0 on success. */
+int oqs_thread_attr_init(pthread_attr_t *attr);
+#endif
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
+
+#endif // OQS_THREAD_HELPERS_H
@@ -0,0 +1,238 @@
+// SPDX-License-Identifier: MIT
+
+#include <oqs/common.h>
+
+#include <stddef.h>
+
+#include "thread_helpers.h"
+
+struct OQS_THREADPOOL {
+	/* NULL for pools backed by our own worker threads */
+	OQS_THREADPOOL_executor executor;
+	void *context;
+	size_t concurrency;
+#if defined(OQS_USE_PTHREADS)
+	pthread_t *workers;
+	size_t num_workers;
+	/* Held by the thread whose batch the workers are running */
+	pthread_mutex_t run_lock;
+	/* Protects everything below */
+	pthread_mutex_t lock;
+	pthread_cond_t work_posted;
+	pthread_cond_t work_finished;
+	OQS_THREADPOOL_task task;
+	void *arg;
+	size_t count;
+	size_t next;
+	size_t finished;
+	unsigned long generation;
+	int shutdown;
+#endif
+};
+
+/* Set by the application; see OQS_THREADPOOL_set_default */
+static OQS_THREADPOOL *default_pool = NULL;
+
+static void run_inline(OQS_THREADPOOL_task task, void *arg, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		task(arg, i);
+	}
+}
+
+#if defined(OQS_USE_PTHREADS)
+
+int oqs_thread_attr_init(pthread_attr_t *attr) {
+	size_t stack_size;
+
+	if (pthread_attr_init(attr) != 0) {
+		return -1;
+	}
+	if (pthread_attr_getstacksize(attr, &stack_size) == 0 && stack_size < OQS_THREAD_STACK_SIZE) {
+		pthread_attr_setstacksize(attr, OQS_THREAD_STACK_SIZE);
+	}
+	return 0;
+}
+
+/* Runs tasks of the current batch until none are left; called with pool->lock held */
+static void run_batch(OQS_THREADPOOL *pool) {
+	while (pool->next < pool->count) {
+		OQS_THREADPOOL_task task = pool->task;
+		void *arg = pool->arg;
+		size_t index = pool->next++;
+		pthread_mutex_unlock(&pool->lock);
+		task(arg, index);
+		pthread_mutex_lock(&pool->lock);
+		if (++pool->finished == pool->count) {
+			pthread_cond_signal(&pool->work_finished);
+		}
+	}
+}
+
+static void *worker_main(void *arg) {
+	OQS_THREADPOOL *pool = arg;
+	unsigned long seen;
+
+	pthread_mutex_lock(&pool->lock);
+	seen = pool->generation;
+	for (;;) {
+		while (!pool->shutdown && pool->generation == seen) {
+			pthread_cond_wait(&pool->work_posted, &pool->lock);
+		}
+		if (pool->shutdown) {
+			pthread_mutex_unlock(&pool->lock);
+			return NULL;
+		}
+		seen = pool->generation;
+		run_batch(pool);
+	}
+}
+
+#endif
+
+OQS_API OQS_THREADPOOL *OQS_THREADPOOL_new(size_t num_threads) {
+	OQS_THREADPOOL *pool = OQS_MEM_calloc(1, sizeof(OQS_THREADPOOL));
+#if defined(OQS_USE_PTHREADS)
+	pthread_attr_t attr;
+#endif
+	if (pool == NULL) {
+		return NULL;
+	}
+	pool->concurrency = 1;
+#if defined(OQS_USE_PTHREADS)
+	if (num_threads <= 1) {
+		return pool;
+	}
+	pool->workers = OQS_MEM_malloc((num_threads - 1) * sizeof(pthread_t));
+	if (pool->workers == NULL) {
+		OQS_MEM_insecure_free(pool);
+		return NULL;
+	}
+	if (pthread_mutex_init(&pool->run_lock, NULL) != 0) {
+		goto no_workers;
+	}
+	if (pthread_mutex_init(&pool->lock, NULL) != 0) {
+		pthread_mutex_destroy(&pool->run_lock);
+		goto no_workers;
+	}
+	if (pthread_cond_init(&pool->work_posted, NULL) != 0) {
+		pthread_mutex_destroy(&pool->lock);
+		pthread_mutex_destroy(&pool->run_lock);
+		goto no_workers;
+	}
+	if (pthread_cond_init(&pool->work_finished, NULL) != 0) {
+		pthread_cond_destroy(&pool->work_posted);
+		pthread_mutex_destroy(&pool->lock);
+		pthread_mutex_destroy(&pool->run_lock);
+		goto no_workers;
+	}
+	if (oqs_thread_attr_init(&attr) != 0) {
+		pthread_cond_destroy(&pool->work_finished);
+		pthread_cond_destroy(&pool->work_posted);
+		pthread_mutex_destroy(&pool->lock);
+		pthread_mutex_destroy(&pool->run_lock);
+		goto no_workers;
+	}
+	while (pool->num_workers < num_threads - 1 && pthread_create(&pool->workers[pool->num_workers], &attr, worker_main, pool) == 0) {
+		pool->num_workers++;
+	}
+	pthread_attr_destroy(&attr);
+	pool->concurrency = pool->num_workers + 1;
+	if (pool->num_workers > 0) {
+		return pool;
+	}
+	pthread_cond_destroy(&pool->work_finished);
+	pthread_cond_destroy(&pool->work_posted);
+	pthread_mutex_destroy(&pool->lock);
+	pthread_mutex_destroy(&pool->run_lock);
+no_workers:
+	OQS_MEM_insecure_free(pool->workers);
+	pool->workers = NULL;
+#else
+	(void)num_threads;
+#endif
+	return pool;
+}
+
+OQS_API OQS_THREADPOOL *OQS_THREADPOOL_new_custom(OQS_THREADPOOL_executor executor, void *context, size_t concurrency) {
+	OQS_THREADPOOL *pool;
+	if (executor == NULL) {
+		return NULL;
+	}
+	pool = OQS_MEM_calloc(1, sizeof(OQS_THREADPOOL));
+	if (pool == NULL) {
+		return NULL;
+	}
+	pool->executor = executor;
+	pool->context = context;
+	pool->concurrency = concurrency > 0 ? concurrency : 1;
+	return pool;
+}
+
+OQS_API void OQS_THREADPOOL_free(OQS_THREADPOOL *pool) {
+	if (pool == NULL) {
+		return;
+	}
+#if defined(OQS_USE_PTHREADS)
+	if (pool->workers != NULL) {
+		pthread_mutex_lock(&pool->lock);
+		pool->shutdown = 1;
+		pthread_cond_broadcast(&pool->work_posted);
+		pthread_mutex_unlock(&pool->lock);
+		for (size_t i = 0; i < pool->num_workers; i++) {
+			pthread_join(pool->workers[i], NULL);
+		}
+		pthread_cond_destroy(&pool->work_finished);
+		pthread_cond_destroy(&pool->work_posted);
+		pthread_mutex_destroy(&pool->lock);
+		pthread_mutex_destroy(&pool->run_lock);
+		OQS_MEM_insecure_free(pool->workers);
+	}
+#endif
+	OQS_MEM_insecure_free(pool);
+}
+
+OQS_API size_t OQS_THREADPOOL_concurrency(const OQS_THREADPOOL *pool) {
+	return pool == NULL ? 1 : pool->concurrency;
+}
+
+OQS_API void OQS_THREADPOOL_run(OQS_THREADPOOL *pool, OQS_THREADPOOL_task task, void *arg, size_t count) {
+	if (pool == NULL || count == 0) {
+		run_inline(task, arg, count);
+		return;
+	}
+	if (pool->executor != NULL) {
+		pool->executor(pool->context, task, arg, count);
+		return;
+	}
+#if defined(OQS_USE_PTHREADS)
+	/* Nested or concurrent batches run in their caller rather than queueing up */
+	if (pool->workers == NULL || count == 1 || pthread_mutex_trylock(&pool->run_lock) != 0) {
+		run_inline(task, arg, count);
+		return;
+	}
+	pthread_mutex_lock(&pool->lock);
+	pool->task = task;
+	pool->arg = arg;
+	pool->count = count;
+	pool->next = 0;
+	pool->finished = 0;
+	pool->generation++;
+	pthread_cond_broadcast(&pool->work_posted);
+	run_batch(pool);
+	while (pool->finished < pool->count) {
+		pthread_cond_wait(&pool->work_finished, &pool->lock);
+	}
+	pthread_mutex_unlock(&pool->lock);
+	pthread_mutex_unlock(&pool->run_lock);
+#else
+	run_inline(task, arg, count);
+#endif
+}
+
+OQS_API void OQS_THREADPOOL_set_default(OQS_THREADPOOL *pool) {
+	default_pool = pool;
+}
+
+OQS_API OQS_THREADPOOL *OQS_THREADPOOL_get_default(void) {
+	return default_pool;
+}
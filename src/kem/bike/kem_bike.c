@@ -24,6 +24,17 @@ OQS_KEM *OQS_KEM_bike_l1_new(void) {
 	kem->keypair = OQS_KEM_bike_l1_keypair;
 	kem->encaps = OQS_KEM_bike_l1_encaps;
 	kem->decaps = OQS_KEM_bike_l1_decaps;
+	kem->keypair_batch = NULL;
+	kem->encaps_batch = NULL;
+	kem->decaps_batch = NULL;
+	kem->length_expanded_public_key = 0;
+	kem->public_key_expand = NULL;
+	kem->encaps_expanded = NULL;
+	kem->length_expanded_secret_key = 0;
+	kem->secret_key_expand = NULL;
+	kem->decaps_expanded = NULL;
+	kem->encaps_stream = NULL;
+	kem->keypair_parallel = NULL;
 
 	return kem;
 }
@@ -49,6 +60,17 @@ OQS_KEM *OQS_KEM_bike_l3_new(void) {
 	kem->keypair = OQS_KEM_bike_l3_keypair;
 	kem->encaps = OQS_KEM_bike_l3_encaps;
 	kem->decaps = OQS_KEM_bike_l3_decaps;
+	kem->keypair_batch = NULL;
+	kem->encaps_batch = NULL;
+	kem->decaps_batch = NULL;
+	kem->length_expanded_public_key = 0;
+	kem->public_key_expand = NULL;
+	kem->encaps_expanded = NULL;
+	kem->length_expanded_secret_key = 0;
+	kem->secret_key_expand = NULL;
+	kem->decaps_expanded = NULL;
+	kem->encaps_stream = NULL;
+	kem->keypair_parallel = NULL;
 
 	return kem;
 }
@@ -74,6 +96,17 @@ OQS_KEM *OQS_KEM_bike_l5_new(void) {
 	kem->keypair = OQS_KEM_bike_l5_keypair;
 	kem->encaps = OQS_KEM_bike_l5_encaps;
 	kem->decaps = OQS_KEM_bike_l5_decaps;
+	kem->keypair_batch = NULL;
+	kem->encaps_batch = NULL;
+	kem->decaps_batch = NULL;
+	kem->length_expanded_public_key = 0;
+	kem->public_key_expand = NULL;
+	kem->encaps_expanded = NULL;
+	kem->length_expanded_secret_key = 0;
+	kem->secret_key_expand = NULL;
+	kem->decaps_expanded = NULL;
+	kem->encaps_stream = NULL;
+	kem->keypair_parallel = NULL;
 
 	return kem;
 }
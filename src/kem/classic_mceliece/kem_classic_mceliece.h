@@ -14,6 +14,8 @@ OQS_KEM *OQS_KEM_classic_mceliece_348864_new(void);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_348864_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_348864_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_348864_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_348864_encaps_stream(uint8_t *ciphertext, uint8_t *shared_secret, OQS_KEM_public_key_reader read_public_key, void *context);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_348864_keypair_parallel(uint8_t *public_key, uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_KEM_classic_mceliece_348864f)
@@ -25,6 +27,8 @@ OQS_KEM *OQS_KEM_classic_mceliece_348864f_new(void);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_348864f_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_348864f_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_348864f_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_348864f_encaps_stream(uint8_t *ciphertext, uint8_t *shared_secret, OQS_KEM_public_key_reader read_public_key, void *context);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_348864f_keypair_parallel(uint8_t *public_key, uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_KEM_classic_mceliece_460896)
@@ -36,6 +40,8 @@ OQS_KEM *OQS_KEM_classic_mceliece_460896_new(void);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_460896_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_460896_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_460896_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_460896_encaps_stream(uint8_t *ciphertext, uint8_t *shared_secret, OQS_KEM_public_key_reader read_public_key, void *context);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_460896_keypair_parallel(uint8_t *public_key, uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_KEM_classic_mceliece_460896f)
@@ -47,6 +53,8 @@ OQS_KEM *OQS_KEM_classic_mceliece_460896f_new(void);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_460896f_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_460896f_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_460896f_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_460896f_encaps_stream(uint8_t *ciphertext, uint8_t *shared_secret, OQS_KEM_public_key_reader read_public_key, void *context);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_460896f_keypair_parallel(uint8_t *public_key, uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_KEM_classic_mceliece_6688128)
@@ -58,6 +66,8 @@ OQS_KEM *OQS_KEM_classic_mceliece_6688128_new(void);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6688128_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6688128_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6688128_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6688128_encaps_stream(uint8_t *ciphertext, uint8_t *shared_secret, OQS_KEM_public_key_reader read_public_key, void *context);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6688128_keypair_parallel(uint8_t *public_key, uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_KEM_classic_mceliece_6688128f)
@@ -69,6 +79,8 @@ OQS_KEM *OQS_KEM_classic_mceliece_6688128f_new(void);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6688128f_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6688128f_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6688128f_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6688128f_encaps_stream(uint8_t *ciphertext, uint8_t *shared_secret, OQS_KEM_public_key_reader read_public_key, void *context);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6688128f_keypair_parallel(uint8_t *public_key, uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_KEM_classic_mceliece_6960119)
@@ -80,6 +92,8 @@ OQS_KEM *OQS_KEM_classic_mceliece_6960119_new(void);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6960119_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6960119_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6960119_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6960119_encaps_stream(uint8_t *ciphertext, uint8_t *shared_secret, OQS_KEM_public_key_reader read_public_key, void *context);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6960119_keypair_parallel(uint8_t *public_key, uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_KEM_classic_mceliece_6960119f)
@@ -91,6 +105,8 @@ OQS_KEM *OQS_KEM_classic_mceliece_6960119f_new(void);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6960119f_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6960119f_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6960119f_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6960119f_encaps_stream(uint8_t *ciphertext, uint8_t *shared_secret, OQS_KEM_public_key_reader read_public_key, void *context);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_6960119f_keypair_parallel(uint8_t *public_key, uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_KEM_classic_mceliece_8192128)
@@ -102,6 +118,8 @@ OQS_KEM *OQS_KEM_classic_mceliece_8192128_new(void);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_8192128_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_8192128_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_8192128_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_8192128_encaps_stream(uint8_t *ciphertext, uint8_t *shared_secret, OQS_KEM_public_key_reader read_public_key, void *context);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_8192128_keypair_parallel(uint8_t *public_key, uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_KEM_classic_mceliece_8192128f)
@@ -113,6 +131,8 @@ OQS_KEM *OQS_KEM_classic_mceliece_8192128f_new(void);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_8192128f_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_8192128f_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_8192128f_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_8192128f_encaps_stream(uint8_t *ciphertext, uint8_t *shared_secret, OQS_KEM_public_key_reader read_public_key, void *context);
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_8192128f_keypair_parallel(uint8_t *public_key, uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #endif
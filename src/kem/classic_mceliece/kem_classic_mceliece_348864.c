@@ -26,6 +26,17 @@ OQS_KEM *OQS_KEM_classic_mceliece_348864_new(void) {
 	kem->keypair = OQS_KEM_classic_mceliece_348864_keypair;
 	kem->encaps = OQS_KEM_classic_mceliece_348864_encaps;
 	kem->decaps = OQS_KEM_classic_mceliece_348864_decaps;
+	kem->keypair_batch = NULL;
+	kem->encaps_batch = NULL;
+	kem->decaps_batch = NULL;
+	kem->length_expanded_public_key = 0;
+	kem->public_key_expand = NULL;
+	kem->encaps_expanded = NULL;
+	kem->length_expanded_secret_key = 0;
+	kem->secret_key_expand = NULL;
+	kem->decaps_expanded = NULL;
+	kem->encaps_stream = OQS_KEM_classic_mceliece_348864_encaps_stream;
+	kem->keypair_parallel = OQS_KEM_classic_mceliece_348864_keypair_parallel;
 
 	return kem;
 }
@@ -33,11 +44,15 @@ OQS_KEM *OQS_KEM_classic_mceliece_348864_new(void) {
 extern int PQCLEAN_MCELIECE348864_CLEAN_crypto_kem_keypair(uint8_t *pk, uint8_t *sk);
 extern int PQCLEAN_MCELIECE348864_CLEAN_crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
 extern int PQCLEAN_MCELIECE348864_CLEAN_crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+extern int PQCLEAN_MCELIECE348864_CLEAN_crypto_kem_enc_stream(uint8_t *ct, uint8_t *ss, int (*read_pk)(void *ctx, uint8_t *buf, size_t len), void *ctx);
+extern int PQCLEAN_MCELIECE348864_CLEAN_crypto_kem_keypair_tasks(uint8_t *pk, uint8_t *sk, void (*run_tasks)(void *executor, void (*task)(void *arg, size_t index), void *arg, size_t count), void *executor, size_t candidates);
 
 #if defined(OQS_ENABLE_KEM_classic_mceliece_348864_avx2)
 extern int PQCLEAN_MCELIECE348864_AVX2_crypto_kem_keypair(uint8_t *pk, uint8_t *sk);
 extern int PQCLEAN_MCELIECE348864_AVX2_crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
 extern int PQCLEAN_MCELIECE348864_AVX2_crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+extern int PQCLEAN_MCELIECE348864_AVX2_crypto_kem_enc_stream(uint8_t *ct, uint8_t *ss, int (*read_pk)(void *ctx, uint8_t *buf, size_t len), void *ctx);
+extern int PQCLEAN_MCELIECE348864_AVX2_crypto_kem_keypair_tasks(uint8_t *pk, uint8_t *sk, void (*run_tasks)(void *executor, void (*task)(void *arg, size_t index), void *arg, size_t count), void *executor, size_t candidates);
 #endif
 
 OQS_API OQS_STATUS OQS_KEM_classic_mceliece_348864_keypair(uint8_t *public_key, uint8_t *secret_key) {
@@ -88,4 +103,56 @@ OQS_API OQS_STATUS OQS_KEM_classic_mceliece_348864_decaps(uint8_t *shared_secret
 #endif
 }
 
+/* Adapts an OQS_KEM_public_key_reader to the callback taken by the implementations */
+typedef struct {
+	OQS_KEM_public_key_reader read_public_key;
+	void *context;
+} public_key_reader;
+
+static int read_public_key_rows(void *ctx, uint8_t *buf, size_t len) {
+	const public_key_reader *reader = ctx;
+	return reader->read_public_key(reader->context, buf, len) == OQS_SUCCESS ? 0 : -1;
+}
+
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_348864_encaps_stream(uint8_t *ciphertext, uint8_t *shared_secret, OQS_KEM_public_key_reader read_public_key, void *context) {
+	public_key_reader reader = { read_public_key, context };
+#if defined(OQS_ENABLE_KEM_classic_mceliece_348864_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_MCELIECE348864_AVX2_crypto_kem_enc_stream(ciphertext, shared_secret, read_public_key_rows, &reader);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_MCELIECE348864_CLEAN_crypto_kem_enc_stream(ciphertext, shared_secret, read_public_key_rows, &reader);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_MCELIECE348864_CLEAN_crypto_kem_enc_stream(ciphertext, shared_secret, read_public_key_rows, &reader);
+#endif
+}
+
+/* Hands the candidate seeds of crypto_kem_keypair_tasks to an OQS_THREADPOOL */
+static void run_keygen_tasks(void *executor, void (*task)(void *arg, size_t index), void *arg, size_t count) {
+	OQS_THREADPOOL_run((OQS_THREADPOOL *)executor, task, arg, count);
+}
+
+OQS_API OQS_STATUS OQS_KEM_classic_mceliece_348864_keypair_parallel(uint8_t *public_key, uint8_t *secret_key, OQS_THREADPOOL *pool) {
+	if (OQS_THREADPOOL_concurrency(pool) <= 1) {
+		return OQS_KEM_classic_mceliece_348864_keypair(public_key, secret_key);
+	}
+#if defined(OQS_ENABLE_KEM_classic_mceliece_348864_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_MCELIECE348864_AVX2_crypto_kem_keypair_tasks(public_key, secret_key, run_keygen_tasks, pool, OQS_THREADPOOL_concurrency(pool));
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_MCELIECE348864_CLEAN_crypto_kem_keypair_tasks(public_key, secret_key, run_keygen_tasks, pool, OQS_THREADPOOL_concurrency(pool));
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_MCELIECE348864_CLEAN_crypto_kem_keypair_tasks(public_key, secret_key, run_keygen_tasks, pool, OQS_THREADPOOL_concurrency(pool));
+#endif
+}
+
 #endif
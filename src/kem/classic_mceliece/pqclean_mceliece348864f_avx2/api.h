@@ -1,6 +1,7 @@
 #ifndef PQCLEAN_MCELIECE348864F_AVX2_API_H
 #define PQCLEAN_MCELIECE348864F_AVX2_API_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #define PQCLEAN_MCELIECE348864F_AVX2_CRYPTO_ALGNAME "Classic McEliece 348864"
@@ -15,6 +16,14 @@ int PQCLEAN_MCELIECE348864F_AVX2_crypto_kem_enc(
     const uint8_t *pk
 );
 
+/* Like crypto_kem_enc, with the public key supplied front to back by read_pk, which returns 0 on success */
+int PQCLEAN_MCELIECE348864F_AVX2_crypto_kem_enc_stream(
+    uint8_t *c,
+    uint8_t *key,
+    int (*read_pk)(void *ctx, uint8_t *buf, size_t len),
+    void *ctx
+);
+
 int PQCLEAN_MCELIECE348864F_AVX2_crypto_kem_dec(
     uint8_t *key,
     const uint8_t *c,
@@ -27,4 +36,14 @@ int PQCLEAN_MCELIECE348864F_AVX2_crypto_kem_keypair
     uint8_t *sk
 );
 
+/* Like crypto_kem_keypair, trying candidates seeds at a time as tasks handed to run_tasks; the key pair is the same */
+int PQCLEAN_MCELIECE348864F_AVX2_crypto_kem_keypair_tasks
+(
+    uint8_t *pk,
+    uint8_t *sk,
+    void (*run_tasks)(void *executor, void (*task)(void *arg, size_t index), void *arg, size_t count),
+    void *executor,
+    size_t candidates
+);
+
 #endif
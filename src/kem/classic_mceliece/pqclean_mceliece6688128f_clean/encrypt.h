@@ -6,8 +6,13 @@
 
 #include "namespace.h"
 
+#include <stddef.h>
+
 #define encrypt CRYPTO_NAMESPACE(encrypt)
+#define encrypt_stream CRYPTO_NAMESPACE(encrypt_stream)
 
 void encrypt(unsigned char *s, const unsigned char *pk, unsigned char *e);
 
+int encrypt_stream(unsigned char *s, int (*read_pk)(void *ctx, unsigned char *buf, size_t len), void *ctx, unsigned char *e);
+
 #endif
@@ -5,12 +5,21 @@
 
 #include "crypto_kem.h"
 
+#include <stddef.h>
+
 int crypto_kem_enc(
     unsigned char *c,
     unsigned char *key,
     const unsigned char *pk
 );
 
+int crypto_kem_enc_stream(
+    unsigned char *c,
+    unsigned char *key,
+    int (*read_pk)(void *ctx, unsigned char *buf, size_t len),
+    void *ctx
+);
+
 int crypto_kem_dec(
     unsigned char *key,
     const unsigned char *c,
@@ -23,4 +32,13 @@ int crypto_kem_keypair
     unsigned char *sk
 );
 
+int crypto_kem_keypair_tasks
+(
+    unsigned char *pk,
+    unsigned char *sk,
+    void (*run_tasks)(void *executor, void (*task)(void *arg, size_t index), void *arg, size_t count),
+    void *executor,
+    size_t candidates
+);
+
 #endif
@@ -7,6 +7,7 @@
 #include "randombytes.h"
 
 #include <assert.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -155,3 +156,75 @@ void encrypt(unsigned char *s, const unsigned char *pk, unsigned char *e) {
 
     syndrome(s, pk, e);
 }
+
+/* number of public key rows read per call of read_pk */
+#define STREAM_ROWS 32
+
+/* input: callback read_pk supplying the public key front to back, error vector e */
+/* output: syndrome s; returns 0, or -1 if read_pk failed */
+static int syndrome_stream(unsigned char *s, int (*read_pk)(void *ctx, unsigned char *buf, size_t len), void *ctx, const unsigned char *e) {
+    unsigned char rows[ STREAM_ROWS * PK_ROW_BYTES ];
+    unsigned char e_tail[ PK_ROW_BYTES ] = {0};
+    const unsigned char *row;
+    uint64_t acc, w, v;
+    int i, j, k, n;
+
+    // e_tail holds bits PK_NROWS, PK_NROWS + 1, ... of e, lined up with the rows of pk;
+    // the padding bits of a row are multiplied by zeros past the end of e
+
+    for (j = 0; j < PK_ROW_BYTES && PK_NROWS / 8 + j < SYS_N / 8; j++) {
+        e_tail[j] = e[ PK_NROWS / 8 + j ] >> (PK_NROWS % 8);
+        if (PK_NROWS % 8 != 0 && PK_NROWS / 8 + j + 1 < SYS_N / 8) {
+            e_tail[j] |= (unsigned char)(e[ PK_NROWS / 8 + j + 1 ] << ((8 - PK_NROWS % 8) % 8));
+        }
+    }
+
+    for (i = 0; i < SYND_BYTES; i++) {
+        s[i] = 0;
+    }
+
+    for (i = 0; i < PK_NROWS; i += n) {
+        n = PK_NROWS - i < STREAM_ROWS ? PK_NROWS - i : STREAM_ROWS;
+
+        if (read_pk(ctx, rows, (size_t)n * PK_ROW_BYTES) != 0) {
+            return -1;
+        }
+
+        for (j = 0; j < n; j++) {
+            row = rows + j * PK_ROW_BYTES;
+
+            // both operands are loaded the same way, so byte order does not matter
+            acc = 0;
+            for (k = 0; k + 8 <= PK_ROW_BYTES; k += 8) {
+                memcpy(&w, row + k, 8);
+                memcpy(&v, e_tail + k, 8);
+                acc ^= w & v;
+            }
+            for (; k < PK_ROW_BYTES; k++) {
+                acc ^= row[k] & e_tail[k];
+            }
+
+            // the identity part of the parity check matrix
+            acc ^= (e[ (i + j) / 8 ] >> ((i + j) % 8)) & 1;
+
+            acc ^= acc >> 32;
+            acc ^= acc >> 16;
+            acc ^= acc >> 8;
+            acc ^= acc >> 4;
+            acc ^= acc >> 2;
+            acc ^= acc >> 1;
+
+            s[ (i + j) / 8 ] |= (unsigned char)((acc & 1) << ((i + j) % 8));
+        }
+    }
+
+    return 0;
+}
+
+/* input: callback read_pk supplying the public key front to back */
+/* output: error vector e, syndrome s; returns 0, or -1 if read_pk failed */
+int encrypt_stream(unsigned char *s, int (*read_pk)(void *ctx, unsigned char *buf, size_t len), void *ctx, unsigned char *e) {
+    gen_e(e);
+
+    return syndrome_stream(s, read_pk, ctx, e);
+}
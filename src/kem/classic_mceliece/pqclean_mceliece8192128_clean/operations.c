@@ -9,6 +9,9 @@
 #include "sk_gen.h"
 #include "util.h"
 
+#include <oqs/common.h>
+
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -35,6 +38,29 @@ int crypto_kem_enc(
     return 0;
 }
 
+int crypto_kem_enc_stream(
+    unsigned char *c,
+    unsigned char *key,
+    int (*read_pk)(void *ctx, unsigned char *buf, size_t len),
+    void *ctx
+) {
+    unsigned char e[ SYS_N / 8 ];
+    unsigned char one_ec[ 1 + SYS_N / 8 + SYND_BYTES ] = {1};
+
+    //
+
+    if (encrypt_stream(c, read_pk, ctx, e) != 0) {
+        return -1;
+    }
+
+    memcpy(one_ec + 1, e, SYS_N / 8);
+    memcpy(one_ec + 1 + SYS_N / 8, c, SYND_BYTES);
+
+    crypto_hash_32b(key, one_ec, sizeof(one_ec));
+
+    return 0;
+}
+
 int crypto_kem_dec(
     unsigned char *key,
     const unsigned char *c,
@@ -73,78 +99,178 @@ int crypto_kem_dec(
     return 0;
 }
 
-int crypto_kem_keypair
+#define KEYGEN_R_BYTES (SYS_N / 8 + (1 << GFBITS) * sizeof(uint32_t) + SYS_T * 2 + 32)
+#define KEYGEN_PK_BYTES (PK_NROWS * PK_ROW_BYTES)
+#define KEYGEN_SK_BYTES (32 + 8 + IRR_BYTES + COND_BYTES + SYS_N / 8)
+
+/* derive a key pair from seed and its expansion r */
+/* return: 0 on success, -1 if the seed has to be rejected */
+static int keypair_from_seed
 (
     unsigned char *pk,
-    unsigned char *sk
+    unsigned char *sk,
+    const unsigned char *seed,
+    const unsigned char *r
 ) {
     int i;
-    unsigned char seed[ 33 ] = {64};
-    unsigned char r[ SYS_N / 8 + (1 << GFBITS)*sizeof(uint32_t) + SYS_T * 2 + 32 ];
-    unsigned char *rp, *skp;
+    const unsigned char *rp = &r[ KEYGEN_R_BYTES - 32 ];
+    unsigned char *skp = sk;
 
     gf f[ SYS_T ]; // element in GF(2^mt)
     gf irr[ SYS_T ]; // Goppa polynomial
     uint32_t perm[ 1 << GFBITS ]; // random permutation as 32-bit integers
     int16_t pi[ 1 << GFBITS ]; // random permutation
 
+    memcpy(skp, seed, 32);
+    skp += 32 + 8;
+
+    // generating irreducible polynomial
+
+    rp -= sizeof(f);
+
+    for (i = 0; i < SYS_T; i++) {
+        f[i] = load_gf(rp + i * 2);
+    }
+
+    if (genpoly_gen(irr, f)) {
+        return -1;
+    }
+
+    for (i = 0; i < SYS_T; i++) {
+        store_gf(skp + i * 2, irr[i]);
+    }
+
+    skp += IRR_BYTES;
+
+    // generating permutation
+
+    rp -= sizeof(perm);
+
+    for (i = 0; i < (1 << GFBITS); i++) {
+        perm[i] = load4(rp + i * 4);
+    }
+
+    if (pk_gen(pk, skp - IRR_BYTES, perm, pi)) {
+        return -1;
+    }
+
+    controlbitsfrompermutation(skp, pi, GFBITS, 1 << GFBITS);
+    skp += COND_BYTES;
+
+    // storing the random string s
+
+    rp -= SYS_N / 8;
+    memcpy(skp, rp, SYS_N / 8);
+
+    // storing positions of the 32 pivots
+
+    store8(sk + 32, 0xFFFFFFFF);
+
+    return 0;
+}
+
+int crypto_kem_keypair
+(
+    unsigned char *pk,
+    unsigned char *sk
+) {
+    unsigned char seed[ 33 ] = {64};
+    unsigned char r[ KEYGEN_R_BYTES ];
+
     randombytes(seed + 1, 32);
 
     while (1) {
-        rp = &r[ sizeof(r) - 32 ];
-        skp = sk;
-
         // expanding and updating the seed
 
         shake(r, sizeof(r), seed, 33);
-        memcpy(skp, seed + 1, 32);
-        skp += 32 + 8;
-        memcpy(seed + 1, &r[ sizeof(r) - 32 ], 32);
 
-        // generating irreducible polynomial
+        if (keypair_from_seed(pk, sk, seed + 1, r) == 0) {
+            break;
+        }
 
-        rp -= sizeof(f);
+        memcpy(seed + 1, &r[ sizeof(r) - 32 ], 32);
+    }
 
-        for (i = 0; i < SYS_T; i++) {
-            f[i] = load_gf(rp + i * 2);
-        }
+    return 0;
+}
 
-        if (genpoly_gen(irr, f)) {
-            continue;
-        }
+struct keypair_candidate {
+    unsigned char seed[ 32 ];
+    unsigned char r[ KEYGEN_R_BYTES ];
+    unsigned char *pk;
+    unsigned char *sk;
+    int status;
+};
 
-        for (i = 0; i < SYS_T; i++) {
-            store_gf(skp + i * 2, irr[i]);
-        }
+static void keypair_candidate_task(void *arg, size_t index) {
+    struct keypair_candidate *candidate = (struct keypair_candidate *)arg + index;
 
-        skp += IRR_BYTES;
+    candidate->status = keypair_from_seed(candidate->pk, candidate->sk, candidate->seed, candidate->r);
+}
 
-        // generating permutation
+int crypto_kem_keypair_tasks
+(
+    unsigned char *pk,
+    unsigned char *sk,
+    void (*run_tasks)(void *executor, void (*task)(void *arg, size_t index), void *arg, size_t count),
+    void *executor,
+    size_t candidates
+) {
+    size_t i;
+    int ret = -1;
+    unsigned char seed[ 33 ] = {64};
+    struct keypair_candidate *candidate;
+    unsigned char *keys;
 
-        rp -= sizeof(perm);
+    if (candidates <= 1) {
+        return crypto_kem_keypair(pk, sk);
+    }
 
-        for (i = 0; i < (1 << GFBITS); i++) {
-            perm[i] = load4(rp + i * 4);
-        }
+    candidate = OQS_MEM_malloc(candidates * sizeof(struct keypair_candidate));
+    keys = OQS_MEM_malloc((candidates - 1) * (KEYGEN_PK_BYTES + KEYGEN_SK_BYTES));
+    if (candidate == NULL || keys == NULL) {
+        // without room for the candidates, search for the key sequentially
+        OQS_MEM_insecure_free(candidate);
+        OQS_MEM_insecure_free(keys);
+        return crypto_kem_keypair(pk, sk);
+    }
 
-        if (pk_gen(pk, skp - IRR_BYTES, perm, pi)) {
-            continue;
-        }
+    candidate[0].pk = pk;
+    candidate[0].sk = sk;
+    for (i = 1; i < candidates; i++) {
+        candidate[i].pk = keys + (i - 1) * (KEYGEN_PK_BYTES + KEYGEN_SK_BYTES);
+        candidate[i].sk = candidate[i].pk + KEYGEN_PK_BYTES;
+    }
 
-        controlbitsfrompermutation(skp, pi, GFBITS, 1 << GFBITS);
-        skp += COND_BYTES;
+    randombytes(seed + 1, 32);
 
-        // storing the random string s
+    while (ret != 0) {
+        // expanding the next seeds crypto_kem_keypair would try
 
-        rp -= SYS_N / 8;
-        memcpy(skp, rp, SYS_N / 8);
+        for (i = 0; i < candidates; i++) {
+            shake(candidate[i].r, KEYGEN_R_BYTES, seed, 33);
+            memcpy(candidate[i].seed, seed + 1, 32);
+            memcpy(seed + 1, &candidate[i].r[ KEYGEN_R_BYTES - 32 ], 32);
+        }
 
-        // storing positions of the 32 pivots
+        run_tasks(executor, keypair_candidate_task, candidate, candidates);
 
-        store8(sk + 32, 0xFFFFFFFF);
+        // the first seed that works is the one crypto_kem_keypair ends up with
 
-        break;
+        for (i = 0; i < candidates; i++) {
+            if (candidate[i].status == 0) {
+                if (i > 0) {
+                    memcpy(pk, candidate[i].pk, KEYGEN_PK_BYTES);
+                    memcpy(sk, candidate[i].sk, KEYGEN_SK_BYTES);
+                }
+                ret = 0;
+                break;
+            }
+        }
     }
 
-    return 0;
+    OQS_MEM_secure_free(candidate, candidates * sizeof(struct keypair_candidate));
+    OQS_MEM_secure_free(keys, (candidates - 1) * (KEYGEN_PK_BYTES + KEYGEN_SK_BYTES));
+
+    return ret;
 }
@@ -10,3 +10,6 @@
 
 #define frodo_mul_add_as_plus_e_actual frodo_mul_add_as_plus_e_avx2
 #include "frodo_macrify_as_plus_e.c"
+
+#define frodo_mul_add_sa_plus_e_expanded_actual frodo_mul_add_sa_plus_e_expanded_avx2
+#include "frodo_macrify_sa_plus_e_expanded.c"
@@ -30,6 +30,10 @@
 #define crypto_kem_keypair            OQS_KEM_frodokem_976_shake_keypair
 #define crypto_kem_enc                OQS_KEM_frodokem_976_shake_encaps
 #define crypto_kem_dec                OQS_KEM_frodokem_976_shake_decaps
+#define crypto_kem_expand_pk          OQS_KEM_frodokem_976_shake_public_key_expand
+#define crypto_kem_enc_expanded       OQS_KEM_frodokem_976_shake_encaps_expanded
+#define crypto_kem_expand_sk          OQS_KEM_frodokem_976_shake_secret_key_expand
+#define crypto_kem_dec_expanded       OQS_KEM_frodokem_976_shake_decaps_expanded
 
 #define frodo_sample_n oqs_kem_frodokem_976_shake_sample_n
 #define frodo_pack oqs_kem_frodokem_976_shake_pack
@@ -45,6 +49,10 @@
 #define frodo_mul_add_sa_plus_e_shake_avx2 oqs_kem_frodokem_976_shake_mul_add_sa_plus_e_avx2
 #define frodo_mul_add_sb_plus_e oqs_kem_frodokem_976_shake_mul_add_sb_plus_e
 #define frodo_mul_bs oqs_kem_frodokem_976_shake_mul_bs
+#define frodo_expand_a oqs_kem_frodokem_976_shake_expand_a
+#define frodo_mul_add_sa_plus_e_expanded oqs_kem_frodokem_976_shake_mul_add_sa_plus_e_expanded
+#define frodo_mul_add_sa_plus_e_expanded_portable oqs_kem_frodokem_976_shake_mul_add_sa_plus_e_expanded_portable
+#define frodo_mul_add_sa_plus_e_expanded_avx2 oqs_kem_frodokem_976_shake_mul_add_sa_plus_e_expanded_avx2
 
 #define frodo_add oqs_kem_frodokem_976_shake_add
 #define frodo_sub oqs_kem_frodokem_976_shake_sub
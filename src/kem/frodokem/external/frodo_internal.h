@@ -21,6 +21,11 @@ int frodo_mul_add_sa_plus_e(uint16_t *b, const uint16_t *s, const uint16_t *e, c
 void frodo_mul_add_sb_plus_e(uint16_t *out, const uint16_t *b, const uint16_t *s, const uint16_t *e);
 void frodo_mul_bs(uint16_t *out, const uint16_t *b, const uint16_t *s);
 
+// Expanded matrix A, stored as N/A_TILE_COLS tiles of A_TILE_COLS columns each, every tile row-major
+#define A_TILE_COLS 16
+void frodo_expand_a(uint16_t *A, const uint8_t *seed_A);
+int frodo_mul_add_sa_plus_e_expanded(uint16_t *b, const uint16_t *s, const uint16_t *e, const uint16_t *A);
+
 void frodo_add(uint16_t *out, const uint16_t *a, const uint16_t *b);
 void frodo_sub(uint16_t *out, const uint16_t *a, const uint16_t *b);
 void frodo_key_encode(uint16_t *out, const uint16_t *in);
@@ -17,11 +17,15 @@
 #define frodo_mul_add_as_plus_e_actual frodo_mul_add_as_plus_e_portable
 #include "frodo_macrify_as_plus_e.c"
 
+#define frodo_mul_add_sa_plus_e_expanded_actual frodo_mul_add_sa_plus_e_expanded_portable
+#include "frodo_macrify_sa_plus_e_expanded.c"
+
 int frodo_mul_add_as_plus_e_avx2(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A);
 int frodo_mul_add_sa_plus_e_aes_avx2(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A);
 int frodo_mul_add_sa_plus_e_aes_portable(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A);
 int frodo_mul_add_sa_plus_e_shake_avx2(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A);
 int frodo_mul_add_sa_plus_e_shake_portable(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A);
+int frodo_mul_add_sa_plus_e_expanded_avx2(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint16_t *A);
 
 int frodo_mul_add_as_plus_e(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A)
 { // Generate-and-multiply: generate matrix A (N x N) row-wise, multiply by s on the right.
@@ -71,6 +75,87 @@ int frodo_mul_add_sa_plus_e(uint16_t *out, const uint16_t *s, const uint16_t *e,
 #endif
 }
 
+void frodo_expand_a(uint16_t *A, const uint8_t *seed_A)
+{ // Generate matrix A (N x N) once, for repeated use by frodo_mul_add_sa_plus_e_expanded.
+  // Input:  seed_A
+  // Output: A, as N/A_TILE_COLS tiles of A_TILE_COLS columns, each tile stored row-major
+    int i, j, k;
+
+#if defined(USE_AES128_FOR_A)
+    const int rows = 4;                                         // Rows of A generated per step
+    uint16_t a_rows[4*PARAMS_N];
+    uint16_t a_rows_temp[4*PARAMS_N] = {0};
+    uint8_t *aes_key_schedule;
+    OQS_AES128_ECB_load_schedule(seed_A, (void **) &aes_key_schedule);
+
+    for (k = 0; k < 4; k++) {
+        for (j = 0; j < PARAMS_N; j += PARAMS_STRIPE_STEP) {
+            a_rows_temp[k*PARAMS_N + j + 1] = UINT16_TO_LE(j);  // Loading values in the little-endian order
+        }
+    }
+#elif defined (USE_SHAKE128_FOR_A)
+    const int rows = 8;                                         // Rows of A generated per step; PARAMS_N is a multiple of 8
+    uint16_t a_rows[8*PARAMS_N];
+    uint8_t seed_A_separated[8][2 + BYTES_SEED_A];
+    OQS_SHA3_shake128_x8_inc_ctx state;
+    OQS_SHA3_shake128_x8_inc_init(&state);
+    for (k = 0; k < 8; k++) {
+        memcpy(&seed_A_separated[k][2], seed_A, BYTES_SEED_A);
+    }
+#endif
+
+    for (i = 0; i < PARAMS_N; i += rows) {
+#if defined(USE_AES128_FOR_A)
+        for (k = 0; k < 4; k++) {
+            for (j = 0; j < PARAMS_N; j += PARAMS_STRIPE_STEP) {
+                a_rows_temp[k*PARAMS_N + j] = UINT16_TO_LE(i + k);
+            }
+        }
+        OQS_AES128_ECB_enc_sch((uint8_t*)a_rows_temp, 4*PARAMS_N*sizeof(uint16_t), aes_key_schedule, (uint8_t*)a_rows);
+#elif defined (USE_SHAKE128_FOR_A)
+        for (k = 0; k < 8; k++) {
+            seed_A_separated[k][0] = (uint8_t)(i + k);
+            seed_A_separated[k][1] = (uint8_t)((i + k) >> 8);
+        }
+        OQS_SHA3_shake128_x8_inc_ctx_reset(&state);
+        OQS_SHA3_shake128_x8_inc_absorb(&state, seed_A_separated[0], seed_A_separated[1], seed_A_separated[2], seed_A_separated[3],
+                    seed_A_separated[4], seed_A_separated[5], seed_A_separated[6], seed_A_separated[7], 2 + BYTES_SEED_A);
+        OQS_SHA3_shake128_x8_inc_finalize(&state);
+        OQS_SHA3_shake128_x8_inc_squeeze((unsigned char*)(a_rows), (unsigned char*)(a_rows + PARAMS_N), (unsigned char*)(a_rows + 2*PARAMS_N), (unsigned char*)(a_rows + 3*PARAMS_N),
+                    (unsigned char*)(a_rows + 4*PARAMS_N), (unsigned char*)(a_rows + 5*PARAMS_N), (unsigned char*)(a_rows + 6*PARAMS_N), (unsigned char*)(a_rows + 7*PARAMS_N),
+                    2*PARAMS_N, &state);
+#endif
+        for (k = 0; k < rows; k++) {                            // Scatter the rows over the tiles
+            for (j = 0; j < PARAMS_N; j++) {
+                A[(j - j % A_TILE_COLS)*PARAMS_N + (i + k)*A_TILE_COLS + j % A_TILE_COLS] = LE_TO_UINT16(a_rows[k*PARAMS_N + j]);
+            }
+        }
+    }
+
+#if defined(USE_AES128_FOR_A)
+    OQS_AES128_free_schedule(aes_key_schedule);
+#elif defined (USE_SHAKE128_FOR_A)
+    OQS_SHA3_shake128_x8_inc_ctx_release(&state);
+#endif
+}
+
+int frodo_mul_add_sa_plus_e_expanded(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint16_t *A)
+{ // Multiply by s' on the left, with A expanded by frodo_expand_a.
+  // Inputs: s', e' (N_BAR x N), A
+  // Output: out = s'*A + e' (N_BAR x N)
+#if defined(OQS_DIST_X86_64_BUILD)
+    if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+      return frodo_mul_add_sa_plus_e_expanded_avx2(out, s, e, A);
+    } else {
+      return frodo_mul_add_sa_plus_e_expanded_portable(out, s, e, A);
+    }
+#elif defined(OQS_USE_AVX2_INSTRUCTIONS)
+  return frodo_mul_add_sa_plus_e_expanded_avx2(out, s, e, A);
+#else
+  return frodo_mul_add_sa_plus_e_expanded_portable(out, s, e, A);
+#endif
+}
+
 void frodo_mul_bs(uint16_t *out, const uint16_t *b, const uint16_t *s)
 { // Multiply by s on the right
   // Inputs: b (N_BAR x N), s (N x N_BAR)
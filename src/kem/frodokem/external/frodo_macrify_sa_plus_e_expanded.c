@@ -0,0 +1,33 @@
+int frodo_mul_add_sa_plus_e_expanded_actual(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint16_t *A)
+{ // Multiply by s' on the left, with A expanded by frodo_expand_a.
+  // Inputs: s', e' (N_BAR x N), A (N x N, in tiles of A_TILE_COLS columns)
+  // Output: out = s'*A + e' (N_BAR x N)
+  // Each tile is read once from start to end while the N_BAR x A_TILE_COLS block of out it contributes to stays in registers.
+    int i, j, k, t;
+
+    for (t = 0; t < PARAMS_N; t += A_TILE_COLS) {
+        const uint16_t *a_tile = &A[t*PARAMS_N];
+        ALIGN_HEADER(32) uint16_t acc[PARAMS_NBAR*A_TILE_COLS] ALIGN_FOOTER(32);
+
+        for (i = 0; i < PARAMS_NBAR; i++) {
+            for (k = 0; k < A_TILE_COLS; k++) {
+                acc[i*A_TILE_COLS + k] = e[i*PARAMS_N + t + k];
+            }
+        }
+        for (j = 0; j < PARAMS_N; j++) {                        // Go through the tile's rows, one row of A at a time
+            const uint16_t *a_row = &a_tile[j*A_TILE_COLS];
+            for (i = 0; i < PARAMS_NBAR; i++) {
+                uint16_t sp = s[i*PARAMS_N + j];
+                for (k = 0; k < A_TILE_COLS; k++) {
+                    acc[i*A_TILE_COLS + k] += (uint16_t) ((uint32_t) sp * (uint32_t) a_row[k]);
+                }
+            }
+        }
+        for (i = 0; i < PARAMS_NBAR; i++) {
+            for (k = 0; k < A_TILE_COLS; k++) {
+                out[i*PARAMS_N + t + k] = acc[i*A_TILE_COLS + k];
+            }
+        }
+    }
+    return 1;
+}
@@ -63,13 +63,22 @@ OQS_STATUS crypto_kem_keypair(unsigned char* pk, unsigned char* sk)
 }
 
 
-OQS_STATUS crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
-{ // FrodoKEM's key encapsulation
-    const uint8_t *pk_seedA = &pk[0];
-    const uint8_t *pk_b = &pk[BYTES_SEED_A];
+// Expanded public key: A (see frodo_expand_a), B unpacked (N x N_BAR) and pkh = G_1(pk)
+#define EXPANDED_PK_A 0
+#define EXPANDED_PK_B (EXPANDED_PK_A + PARAMS_N*PARAMS_N*sizeof(uint16_t))
+#define EXPANDED_PK_PKH (EXPANDED_PK_B + PARAMS_N*PARAMS_NBAR*sizeof(uint16_t))
+
+// Expanded secret key: A, B unpacked, S unpacked (N_BAR x N) and the secret key itself
+#define EXPANDED_SK_A 0
+#define EXPANDED_SK_B (EXPANDED_SK_A + PARAMS_N*PARAMS_N*sizeof(uint16_t))
+#define EXPANDED_SK_S (EXPANDED_SK_B + PARAMS_N*PARAMS_NBAR*sizeof(uint16_t))
+#define EXPANDED_SK_SK (EXPANDED_SK_S + PARAMS_N*PARAMS_NBAR*sizeof(uint16_t))
+
+
+static OQS_STATUS kem_enc_internal(unsigned char *ct, unsigned char *ss, const uint8_t *pkh_in, const uint16_t *B, const uint8_t *pk_seedA, const uint16_t *A)
+{ // FrodoKEM's key encapsulation, given G_1(pk), B unpacked, and either seed_A or A expanded (A == NULL generates A on-the-fly)
     uint8_t *ct_c1 = &ct[0];
     uint8_t *ct_c2 = &ct[(PARAMS_LOGQ*PARAMS_N*PARAMS_NBAR)/8];
-    uint16_t B[PARAMS_N*PARAMS_NBAR] = {0};
     uint16_t V[PARAMS_NBAR*PARAMS_NBAR]= {0};                 // contains secret data
     uint16_t C[PARAMS_NBAR*PARAMS_NBAR] = {0};
     ALIGN_HEADER(32) uint16_t Bp[PARAMS_N*PARAMS_NBAR] ALIGN_FOOTER(32) = {0};
@@ -87,12 +96,12 @@ OQS_STATUS crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned c
     uint8_t *Fin_k = &Fin[CRYPTO_CIPHERTEXTBYTES];            // contains secret data
     uint8_t shake_input_seedSE[1 + CRYPTO_BYTES];             // contains secret data
 
-    // pkh <- G_1(pk), generate random mu, compute (seedSE || k) = G_2(pkh || mu)
-    shake(pkh, BYTES_PKHASH, pk, CRYPTO_PUBLICKEYBYTES);
+    // Generate random mu, compute (seedSE || k) = G_2(pkh || mu)
+    memcpy(pkh, pkh_in, BYTES_PKHASH);
     randombytes(mu, BYTES_MU);
     shake(G2out, CRYPTO_BYTES + CRYPTO_BYTES, G2in, BYTES_PKHASH + BYTES_MU);
 
-    // Generate Sp and Ep, and compute Bp = Sp*A + Ep. Generate A on-the-fly
+    // Generate Sp and Ep, and compute Bp = Sp*A + Ep
     shake_input_seedSE[0] = 0x96;
     memcpy(&shake_input_seedSE[1], seedSE, CRYPTO_BYTES);
     shake((uint8_t*)Sp, (2*PARAMS_N+PARAMS_NBAR)*PARAMS_NBAR*sizeof(uint16_t), shake_input_seedSE, 1 + CRYPTO_BYTES);
@@ -101,12 +110,15 @@ OQS_STATUS crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned c
     }
     frodo_sample_n(Sp, PARAMS_N*PARAMS_NBAR);
     frodo_sample_n(Ep, PARAMS_N*PARAMS_NBAR);
-    frodo_mul_add_sa_plus_e(Bp, Sp, Ep, pk_seedA);
+    if (A == NULL) {
+        frodo_mul_add_sa_plus_e(Bp, Sp, Ep, pk_seedA);
+    } else {
+        frodo_mul_add_sa_plus_e_expanded(Bp, Sp, Ep, A);
+    }
     frodo_pack(ct_c1, (PARAMS_LOGQ*PARAMS_N*PARAMS_NBAR)/8, Bp, PARAMS_N*PARAMS_NBAR, PARAMS_LOGQ);
 
     // Generate Epp, and compute V = Sp*B + Epp
     frodo_sample_n(Epp, PARAMS_NBAR*PARAMS_NBAR);
-    frodo_unpack(B, PARAMS_N*PARAMS_NBAR, pk_b, CRYPTO_PUBLICKEYBYTES - BYTES_SEED_A, PARAMS_LOGQ);
     frodo_mul_add_sb_plus_e(V, B, Sp, Epp);
 
     // Encode mu, and compute C = V + enc(mu) (mod q)
@@ -132,9 +144,37 @@ OQS_STATUS crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned c
 }
 
 
-OQS_STATUS crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
-{ // FrodoKEM's key decapsulation
+OQS_STATUS crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // FrodoKEM's key encapsulation
+    const uint8_t *pk_seedA = &pk[0];
+    const uint8_t *pk_b = &pk[BYTES_SEED_A];
     uint16_t B[PARAMS_N*PARAMS_NBAR] = {0};
+    uint8_t pkh[BYTES_PKHASH];
+
+    // pkh <- G_1(pk), and generate A on-the-fly
+    shake(pkh, BYTES_PKHASH, pk, CRYPTO_PUBLICKEYBYTES);
+    frodo_unpack(B, PARAMS_N*PARAMS_NBAR, pk_b, CRYPTO_PUBLICKEYBYTES - BYTES_SEED_A, PARAMS_LOGQ);
+    return kem_enc_internal(ct, ss, pkh, B, pk_seedA, NULL);
+}
+
+
+OQS_STATUS crypto_kem_expand_pk(unsigned char *epk, const unsigned char *pk)
+{ // Expand pk for crypto_kem_enc_expanded: generate A once, unpack B and compute pkh <- G_1(pk)
+    frodo_expand_a((uint16_t *)&epk[EXPANDED_PK_A], &pk[0]);
+    frodo_unpack((uint16_t *)&epk[EXPANDED_PK_B], PARAMS_N*PARAMS_NBAR, &pk[BYTES_SEED_A], CRYPTO_PUBLICKEYBYTES - BYTES_SEED_A, PARAMS_LOGQ);
+    shake(&epk[EXPANDED_PK_PKH], BYTES_PKHASH, pk, CRYPTO_PUBLICKEYBYTES);
+    return OQS_SUCCESS;
+}
+
+
+OQS_STATUS crypto_kem_enc_expanded(unsigned char *ct, unsigned char *ss, const unsigned char *epk)
+{ // FrodoKEM's key encapsulation against a public key expanded by crypto_kem_expand_pk
+    return kem_enc_internal(ct, ss, &epk[EXPANDED_PK_PKH], (const uint16_t *)&epk[EXPANDED_PK_B], NULL, (const uint16_t *)&epk[EXPANDED_PK_A]);
+}
+
+
+static OQS_STATUS kem_dec_internal(unsigned char *ss, const unsigned char *ct, const uint8_t *sk_s, const uint8_t *sk_pkh, const uint16_t *S, const uint16_t *B, const uint8_t *pk_seedA, const uint16_t *A)
+{ // FrodoKEM's key decapsulation, given S and B unpacked, and either seed_A or A expanded (A == NULL generates A on-the-fly)
     uint16_t Bp[PARAMS_N*PARAMS_NBAR] = {0};
     uint16_t W[PARAMS_NBAR*PARAMS_NBAR] = {0};                // contains secret data
     uint16_t C[PARAMS_NBAR*PARAMS_NBAR] = {0};
@@ -145,13 +185,6 @@ OQS_STATUS crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsi
     uint16_t *Epp = (uint16_t *)&Sp[2*PARAMS_N*PARAMS_NBAR];  // contains secret data
     const uint8_t *ct_c1 = &ct[0];
     const uint8_t *ct_c2 = &ct[(PARAMS_LOGQ*PARAMS_N*PARAMS_NBAR)/8];
-    const uint8_t *sk_s = &sk[0];
-    const uint8_t *sk_pk = &sk[CRYPTO_BYTES];
-    const uint16_t *sk_S = (uint16_t *) &sk[CRYPTO_BYTES + CRYPTO_PUBLICKEYBYTES];
-    uint16_t S[PARAMS_N * PARAMS_NBAR];                      // contains secret data
-    const uint8_t *sk_pkh = &sk[CRYPTO_BYTES + CRYPTO_PUBLICKEYBYTES + 2*PARAMS_N*PARAMS_NBAR];
-    const uint8_t *pk_seedA = &sk_pk[0];
-    const uint8_t *pk_b = &sk_pk[BYTES_SEED_A];
     uint8_t G2in[BYTES_PKHASH + BYTES_MU];                   // contains secret data via muprime
     uint8_t *pkh = &G2in[0];
     uint8_t *muprime = &G2in[BYTES_PKHASH];                  // contains secret data
@@ -163,10 +196,6 @@ OQS_STATUS crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsi
     uint8_t *Fin_k = &Fin[CRYPTO_CIPHERTEXTBYTES];           // contains secret data
     uint8_t shake_input_seedSEprime[1 + CRYPTO_BYTES];       // contains secret data
 
-    for (size_t i = 0; i < PARAMS_N * PARAMS_NBAR; i++) {
-        S[i] = LE_TO_UINT16(sk_S[i]);
-    }
-
     // Compute W = C - Bp*S (mod q), and decode the randomness mu
     frodo_unpack(Bp, PARAMS_N*PARAMS_NBAR, ct_c1, (PARAMS_LOGQ*PARAMS_N*PARAMS_NBAR)/8, PARAMS_LOGQ);
     frodo_unpack(C, PARAMS_NBAR*PARAMS_NBAR, ct_c2, (PARAMS_LOGQ*PARAMS_NBAR*PARAMS_NBAR)/8, PARAMS_LOGQ);
@@ -178,7 +207,7 @@ OQS_STATUS crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsi
     memcpy(pkh, sk_pkh, BYTES_PKHASH);
     shake(G2out, CRYPTO_BYTES + CRYPTO_BYTES, G2in, BYTES_PKHASH + BYTES_MU);
 
-    // Generate Sp and Ep, and compute BBp = Sp*A + Ep. Generate A on-the-fly
+    // Generate Sp and Ep, and compute BBp = Sp*A + Ep
     shake_input_seedSEprime[0] = 0x96;
     memcpy(&shake_input_seedSEprime[1], seedSEprime, CRYPTO_BYTES);
     shake((uint8_t*)Sp, (2*PARAMS_N+PARAMS_NBAR)*PARAMS_NBAR*sizeof(uint16_t), shake_input_seedSEprime, 1 + CRYPTO_BYTES);
@@ -187,11 +216,14 @@ OQS_STATUS crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsi
     }
     frodo_sample_n(Sp, PARAMS_N*PARAMS_NBAR);
     frodo_sample_n(Ep, PARAMS_N*PARAMS_NBAR);
-    frodo_mul_add_sa_plus_e(BBp, Sp, Ep, pk_seedA);
+    if (A == NULL) {
+        frodo_mul_add_sa_plus_e(BBp, Sp, Ep, pk_seedA);
+    } else {
+        frodo_mul_add_sa_plus_e_expanded(BBp, Sp, Ep, A);
+    }
 
     // Generate Epp, and compute W = Sp*B + Epp
     frodo_sample_n(Epp, PARAMS_NBAR*PARAMS_NBAR);
-    frodo_unpack(B, PARAMS_N*PARAMS_NBAR, pk_b, CRYPTO_PUBLICKEYBYTES - BYTES_SEED_A, PARAMS_LOGQ);
     frodo_mul_add_sb_plus_e(W, B, Sp, Epp);
 
     // Encode mu, and compute CC = W + enc(mu') (mod q)
@@ -216,7 +248,6 @@ OQS_STATUS crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsi
     // Cleanup:
     clear_bytes((uint8_t *)W, PARAMS_NBAR*PARAMS_NBAR*sizeof(uint16_t));
     clear_bytes((uint8_t *)Sp, PARAMS_N*PARAMS_NBAR*sizeof(uint16_t));
-    clear_bytes((uint8_t *)S, PARAMS_N*PARAMS_NBAR*sizeof(uint16_t));
     clear_bytes((uint8_t *)Ep, PARAMS_N*PARAMS_NBAR*sizeof(uint16_t));
     clear_bytes((uint8_t *)Epp, PARAMS_NBAR*PARAMS_NBAR*sizeof(uint16_t));
     clear_bytes(muprime, BYTES_MU);
@@ -225,3 +256,53 @@ OQS_STATUS crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsi
     clear_bytes(shake_input_seedSEprime, 1 + CRYPTO_BYTES);
     return OQS_SUCCESS;
 }
+
+
+OQS_STATUS crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
+{ // FrodoKEM's key decapsulation
+    uint16_t B[PARAMS_N*PARAMS_NBAR] = {0};
+    const uint8_t *sk_s = &sk[0];
+    const uint8_t *sk_pk = &sk[CRYPTO_BYTES];
+    const uint16_t *sk_S = (uint16_t *) &sk[CRYPTO_BYTES + CRYPTO_PUBLICKEYBYTES];
+    uint16_t S[PARAMS_N * PARAMS_NBAR];                      // contains secret data
+    const uint8_t *sk_pkh = &sk[CRYPTO_BYTES + CRYPTO_PUBLICKEYBYTES + 2*PARAMS_N*PARAMS_NBAR];
+    const uint8_t *pk_seedA = &sk_pk[0];
+    const uint8_t *pk_b = &sk_pk[BYTES_SEED_A];
+    OQS_STATUS ret;
+
+    for (size_t i = 0; i < PARAMS_N * PARAMS_NBAR; i++) {
+        S[i] = LE_TO_UINT16(sk_S[i]);
+    }
+    frodo_unpack(B, PARAMS_N*PARAMS_NBAR, pk_b, CRYPTO_PUBLICKEYBYTES - BYTES_SEED_A, PARAMS_LOGQ);
+
+    // Generate A on-the-fly
+    ret = kem_dec_internal(ss, ct, sk_s, sk_pkh, S, B, pk_seedA, NULL);
+
+    // Cleanup:
+    clear_bytes((uint8_t *)S, PARAMS_N*PARAMS_NBAR*sizeof(uint16_t));
+    return ret;
+}
+
+
+OQS_STATUS crypto_kem_expand_sk(unsigned char *esk, const unsigned char *sk)
+{ // Expand sk for crypto_kem_dec_expanded: generate A once, and unpack B and S
+    const uint8_t *sk_pk = &sk[CRYPTO_BYTES];
+    const uint16_t *sk_S = (uint16_t *) &sk[CRYPTO_BYTES + CRYPTO_PUBLICKEYBYTES];
+    uint16_t *S = (uint16_t *)&esk[EXPANDED_SK_S];
+
+    frodo_expand_a((uint16_t *)&esk[EXPANDED_SK_A], &sk_pk[0]);
+    frodo_unpack((uint16_t *)&esk[EXPANDED_SK_B], PARAMS_N*PARAMS_NBAR, &sk_pk[BYTES_SEED_A], CRYPTO_PUBLICKEYBYTES - BYTES_SEED_A, PARAMS_LOGQ);
+    for (size_t i = 0; i < PARAMS_N * PARAMS_NBAR; i++) {
+        S[i] = LE_TO_UINT16(sk_S[i]);
+    }
+    memcpy(&esk[EXPANDED_SK_SK], sk, CRYPTO_SECRETKEYBYTES);
+    return OQS_SUCCESS;
+}
+
+
+OQS_STATUS crypto_kem_dec_expanded(unsigned char *ss, const unsigned char *ct, const unsigned char *esk)
+{ // FrodoKEM's key decapsulation with a secret key expanded by crypto_kem_expand_sk
+    const uint8_t *sk = &esk[EXPANDED_SK_SK];
+    return kem_dec_internal(ss, ct, &sk[0], &sk[CRYPTO_BYTES + CRYPTO_PUBLICKEYBYTES + 2*PARAMS_N*PARAMS_NBAR],
+                            (const uint16_t *)&esk[EXPANDED_SK_S], (const uint16_t *)&esk[EXPANDED_SK_B], NULL, (const uint16_t *)&esk[EXPANDED_SK_A]);
+}
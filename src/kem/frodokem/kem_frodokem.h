@@ -10,10 +10,16 @@
 #define OQS_KEM_frodokem_640_aes_length_secret_key 19888
 #define OQS_KEM_frodokem_640_aes_length_ciphertext 9720
 #define OQS_KEM_frodokem_640_aes_length_shared_secret 16
+#define OQS_KEM_frodokem_640_aes_length_expanded_public_key 829456
+#define OQS_KEM_frodokem_640_aes_length_expanded_secret_key 859568
 OQS_KEM *OQS_KEM_frodokem_640_aes_new(void);
 OQS_API OQS_STATUS OQS_KEM_frodokem_640_aes_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_frodokem_640_aes_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_frodokem_640_aes_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_640_aes_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_640_aes_encaps_expanded(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_640_aes_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_640_aes_decaps_expanded(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *expanded_secret_key);
 #endif
 
 #ifdef OQS_ENABLE_KEM_frodokem_640_shake
@@ -21,10 +27,16 @@ OQS_API OQS_STATUS OQS_KEM_frodokem_640_aes_decaps(uint8_t *shared_secret, const
 #define OQS_KEM_frodokem_640_shake_length_secret_key 19888
 #define OQS_KEM_frodokem_640_shake_length_ciphertext 9720
 #define OQS_KEM_frodokem_640_shake_length_shared_secret 16
+#define OQS_KEM_frodokem_640_shake_length_expanded_public_key 829456
+#define OQS_KEM_frodokem_640_shake_length_expanded_secret_key 859568
 OQS_KEM *OQS_KEM_frodokem_640_shake_new(void);
 OQS_API OQS_STATUS OQS_KEM_frodokem_640_shake_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_frodokem_640_shake_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_frodokem_640_shake_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_640_shake_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_640_shake_encaps_expanded(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_640_shake_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_640_shake_decaps_expanded(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *expanded_secret_key);
 #endif
 
 #ifdef OQS_ENABLE_KEM_frodokem_976_aes
@@ -32,10 +44,16 @@ OQS_API OQS_STATUS OQS_KEM_frodokem_640_shake_decaps(uint8_t *shared_secret, con
 #define OQS_KEM_frodokem_976_aes_length_secret_key 31296
 #define OQS_KEM_frodokem_976_aes_length_ciphertext 15744
 #define OQS_KEM_frodokem_976_aes_length_shared_secret 24
+#define OQS_KEM_frodokem_976_aes_length_expanded_public_key 1920792
+#define OQS_KEM_frodokem_976_aes_length_expanded_secret_key 1967680
 OQS_KEM *OQS_KEM_frodokem_976_aes_new(void);
 OQS_API OQS_STATUS OQS_KEM_frodokem_976_aes_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_frodokem_976_aes_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_frodokem_976_aes_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_976_aes_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_976_aes_encaps_expanded(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_976_aes_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_976_aes_decaps_expanded(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *expanded_secret_key);
 #endif
 
 #ifdef OQS_ENABLE_KEM_frodokem_976_shake
@@ -43,10 +61,16 @@ OQS_API OQS_STATUS OQS_KEM_frodokem_976_aes_decaps(uint8_t *shared_secret, const
 #define OQS_KEM_frodokem_976_shake_length_secret_key 31296
 #define OQS_KEM_frodokem_976_shake_length_ciphertext 15744
 #define OQS_KEM_frodokem_976_shake_length_shared_secret 24
+#define OQS_KEM_frodokem_976_shake_length_expanded_public_key 1920792
+#define OQS_KEM_frodokem_976_shake_length_expanded_secret_key 1967680
 OQS_KEM *OQS_KEM_frodokem_976_shake_new(void);
 OQS_API OQS_STATUS OQS_KEM_frodokem_976_shake_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_frodokem_976_shake_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_frodokem_976_shake_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_976_shake_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_976_shake_encaps_expanded(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_976_shake_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_976_shake_decaps_expanded(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *expanded_secret_key);
 #endif
 
 #ifdef OQS_ENABLE_KEM_frodokem_1344_aes
@@ -54,10 +78,16 @@ OQS_API OQS_STATUS OQS_KEM_frodokem_976_shake_decaps(uint8_t *shared_secret, con
 #define OQS_KEM_frodokem_1344_aes_length_secret_key 43088
 #define OQS_KEM_frodokem_1344_aes_length_ciphertext 21632
 #define OQS_KEM_frodokem_1344_aes_length_shared_secret 32
+#define OQS_KEM_frodokem_1344_aes_length_expanded_public_key 3634208
+#define OQS_KEM_frodokem_1344_aes_length_expanded_secret_key 3698768
 OQS_KEM *OQS_KEM_frodokem_1344_aes_new(void);
 OQS_API OQS_STATUS OQS_KEM_frodokem_1344_aes_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_frodokem_1344_aes_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_frodokem_1344_aes_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_1344_aes_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_1344_aes_encaps_expanded(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_1344_aes_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_1344_aes_decaps_expanded(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *expanded_secret_key);
 #endif
 
 #ifdef OQS_ENABLE_KEM_frodokem_1344_shake
@@ -65,10 +95,16 @@ OQS_API OQS_STATUS OQS_KEM_frodokem_1344_aes_decaps(uint8_t *shared_secret, cons
 #define OQS_KEM_frodokem_1344_shake_length_secret_key 43088
 #define OQS_KEM_frodokem_1344_shake_length_ciphertext 21632
 #define OQS_KEM_frodokem_1344_shake_length_shared_secret 32
+#define OQS_KEM_frodokem_1344_shake_length_expanded_public_key 3634208
+#define OQS_KEM_frodokem_1344_shake_length_expanded_secret_key 3698768
 OQS_KEM *OQS_KEM_frodokem_1344_shake_new(void);
 OQS_API OQS_STATUS OQS_KEM_frodokem_1344_shake_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_frodokem_1344_shake_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_frodokem_1344_shake_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_1344_shake_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_1344_shake_encaps_expanded(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_1344_shake_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_frodokem_1344_shake_decaps_expanded(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *expanded_secret_key);
 #endif
 
 #endif // OQS_KEM_FRODOKEM_H
@@ -26,6 +26,17 @@ OQS_KEM *OQS_KEM_frodokem_640_aes_new(void) {
 	kem->keypair = OQS_KEM_frodokem_640_aes_keypair;
 	kem->encaps = OQS_KEM_frodokem_640_aes_encaps;
 	kem->decaps = OQS_KEM_frodokem_640_aes_decaps;
+	kem->keypair_batch = NULL;
+	kem->encaps_batch = NULL;
+	kem->decaps_batch = NULL;
+	kem->length_expanded_public_key = OQS_KEM_frodokem_640_aes_length_expanded_public_key;
+	kem->public_key_expand = OQS_KEM_frodokem_640_aes_public_key_expand;
+	kem->encaps_expanded = OQS_KEM_frodokem_640_aes_encaps_expanded;
+	kem->length_expanded_secret_key = OQS_KEM_frodokem_640_aes_length_expanded_secret_key;
+	kem->secret_key_expand = OQS_KEM_frodokem_640_aes_secret_key_expand;
+	kem->decaps_expanded = OQS_KEM_frodokem_640_aes_decaps_expanded;
+	kem->encaps_stream = NULL;
+	kem->keypair_parallel = NULL;
 
 	return kem;
 }
@@ -26,6 +26,17 @@ OQS_KEM *OQS_KEM_frodokem_976_shake_new(void) {
 	kem->keypair = OQS_KEM_frodokem_976_shake_keypair;
 	kem->encaps = OQS_KEM_frodokem_976_shake_encaps;
 	kem->decaps = OQS_KEM_frodokem_976_shake_decaps;
+	kem->keypair_batch = NULL;
+	kem->encaps_batch = NULL;
+	kem->decaps_batch = NULL;
+	kem->length_expanded_public_key = OQS_KEM_frodokem_976_shake_length_expanded_public_key;
+	kem->public_key_expand = OQS_KEM_frodokem_976_shake_public_key_expand;
+	kem->encaps_expanded = OQS_KEM_frodokem_976_shake_encaps_expanded;
+	kem->length_expanded_secret_key = OQS_KEM_frodokem_976_shake_length_expanded_secret_key;
+	kem->secret_key_expand = OQS_KEM_frodokem_976_shake_secret_key_expand;
+	kem->decaps_expanded = OQS_KEM_frodokem_976_shake_decaps_expanded;
+	kem->encaps_stream = NULL;
+	kem->keypair_parallel = NULL;
 
 	return kem;
 }
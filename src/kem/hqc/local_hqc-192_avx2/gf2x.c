@@ -0,0 +1,153 @@
+#include "gf2x.h"
+#include "parameters.h"
+#include <immintrin.h>
+#include <stddef.h>
+#include <stdint.h>
+/**
+ * @file gf2x.c
+ * @brief Implementation of multiplication of two polynomials using PCLMULQDQ
+ */
+
+/* Below this size (in 64-bit words), Karatsuba recursion costs more than it saves */
+#define SCHOOLBOOK_MAX_WORDS 8
+
+/**
+ * @brief Schoolbook multiplication of two polynomials of at most SCHOOLBOOK_MAX_WORDS words
+ *
+ * Each 64x64-bit carryless product is computed with PCLMULQDQ and accumulated
+ * at its word offset; overlapping halves are merged once at the end.
+ *
+ * @param[out] o The result o = a * b, of 2 * size words
+ * @param[in] a The first polynomial a
+ * @param[in] b The second polynomial b
+ * @param[in] size Length of the polynomials in words
+ */
+static void schoolbook_mul(uint64_t *o, const uint64_t *a, const uint64_t *b, size_t size) {
+    __m128i acc[2 * SCHOOLBOOK_MAX_WORDS - 1];
+    __m128i va;
+
+    for (size_t k = 0; k < 2 * size - 1; ++k) {
+        acc[k] = _mm_setzero_si128();
+    }
+
+    for (size_t i = 0; i < size; ++i) {
+        va = _mm_cvtsi64_si128((long long)a[i]);
+        for (size_t j = 0; j < size; ++j) {
+            acc[i + j] = _mm_xor_si128(acc[i + j], _mm_clmulepi64_si128(va, _mm_cvtsi64_si128((long long)b[j]), 0x00));
+        }
+    }
+
+    o[0] = (uint64_t)_mm_cvtsi128_si64(acc[0]);
+    for (size_t k = 1; k < 2 * size - 1; ++k) {
+        o[k] = (uint64_t)_mm_cvtsi128_si64(acc[k]) ^ (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(acc[k - 1], acc[k - 1]));
+    }
+    o[2 * size - 1] = (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(acc[2 * size - 2], acc[2 * size - 2]));
+}
+
+static void karatsuba_add1(uint64_t *alh, uint64_t *blh, const uint64_t *a, const uint64_t *b, size_t size_l, size_t size_h) {
+    for (size_t i = 0; i < size_h; ++i) {
+        alh[i] = a[i] ^ a[i + size_l];
+        blh[i] = b[i] ^ b[i + size_l];
+    }
+
+    if (size_h < size_l) {
+        alh[size_h] = a[size_h];
+        blh[size_h] = b[size_h];
+    }
+}
+
+static void karatsuba_add2(uint64_t *o, uint64_t *tmp1, const uint64_t *tmp2, size_t size_l, size_t size_h) {
+    for (size_t i = 0; i < (2 * size_l); ++i) {
+        tmp1[i] = tmp1[i] ^ o[i];
+    }
+
+    for (size_t i = 0; i < ( 2 * size_h); ++i) {
+        tmp1[i] = tmp1[i] ^ tmp2[i];
+    }
+
+    for (size_t i = 0; i <  (2 * size_l); ++i) {
+        o[i + size_l] = o[i + size_l] ^ tmp1[i];
+    }
+}
+
+/**
+ * Karatsuba multiplication of a and b, Implementation inspired from the NTL library.
+ * Operands of at most SCHOOLBOOK_MAX_WORDS words are multiplied directly.
+ *
+ * @param[out] o Polynomial
+ * @param[in] a Polynomial
+ * @param[in] b Polynomial
+ * @param[in] size Length of polynomial
+ * @param[in] stack Length of polynomial
+ */
+static void karatsuba(uint64_t *o, const uint64_t *a, const uint64_t *b, size_t size, uint64_t *stack) {
+    size_t size_l, size_h;
+    const uint64_t *ah, *bh;
+
+    if (size <= SCHOOLBOOK_MAX_WORDS) {
+        schoolbook_mul(o, a, b, size);
+        return;
+    }
+
+    size_h = size / 2;
+    size_l = (size + 1) / 2;
+
+    uint64_t *alh = stack;
+    uint64_t *blh = alh + size_l;
+    uint64_t *tmp1 = blh + size_l;
+    uint64_t *tmp2 = o + 2 * size_l;
+
+    stack += 4 * size_l;
+
+    ah = a + size_l;
+    bh = b + size_l;
+
+    karatsuba(o, a, b, size_l, stack);
+
+    karatsuba(tmp2, ah, bh, size_h, stack);
+
+    karatsuba_add1(alh, blh, a, b, size_l, size_h);
+
+    karatsuba(tmp1, alh, blh, size_l, stack);
+
+    karatsuba_add2(o, tmp1, tmp2, size_l, size_h);
+}
+
+/**
+ * @brief Compute o(x) = a(x) mod \f$ X^n - 1\f$
+ *
+ * This function computes the modular reduction of the polynomial a(x)
+ *
+ * @param[in] a Pointer to the polynomial a(x)
+ * @param[out] o Pointer to the result
+ */
+static void reduce(uint64_t *o, const uint64_t *a) {
+    uint64_t r;
+    uint64_t carry;
+
+    for (size_t i = 0; i < VEC_N_SIZE_64; ++i) {
+        r = a[i + VEC_N_SIZE_64 - 1] >> (PARAM_N & 0x3F);
+        carry = a[i + VEC_N_SIZE_64] << (64 - (PARAM_N & 0x3F));
+        o[i] = a[i] ^ r ^ carry;
+    }
+
+    o[VEC_N_SIZE_64 - 1] &= RED_MASK;
+}
+
+/**
+ * @brief Multiply two polynomials modulo \f$ X^n - 1\f$.
+ *
+ * This functions multiplies polynomials <b>v1</b> and <b>v2</b>.
+ * The multiplication is done modulo \f$ X^n - 1\f$.
+ *
+ * @param[out] o Product of <b>v1</b> and <b>v2</b>
+ * @param[in] v1 Pointer to the first polynomial
+ * @param[in] v2 Pointer to the second polynomial
+ */
+void PQCLEAN_HQC192_AVX2_vect_mul(uint64_t *o, const uint64_t *v1, const uint64_t *v2) {
+    uint64_t stack[VEC_N_SIZE_64 << 3] = {0};
+    uint64_t o_karat[VEC_N_SIZE_64 << 1] = {0};
+
+    karatsuba(o_karat, v1, v2, VEC_N_SIZE_64, stack);
+    reduce(o, o_karat);
+}
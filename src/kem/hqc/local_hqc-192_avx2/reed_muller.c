@@ -0,0 +1,216 @@
+#include "parameters.h"
+#include "reed_muller.h"
+#include <immintrin.h>
+#include <stdint.h>
+#include <string.h>
+/**
+ * @file reed_muller.c
+ * @brief Constant time implementation of Reed-Muller code RM(1,7) using AVX2
+ */
+
+// number of repeated code words
+#define MULTIPLICITY                   CEIL_DIVIDE(PARAM_N2, 128)
+
+// copy bit 0 into all bits of a 32 bit value
+#define BIT0MASK(x) (uint32_t)(-((x) & 1))
+
+/**
+ * @brief Encode a single byte into a single codeword using RM(1,7)
+ *
+ * Encoding matrix of this code:
+ * bit pattern (note that bits are numbered big endian)
+ * 0   aaaaaaaa aaaaaaaa aaaaaaaa aaaaaaaa
+ * 1   cccccccc cccccccc cccccccc cccccccc
+ * 2   f0f0f0f0 f0f0f0f0 f0f0f0f0 f0f0f0f0
+ * 3   ff00ff00 ff00ff00 ff00ff00 ff00ff00
+ * 4   ffff0000 ffff0000 ffff0000 ffff0000
+ * 5   ffffffff 00000000 ffffffff 00000000
+ * 6   ffffffff ffffffff 00000000 00000000
+ * 7   ffffffff ffffffff ffffffff ffffffff
+ *
+ * @param[out] word An RM(1,7) codeword
+ * @param[in] message A message
+ */
+static void encode(uint64_t *cword, uint8_t message) {
+    uint32_t first_word;
+    // bit 7 flips all the bits, do that first to save work
+    first_word = BIT0MASK(message >> 7);
+    // bits 0, 1, 2, 3, 4 are the same for all four longs
+    // (Warning: in the bit matrix above, low bits are at the left!)
+    first_word ^= BIT0MASK(message >> 0) & 0xaaaaaaaa;
+    first_word ^= BIT0MASK(message >> 1) & 0xcccccccc;
+    first_word ^= BIT0MASK(message >> 2) & 0xf0f0f0f0;
+    first_word ^= BIT0MASK(message >> 3) & 0xff00ff00;
+    first_word ^= BIT0MASK(message >> 4) & 0xffff0000;
+    // we can store this in the first quarter
+    cword[0] = first_word;
+    // bit 5 flips entries 1 and 3; bit 6 flips 2 and 3
+    first_word ^= BIT0MASK(message >> 5);
+    cword[0] |= (uint64_t)first_word << 32;
+    first_word ^= BIT0MASK(message >> 6);
+    cword[1] = (uint64_t)first_word << 32;
+    first_word ^= BIT0MASK(message >> 5);
+    cword[1] |= first_word;
+}
+
+/**
+ * @brief Hadamard transform
+ *
+ * Perform hadamard transform of src and store result in dst
+ * src is overwritten
+ *
+ * Each pass replaces the 128 entries by the sums of adjacent pairs followed by
+ * their differences; with 16 entries per vector, a pass is four horizontal
+ * additions and subtractions whose lanes are put back in order by a permute.
+ *
+ * @param[out] src Structure that contain the expanded codeword
+ * @param[out] dst Structure that contain the expanded codeword
+ */
+static void hadamard(__m256i src[8], __m256i dst[8]) {
+    // the passes move data:
+    // src -> dst -> src -> dst -> src -> dst -> src -> dst
+    // using p1 and p2 alternately
+    __m256i *p1 = src;
+    __m256i *p2 = dst;
+    __m256i *p3;
+    for (size_t pass = 0; pass < 7; ++pass) {
+        for (size_t i = 0; i < 4; ++i) {
+            p2[i] = _mm256_permute4x64_epi64(_mm256_hadd_epi16(p1[2 * i], p1[2 * i + 1]), 0xd8);
+            p2[i + 4] = _mm256_permute4x64_epi64(_mm256_hsub_epi16(p1[2 * i], p1[2 * i + 1]), 0xd8);
+        }
+        // swap p1, p2 for next round
+        p3 = p1;
+        p1 = p2;
+        p2 = p3;
+    }
+}
+
+/**
+ * @brief Add multiple codewords into expanded codeword
+ *
+ * Accesses memory in order
+ * Note: this does not write the codewords as -1 or +1 as the green machine does
+ * instead, just 0 and 1 is used.
+ * The resulting hadamard transform has:
+ * all values are halved
+ * the first entry is 64 too high
+ *
+ * Each group of 16 bits is broadcast to all lanes and lane j keeps bit j, so a
+ * set bit adds one to its lane.
+ *
+ * @param[out] dest Structure that contain the expanded codeword
+ * @param[in] src Structure that contain the codeword
+ */
+static void expand_and_sum(__m256i dest[8], const uint64_t src[2 * MULTIPLICITY]) {
+    const __m256i bit_mask = _mm256_setr_epi16(0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0020, 0x0040, 0x0080,
+                             0x0100, 0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, (short)0x8000);
+    __m256i bits;
+
+    for (size_t i = 0; i < 8; ++i) {
+        dest[i] = _mm256_setzero_si256();
+        for (size_t copy = 0; copy < MULTIPLICITY; ++copy) {
+            bits = _mm256_set1_epi16((short)(src[2 * copy + i / 4] >> (16 * (i % 4))));
+            // subtracting the all-ones lanes of the comparison adds one
+            dest[i] = _mm256_sub_epi16(dest[i], _mm256_cmpeq_epi16(_mm256_and_si256(bits, bit_mask), bit_mask));
+        }
+    }
+}
+
+/**
+ * @brief Finding the location of the highest value
+ *
+ * This is the final step of the green machine: find the location of the highest value,
+ * and add 128 if the peak is positive
+ * if there are two identical peaks, the peak with smallest value
+ * in the lowest 7 bits it taken
+ *
+ * The highest absolute value and then the smallest position holding it are
+ * found with vector maxima and minima, reduced with PHMINPOSUW.
+ * @param[in] transform Structure that contain the expanded codeword
+ */
+static uint8_t find_peaks(const __m256i transform[8]) {
+    const __m256i lane_index = _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m256i abs[8];
+    __m256i peak_abs = _mm256_setzero_si256();
+    __m256i peak_pos = _mm256_set1_epi16(-1);
+    __m256i peak_neg = _mm256_setzero_si256();
+    __m256i index, mask;
+    __m128i r;
+    uint16_t pos;
+    uint32_t neg;
+
+    for (size_t i = 0; i < 8; ++i) {
+        abs[i] = _mm256_abs_epi16(transform[i]);
+        peak_abs = _mm256_max_epi16(peak_abs, abs[i]);
+    }
+    // PHMINPOSUW finds a minimum, so look for the smallest 0x7fff - abs
+    r = _mm_max_epi16(_mm256_castsi256_si128(peak_abs), _mm256_extracti128_si256(peak_abs, 1));
+    r = _mm_minpos_epu16(_mm_sub_epi16(_mm_set1_epi16(0x7fff), r));
+    peak_abs = _mm256_set1_epi16((short)(0x7fff - _mm_extract_epi16(r, 0)));
+
+    // positions not holding the peak become 0xffff
+    for (size_t i = 0; i < 8; ++i) {
+        index = _mm256_add_epi16(lane_index, _mm256_set1_epi16((short)(16 * i)));
+        mask = _mm256_cmpeq_epi16(abs[i], peak_abs);
+        peak_pos = _mm256_min_epu16(peak_pos, _mm256_or_si256(index, _mm256_xor_si256(mask, _mm256_set1_epi16(-1))));
+    }
+    r = _mm_min_epu16(_mm256_castsi256_si128(peak_pos), _mm256_extracti128_si256(peak_pos, 1));
+    pos = (uint16_t)_mm_extract_epi16(_mm_minpos_epu16(r), 0);
+
+    // collect the sign of the peak
+    for (size_t i = 0; i < 8; ++i) {
+        index = _mm256_add_epi16(lane_index, _mm256_set1_epi16((short)(16 * i)));
+        mask = _mm256_cmpeq_epi16(index, _mm256_set1_epi16((short)pos));
+        peak_neg = _mm256_or_si256(peak_neg, _mm256_and_si256(mask, transform[i]));
+    }
+    neg = (uint32_t)_mm256_movemask_epi8(peak_neg) & 0xaaaaaaaa;
+    neg = (neg | (0 - neg)) >> 31;
+
+    // set bit 7
+    pos |= 128 & (uint16_t)(neg - 1);
+    return (uint8_t) pos;
+}
+
+/**
+ * @brief Encodes the received word
+ *
+ * The message consists of N1 bytes each byte is encoded into PARAM_N2 bits,
+ * or MULTIPLICITY repeats of 128 bits
+ *
+ * @param[out] cdw Array of size VEC_N1N2_SIZE_64 receiving the encoded message
+ * @param[in] msg Array of size VEC_N1_SIZE_64 storing the message
+ */
+void PQCLEAN_HQC192_AVX2_reed_muller_encode(uint64_t *cdw, const uint8_t *msg) {
+    for (size_t i = 0; i < VEC_N1_SIZE_BYTES; ++i) {
+        // encode first word
+        encode(&cdw[2 * i * MULTIPLICITY], msg[i]);
+        // copy to other identical codewords
+        for (size_t copy = 1; copy < MULTIPLICITY; ++copy) {
+            memcpy(&cdw[2 * i * MULTIPLICITY + 2 * copy], &cdw[2 * i * MULTIPLICITY], 16);
+        }
+    }
+}
+
+/**
+ * @brief Decodes the received word
+ *
+ * Decoding uses fast hadamard transform, for a more complete picture on Reed-Muller decoding, see MacWilliams, Florence Jessie, and Neil James Alexander Sloane.
+ * The theory of error-correcting codes codes @cite macwilliams1977theory
+ *
+ * @param[out] msg Array of size VEC_N1_SIZE_64 receiving the decoded message
+ * @param[in] cdw Array of size VEC_N1N2_SIZE_64 storing the received word
+ */
+void PQCLEAN_HQC192_AVX2_reed_muller_decode(uint8_t *msg, const uint64_t *cdw) {
+    __m256i expanded[8];
+    __m256i transform[8];
+    for (size_t i = 0; i < VEC_N1_SIZE_BYTES; ++i) {
+        // collect the codewords
+        expand_and_sum(expanded, &cdw[2 * i * MULTIPLICITY]);
+        // apply hadamard transform
+        hadamard(expanded, transform);
+        // fix the first entry to get the half Hadamard transform
+        transform[0] = _mm256_sub_epi16(transform[0], _mm256_setr_epi16(64 * MULTIPLICITY, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0));
+        // finish the decoding
+        msg[i] = find_peaks(transform);
+    }
+}
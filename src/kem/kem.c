@@ -2,8 +2,8 @@
 
 #include <assert.h>
 #include <stdlib.h>
-#if defined(_WIN32)
 #include <string.h>
+#if defined(_WIN32)
 #define strcasecmp _stricmp
 #else
 #include <strings.h>
@@ -474,6 +474,19 @@ OQS_API OQS_STATUS OQS_KEM_keypair(const OQS_KEM *kem, uint8_t *public_key, uint
 	}
 }
 
+OQS_API OQS_STATUS OQS_KEM_keypair_parallel(const OQS_KEM *kem, uint8_t *public_key, uint8_t *secret_key, OQS_THREADPOOL *pool) {
+	if (pool == NULL) {
+		pool = OQS_THREADPOOL_get_default();
+	}
+	if (kem == NULL) {
+		return OQS_ERROR;
+	} else if (kem->keypair_parallel == NULL) {
+		return kem->keypair(public_key, secret_key);
+	} else {
+		return kem->keypair_parallel(public_key, secret_key, pool);
+	}
+}
+
 OQS_API OQS_STATUS OQS_KEM_encaps(const OQS_KEM *kem, uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key) {
 	if (kem == NULL) {
 		return OQS_ERROR;
@@ -482,6 +495,27 @@ OQS_API OQS_STATUS OQS_KEM_encaps(const OQS_KEM *kem, uint8_t *ciphertext, uint8
 	}
 }
 
+OQS_API OQS_STATUS OQS_KEM_encaps_stream(const OQS_KEM *kem, uint8_t *ciphertext, uint8_t *shared_secret, OQS_KEM_public_key_reader read_public_key, void *context) {
+	uint8_t *public_key;
+	OQS_STATUS rc;
+
+	if (kem == NULL || read_public_key == NULL) {
+		return OQS_ERROR;
+	} else if (kem->encaps_stream != NULL) {
+		return kem->encaps_stream(ciphertext, shared_secret, read_public_key, context);
+	}
+	public_key = OQS_MEM_malloc(kem->length_public_key);
+	if (public_key == NULL) {
+		return OQS_ERROR;
+	}
+	rc = read_public_key(context, public_key, kem->length_public_key);
+	if (rc == OQS_SUCCESS) {
+		rc = kem->encaps(ciphertext, shared_secret, public_key);
+	}
+	OQS_MEM_insecure_free(public_key);
+	return rc;
+}
+
 OQS_API OQS_STATUS OQS_KEM_decaps(const OQS_KEM *kem, uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key) {
 	if (kem == NULL) {
 		return OQS_ERROR;
@@ -490,6 +524,153 @@ OQS_API OQS_STATUS OQS_KEM_decaps(const OQS_KEM *kem, uint8_t *shared_secret, co
 	}
 }
 
+OQS_API OQS_STATUS OQS_KEM_keypair_batch(const OQS_KEM *kem, uint8_t *public_keys, uint8_t *secret_keys, size_t count) {
+	if (kem == NULL) {
+		return OQS_ERROR;
+	} else if (kem->keypair_batch != NULL) {
+		return kem->keypair_batch(public_keys, secret_keys, count);
+	}
+	for (size_t i = 0; i < count; i++) {
+		if (kem->keypair(public_keys + i * kem->length_public_key, secret_keys + i * kem->length_secret_key) != OQS_SUCCESS) {
+			return OQS_ERROR;
+		}
+	}
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_KEM_encaps_batch(const OQS_KEM *kem, uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_key, size_t count) {
+	if (kem == NULL) {
+		return OQS_ERROR;
+	} else if (kem->encaps_batch != NULL) {
+		return kem->encaps_batch(ciphertexts, shared_secrets, public_key, count);
+	}
+	for (size_t i = 0; i < count; i++) {
+		if (kem->encaps(ciphertexts + i * kem->length_ciphertext, shared_secrets + i * kem->length_shared_secret, public_key) != OQS_SUCCESS) {
+			return OQS_ERROR;
+		}
+	}
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_KEM_decaps_batch(const OQS_KEM *kem, uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_key, size_t count) {
+	if (kem == NULL) {
+		return OQS_ERROR;
+	} else if (kem->decaps_batch != NULL) {
+		return kem->decaps_batch(shared_secrets, ciphertexts, secret_key, count);
+	}
+	for (size_t i = 0; i < count; i++) {
+		if (kem->decaps(shared_secrets + i * kem->length_shared_secret, ciphertexts + i * kem->length_ciphertext, secret_key) != OQS_SUCCESS) {
+			return OQS_ERROR;
+		}
+	}
+	return OQS_SUCCESS;
+}
+
+struct OQS_KEM_expanded_public_key {
+	/* Algorithm the key was expanded for */
+	const char *method_name;
+	/* Expanded form, or a plain copy of the public key if the KEM has none */
+	uint8_t *data;
+};
+
+struct OQS_KEM_expanded_secret_key {
+	/* Algorithm the key was expanded for */
+	const char *method_name;
+	/* Expanded form, or a plain copy of the secret key if the KEM has none */
+	uint8_t *data;
+	size_t length;
+};
+
+static size_t expanded_key_alloc_length(size_t length) {
+	// OQS_MEM_aligned_alloc wants a size that is a multiple of the alignment
+	return (length + OQS_KEM_EXPANDED_KEY_ALIGNMENT - 1) & ~((size_t) OQS_KEM_EXPANDED_KEY_ALIGNMENT - 1);
+}
+
+OQS_API OQS_KEM_expanded_public_key *OQS_KEM_public_key_expand(const OQS_KEM *kem, const uint8_t *public_key) {
+	if (kem == NULL || public_key == NULL) {
+		return NULL;
+	}
+	OQS_KEM_expanded_public_key *expanded_public_key = OQS_MEM_malloc(sizeof(OQS_KEM_expanded_public_key));
+	if (expanded_public_key == NULL) {
+		return NULL;
+	}
+	expanded_public_key->method_name = kem->method_name;
+	size_t length = kem->public_key_expand != NULL ? kem->length_expanded_public_key : kem->length_public_key;
+	expanded_public_key->data = OQS_MEM_aligned_alloc(OQS_KEM_EXPANDED_KEY_ALIGNMENT, expanded_key_alloc_length(length));
+	if (expanded_public_key->data == NULL) {
+		OQS_MEM_insecure_free(expanded_public_key);
+		return NULL;
+	}
+	if (kem->public_key_expand == NULL) {
+		memcpy(expanded_public_key->data, public_key, kem->length_public_key);
+	} else if (kem->public_key_expand(expanded_public_key->data, public_key) != OQS_SUCCESS) {
+		OQS_KEM_expanded_public_key_free(expanded_public_key);
+		return NULL;
+	}
+	return expanded_public_key;
+}
+
+OQS_API OQS_STATUS OQS_KEM_encaps_expanded(const OQS_KEM *kem, uint8_t *ciphertext, uint8_t *shared_secret, const OQS_KEM_expanded_public_key *expanded_public_key) {
+	if (kem == NULL || expanded_public_key == NULL || strcmp(kem->method_name, expanded_public_key->method_name) != 0) {
+		return OQS_ERROR;
+	} else if (kem->encaps_expanded == NULL) {
+		return kem->encaps(ciphertext, shared_secret, expanded_public_key->data);
+	} else {
+		return kem->encaps_expanded(ciphertext, shared_secret, expanded_public_key->data);
+	}
+}
+
+OQS_API void OQS_KEM_expanded_public_key_free(OQS_KEM_expanded_public_key *expanded_public_key) {
+	if (expanded_public_key == NULL) {
+		return;
+	}
+	OQS_MEM_aligned_free(expanded_public_key->data);
+	OQS_MEM_insecure_free(expanded_public_key);
+}
+
+OQS_API OQS_KEM_expanded_secret_key *OQS_KEM_secret_key_expand(const OQS_KEM *kem, const uint8_t *secret_key) {
+	if (kem == NULL || secret_key == NULL) {
+		return NULL;
+	}
+	OQS_KEM_expanded_secret_key *expanded_secret_key = OQS_MEM_malloc(sizeof(OQS_KEM_expanded_secret_key));
+	if (expanded_secret_key == NULL) {
+		return NULL;
+	}
+	expanded_secret_key->method_name = kem->method_name;
+	expanded_secret_key->length = expanded_key_alloc_length(kem->secret_key_expand != NULL ? kem->length_expanded_secret_key : kem->length_secret_key);
+	expanded_secret_key->data = OQS_MEM_aligned_alloc(OQS_KEM_EXPANDED_KEY_ALIGNMENT, expanded_secret_key->length);
+	if (expanded_secret_key->data == NULL) {
+		OQS_MEM_insecure_free(expanded_secret_key);
+		return NULL;
+	}
+	if (kem->secret_key_expand == NULL) {
+		memcpy(expanded_secret_key->data, secret_key, kem->length_secret_key);
+	} else if (kem->secret_key_expand(expanded_secret_key->data, secret_key) != OQS_SUCCESS) {
+		OQS_KEM_expanded_secret_key_free(expanded_secret_key);
+		return NULL;
+	}
+	return expanded_secret_key;
+}
+
+OQS_API OQS_STATUS OQS_KEM_decaps_expanded(const OQS_KEM *kem, uint8_t *shared_secret, const uint8_t *ciphertext, const OQS_KEM_expanded_secret_key *expanded_secret_key) {
+	if (kem == NULL || expanded_secret_key == NULL || strcmp(kem->method_name, expanded_secret_key->method_name) != 0) {
+		return OQS_ERROR;
+	} else if (kem->decaps_expanded == NULL) {
+		return kem->decaps(shared_secret, ciphertext, expanded_secret_key->data);
+	} else {
+		return kem->decaps_expanded(shared_secret, ciphertext, expanded_secret_key->data);
+	}
+}
+
+OQS_API void OQS_KEM_expanded_secret_key_free(OQS_KEM_expanded_secret_key *expanded_secret_key) {
+	if (expanded_secret_key == NULL) {
+		return;
+	}
+	OQS_MEM_cleanse(expanded_secret_key->data, expanded_secret_key->length);
+	OQS_MEM_aligned_free(expanded_secret_key->data);
+	OQS_MEM_insecure_free(expanded_secret_key);
+}
+
 OQS_API void OQS_KEM_free(OQS_KEM *kem) {
 	OQS_MEM_insecure_free(kem);
 }
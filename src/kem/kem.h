@@ -127,6 +127,19 @@ OQS_API int OQS_KEM_alg_count(void);
  */
 OQS_API int OQS_KEM_alg_is_enabled(const char *method_name);
 
+/**
+ * Callback supplying a public key piecewise, for OQS_KEM_encaps_stream.
+ *
+ * Each call must write the next `length` bytes of the public key to `buffer`;
+ * successive calls walk the key once from front to back.
+ *
+ * @param[in] context The context passed to OQS_KEM_encaps_stream.
+ * @param[out] buffer The buffer to fill.
+ * @param[in] length The number of bytes to supply.
+ * @return OQS_SUCCESS, or OQS_ERROR if the bytes cannot be supplied.
+ */
+typedef OQS_STATUS (*OQS_KEM_public_key_reader)(void *context, uint8_t *buffer, size_t length);
+
 /**
  * Key encapsulation mechanism object
  */
@@ -199,8 +212,149 @@ typedef struct OQS_KEM {
 	 */
 	OQS_STATUS (*decaps)(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
 
+	/**
+	 * Batched keypair generation algorithm, producing `count` independent keypairs.
+	 *
+	 * Optional: may be NULL, in which case OQS_KEM_keypair_batch loops over `keypair`.
+	 *
+	 * @param[out] public_keys `count` public keys, stored consecutively.
+	 * @param[out] secret_keys `count` secret keys, stored consecutively.
+	 * @param[in] count The number of keypairs to generate.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*keypair_batch)(uint8_t *public_keys, uint8_t *secret_keys, size_t count);
+
+	/**
+	 * Batched encapsulation algorithm, producing `count` encapsulations against one public key.
+	 *
+	 * Optional: may be NULL, in which case OQS_KEM_encaps_batch loops over `encaps`.
+	 *
+	 * @param[out] ciphertexts `count` ciphertexts, stored consecutively.
+	 * @param[out] shared_secrets `count` shared secrets, stored consecutively.
+	 * @param[in] public_key The public key represented as a byte string.
+	 * @param[in] count The number of encapsulations to perform.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*encaps_batch)(uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_key, size_t count);
+
+	/**
+	 * Batched decapsulation algorithm, decapsulating `count` ciphertexts with one secret key.
+	 *
+	 * Optional: may be NULL, in which case OQS_KEM_decaps_batch loops over `decaps`.
+	 *
+	 * @param[out] shared_secrets `count` shared secrets, stored consecutively.
+	 * @param[in] ciphertexts `count` ciphertexts, stored consecutively.
+	 * @param[in] secret_key The secret key represented as a byte string.
+	 * @param[in] count The number of decapsulations to perform.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*decaps_batch)(uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_key, size_t count);
+
+	/** The length, in bytes, of expanded public keys for this KEM, or 0 if it has no expanded form. */
+	size_t length_expanded_public_key;
+
+	/**
+	 * Public key expansion algorithm, precomputing everything encapsulation derives
+	 * from the public key alone.
+	 *
+	 * Optional: may be NULL, in which case `length_expanded_public_key` is 0 and
+	 * OQS_KEM_public_key_expand keeps a copy of the public key instead.
+	 *
+	 * @param[out] expanded_public_key The expanded public key, `length_expanded_public_key`
+	 *             bytes aligned to OQS_KEM_EXPANDED_KEY_ALIGNMENT.
+	 * @param[in] public_key The public key represented as a byte string.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*public_key_expand)(uint8_t *expanded_public_key, const uint8_t *public_key);
+
+	/**
+	 * Encapsulation algorithm against a public key expanded by `public_key_expand`.
+	 *
+	 * Optional: NULL exactly when `public_key_expand` is NULL.
+	 *
+	 * @param[out] ciphertext The ciphertext (encapsulation) represented as a byte string.
+	 * @param[out] shared_secret The shared secret represented as a byte string.
+	 * @param[in] expanded_public_key The expanded public key.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*encaps_expanded)(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *expanded_public_key);
+
+	/** The length, in bytes, of expanded secret keys for this KEM, or 0 if it has no expanded form. */
+	size_t length_expanded_secret_key;
+
+	/**
+	 * Secret key expansion algorithm, precomputing everything decapsulation derives
+	 * from the secret key alone.
+	 *
+	 * Optional: may be NULL, in which case `length_expanded_secret_key` is 0 and
+	 * OQS_KEM_secret_key_expand keeps a copy of the secret key instead.
+	 *
+	 * @param[out] expanded_secret_key The expanded secret key, `length_expanded_secret_key`
+	 *             bytes aligned to OQS_KEM_EXPANDED_KEY_ALIGNMENT.
+	 * @param[in] secret_key The secret key represented as a byte string.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*secret_key_expand)(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+
+	/**
+	 * Decapsulation algorithm with a secret key expanded by `secret_key_expand`.
+	 *
+	 * Optional: NULL exactly when `secret_key_expand` is NULL.
+	 *
+	 * @param[out] shared_secret The shared secret represented as a byte string.
+	 * @param[in] ciphertext The ciphertext (encapsulation) represented as a byte string.
+	 * @param[in] expanded_secret_key The expanded secret key.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*decaps_expanded)(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *expanded_secret_key);
+
+	/**
+	 * Encapsulation algorithm reading the public key through a callback, a
+	 * bounded piece at a time, so that it is never held in memory as a whole.
+	 *
+	 * Optional: may be NULL, in which case OQS_KEM_encaps_stream reads the whole
+	 * public key into a temporary buffer and calls `encaps`.
+	 *
+	 * @param[out] ciphertext The ciphertext (encapsulation) represented as a byte string.
+	 * @param[out] shared_secret The shared secret represented as a byte string.
+	 * @param[in] read_public_key The callback supplying the public key.
+	 * @param[in] context The context passed to `read_public_key`.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*encaps_stream)(uint8_t *ciphertext, uint8_t *shared_secret, OQS_KEM_public_key_reader read_public_key, void *context);
+
+	/**
+	 * Keypair generation algorithm spreading its work over several threads.
+	 *
+	 * Optional: may be NULL, in which case OQS_KEM_keypair_parallel generates
+	 * the key pair in the calling thread only.
+	 *
+	 * @param[out] public_key The public key represented as a byte string.
+	 * @param[out] secret_key The secret key represented as a byte string.
+	 * @param[in] pool The thread pool to submit work to; NULL generates in the calling thread.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*keypair_parallel)(uint8_t *public_key, uint8_t *secret_key, OQS_THREADPOOL *pool);
+
 } OQS_KEM;
 
+/** Alignment, in bytes, required of buffers holding expanded keys. */
+#define OQS_KEM_EXPANDED_KEY_ALIGNMENT 32
+
+/**
+ * Opaque handle to a public key expanded for repeated encapsulation.
+ *
+ * Created by OQS_KEM_public_key_expand and released with OQS_KEM_expanded_public_key_free.
+ */
+typedef struct OQS_KEM_expanded_public_key OQS_KEM_expanded_public_key;
+
+/**
+ * Opaque handle to a secret key expanded for repeated decapsulation.
+ *
+ * Created by OQS_KEM_secret_key_expand and released with OQS_KEM_expanded_secret_key_free.
+ */
+typedef struct OQS_KEM_expanded_secret_key OQS_KEM_expanded_secret_key;
+
 /**
  * Constructs an OQS_KEM object for a particular algorithm.
  *
@@ -226,6 +380,23 @@ OQS_API OQS_KEM *OQS_KEM_new(const char *method_name);
  */
 OQS_API OQS_STATUS OQS_KEM_keypair(const OQS_KEM *kem, uint8_t *public_key, uint8_t *secret_key);
 
+/**
+ * Keypair generation algorithm using a thread pool.
+ *
+ * Generates the same key pair as OQS_KEM_keypair would from the same randomness.
+ * Classic McEliece rejects about 70% of seeds once its Gaussian
+ * elimination finds the matrix is not in systematic form; here it tries as many
+ * seeds at once as the pool has threads and keeps the first that works. Other
+ * KEMs generate the key pair in the calling thread.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[out] public_key The public key represented as a byte string.
+ * @param[out] secret_key The secret key represented as a byte string.
+ * @param[in] pool The thread pool to use, or NULL for the one set with OQS_THREADPOOL_set_default.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_keypair_parallel(const OQS_KEM *kem, uint8_t *public_key, uint8_t *secret_key, OQS_THREADPOOL *pool);
+
 /**
  * Encapsulation algorithm.
  *
@@ -241,6 +412,27 @@ OQS_API OQS_STATUS OQS_KEM_keypair(const OQS_KEM *kem, uint8_t *public_key, uint
  */
 OQS_API OQS_STATUS OQS_KEM_encaps(const OQS_KEM *kem, uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 
+/**
+ * Encapsulation algorithm with the public key supplied by a callback.
+ *
+ * Produces the same kind of ciphertext and shared secret as OQS_KEM_encaps, for
+ * public keys too large to keep around in memory: Classic McEliece reads its
+ * public key a few dozen rows at a time, straight from `read_public_key`, so
+ * the key can come from a file or socket without ever being held as a whole.
+ * Other KEMs read the whole key into a temporary buffer first.
+ *
+ * A public key in a memory-mapped file can also be passed to OQS_KEM_encaps
+ * directly; Classic McEliece walks it once, front to back.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[out] ciphertext The ciphertext (encapsulation) represented as a byte string.
+ * @param[out] shared_secret The shared secret represented as a byte string.
+ * @param[in] read_public_key The callback supplying the public key.
+ * @param[in] context The context passed to `read_public_key`.
+ * @return OQS_SUCCESS or OQS_ERROR, including when `read_public_key` fails.
+ */
+OQS_API OQS_STATUS OQS_KEM_encaps_stream(const OQS_KEM *kem, uint8_t *ciphertext, uint8_t *shared_secret, OQS_KEM_public_key_reader read_public_key, void *context);
+
 /**
  * Decapsulation algorithm.
  *
@@ -256,6 +448,189 @@ OQS_API OQS_STATUS OQS_KEM_encaps(const OQS_KEM *kem, uint8_t *ciphertext, uint8
  */
 OQS_API OQS_STATUS OQS_KEM_decaps(const OQS_KEM *kem, uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
 
+/**
+ * Batched keypair generation algorithm.
+ *
+ * Generates `count` independent keypairs. Public keys are written consecutively to
+ * `public_keys`, each `kem->length_public_key` bytes long, and likewise secret keys
+ * to `secret_keys`. Uses the scheme's batched implementation if it has one, and
+ * otherwise calls `kem->keypair` `count` times.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[out] public_keys The public keys represented as consecutive byte strings.
+ * @param[out] secret_keys The secret keys represented as consecutive byte strings.
+ * @param[in] count The number of keypairs to generate.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_keypair_batch(const OQS_KEM *kem, uint8_t *public_keys, uint8_t *secret_keys, size_t count);
+
+/**
+ * Batched encapsulation algorithm.
+ *
+ * Performs `count` encapsulations against the same public key. Ciphertexts and shared
+ * secrets are written consecutively to `ciphertexts` and `shared_secrets`, using the
+ * `length_*` members of `kem` as strides. Schemes with a batched implementation
+ * process the public key once for the whole batch; others call `kem->encaps` `count`
+ * times.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[out] ciphertexts The ciphertexts represented as consecutive byte strings.
+ * @param[out] shared_secrets The shared secrets represented as consecutive byte strings.
+ * @param[in] public_key The public key represented as a byte string.
+ * @param[in] count The number of encapsulations to perform.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_encaps_batch(const OQS_KEM *kem, uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_key, size_t count);
+
+/**
+ * Batched decapsulation algorithm.
+ *
+ * Decapsulates `count` consecutive ciphertexts with the same secret key, writing the
+ * shared secrets consecutively to `shared_secrets`. Schemes with a batched
+ * implementation process the secret key once for the whole batch; others call
+ * `kem->decaps` `count` times.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[out] shared_secrets The shared secrets represented as consecutive byte strings.
+ * @param[in] ciphertexts The ciphertexts represented as consecutive byte strings.
+ * @param[in] secret_key The secret key represented as a byte string.
+ * @param[in] count The number of decapsulations to perform.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_decaps_batch(const OQS_KEM *kem, uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_key, size_t count);
+
+/**
+ * Public key expansion.
+ *
+ * Precomputes, once, the parts of encapsulation that depend only on the public key
+ * (for ML-KEM and Kyber: the unpacked public key, the sampled matrix A^T and H(pk)),
+ * so that repeated encapsulations against the same key with OQS_KEM_encaps_expanded
+ * skip that work. For KEMs without an expanded form the handle simply holds a copy
+ * of the public key.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[in] public_key The public key represented as a byte string.
+ * @return A new expanded public key, or NULL on error. Must be freed with
+ *         OQS_KEM_expanded_public_key_free.
+ */
+OQS_API OQS_KEM_expanded_public_key *OQS_KEM_public_key_expand(const OQS_KEM *kem, const uint8_t *public_key);
+
+/**
+ * Encapsulation algorithm against an expanded public key.
+ *
+ * Produces the same kind of ciphertext and shared secret as OQS_KEM_encaps.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[out] ciphertext The ciphertext (encapsulation) represented as a byte string.
+ * @param[out] shared_secret The shared secret represented as a byte string.
+ * @param[in] expanded_public_key The public key, expanded for the same algorithm as `kem`.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_encaps_expanded(const OQS_KEM *kem, uint8_t *ciphertext, uint8_t *shared_secret, const OQS_KEM_expanded_public_key *expanded_public_key);
+
+/**
+ * Frees an expanded public key created by OQS_KEM_public_key_expand.
+ *
+ * @param[in] expanded_public_key The expanded public key to free; may be NULL.
+ */
+OQS_API void OQS_KEM_expanded_public_key_free(OQS_KEM_expanded_public_key *expanded_public_key);
+
+/**
+ * Secret key expansion.
+ *
+ * Precomputes, once, the parts of decapsulation that depend only on the secret key,
+ * so that repeated decapsulations with OQS_KEM_decaps_expanded skip that work. For
+ * ML-KEM and Kyber this is the unpacked secret vector s-hat together with the
+ * unpacked public key, the sampled matrix A^T and H(pk) used by the re-encryption
+ * check. For KEMs without an expanded form the handle simply holds a copy of the
+ * secret key.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[in] secret_key The secret key represented as a byte string.
+ * @return A new expanded secret key, or NULL on error. Must be freed with
+ *         OQS_KEM_expanded_secret_key_free.
+ */
+OQS_API OQS_KEM_expanded_secret_key *OQS_KEM_secret_key_expand(const OQS_KEM *kem, const uint8_t *secret_key);
+
+/**
+ * Decapsulation algorithm with an expanded secret key.
+ *
+ * Produces the same shared secret as OQS_KEM_decaps.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[out] shared_secret The shared secret represented as a byte string.
+ * @param[in] ciphertext The ciphertext (encapsulation) represented as a byte string.
+ * @param[in] expanded_secret_key The secret key, expanded for the same algorithm as `kem`.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_decaps_expanded(const OQS_KEM *kem, uint8_t *shared_secret, const uint8_t *ciphertext, const OQS_KEM_expanded_secret_key *expanded_secret_key);
+
+/**
+ * Zeroizes and frees an expanded secret key created by OQS_KEM_secret_key_expand.
+ *
+ * @param[in] expanded_secret_key The expanded secret key to free; may be NULL.
+ */
+OQS_API void OQS_KEM_expanded_secret_key_free(OQS_KEM_expanded_secret_key *expanded_secret_key);
+
+/**
+ * A bounded pool of pre-generated keypairs for one KEM.
+ *
+ * Servers that use a fresh (ephemeral) keypair per connection can take keypairs
+ * from a pool instead of generating them during the handshake. A background
+ * thread owned by the pool generates keys whenever half of them or more have
+ * been taken, using the scheme's batched key generation where it has one
+ * (see OQS_KEM_keypair_batch). Taking a keypair only copies it out of the pool
+ * and is lock-free. Secret keys are zeroized as soon as they are taken, and
+ * those left in the pool when it is freed are zeroized too.
+ *
+ * Without pthreads the pool is filled once, when it is created, and is not
+ * refilled; it must then not be used from several threads at the same time.
+ */
+typedef struct OQS_KEM_KEYPOOL OQS_KEM_KEYPOOL;
+
+/**
+ * Creates a keypair pool and starts filling it in the background.
+ *
+ * The refill thread calls OQS_randombytes concurrently with the application's
+ * threads, so the randomness source in use must be thread-safe.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM; it must outlive the pool.
+ * @param[in] capacity The number of keypairs the pool holds.
+ * @return The new pool, or NULL if `capacity` is 0 or memory or the refill
+ *         thread could not be allocated.
+ */
+OQS_API OQS_KEM_KEYPOOL *OQS_KEM_KEYPOOL_new(const OQS_KEM *kem, size_t capacity);
+
+/**
+ * Takes a keypair out of the pool.
+ *
+ * If the pool is empty, the keypair is generated in the calling thread with
+ * OQS_KEM_keypair instead, so the call only fails if that does.
+ *
+ * @param[in] pool The pool.
+ * @param[out] public_key The public key represented as a byte string.
+ * @param[out] secret_key The secret key represented as a byte string.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_KEYPOOL_take(OQS_KEM_KEYPOOL *pool, uint8_t *public_key, uint8_t *secret_key);
+
+/**
+ * Returns the number of keypairs currently in the pool, or 0 if `pool` is NULL.
+ * With a refill thread running the number may change at any time.
+ *
+ * @param[in] pool The pool.
+ * @return The number of keypairs in the pool.
+ */
+OQS_API size_t OQS_KEM_KEYPOOL_available(const OQS_KEM_KEYPOOL *pool);
+
+/**
+ * Stops the refill thread of a pool, zeroizes the keypairs left in it and frees it.
+ * The pool must not be in use.
+ *
+ * @param[in] pool The pool to free; may be NULL.
+ */
+OQS_API void OQS_KEM_KEYPOOL_free(OQS_KEM_KEYPOOL *pool);
+
 /**
  * Frees an OQS_KEM object that was constructed by OQS_KEM_new.
  *
@@ -0,0 +1,305 @@
+// SPDX-License-Identifier: MIT
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <oqs/oqs.h>
+
+#if defined(OQS_USE_PTHREADS) && !defined(__STDC_NO_ATOMICS__)
+#define KEYPOOL_BACKGROUND
+#include <stdatomic.h>
+
+#include "../common/thread_helpers.h"
+#endif
+
+/* Slot states. Only the refill thread fills EMPTY slots, and a consumer owns a
+ * slot from the moment it moves it from FULL to TAKEN until it marks it EMPTY. */
+#define SLOT_EMPTY 0
+#define SLOT_FULL 1
+#define SLOT_TAKEN 2
+
+#if defined(KEYPOOL_BACKGROUND)
+typedef atomic_int slot_state;
+typedef atomic_size_t slot_count;
+#else
+typedef int slot_state;
+typedef size_t slot_count;
+#endif
+
+struct OQS_KEM_KEYPOOL {
+	const OQS_KEM *kem;
+	size_t capacity;
+	/* a refill is requested once this many keys or fewer are left */
+	size_t low_watermark;
+	uint8_t *public_keys;
+	uint8_t *secret_keys;
+	slot_state *state;
+	slot_count available;
+	/* where the next consumer starts looking for a full slot */
+	slot_count next;
+#if defined(KEYPOOL_BACKGROUND)
+	atomic_int refill_requested;
+	pthread_t refill_thread;
+	/* Protects the two fields below; consumers only take it to wake the refill thread */
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	int shutdown;
+#endif
+};
+
+#if defined(KEYPOOL_BACKGROUND)
+
+static int slot_claim(OQS_KEM_KEYPOOL *pool, size_t i) {
+	int expected = SLOT_FULL;
+	return atomic_compare_exchange_strong(&pool->state[i], &expected, SLOT_TAKEN);
+}
+
+static void slot_set(OQS_KEM_KEYPOOL *pool, size_t i, int state) {
+	atomic_store(&pool->state[i], state);
+}
+
+static int slot_get(const OQS_KEM_KEYPOOL *pool, size_t i) {
+	return atomic_load(&pool->state[i]);
+}
+
+static size_t available_add(OQS_KEM_KEYPOOL *pool, size_t n) {
+	return atomic_fetch_add(&pool->available, n) + n;
+}
+
+static size_t available_sub(OQS_KEM_KEYPOOL *pool) {
+	return atomic_fetch_sub(&pool->available, 1) - 1;
+}
+
+static size_t next_slot(OQS_KEM_KEYPOOL *pool) {
+	return atomic_fetch_add(&pool->next, 1) % pool->capacity;
+}
+
+#else
+
+static int slot_claim(OQS_KEM_KEYPOOL *pool, size_t i) {
+	if (pool->state[i] != SLOT_FULL) {
+		return 0;
+	}
+	pool->state[i] = SLOT_TAKEN;
+	return 1;
+}
+
+static void slot_set(OQS_KEM_KEYPOOL *pool, size_t i, int state) {
+	pool->state[i] = state;
+}
+
+static int slot_get(const OQS_KEM_KEYPOOL *pool, size_t i) {
+	return pool->state[i];
+}
+
+static size_t available_add(OQS_KEM_KEYPOOL *pool, size_t n) {
+	return pool->available += n;
+}
+
+static size_t available_sub(OQS_KEM_KEYPOOL *pool) {
+	return --pool->available;
+}
+
+static size_t next_slot(OQS_KEM_KEYPOOL *pool) {
+	return pool->next++ % pool->capacity;
+}
+
+/* nothing refills the pool without a refill thread */
+static void request_refill(OQS_KEM_KEYPOOL *pool) {
+	(void)pool;
+}
+
+#endif
+
+/* Fills every empty slot, a run of adjacent empty slots at a time so that KEMs
+ * with a batched key generation (such as sntrup761) can use it. Only one thread
+ * at a time may call this. */
+static void refill(OQS_KEM_KEYPOOL *pool) {
+	const OQS_KEM *kem = pool->kem;
+	size_t i = 0, n;
+
+	while (i < pool->capacity) {
+		if (slot_get(pool, i) != SLOT_EMPTY) {
+			i++;
+			continue;
+		}
+		for (n = 1; i + n < pool->capacity && slot_get(pool, i + n) == SLOT_EMPTY; n++) {
+		}
+		if (OQS_KEM_keypair_batch(kem, pool->public_keys + i * kem->length_public_key, pool->secret_keys + i * kem->length_secret_key, n) != OQS_SUCCESS) {
+			/* leave the slots empty and retry on the next request */
+			OQS_MEM_cleanse(pool->secret_keys + i * kem->length_secret_key, n * kem->length_secret_key);
+			return;
+		}
+		/* count the keys before publishing them, so that a consumer never
+		 * takes `available` below zero */
+		available_add(pool, n);
+		for (size_t j = i; j < i + n; j++) {
+			slot_set(pool, j, SLOT_FULL);
+		}
+		i += n;
+	}
+}
+
+#if defined(KEYPOOL_BACKGROUND)
+
+static void *refill_main(void *arg) {
+	OQS_KEM_KEYPOOL *pool = arg;
+
+	pthread_mutex_lock(&pool->lock);
+	for (;;) {
+		while (!pool->shutdown && !atomic_load(&pool->refill_requested)) {
+			pthread_cond_wait(&pool->wake, &pool->lock);
+		}
+		if (pool->shutdown) {
+			pthread_mutex_unlock(&pool->lock);
+			return NULL;
+		}
+		atomic_store(&pool->refill_requested, 0);
+		pthread_mutex_unlock(&pool->lock);
+		refill(pool);
+		pthread_mutex_lock(&pool->lock);
+	}
+}
+
+static void request_refill(OQS_KEM_KEYPOOL *pool) {
+	/* only the first request after a refill started needs to wake the thread */
+	if (atomic_exchange(&pool->refill_requested, 1) == 0) {
+		pthread_mutex_lock(&pool->lock);
+		pthread_cond_signal(&pool->wake);
+		pthread_mutex_unlock(&pool->lock);
+	}
+}
+
+/* Starts the refill thread, which then fills the pool for the first time */
+static int start_refill_thread(OQS_KEM_KEYPOOL *pool) {
+	pthread_attr_t attr;
+	int rc;
+
+	atomic_init(&pool->refill_requested, 1);
+	if (pthread_mutex_init(&pool->lock, NULL) != 0) {
+		return -1;
+	}
+	if (pthread_cond_init(&pool->wake, NULL) != 0) {
+		pthread_mutex_destroy(&pool->lock);
+		return -1;
+	}
+	if (oqs_thread_attr_init(&attr) != 0) {
+		pthread_cond_destroy(&pool->wake);
+		pthread_mutex_destroy(&pool->lock);
+		return -1;
+	}
+	rc = pthread_create(&pool->refill_thread, &attr, refill_main, pool);
+	pthread_attr_destroy(&attr);
+	if (rc != 0) {
+		pthread_cond_destroy(&pool->wake);
+		pthread_mutex_destroy(&pool->lock);
+		return -1;
+	}
+	return 0;
+}
+
+static void stop_refill_thread(OQS_KEM_KEYPOOL *pool) {
+	pthread_mutex_lock(&pool->lock);
+	pool->shutdown = 1;
+	pthread_cond_signal(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+	pthread_join(pool->refill_thread, NULL);
+	pthread_cond_destroy(&pool->wake);
+	pthread_mutex_destroy(&pool->lock);
+}
+
+#endif
+
+OQS_API OQS_KEM_KEYPOOL *OQS_KEM_KEYPOOL_new(const OQS_KEM *kem, size_t capacity) {
+	OQS_KEM_KEYPOOL *pool;
+
+	if (kem == NULL || capacity == 0 || capacity > SIZE_MAX / kem->length_public_key || capacity > SIZE_MAX / kem->length_secret_key) {
+		return NULL;
+	}
+	pool = OQS_MEM_calloc(1, sizeof(OQS_KEM_KEYPOOL));
+	if (pool == NULL) {
+		return NULL;
+	}
+	pool->kem = kem;
+	pool->capacity = capacity;
+	pool->low_watermark = capacity / 2;
+	pool->public_keys = OQS_MEM_malloc(capacity * kem->length_public_key);
+	pool->secret_keys = OQS_MEM_malloc(capacity * kem->length_secret_key);
+	pool->state = OQS_MEM_calloc(capacity, sizeof(slot_state));
+	if (pool->public_keys == NULL || pool->secret_keys == NULL || pool->state == NULL) {
+		goto err;
+	}
+#if defined(KEYPOOL_BACKGROUND)
+	for (size_t i = 0; i < capacity; i++) {
+		atomic_init(&pool->state[i], SLOT_EMPTY);
+	}
+	atomic_init(&pool->available, 0);
+	atomic_init(&pool->next, 0);
+	if (start_refill_thread(pool) != 0) {
+		goto err;
+	}
+#else
+	refill(pool);
+#endif
+	return pool;
+
+err:
+	OQS_MEM_insecure_free(pool->public_keys);
+	OQS_MEM_insecure_free(pool->secret_keys);
+	OQS_MEM_insecure_free(pool->state);
+	OQS_MEM_insecure_free(pool);
+	return NULL;
+}
+
+OQS_API OQS_STATUS OQS_KEM_KEYPOOL_take(OQS_KEM_KEYPOOL *pool, uint8_t *public_key, uint8_t *secret_key) {
+	const OQS_KEM *kem;
+	size_t start, i;
+
+	if (pool == NULL || public_key == NULL || secret_key == NULL) {
+		return OQS_ERROR;
+	}
+	kem = pool->kem;
+	start = next_slot(pool);
+	for (size_t k = 0; k < pool->capacity; k++) {
+		i = (start + k) % pool->capacity;
+		if (!slot_claim(pool, i)) {
+			continue;
+		}
+		memcpy(public_key, pool->public_keys + i * kem->length_public_key, kem->length_public_key);
+		memcpy(secret_key, pool->secret_keys + i * kem->length_secret_key, kem->length_secret_key);
+		OQS_MEM_cleanse(pool->secret_keys + i * kem->length_secret_key, kem->length_secret_key);
+		slot_set(pool, i, SLOT_EMPTY);
+		if (available_sub(pool) <= pool->low_watermark) {
+			request_refill(pool);
+		}
+		return OQS_SUCCESS;
+	}
+	/* the pool ran dry: generate the key pair here */
+	request_refill(pool);
+	return OQS_KEM_keypair(kem, public_key, secret_key);
+}
+
+OQS_API size_t OQS_KEM_KEYPOOL_available(const OQS_KEM_KEYPOOL *pool) {
+	if (pool == NULL) {
+		return 0;
+	}
+#if defined(KEYPOOL_BACKGROUND)
+	return atomic_load(&pool->available);
+#else
+	return pool->available;
+#endif
+}
+
+OQS_API void OQS_KEM_KEYPOOL_free(OQS_KEM_KEYPOOL *pool) {
+	if (pool == NULL) {
+		return;
+	}
+#if defined(KEYPOOL_BACKGROUND)
+	stop_refill_thread(pool);
+#endif
+	OQS_MEM_secure_free(pool->secret_keys, pool->capacity * pool->kem->length_secret_key);
+	OQS_MEM_insecure_free(pool->public_keys);
+	OQS_MEM_insecure_free(pool->state);
+	OQS_MEM_insecure_free(pool);
+}
@@ -10,10 +10,18 @@
 #define OQS_KEM_kyber_512_length_secret_key 1632
 #define OQS_KEM_kyber_512_length_ciphertext 768
 #define OQS_KEM_kyber_512_length_shared_secret 32
+#define OQS_KEM_kyber_512_length_expanded_public_key 3104
+#define OQS_KEM_kyber_512_length_expanded_secret_key 4160
 OQS_KEM *OQS_KEM_kyber_512_new(void);
 OQS_API OQS_STATUS OQS_KEM_kyber_512_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_kyber_512_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_kyber_512_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_kyber_512_encaps_batch(uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_key, size_t count);
+OQS_API OQS_STATUS OQS_KEM_kyber_512_decaps_batch(uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_key, size_t count);
+OQS_API OQS_STATUS OQS_KEM_kyber_512_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_KEM_kyber_512_encaps_expanded(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_KEM_kyber_512_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_kyber_512_decaps_expanded(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *expanded_secret_key);
 #endif
 
 #if defined(OQS_ENABLE_KEM_kyber_768)
@@ -21,10 +29,18 @@ OQS_API OQS_STATUS OQS_KEM_kyber_512_decaps(uint8_t *shared_secret, const uint8_
 #define OQS_KEM_kyber_768_length_secret_key 2400
 #define OQS_KEM_kyber_768_length_ciphertext 1088
 #define OQS_KEM_kyber_768_length_shared_secret 32
+#define OQS_KEM_kyber_768_length_expanded_public_key 6176
+#define OQS_KEM_kyber_768_length_expanded_secret_key 7744
 OQS_KEM *OQS_KEM_kyber_768_new(void);
 OQS_API OQS_STATUS OQS_KEM_kyber_768_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_kyber_768_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_kyber_768_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_kyber_768_encaps_batch(uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_key, size_t count);
+OQS_API OQS_STATUS OQS_KEM_kyber_768_decaps_batch(uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_key, size_t count);
+OQS_API OQS_STATUS OQS_KEM_kyber_768_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_KEM_kyber_768_encaps_expanded(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_KEM_kyber_768_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_kyber_768_decaps_expanded(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *expanded_secret_key);
 #endif
 
 #if defined(OQS_ENABLE_KEM_kyber_1024)
@@ -32,10 +48,18 @@ OQS_API OQS_STATUS OQS_KEM_kyber_768_decaps(uint8_t *shared_secret, const uint8_
 #define OQS_KEM_kyber_1024_length_secret_key 3168
 #define OQS_KEM_kyber_1024_length_ciphertext 1568
 #define OQS_KEM_kyber_1024_length_shared_secret 32
+#define OQS_KEM_kyber_1024_length_expanded_public_key 10272
+#define OQS_KEM_kyber_1024_length_expanded_secret_key 12352
 OQS_KEM *OQS_KEM_kyber_1024_new(void);
 OQS_API OQS_STATUS OQS_KEM_kyber_1024_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_kyber_1024_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_kyber_1024_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_kyber_1024_encaps_batch(uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_key, size_t count);
+OQS_API OQS_STATUS OQS_KEM_kyber_1024_decaps_batch(uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_key, size_t count);
+OQS_API OQS_STATUS OQS_KEM_kyber_1024_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_KEM_kyber_1024_encaps_expanded(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_KEM_kyber_1024_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_kyber_1024_decaps_expanded(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *expanded_secret_key);
 #endif
 
 #endif
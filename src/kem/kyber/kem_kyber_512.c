@@ -26,6 +26,17 @@ OQS_KEM *OQS_KEM_kyber_512_new(void) {
 	kem->keypair = OQS_KEM_kyber_512_keypair;
 	kem->encaps = OQS_KEM_kyber_512_encaps;
 	kem->decaps = OQS_KEM_kyber_512_decaps;
+	kem->keypair_batch = NULL;
+	kem->encaps_batch = OQS_KEM_kyber_512_encaps_batch;
+	kem->decaps_batch = OQS_KEM_kyber_512_decaps_batch;
+	kem->length_expanded_public_key = OQS_KEM_kyber_512_length_expanded_public_key;
+	kem->public_key_expand = OQS_KEM_kyber_512_public_key_expand;
+	kem->encaps_expanded = OQS_KEM_kyber_512_encaps_expanded;
+	kem->length_expanded_secret_key = OQS_KEM_kyber_512_length_expanded_secret_key;
+	kem->secret_key_expand = OQS_KEM_kyber_512_secret_key_expand;
+	kem->decaps_expanded = OQS_KEM_kyber_512_decaps_expanded;
+	kem->encaps_stream = NULL;
+	kem->keypair_parallel = NULL;
 
 	return kem;
 }
@@ -33,11 +44,23 @@ OQS_KEM *OQS_KEM_kyber_512_new(void) {
 extern int pqcrystals_kyber512_ref_keypair(uint8_t *pk, uint8_t *sk);
 extern int pqcrystals_kyber512_ref_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
 extern int pqcrystals_kyber512_ref_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+extern int pqcrystals_kyber512_ref_enc_batch(uint8_t *ct, uint8_t *ss, const uint8_t *pk, size_t count);
+extern int pqcrystals_kyber512_ref_dec_batch(uint8_t *ss, const uint8_t *ct, const uint8_t *sk, size_t count);
+extern int pqcrystals_kyber512_ref_expand_pk(uint8_t *epk, const uint8_t *pk);
+extern int pqcrystals_kyber512_ref_enc_expanded(uint8_t *ct, uint8_t *ss, const uint8_t *epk);
+extern int pqcrystals_kyber512_ref_expand_sk(uint8_t *esk, const uint8_t *sk);
+extern int pqcrystals_kyber512_ref_dec_expanded(uint8_t *ss, const uint8_t *ct, const uint8_t *esk);
 
 #if defined(OQS_ENABLE_KEM_kyber_512_avx2)
 extern int pqcrystals_kyber512_avx2_keypair(uint8_t *pk, uint8_t *sk);
 extern int pqcrystals_kyber512_avx2_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
 extern int pqcrystals_kyber512_avx2_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+extern int pqcrystals_kyber512_avx2_enc_batch(uint8_t *ct, uint8_t *ss, const uint8_t *pk, size_t count);
+extern int pqcrystals_kyber512_avx2_dec_batch(uint8_t *ss, const uint8_t *ct, const uint8_t *sk, size_t count);
+extern int pqcrystals_kyber512_avx2_expand_pk(uint8_t *epk, const uint8_t *pk);
+extern int pqcrystals_kyber512_avx2_enc_expanded(uint8_t *ct, uint8_t *ss, const uint8_t *epk);
+extern int pqcrystals_kyber512_avx2_expand_sk(uint8_t *esk, const uint8_t *sk);
+extern int pqcrystals_kyber512_avx2_dec_expanded(uint8_t *ss, const uint8_t *ct, const uint8_t *esk);
 #endif
 
 #if defined(OQS_ENABLE_KEM_kyber_512_aarch64)
@@ -185,4 +208,118 @@ OQS_API OQS_STATUS OQS_KEM_kyber_512_decaps(uint8_t *shared_secret, const uint8_
 #endif /* OQS_LIBJADE_BUILD */
 }
 
+OQS_API OQS_STATUS OQS_KEM_kyber_512_encaps_batch(uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_key, size_t count) {
+#if (defined(OQS_LIBJADE_BUILD) && defined(OQS_ENABLE_LIBJADE_KEM_kyber_512)) || defined(OQS_ENABLE_KEM_kyber_512_aarch64)
+	for (size_t i = 0; i < count; i++) {
+		if (OQS_KEM_kyber_512_encaps(ciphertexts + i * OQS_KEM_kyber_512_length_ciphertext, shared_secrets + i * OQS_KEM_kyber_512_length_shared_secret, public_key) != OQS_SUCCESS) {
+			return OQS_ERROR;
+		}
+	}
+	return OQS_SUCCESS;
+#else
+#if defined(OQS_ENABLE_KEM_kyber_512_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_kyber512_avx2_enc_batch(ciphertexts, shared_secrets, public_key, count);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_kyber512_ref_enc_batch(ciphertexts, shared_secrets, public_key, count);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_kyber512_ref_enc_batch(ciphertexts, shared_secrets, public_key, count);
+#endif
+#endif
+}
+
+OQS_API OQS_STATUS OQS_KEM_kyber_512_decaps_batch(uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_key, size_t count) {
+#if (defined(OQS_LIBJADE_BUILD) && defined(OQS_ENABLE_LIBJADE_KEM_kyber_512)) || defined(OQS_ENABLE_KEM_kyber_512_aarch64)
+	for (size_t i = 0; i < count; i++) {
+		if (OQS_KEM_kyber_512_decaps(shared_secrets + i * OQS_KEM_kyber_512_length_shared_secret, ciphertexts + i * OQS_KEM_kyber_512_length_ciphertext, secret_key) != OQS_SUCCESS) {
+			return OQS_ERROR;
+		}
+	}
+	return OQS_SUCCESS;
+#else
+#if defined(OQS_ENABLE_KEM_kyber_512_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_kyber512_avx2_dec_batch(shared_secrets, ciphertexts, secret_key, count);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_kyber512_ref_dec_batch(shared_secrets, ciphertexts, secret_key, count);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_kyber512_ref_dec_batch(shared_secrets, ciphertexts, secret_key, count);
+#endif
+#endif
+}
+
+OQS_API OQS_STATUS OQS_KEM_kyber_512_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key) {
+#if defined(OQS_ENABLE_KEM_kyber_512_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_kyber512_avx2_expand_pk(expanded_public_key, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_kyber512_ref_expand_pk(expanded_public_key, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_kyber512_ref_expand_pk(expanded_public_key, public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_KEM_kyber_512_encaps_expanded(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *expanded_public_key) {
+#if defined(OQS_ENABLE_KEM_kyber_512_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_kyber512_avx2_enc_expanded(ciphertext, shared_secret, expanded_public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_kyber512_ref_enc_expanded(ciphertext, shared_secret, expanded_public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_kyber512_ref_enc_expanded(ciphertext, shared_secret, expanded_public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_KEM_kyber_512_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key) {
+#if defined(OQS_ENABLE_KEM_kyber_512_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_kyber512_avx2_expand_sk(expanded_secret_key, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_kyber512_ref_expand_sk(expanded_secret_key, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_kyber512_ref_expand_sk(expanded_secret_key, secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_KEM_kyber_512_decaps_expanded(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *expanded_secret_key) {
+#if defined(OQS_ENABLE_KEM_kyber_512_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_kyber512_avx2_dec_expanded(shared_secret, ciphertext, expanded_secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_kyber512_ref_dec_expanded(shared_secret, ciphertext, expanded_secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_kyber512_ref_dec_expanded(shared_secret, ciphertext, expanded_secret_key);
+#endif
+}
+
 #endif
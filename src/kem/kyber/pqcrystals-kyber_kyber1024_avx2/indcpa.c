@@ -530,34 +530,34 @@ void indcpa_keypair(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
 }
 
 /*************************************************
-* Name:        indcpa_enc
+* Name:        indcpa_enc_expanded
 *
 * Description: Encryption function of the CPA-secure
-*              public-key encryption scheme underlying Kyber.
+*              public-key encryption scheme underlying Kyber,
+*              operating on a public key expanded by indcpa_expand_pk.
 *
 * Arguments:   - uint8_t *c: pointer to output ciphertext
 *                            (of length KYBER_INDCPA_BYTES bytes)
 *              - const uint8_t *m: pointer to input message
 *                                  (of length KYBER_INDCPA_MSGBYTES bytes)
-*              - const uint8_t *pk: pointer to input public key
-*                                   (of length KYBER_INDCPA_PUBLICKEYBYTES)
+*              - const polyvec *at: pointer to input transposed matrix A
+*                                   (KYBER_K polynomial vectors, NTT domain)
+*              - const polyvec *pkpv: pointer to input public-key polynomial vector
 *              - const uint8_t *coins: pointer to input random coins used as seed
 *                                      (of length KYBER_SYMBYTES) to deterministically
 *                                      generate all randomness
 **************************************************/
-void indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
-                const uint8_t m[KYBER_INDCPA_MSGBYTES],
-                const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
-                const uint8_t coins[KYBER_SYMBYTES])
+void indcpa_enc_expanded(uint8_t c[KYBER_INDCPA_BYTES],
+                         const uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const polyvec at[KYBER_K],
+                         const polyvec *pkpv,
+                         const uint8_t coins[KYBER_SYMBYTES])
 {
   unsigned int i;
-  uint8_t seed[KYBER_SYMBYTES];
-  polyvec sp, pkpv, ep, at[KYBER_K], b;
+  polyvec sp, ep, b;
   poly v, k, epp;
 
-  unpack_pk(&pkpv, seed, pk);
   poly_frommsg(&k, m);
-  gen_at(at, seed);
 
 #ifdef KYBER_90S
 #define NOISE_NBLOCKS ((KYBER_ETA1*KYBER_N/4)/AES256CTR_BLOCKBYTES) /* Assumes divisibility */
@@ -601,7 +601,7 @@ void indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
   // matrix-vector multiplication
   for(i=0;i<KYBER_K;i++)
     polyvec_basemul_acc_montgomery(&b.vec[i], &at[i], &sp);
-  polyvec_basemul_acc_montgomery(&v, &pkpv, &sp);
+  polyvec_basemul_acc_montgomery(&v, pkpv, &sp);
 
   polyvec_invntt_tomont(&b);
   poly_invntt_tomont(&v);
@@ -616,30 +616,79 @@ void indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
 }
 
 /*************************************************
-* Name:        indcpa_dec
+* Name:        indcpa_expand_pk
 *
-* Description: Decryption function of the CPA-secure
+* Description: Unpacks the public key and expands the transposed
+*              matrix A from its seed, so that both can be reused
+*              across several calls to indcpa_enc_expanded.
+*
+* Arguments:   - polyvec *at: pointer to output transposed matrix A
+*                             (KYBER_K polynomial vectors)
+*              - polyvec *pkpv: pointer to output public-key polynomial vector
+*              - const uint8_t *pk: pointer to input public key
+*                                   (of length KYBER_INDCPA_PUBLICKEYBYTES)
+**************************************************/
+void indcpa_expand_pk(polyvec at[KYBER_K],
+                      polyvec *pkpv,
+                      const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES])
+{
+  uint8_t seed[KYBER_SYMBYTES];
+
+  unpack_pk(pkpv, seed, pk);
+  gen_at(at, seed);
+}
+
+/*************************************************
+* Name:        indcpa_enc
+*
+* Description: Encryption function of the CPA-secure
 *              public-key encryption scheme underlying Kyber.
 *
+* Arguments:   - uint8_t *c: pointer to output ciphertext
+*                            (of length KYBER_INDCPA_BYTES bytes)
+*              - const uint8_t *m: pointer to input message
+*                                  (of length KYBER_INDCPA_MSGBYTES bytes)
+*              - const uint8_t *pk: pointer to input public key
+*                                   (of length KYBER_INDCPA_PUBLICKEYBYTES)
+*              - const uint8_t *coins: pointer to input random coins used as seed
+*                                      (of length KYBER_SYMBYTES) to deterministically
+*                                      generate all randomness
+**************************************************/
+void indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
+                const uint8_t m[KYBER_INDCPA_MSGBYTES],
+                const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+                const uint8_t coins[KYBER_SYMBYTES])
+{
+  polyvec pkpv, at[KYBER_K];
+
+  indcpa_expand_pk(at, &pkpv, pk);
+  indcpa_enc_expanded(c, m, at, &pkpv, coins);
+}
+
+/*************************************************
+* Name:        indcpa_dec_expanded
+*
+* Description: Decryption function of the CPA-secure
+*              public-key encryption scheme underlying Kyber,
+*              operating on a secret key expanded by indcpa_expand_sk.
+*
 * Arguments:   - uint8_t *m: pointer to output decrypted message
 *                            (of length KYBER_INDCPA_MSGBYTES)
 *              - const uint8_t *c: pointer to input ciphertext
 *                                  (of length KYBER_INDCPA_BYTES)
-*              - const uint8_t *sk: pointer to input secret key
-*                                   (of length KYBER_INDCPA_SECRETKEYBYTES)
+*              - const polyvec *skpv: pointer to input secret-key polynomial vector
 **************************************************/
-void indcpa_dec(uint8_t m[KYBER_INDCPA_MSGBYTES],
-                const uint8_t c[KYBER_INDCPA_BYTES],
-                const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES])
+void indcpa_dec_expanded(uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const uint8_t c[KYBER_INDCPA_BYTES],
+                         const polyvec *skpv)
 {
-  polyvec b, skpv;
+  polyvec b;
   poly v, mp;
 
   unpack_ciphertext(&b, &v, c);
-  unpack_sk(&skpv, sk);
 
   polyvec_ntt(&b);
-  polyvec_basemul_acc_montgomery(&mp, &skpv, &b);
+  polyvec_basemul_acc_montgomery(&mp, skpv, &b);
   poly_invntt_tomont(&mp);
 
   poly_sub(&mp, &v, &mp);
@@ -647,3 +696,42 @@ void indcpa_dec(uint8_t m[KYBER_INDCPA_MSGBYTES],
 
   poly_tomsg(m, &mp);
 }
+
+/*************************************************
+* Name:        indcpa_expand_sk
+*
+* Description: Unpacks the secret key for reuse across several
+*              calls to indcpa_dec_expanded.
+*
+* Arguments:   - polyvec *skpv: pointer to output secret-key polynomial vector
+*              - const uint8_t *sk: pointer to input secret key
+*                                   (of length KYBER_INDCPA_SECRETKEYBYTES)
+**************************************************/
+void indcpa_expand_sk(polyvec *skpv,
+                      const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES])
+{
+  unpack_sk(skpv, sk);
+}
+
+/*************************************************
+* Name:        indcpa_dec
+*
+* Description: Decryption function of the CPA-secure
+*              public-key encryption scheme underlying Kyber.
+*
+* Arguments:   - uint8_t *m: pointer to output decrypted message
+*                            (of length KYBER_INDCPA_MSGBYTES)
+*              - const uint8_t *c: pointer to input ciphertext
+*                                  (of length KYBER_INDCPA_BYTES)
+*              - const uint8_t *sk: pointer to input secret key
+*                                   (of length KYBER_INDCPA_SECRETKEYBYTES)
+**************************************************/
+void indcpa_dec(uint8_t m[KYBER_INDCPA_MSGBYTES],
+                const uint8_t c[KYBER_INDCPA_BYTES],
+                const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES])
+{
+  polyvec skpv;
+
+  indcpa_expand_sk(&skpv, sk);
+  indcpa_dec_expanded(m, c, &skpv);
+}
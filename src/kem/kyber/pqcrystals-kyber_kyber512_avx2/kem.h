@@ -1,8 +1,10 @@
 #ifndef KEM_H
 #define KEM_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "params.h"
+#include "polyvec.h"
 
 #define CRYPTO_SECRETKEYBYTES  KYBER_SECRETKEYBYTES
 #define CRYPTO_PUBLICKEYBYTES  KYBER_PUBLICKEYBYTES
@@ -29,6 +31,20 @@
 #endif
 #endif
 
+/* Public key unpacked and hashed once, for repeated encapsulation */
+typedef struct {
+  polyvec at[KYBER_K];
+  polyvec pkpv;
+  uint8_t hpk[KYBER_SYMBYTES];
+} expanded_pk;
+
+/* Secret key unpacked once, for repeated decapsulation */
+typedef struct {
+  polyvec skpv;
+  expanded_pk pk;
+  uint8_t z[KYBER_SYMBYTES];
+} expanded_sk;
+
 #define crypto_kem_keypair KYBER_NAMESPACE(keypair)
 int crypto_kem_keypair(uint8_t *pk, uint8_t *sk);
 
@@ -38,4 +54,22 @@ int crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
 #define crypto_kem_dec KYBER_NAMESPACE(dec)
 int crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
 
+#define crypto_kem_expand_pk KYBER_NAMESPACE(expand_pk)
+int crypto_kem_expand_pk(expanded_pk *epk, const uint8_t *pk);
+
+#define crypto_kem_enc_expanded KYBER_NAMESPACE(enc_expanded)
+int crypto_kem_enc_expanded(uint8_t *ct, uint8_t *ss, const expanded_pk *epk);
+
+#define crypto_kem_expand_sk KYBER_NAMESPACE(expand_sk)
+int crypto_kem_expand_sk(expanded_sk *esk, const uint8_t *sk);
+
+#define crypto_kem_dec_expanded KYBER_NAMESPACE(dec_expanded)
+int crypto_kem_dec_expanded(uint8_t *ss, const uint8_t *ct, const expanded_sk *esk);
+
+#define crypto_kem_enc_batch KYBER_NAMESPACE(enc_batch)
+int crypto_kem_enc_batch(uint8_t *ct, uint8_t *ss, const uint8_t *pk, size_t count);
+
+#define crypto_kem_dec_batch KYBER_NAMESPACE(dec_batch)
+int crypto_kem_dec_batch(uint8_t *ss, const uint8_t *ct, const uint8_t *sk, size_t count);
+
 #endif
@@ -1,5 +1,7 @@
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
+#include <oqs/kem_kyber.h>
 #include "params.h"
 #include "kem.h"
 #include "indcpa.h"
@@ -7,6 +9,17 @@
 #include "symmetric.h"
 #include "randombytes.h"
 
+/* The liboqs wrappers advertise these layouts as the expanded key lengths */
+#if   (KYBER_K == 2)
+#define OQS_LENGTH_EXPANDED(s) OQS_KEM_kyber_512_length_expanded_##s
+#elif (KYBER_K == 3)
+#define OQS_LENGTH_EXPANDED(s) OQS_KEM_kyber_768_length_expanded_##s
+#elif (KYBER_K == 4)
+#define OQS_LENGTH_EXPANDED(s) OQS_KEM_kyber_1024_length_expanded_##s
+#endif
+_Static_assert(sizeof(expanded_pk) == OQS_LENGTH_EXPANDED(public_key), "expanded_pk does not match the advertised length");
+_Static_assert(sizeof(expanded_sk) == OQS_LENGTH_EXPANDED(secret_key), "expanded_sk does not match the advertised length");
+
 /*************************************************
 * Name:        crypto_kem_keypair
 *
@@ -125,3 +138,194 @@ int crypto_kem_dec(uint8_t *ss,
   kdf(ss, kr, 2*KYBER_SYMBYTES);
   return 0;
 }
+
+/*************************************************
+* Name:        crypto_kem_expand_pk
+*
+* Description: Unpacks a public key, expands its matrix A^T and
+*              hashes it, for use with crypto_kem_enc_expanded
+*
+* Arguments:   - expanded_pk *epk: pointer to output expanded public key
+*              - const uint8_t *pk: pointer to input public key
+*                (an already allocated array of KYBER_PUBLICKEYBYTES bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_kem_expand_pk(expanded_pk *epk, const uint8_t *pk)
+{
+  indcpa_expand_pk(epk->at, &epk->pkpv, pk);
+  hash_h(epk->hpk, pk, KYBER_PUBLICKEYBYTES);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_kem_enc_expanded
+*
+* Description: Generates cipher text and shared
+*              secret for a public key expanded by crypto_kem_expand_pk
+*
+* Arguments:   - uint8_t *ct: pointer to output cipher text
+*                (an already allocated array of KYBER_CIPHERTEXTBYTES bytes)
+*              - uint8_t *ss: pointer to output shared secret
+*                (an already allocated array of KYBER_SSBYTES bytes)
+*              - const expanded_pk *epk: pointer to input expanded public key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_kem_enc_expanded(uint8_t *ct,
+                            uint8_t *ss,
+                            const expanded_pk *epk)
+{
+  uint8_t buf[2*KYBER_SYMBYTES];
+  /* Will contain key, coins */
+  uint8_t kr[2*KYBER_SYMBYTES];
+
+  randombytes(buf, KYBER_SYMBYTES);
+  /* Don't release system RNG output */
+  hash_h(buf, buf, KYBER_SYMBYTES);
+
+  /* Multitarget countermeasure for coins + contributory KEM */
+  memcpy(buf+KYBER_SYMBYTES, epk->hpk, KYBER_SYMBYTES);
+  hash_g(kr, buf, 2*KYBER_SYMBYTES);
+
+  /* coins are in kr+KYBER_SYMBYTES */
+  indcpa_enc_expanded(ct, buf, epk->at, &epk->pkpv, kr+KYBER_SYMBYTES);
+
+  /* overwrite coins in kr with H(c) */
+  hash_h(kr+KYBER_SYMBYTES, ct, KYBER_CIPHERTEXTBYTES);
+  /* hash concatenation of pre-k and H(c) to k */
+  kdf(ss, kr, 2*KYBER_SYMBYTES);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_kem_expand_sk
+*
+* Description: Unpacks a secret key together with the public key,
+*              matrix A^T and H(pk) needed for re-encryption, for use
+*              with crypto_kem_dec_expanded
+*
+* Arguments:   - expanded_sk *esk: pointer to output expanded secret key
+*              - const uint8_t *sk: pointer to input private key
+*                (an already allocated array of KYBER_SECRETKEYBYTES bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_kem_expand_sk(expanded_sk *esk, const uint8_t *sk)
+{
+  indcpa_expand_sk(&esk->skpv, sk);
+  indcpa_expand_pk(esk->pk.at, &esk->pk.pkpv, sk+KYBER_INDCPA_SECRETKEYBYTES);
+  memcpy(esk->pk.hpk, sk+KYBER_SECRETKEYBYTES-2*KYBER_SYMBYTES, KYBER_SYMBYTES);
+  memcpy(esk->z, sk+KYBER_SECRETKEYBYTES-KYBER_SYMBYTES, KYBER_SYMBYTES);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_kem_dec_expanded
+*
+* Description: Generates shared secret for given
+*              cipher text and secret key expanded by crypto_kem_expand_sk
+*
+* Arguments:   - uint8_t *ss: pointer to output shared secret
+*                (an already allocated array of KYBER_SSBYTES bytes)
+*              - const uint8_t *ct: pointer to input cipher text
+*                (an already allocated array of KYBER_CIPHERTEXTBYTES bytes)
+*              - const expanded_sk *esk: pointer to input expanded secret key
+*
+* Returns 0.
+*
+* On failure, ss will contain a pseudo-random value.
+**************************************************/
+int crypto_kem_dec_expanded(uint8_t *ss,
+                            const uint8_t *ct,
+                            const expanded_sk *esk)
+{
+  int fail;
+  uint8_t buf[2*KYBER_SYMBYTES];
+  /* Will contain key, coins */
+  uint8_t kr[2*KYBER_SYMBYTES];
+  uint8_t cmp[KYBER_CIPHERTEXTBYTES];
+
+  indcpa_dec_expanded(buf, ct, &esk->skpv);
+
+  /* Multitarget countermeasure for coins + contributory KEM */
+  memcpy(buf+KYBER_SYMBYTES, esk->pk.hpk, KYBER_SYMBYTES);
+  hash_g(kr, buf, 2*KYBER_SYMBYTES);
+
+  /* coins are in kr+KYBER_SYMBYTES */
+  indcpa_enc_expanded(cmp, buf, esk->pk.at, &esk->pk.pkpv, kr+KYBER_SYMBYTES);
+
+  fail = verify(ct, cmp, KYBER_CIPHERTEXTBYTES);
+
+  /* overwrite coins in kr with H(c) */
+  hash_h(kr+KYBER_SYMBYTES, ct, KYBER_CIPHERTEXTBYTES);
+
+  /* Overwrite pre-k with z on re-encryption failure */
+  cmov(kr, esk->z, KYBER_SYMBYTES, fail);
+
+  /* hash concatenation of pre-k and H(c) to k */
+  kdf(ss, kr, 2*KYBER_SYMBYTES);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_kem_enc_batch
+*
+* Description: Generates count ciphertexts and shared secrets
+*              for the same public key, expanding it only once
+*
+* Arguments:   - uint8_t *ct: pointer to output ciphertexts
+*                (an already allocated array of count*KYBER_CIPHERTEXTBYTES bytes)
+*              - uint8_t *ss: pointer to output shared secrets
+*                (an already allocated array of count*KYBER_SSBYTES bytes)
+*              - const uint8_t *pk: pointer to input public key
+*                (an already allocated array of KYBER_PUBLICKEYBYTES bytes)
+*              - size_t count: number of encapsulations
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_kem_enc_batch(uint8_t *ct,
+                         uint8_t *ss,
+                         const uint8_t *pk,
+                         size_t count)
+{
+  size_t i;
+  expanded_pk epk;
+
+  crypto_kem_expand_pk(&epk, pk);
+  for(i=0;i<count;i++)
+    crypto_kem_enc_expanded(ct+i*KYBER_CIPHERTEXTBYTES, ss+i*KYBER_SSBYTES, &epk);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_kem_dec_batch
+*
+* Description: Decapsulates count ciphertexts under the same
+*              secret key, expanding it only once
+*
+* Arguments:   - uint8_t *ss: pointer to output shared secrets
+*                (an already allocated array of count*KYBER_SSBYTES bytes)
+*              - const uint8_t *ct: pointer to input ciphertexts
+*                (an already allocated array of count*KYBER_CIPHERTEXTBYTES bytes)
+*              - const uint8_t *sk: pointer to input private key
+*                (an already allocated array of KYBER_SECRETKEYBYTES bytes)
+*              - size_t count: number of decapsulations
+*
+* Returns 0.
+*
+* On failure, the corresponding ss will contain a pseudo-random value.
+**************************************************/
+int crypto_kem_dec_batch(uint8_t *ss,
+                         const uint8_t *ct,
+                         const uint8_t *sk,
+                         size_t count)
+{
+  size_t i;
+  expanded_sk esk;
+
+  crypto_kem_expand_sk(&esk, sk);
+  for(i=0;i<count;i++)
+    crypto_kem_dec_expanded(ss+i*KYBER_SSBYTES, ct+i*KYBER_CIPHERTEXTBYTES, &esk);
+  return 0;
+}
@@ -19,9 +19,30 @@ void indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
                 const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
                 const uint8_t coins[KYBER_SYMBYTES]);
 
+#define indcpa_expand_pk KYBER_NAMESPACE(indcpa_expand_pk)
+void indcpa_expand_pk(polyvec at[KYBER_K],
+                      polyvec *pkpv,
+                      const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES]);
+
+#define indcpa_enc_expanded KYBER_NAMESPACE(indcpa_enc_expanded)
+void indcpa_enc_expanded(uint8_t c[KYBER_INDCPA_BYTES],
+                         const uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const polyvec at[KYBER_K],
+                         const polyvec *pkpv,
+                         const uint8_t coins[KYBER_SYMBYTES]);
+
 #define indcpa_dec KYBER_NAMESPACE(indcpa_dec)
 void indcpa_dec(uint8_t m[KYBER_INDCPA_MSGBYTES],
                 const uint8_t c[KYBER_INDCPA_BYTES],
                 const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]);
 
+#define indcpa_expand_sk KYBER_NAMESPACE(indcpa_expand_sk)
+void indcpa_expand_sk(polyvec *skpv,
+                      const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]);
+
+#define indcpa_dec_expanded KYBER_NAMESPACE(indcpa_dec_expanded)
+void indcpa_dec_expanded(uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const uint8_t c[KYBER_INDCPA_BYTES],
+                         const polyvec *skpv);
+
 #endif
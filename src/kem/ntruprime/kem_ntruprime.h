@@ -14,6 +14,7 @@ OQS_KEM *OQS_KEM_ntruprime_sntrup761_new(void);
 OQS_API OQS_STATUS OQS_KEM_ntruprime_sntrup761_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_ntruprime_sntrup761_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_ntruprime_sntrup761_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_ntruprime_sntrup761_keypair_batch(uint8_t *public_keys, uint8_t *secret_keys, size_t count);
 #endif
 
 #endif
@@ -26,6 +26,17 @@ OQS_KEM *OQS_KEM_ntruprime_sntrup761_new(void) {
 	kem->keypair = OQS_KEM_ntruprime_sntrup761_keypair;
 	kem->encaps = OQS_KEM_ntruprime_sntrup761_encaps;
 	kem->decaps = OQS_KEM_ntruprime_sntrup761_decaps;
+	kem->keypair_batch = OQS_KEM_ntruprime_sntrup761_keypair_batch;
+	kem->encaps_batch = NULL;
+	kem->decaps_batch = NULL;
+	kem->length_expanded_public_key = 0;
+	kem->public_key_expand = NULL;
+	kem->encaps_expanded = NULL;
+	kem->length_expanded_secret_key = 0;
+	kem->secret_key_expand = NULL;
+	kem->decaps_expanded = NULL;
+	kem->encaps_stream = NULL;
+	kem->keypair_parallel = NULL;
 
 	return kem;
 }
@@ -33,11 +44,13 @@ OQS_KEM *OQS_KEM_ntruprime_sntrup761_new(void) {
 extern int PQCLEAN_SNTRUP761_CLEAN_crypto_kem_keypair(uint8_t *pk, uint8_t *sk);
 extern int PQCLEAN_SNTRUP761_CLEAN_crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
 extern int PQCLEAN_SNTRUP761_CLEAN_crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+extern int PQCLEAN_SNTRUP761_CLEAN_crypto_kem_keypair_batch(uint8_t *pk, uint8_t *sk, size_t count);
 
 #if defined(OQS_ENABLE_KEM_ntruprime_sntrup761_avx2)
 extern int PQCLEAN_SNTRUP761_AVX2_crypto_kem_keypair(uint8_t *pk, uint8_t *sk);
 extern int PQCLEAN_SNTRUP761_AVX2_crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
 extern int PQCLEAN_SNTRUP761_AVX2_crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+extern int PQCLEAN_SNTRUP761_AVX2_crypto_kem_keypair_batch(uint8_t *pk, uint8_t *sk, size_t count);
 #endif
 
 OQS_API OQS_STATUS OQS_KEM_ntruprime_sntrup761_keypair(uint8_t *public_key, uint8_t *secret_key) {
@@ -88,4 +101,20 @@ OQS_API OQS_STATUS OQS_KEM_ntruprime_sntrup761_decaps(uint8_t *shared_secret, co
 #endif
 }
 
+OQS_API OQS_STATUS OQS_KEM_ntruprime_sntrup761_keypair_batch(uint8_t *public_keys, uint8_t *secret_keys, size_t count) {
+#if defined(OQS_ENABLE_KEM_ntruprime_sntrup761_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_SNTRUP761_AVX2_crypto_kem_keypair_batch(public_keys, secret_keys, count);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_SNTRUP761_CLEAN_crypto_kem_keypair_batch(public_keys, secret_keys, count);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_SNTRUP761_CLEAN_crypto_kem_keypair_batch(public_keys, secret_keys, count);
+#endif
+}
+
 #endif
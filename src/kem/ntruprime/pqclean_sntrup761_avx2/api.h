@@ -1,6 +1,7 @@
 #ifndef PQCLEAN_SNTRUP761_AVX2_API_H
 #define PQCLEAN_SNTRUP761_AVX2_API_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 
@@ -12,6 +13,7 @@
 #define PQCLEAN_SNTRUP761_AVX2_CRYPTO_BYTES 32
 
 int PQCLEAN_SNTRUP761_AVX2_crypto_kem_keypair(uint8_t *pk, uint8_t *sk);
+int PQCLEAN_SNTRUP761_AVX2_crypto_kem_keypair_batch(uint8_t *pk, uint8_t *sk, size_t count);
 int PQCLEAN_SNTRUP761_AVX2_crypto_kem_enc(uint8_t *c, uint8_t *k, const uint8_t *pk);
 int PQCLEAN_SNTRUP761_AVX2_crypto_kem_dec(uint8_t *k, const uint8_t *c, const uint8_t *sk);
 #endif
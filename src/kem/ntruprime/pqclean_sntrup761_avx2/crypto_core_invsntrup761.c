@@ -126,8 +126,9 @@ static inline void vectormodq_xswapeliminate(Fq *f, Fq *g, int len, const Fq f0,
     }
 }
 
-int PQCLEAN_SNTRUP761_AVX2_crypto_core_invsntrup761(unsigned char *outbytes, const unsigned char *inbytes) {
-    small *in = (void *) inbytes;
+/* out = 1/(3*in) in Rq */
+/* outbytes[2*p] is 0 if recip succeeded; else -1 */
+static void invsntrup761(unsigned char *outbytes, const Fq *in) {
     int loop;
     Fq out[p], f[ppad], g[ppad], v[ppad], r[ppad];
     Fq f0, g0;
@@ -213,5 +214,28 @@ int PQCLEAN_SNTRUP761_AVX2_crypto_core_invsntrup761(unsigned char *outbytes, con
 
     crypto_encode_pxint16(outbytes, out);
     outbytes[2 * p] = (unsigned char) int16_nonzero_mask((int16) delta);
+}
+
+int PQCLEAN_SNTRUP761_AVX2_crypto_core_invsntrup761(unsigned char *outbytes, const unsigned char *inbytes) {
+    small *in = (void *) inbytes;
+    Fq inq[p];
+    int i;
+
+    for (i = 0; i < p; ++i) {
+        inq[i] = (Fq) in[i];
+    }
+    invsntrup761(outbytes, inq);
+    return 0;
+}
+
+int PQCLEAN_SNTRUP761_AVX2_crypto_core_invsntrup761_rq(unsigned char *outbytes, const unsigned char *inbytes) {
+    Fq inq[p];
+    int i;
+
+    crypto_decode_pxint16(inq, inbytes);
+    for (i = 0; i < p; ++i) {
+        inq[i] = Fq_freeze(inq[i]);
+    }
+    invsntrup761(outbytes, inq);
     return 0;
 }
@@ -310,4 +310,79 @@ int PQCLEAN_SNTRUP761_AVX2_crypto_core_multsntrup761(unsigned char *outbytes, co
     crypto_encode_pxint16(outbytes, h);
 
     return 0;
+#undef f
+#undef g
+#undef fg
+#undef h
+}
+
+/* mult768 is exact only while every coefficient of the product stays below 7681*10753/2, */
+/* so the key is split into three digits g = g0 + 32*g1 + 1024*g2 with |gi| <= 16 */
+int PQCLEAN_SNTRUP761_AVX2_crypto_core_multsntrup761_rq(unsigned char *outbytes, const unsigned char *inbytes, const unsigned char *kbytes) {
+    vec768 x1, x2;
+    vec768 digits[3];
+    vec1536 products[3];
+#define f (x1.v)
+#define g (x2.v)
+#define h f
+    int16 *sum = products[0].v;
+    int i, j;
+    int16x16 x;
+
+    x = const_x16(0);
+    for (i = p & ~15; i < 768; i += 16) {
+        store_x16(&f[i], x);
+    }
+    for (i = p & ~15; i < 768; i += 16) {
+        store_x16(&g[i], x);
+    }
+
+    crypto_decode_pxint16(f, inbytes);
+    crypto_decode_pxint16(g, kbytes);
+
+    for (i = 0; i < 768; i += 16) {
+        x = load_x16(&f[i]);
+        x = freeze_4591_x16(squeeze_4591_x16(x));
+        store_x16(&f[i], x);
+        x = load_x16(&g[i]);
+        x = freeze_4591_x16(squeeze_4591_x16(x));
+        store_x16(&g[i], x);
+    }
+    for (i = 0; i < 768; ++i) {
+        int16 gi = g[i];
+        int16 d0 = (int16) (((gi + 16) & 31) - 16);
+        int16 t = (int16) ((gi - d0) / 32);
+        int16 d1 = (int16) (((t + 16) & 31) - 16);
+        digits[0].v[i] = d0;
+        digits[1].v[i] = d1;
+        digits[2].v[i] = (int16) ((t - d1) / 32);
+    }
+
+    for (j = 0; j < 3; ++j) {
+        mult768(products[j].v, f, digits[j].v);
+    }
+
+    /* products[0] + 32*products[1] + 1024*products[2], the constants being 32*2^16 and 1024*2^16 mod q */
+    for (i = 0; i < 1536; i += 16) {
+        x = add_x16(squeeze_4591_x16(load_x16(&products[0].v[i])), mulmod_4591_x16(load_x16(&products[1].v[i]), const_x16(-935)));
+        x = add_x16(x, mulmod_4591_x16(load_x16(&products[2].v[i]), const_x16(2217)));
+        store_x16(&sum[i], squeeze_4591_x16(x));
+    }
+
+    sum[0] = (int16) (sum[0] - sum[p - 1]);
+    for (i = 0; i < 768; i += 16) {
+        int16x16 fgi = load_x16(&sum[i]);
+        int16x16 fgip = load_x16(&sum[i + p]);
+        int16x16 fgip1 = load_x16(&sum[i + p - 1]);
+        x = add_x16(fgi, add_x16(fgip, fgip1));
+        x = freeze_4591_x16(squeeze_4591_x16(x));
+        store_x16(&h[i], x);
+    }
+
+    crypto_encode_pxint16(outbytes, h);
+
+    return 0;
+#undef f
+#undef g
+#undef h
 }
@@ -8,4 +8,7 @@
 #define PQCLEAN_SNTRUP761_AVX2_crypto_core_multsntrup761_CONSTBYTES 0
 
 int PQCLEAN_SNTRUP761_AVX2_crypto_core_multsntrup761(unsigned char *outbytes, const unsigned char *inbytes, const unsigned char *kbytes);
+
+/* as above, for a key of p int16 in Rq (KEYBYTES 1522) rather than p small */
+int PQCLEAN_SNTRUP761_AVX2_crypto_core_multsntrup761_rq(unsigned char *outbytes, const unsigned char *inbytes, const unsigned char *kbytes);
 #endif
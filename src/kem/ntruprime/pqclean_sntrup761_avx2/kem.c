@@ -1,5 +1,8 @@
 #include "api.h"
 #include "crypto_declassify.h"
+#include <oqs/common.h>
+#include <stddef.h>
+#include <string.h>
 #include "crypto_sort_uint32.h"
 #include "params.h"
 #include "randombytes.h"
@@ -59,6 +62,25 @@ static void Rq_recip3(Fq *out, const small *in) {
     crypto_decode_pxint16(out, (unsigned char *) out);
 }
 
+/* h = f*g in the ring Rq */
+static void Rq_mult(Fq *h, const Fq *f, const Fq *g) {
+    unsigned char fbytes[2 * p], gbytes[2 * p];
+    crypto_encode_pxint16(fbytes, f);
+    crypto_encode_pxint16(gbytes, g);
+    crypto_core_mult_rq((unsigned char *) h, fbytes, gbytes);
+    crypto_decode_pxint16(h, (unsigned char *) h);
+}
+
+/* out = 1/(3*in) in Rq, for any nonzero in */
+/* caller must have 2p+1 bytes free in out, not just 2p */
+static void Rq_recip3_rq(Fq *out, const Fq *in) {
+    unsigned char inbytes[2 * p];
+    crypto_encode_pxint16(inbytes, in);
+    crypto_core_inv_rq((unsigned char *) out, inbytes);
+    /* Rq is a field, so inv always works */
+    crypto_decode_pxint16(out, (unsigned char *) out);
+}
+
 /* ----- underlying hash function */
 
 #define Hash_bytes 32
@@ -136,6 +158,21 @@ static void Hide(unsigned char *x, unsigned char *c, unsigned char *r_enc, const
 }
 
 
+/* the rest of the secret key: a copy of pk, rho and Hash4(pk) */
+#define SecretKeys_total PQCLEAN_SNTRUP761_AVX2_CRYPTO_SECRETKEYBYTES
+
+static void SecretKey_finish(unsigned char *sk, const unsigned char *pk) {
+    int i;
+    unsigned char sksave = sk[SecretKeys_bytes - 1];
+    for (i = 0; i < PublicKeys_bytes; ++i) {
+        sk[SecretKeys_bytes + i] = pk[i];
+    }
+    sk[SecretKeys_bytes - 1] = 4;
+    Hash(sk + SecretKeys_bytes + PublicKeys_bytes + Small_bytes, sk + SecretKeys_bytes - 1, 1 + PublicKeys_bytes);
+    sk[SecretKeys_bytes - 1] = sksave;
+    randombytes(sk + SecretKeys_bytes + PublicKeys_bytes, Small_bytes);
+}
+
 int PQCLEAN_SNTRUP761_AVX2_crypto_kem_keypair(uint8_t *pk, uint8_t *sk) {
     small g[p];
     for (;;) {
@@ -163,16 +200,117 @@ int PQCLEAN_SNTRUP761_AVX2_crypto_kem_keypair(uint8_t *pk, uint8_t *sk) {
             Rq_encode(pk, h);
         }
     }
+    SecretKey_finish(sk, pk);
+    return 0;
+}
+
+/* ----- batch key generation */
+
+/* keys per batch; each batch shares one inversion in R3 and one in Rq */
+#define KEYPAIR_BATCH 32
+
+typedef struct {
+    small g[KEYPAIR_BATCH][p];
+    small f[KEYPAIR_BATCH][p];
+    small gprod[KEYPAIR_BATCH][p]; /* g[0]*...*g[i] in R3 */
+    Fq fprod[KEYPAIR_BATCH][p]; /* f[0]*...*f[i] in Rq */
+} KeyPairBatch;
+
+/* n <= KEYPAIR_BATCH key pairs; the n inverses in R3 and in Rq come from */
+/* a single inversion of the product each, by Montgomery's trick */
+static int crypto_kem_keypair_n(uint8_t *pk, uint8_t *sk, size_t n) {
+    KeyPairBatch *b = OQS_MEM_malloc(sizeof(KeyPairBatch));
+    size_t i;
+    if (b == NULL) {
+        return -1;
+    }
+
+    for (i = 0; i < n; ++i) {
+        Small_random(b->g[i]);
+        Short_random(b->f[i]);
+    }
+
+    /* sk gets 1/g[i] in R3 */
+    memcpy(b->gprod[0], b->g[0], p);
+    for (i = 1; i < n; ++i) {
+        R3_mult(b->gprod[i], b->gprod[i - 1], b->g[i]);
+    }
+    {
+        small v[p + 1];
+        small u[p];
+        small vp;
+        crypto_core_inv3((unsigned char *) v, (const unsigned char *) b->gprod[n - 1]);
+        vp = v[p];
+        crypto_declassify(&vp, sizeof vp);
+        if (vp == 0) {
+            /* u = 1/(g[0]*...*g[i]) */
+            memcpy(u, v, p);
+            for (i = n - 1; i > 0; --i) {
+                R3_mult(v, u, b->gprod[i - 1]);
+                Small_encode(sk + i * SecretKeys_total + Small_bytes, v);
+                R3_mult(v, u, b->g[i]);
+                memcpy(u, v, p);
+            }
+            Small_encode(sk + Small_bytes, u);
+        } else {
+            /* some g[i] is not invertible: invert one at a time, resampling as crypto_kem_keypair does */
+            for (i = 0; i < n; ++i) {
+                for (;;) {
+                    crypto_core_inv3((unsigned char *) v, (const unsigned char *) b->g[i]);
+                    vp = v[p];
+                    crypto_declassify(&vp, sizeof vp);
+                    if (vp == 0) {
+                        Small_encode(sk + i * SecretKeys_total + Small_bytes, v);
+                        break;
+                    }
+                    Small_random(b->g[i]);
+                }
+            }
+        }
+    }
+
+    /* pk gets g[i]/(3*f[i]) in Rq */
+    for (i = 0; i < p; ++i) {
+        b->fprod[0][i] = b->f[0][i];
+    }
+    for (i = 1; i < n; ++i) {
+        memcpy(b->fprod[i], b->fprod[i - 1], sizeof b->fprod[i]);
+        Rq_mult_small(b->fprod[i], b->f[i]);
+    }
     {
-        int i;
-        unsigned char sksave = sk[SecretKeys_bytes - 1];
-        for (i = 0; i < PublicKeys_bytes; ++i) {
-            sk[SecretKeys_bytes + i] = pk[i];
+        Fq u[p + 1];
+        Fq h[p];
+        /* u = 1/(3*f[0]*...*f[i]) */
+        Rq_recip3_rq(u, b->fprod[n - 1]);
+        for (i = n - 1; i > 0; --i) {
+            Rq_mult(h, u, b->fprod[i - 1]);
+            Rq_mult_small(h, b->g[i]);
+            Rq_encode(pk + i * PublicKeys_bytes, h);
+            Rq_mult_small(u, b->f[i]);
+        }
+        Rq_mult_small(u, b->g[0]);
+        Rq_encode(pk, u);
+    }
+
+    for (i = 0; i < n; ++i) {
+        Small_encode(sk + i * SecretKeys_total, b->f[i]);
+        SecretKey_finish(sk + i * SecretKeys_total, pk + i * PublicKeys_bytes);
+    }
+
+    OQS_MEM_secure_free(b, sizeof(KeyPairBatch));
+    return 0;
+}
+
+int PQCLEAN_SNTRUP761_AVX2_crypto_kem_keypair_batch(uint8_t *pk, uint8_t *sk, size_t count) {
+    size_t n;
+    while (count > 0) {
+        n = count < KEYPAIR_BATCH ? count : KEYPAIR_BATCH;
+        if (crypto_kem_keypair_n(pk, sk, n) != 0) {
+            return -1;
         }
-        sk[SecretKeys_bytes - 1] = 4;
-        Hash(sk + SecretKeys_bytes + PublicKeys_bytes + Small_bytes, sk + SecretKeys_bytes - 1, 1 + PublicKeys_bytes);
-        sk[SecretKeys_bytes - 1] = sksave;
-        randombytes(sk + SecretKeys_bytes + PublicKeys_bytes, Small_bytes);
+        pk += n * PublicKeys_bytes;
+        sk += n * SecretKeys_total;
+        count -= n;
     }
     return 0;
 }
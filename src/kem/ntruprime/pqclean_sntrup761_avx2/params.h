@@ -67,10 +67,14 @@
 
 #define crypto_core_inv PQCLEAN_SNTRUP761_AVX2_crypto_core_invsntrup761
 
+#define crypto_core_inv_rq PQCLEAN_SNTRUP761_AVX2_crypto_core_invsntrup761_rq
+
 #define crypto_core_inv3 PQCLEAN_SNTRUP761_AVX2_crypto_core_inv3sntrup761
 
 #define crypto_core_mult3 PQCLEAN_SNTRUP761_AVX2_crypto_core_mult3sntrup761
 
 #define crypto_core_mult PQCLEAN_SNTRUP761_AVX2_crypto_core_multsntrup761
 
+#define crypto_core_mult_rq PQCLEAN_SNTRUP761_AVX2_crypto_core_multsntrup761_rq
+
 #endif
@@ -60,8 +60,7 @@ static Fq Fq_recip(Fq a1) {
 
 /* out = 1/(3*in) in Rq */
 /* outbytes[2*p] is 0 if recip succeeded; else -1 */
-int PQCLEAN_SNTRUP761_CLEAN_crypto_core_invsntrup761(unsigned char *outbytes, const unsigned char *inbytes) {
-    small *in = (void *) inbytes;
+static void invsntrup761(unsigned char *outbytes, const Fq *in) {
     Fq out[p], f[p + 1], g[p + 1], v[p + 1], r[p + 1];
     int i, loop, delta;
     int swap, t;
@@ -81,7 +80,7 @@ int PQCLEAN_SNTRUP761_CLEAN_crypto_core_invsntrup761(unsigned char *outbytes, co
     f[0] = 1;
     f[p - 1] = f[p] = -1;
     for (i = 0; i < p; ++i) {
-        g[p - 1 - i] = (Fq) in[i];
+        g[p - 1 - i] = in[i];
     }
     g[p] = 0;
 
@@ -128,5 +127,28 @@ int PQCLEAN_SNTRUP761_CLEAN_crypto_core_invsntrup761(unsigned char *outbytes, co
 
     crypto_encode_pxint16(outbytes, out);
     outbytes[2 * p] = (unsigned char) int16_nonzero_mask((int16) delta);
+}
+
+int PQCLEAN_SNTRUP761_CLEAN_crypto_core_invsntrup761(unsigned char *outbytes, const unsigned char *inbytes) {
+    small *in = (void *) inbytes;
+    Fq inq[p];
+    int i;
+
+    for (i = 0; i < p; ++i) {
+        inq[i] = (Fq) in[i];
+    }
+    invsntrup761(outbytes, inq);
+    return 0;
+}
+
+int PQCLEAN_SNTRUP761_CLEAN_crypto_core_invsntrup761_rq(unsigned char *outbytes, const unsigned char *inbytes) {
+    Fq inq[p];
+    int i;
+
+    crypto_decode_pxint16(inq, inbytes);
+    for (i = 0; i < p; ++i) {
+        inq[i] = Fq_bigfreeze(inq[i]);
+    }
+    invsntrup761(outbytes, inq);
     return 0;
 }
@@ -8,4 +8,7 @@
 #define PQCLEAN_SNTRUP761_CLEAN_crypto_core_invsntrup761_CONSTBYTES 0
 
 int PQCLEAN_SNTRUP761_CLEAN_crypto_core_invsntrup761(unsigned char *outbytes, const unsigned char *inbytes);
+
+/* as above, for an input of p int16 in Rq (INPUTBYTES 1522) rather than p small */
+int PQCLEAN_SNTRUP761_CLEAN_crypto_core_invsntrup761_rq(unsigned char *outbytes, const unsigned char *inbytes);
 #endif
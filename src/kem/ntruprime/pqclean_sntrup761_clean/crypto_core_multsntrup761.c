@@ -58,3 +58,42 @@ int PQCLEAN_SNTRUP761_CLEAN_crypto_core_multsntrup761(unsigned char *outbytes, c
     crypto_encode_pxint16(outbytes, fg);
     return 0;
 }
+
+int PQCLEAN_SNTRUP761_CLEAN_crypto_core_multsntrup761_rq(unsigned char *outbytes, const unsigned char *inbytes, const unsigned char *kbytes) {
+    Fq f[p];
+    Fq g[p];
+    Fq fg[p + p - 1];
+    int32 result;
+    int i, j;
+
+    crypto_decode_pxint16(f, inbytes);
+    crypto_decode_pxint16(g, kbytes);
+    for (i = 0; i < p; ++i) {
+        f[i] = Fq_freeze(f[i]);
+        g[i] = Fq_freeze(g[i]);
+    }
+
+    /* each product is frozen, as a sum of p of them would overflow int32 */
+    for (i = 0; i < p; ++i) {
+        result = 0;
+        for (j = 0; j <= i; ++j) {
+            result += Fq_freeze(f[j] * (int32)g[i - j]);
+        }
+        fg[i] = Fq_freeze(result);
+    }
+    for (i = p; i < p + p - 1; ++i) {
+        result = 0;
+        for (j = i - p + 1; j < p; ++j) {
+            result += Fq_freeze(f[j] * (int32)g[i - j]);
+        }
+        fg[i] = Fq_freeze(result);
+    }
+
+    for (i = p + p - 2; i >= p; --i) {
+        fg[i - p] = Fq_freeze(fg[i - p] + fg[i]);
+        fg[i - p + 1] = Fq_freeze(fg[i - p + 1] + fg[i]);
+    }
+
+    crypto_encode_pxint16(outbytes, fg);
+    return 0;
+}
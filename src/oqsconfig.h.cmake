@@ -38,10 +38,12 @@
 #cmakedefine OQS_USE_BMI2_INSTRUCTIONS 1
 #cmakedefine OQS_USE_PCLMULQDQ_INSTRUCTIONS 1
 #cmakedefine OQS_USE_VPCLMULQDQ_INSTRUCTIONS 1
+#cmakedefine OQS_USE_VAES_INSTRUCTIONS 1
 #cmakedefine OQS_USE_POPCNT_INSTRUCTIONS 1
 #cmakedefine OQS_USE_SSE_INSTRUCTIONS 1
 #cmakedefine OQS_USE_SSE2_INSTRUCTIONS 1
 #cmakedefine OQS_USE_SSE3_INSTRUCTIONS 1
+#cmakedefine OQS_USE_SHA_NI_INSTRUCTIONS 1
 
 #cmakedefine OQS_USE_ARM_AES_INSTRUCTIONS 1
 #cmakedefine OQS_USE_ARM_SHA2_INSTRUCTIONS 1
@@ -53,6 +55,7 @@
 #cmakedefine OQS_ENABLE_TEST_CONSTANT_TIME 1
 
 #cmakedefine OQS_ENABLE_SHA3_xkcp_low_avx2 1
+#cmakedefine OQS_ENABLE_SHA3_xkcp_low_avx512 1
 
 #cmakedefine OQS_ENABLE_KEM_BIKE 1
 #cmakedefine OQS_ENABLE_KEM_bike_l1 1
@@ -97,8 +100,11 @@
 
 #cmakedefine OQS_ENABLE_KEM_HQC 1
 #cmakedefine OQS_ENABLE_KEM_hqc_128 1
+#cmakedefine OQS_ENABLE_KEM_hqc_128_avx2 1
 #cmakedefine OQS_ENABLE_KEM_hqc_192 1
+#cmakedefine OQS_ENABLE_KEM_hqc_192_avx2 1
 #cmakedefine OQS_ENABLE_KEM_hqc_256 1
+#cmakedefine OQS_ENABLE_KEM_hqc_256_avx2 1
 
 #cmakedefine OQS_ENABLE_KEM_KYBER 1
 #cmakedefine OQS_ENABLE_KEM_kyber_512 1
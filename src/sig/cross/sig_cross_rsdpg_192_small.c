@@ -25,6 +25,20 @@ OQS_SIG *OQS_SIG_cross_rsdpg_192_small_new(void) {
 	sig->keypair = OQS_SIG_cross_rsdpg_192_small_keypair;
 	sig->sign = OQS_SIG_cross_rsdpg_192_small_sign;
 	sig->verify = OQS_SIG_cross_rsdpg_192_small_verify;
+	sig->length_expanded_public_key = 0;
+	sig->public_key_expand = NULL;
+	sig->verify_expanded = NULL;
+	sig->length_expanded_secret_key = 0;
+	sig->secret_key_expand = NULL;
+	sig->sign_expanded = NULL;
+	sig->length_stream_state = 0;
+	sig->stream_sign_init = NULL;
+	sig->stream_verify_init = NULL;
+	sig->stream_update = NULL;
+	sig->stream_sign_final = NULL;
+	sig->stream_verify_final = NULL;
+	sig->stream_release = NULL;
+	sig->sign_parallel = NULL;
 
 	return sig;
 }
@@ -1,5 +1,6 @@
 #include <stdint.h>
 #include <string.h>
+#include <oqs/sig_dilithium.h>
 #include "align.h"
 #include "params.h"
 #include "sign.h"
@@ -9,6 +10,17 @@
 #include "randombytes.h"
 #include "symmetric.h"
 #include "fips202.h"
+
+/* The liboqs wrappers advertise these layouts as the expanded key lengths */
+#if DILITHIUM_MODE == 2
+#define OQS_LENGTH_EXPANDED(s) OQS_SIG_dilithium_2_length_expanded_##s
+#elif DILITHIUM_MODE == 3
+#define OQS_LENGTH_EXPANDED(s) OQS_SIG_dilithium_3_length_expanded_##s
+#elif DILITHIUM_MODE == 5
+#define OQS_LENGTH_EXPANDED(s) OQS_SIG_dilithium_5_length_expanded_##s
+#endif
+_Static_assert(sizeof(expanded_pk) == OQS_LENGTH_EXPANDED(public_key), "expanded_pk does not match the advertised length");
+_Static_assert(sizeof(expanded_sk) == OQS_LENGTH_EXPANDED(secret_key), "expanded_sk does not match the advertised length");
 #ifdef DILITHIUM_USE_AES
 #include "aes256ctr.h"
 #endif
@@ -176,27 +188,50 @@ int crypto_sign_keypair(uint8_t *pk, uint8_t *sk) {
 }
 
 /*************************************************
-* Name:        crypto_sign_signature
+* Name:        crypto_sign_expand_sk
 *
-* Description: Computes signature.
+* Description: Unpacks a secret key and precomputes the matrix A and
+*              s1, s2, t0 in NTT domain, for use with
+*              crypto_sign_signature_expanded
 *
-* Arguments:   - uint8_t *sig: pointer to output signature (of length CRYPTO_BYTES)
+* Arguments:   - expanded_sk *esk: pointer to output expanded secret key
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_expand_sk(expanded_sk *esk, const uint8_t *sk) {
+  uint8_t rho[SEEDBYTES];
+
+  unpack_sk(rho, esk->tr, esk->key, &esk->t0, &esk->s1, &esk->s2, sk);
+  polyvec_matrix_expand(esk->mat, rho);
+  polyvecl_ntt(&esk->s1);
+  polyveck_ntt(&esk->s2);
+  polyveck_ntt(&esk->t0);
+  return 0;
+}
+
+/*************************************************
+* Name:        signature_mu
+*
+* Description: Computes signature over a message representative
+*              mu = CRH(tr, msg) with an expanded secret key.
+*
+* Arguments:   - uint8_t *sig:   pointer to output signature (of length CRYPTO_BYTES)
 *              - size_t *siglen: pointer to output length of signature
-*              - uint8_t *m: pointer to message to be signed
-*              - size_t mlen: length of message
-*              - uint8_t *sk: pointer to bit-packed secret key
+*              - const uint8_t *crh: pointer to mu (of length CRHBYTES)
+*              - const expanded_sk *esk: pointer to expanded secret key
 *
 * Returns 0 (success)
 **************************************************/
-int crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk) {
+static int signature_mu(uint8_t *sig, size_t *siglen, const uint8_t crh[CRHBYTES], const expanded_sk *esk) {
   unsigned int i, n, pos;
-  uint8_t seedbuf[3*SEEDBYTES + 2*CRHBYTES];
-  uint8_t *rho, *tr, *key, *mu, *rhoprime;
+  uint8_t seedbuf[SEEDBYTES + 2*CRHBYTES];
+  uint8_t *key, *mu, *rhoprime;
   uint8_t hintbuf[N];
   uint8_t *hint = sig + SEEDBYTES + L*POLYZ_PACKEDBYTES;
   uint64_t nonce = 0;
-  polyvecl mat[K], s1, z;
-  polyveck t0, s2, w1;
+  polyvecl z;
+  polyveck w1;
   poly c, tmp;
   union {
     polyvecl y;
@@ -204,19 +239,13 @@ int crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t
   } tmpv;
   shake256incctx state;
 
-  rho = seedbuf;
-  tr = rho + SEEDBYTES;
-  key = tr + SEEDBYTES;
+  key = seedbuf;
   mu = key + SEEDBYTES;
   rhoprime = mu + CRHBYTES;
-  unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
+  memcpy(key, esk->key, SEEDBYTES);
 
-  /* Compute CRH(tr, msg) */
+  memcpy(mu, crh, CRHBYTES);
   shake256_inc_init(&state);
-  shake256_inc_absorb(&state, tr, SEEDBYTES);
-  shake256_inc_absorb(&state, m, mlen);
-  shake256_inc_finalize(&state);
-  shake256_inc_squeeze(mu, CRHBYTES, &state);
 
 #ifdef DILITHIUM_RANDOMIZED_SIGNING
   randombytes(rhoprime, CRHBYTES);
@@ -224,12 +253,6 @@ int crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t
   shake256(rhoprime, CRHBYTES, key, SEEDBYTES + CRHBYTES);
 #endif
 
-  /* Expand matrix and transform vectors */
-  polyvec_matrix_expand(mat, rho);
-  polyvecl_ntt(&s1);
-  polyveck_ntt(&s2);
-  polyveck_ntt(&t0);
-
 #ifdef DILITHIUM_USE_AES
   aes256ctr_ctx aesctx;
   aes256ctr_init_u64(&aesctx, rhoprime, 0);
@@ -265,7 +288,7 @@ rej:
   /* Matrix-vector product */
   tmpv.y = z;
   polyvecl_ntt(&tmpv.y);
-  polyvec_matrix_pointwise_montgomery(&w1, mat, &tmpv.y);
+  polyvec_matrix_pointwise_montgomery(&w1, esk->mat, &tmpv.y);
   polyveck_invntt_tomont(&w1);
 
   /* Decompose w and call the random oracle */
@@ -283,7 +306,7 @@ rej:
 
   /* Compute z, reject if it reveals secret */
   for(i = 0; i < L; i++) {
-    poly_pointwise_montgomery(&tmp, &c, &s1.vec[i]);
+    poly_pointwise_montgomery(&tmp, &c, &esk->s1.vec[i]);
     poly_invntt_tomont(&tmp);
     poly_add(&z.vec[i], &z.vec[i], &tmp);
     poly_reduce(&z.vec[i]);
@@ -298,7 +321,7 @@ rej:
   for(i = 0; i < K; i++) {
     /* Check that subtracting cs2 does not change high bits of w and low bits
      * do not reveal secret information */
-    poly_pointwise_montgomery(&tmp, &c, &s2.vec[i]);
+    poly_pointwise_montgomery(&tmp, &c, &esk->s2.vec[i]);
     poly_invntt_tomont(&tmp);
     poly_sub(&tmpv.w0.vec[i], &tmpv.w0.vec[i], &tmp);
     poly_reduce(&tmpv.w0.vec[i]);
@@ -306,7 +329,7 @@ rej:
       goto rej;
 
     /* Compute hints */
-    poly_pointwise_montgomery(&tmp, &c, &t0.vec[i]);
+    poly_pointwise_montgomery(&tmp, &c, &esk->t0.vec[i]);
     poly_invntt_tomont(&tmp);
     poly_reduce(&tmp);
     if(poly_chknorm(&tmp, GAMMA2))
@@ -335,6 +358,55 @@ rej:
   return 0;
 }
 
+/*************************************************
+* Name:        crypto_sign_signature_expanded
+*
+* Description: Computes signature with a secret key expanded
+*              by crypto_sign_expand_sk.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - const expanded_sk *esk: pointer to expanded secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const expanded_sk *esk) {
+  uint8_t mu[CRHBYTES];
+  shake256incctx state;
+
+  /* Compute CRH(tr, msg) */
+  shake256_inc_init(&state);
+  shake256_inc_absorb(&state, esk->tr, SEEDBYTES);
+  shake256_inc_absorb(&state, m, mlen);
+  shake256_inc_finalize(&state);
+  shake256_inc_squeeze(mu, CRHBYTES, &state);
+  shake256_inc_ctx_release(&state);
+
+  return signature_mu(sig, siglen, mu, esk);
+}
+
+/*************************************************
+* Name:        crypto_sign_signature
+*
+* Description: Computes signature.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk) {
+  expanded_sk esk;
+
+  crypto_sign_expand_sk(&esk, sk);
+  return crypto_sign_signature_expanded(sig, siglen, m, mlen, &esk);
+}
+
 /*************************************************
 * Name:        crypto_sign
 *
@@ -491,6 +563,138 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size
   return 0;
 }
 
+/*************************************************
+* Name:        crypto_sign_expand_pk
+*
+* Description: Precomputes tr, the matrix A and t1*2^d in NTT domain
+*              from a public key, for use with crypto_sign_verify_expanded
+*
+* Arguments:   - expanded_pk *epk: pointer to output expanded public key
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_expand_pk(expanded_pk *epk, const uint8_t *pk) {
+  uint8_t rho[SEEDBYTES];
+
+  unpack_pk(rho, &epk->t1, pk);
+  shake256(epk->tr, SEEDBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+  polyvec_matrix_expand(epk->mat, rho);
+
+  polyveck_shiftl(&epk->t1);
+  polyveck_ntt(&epk->t1);
+  return 0;
+}
+
+/*************************************************
+* Name:        verify_mu
+*
+* Description: Verifies signature over a message representative
+*              mu = CRH(tr, msg) with an expanded public key.
+*
+* Arguments:   - const uint8_t *sig: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *mu: pointer to mu (of length CRHBYTES)
+*              - const expanded_pk *epk: pointer to expanded public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+static int verify_mu(const uint8_t *sig, size_t siglen, const uint8_t mu[CRHBYTES], const expanded_pk *epk) {
+  unsigned int i, j, pos = 0;
+  /* polyw1_pack writes additional 14 bytes */
+  ALIGNED_UINT8(K*POLYW1_PACKEDBYTES+14) buf;
+  const uint8_t *hint = sig + SEEDBYTES + L*POLYZ_PACKEDBYTES;
+  polyvecl z;
+  poly c, w1, h;
+  shake256incctx state;
+
+  if(siglen != CRYPTO_BYTES)
+    return -1;
+
+  /* Expand challenge */
+  poly_challenge(&c, sig);
+  poly_ntt(&c);
+
+  /* Unpack z; shortness follows from unpacking */
+  for(i = 0; i < L; i++) {
+    polyz_unpack(&z.vec[i], sig + SEEDBYTES + i*POLYZ_PACKEDBYTES);
+    poly_ntt(&z.vec[i]);
+  }
+
+  for(i = 0; i < K; i++) {
+    /* Compute i-th row of Az - c2^Dt1 */
+    polyvecl_pointwise_acc_montgomery(&w1, &epk->mat[i], &z);
+
+    poly_pointwise_montgomery(&h, &c, &epk->t1.vec[i]);
+
+    poly_sub(&w1, &w1, &h);
+    poly_reduce(&w1);
+    poly_invntt_tomont(&w1);
+
+    /* Get hint polynomial and reconstruct w1 */
+    memset(h.vec, 0, sizeof(poly));
+    if(hint[OMEGA + i] < pos || hint[OMEGA + i] > OMEGA)
+      return -1;
+
+    for(j = pos; j < hint[OMEGA + i]; ++j) {
+      /* Coefficients are ordered for strong unforgeability */
+      if(j > pos && hint[j] <= hint[j-1]) return -1;
+      h.coeffs[hint[j]] = 1;
+    }
+    pos = hint[OMEGA + i];
+
+    poly_caddq(&w1);
+    poly_use_hint(&w1, &w1, &h);
+    polyw1_pack(buf.coeffs + i*POLYW1_PACKEDBYTES, &w1);
+  }
+
+  /* Extra indices are zero for strong unforgeability */
+  for(j = pos; j < OMEGA; ++j)
+    if(hint[j]) return -1;
+
+  /* Call random oracle and verify challenge */
+  shake256_inc_init(&state);
+  shake256_inc_absorb(&state, mu, CRHBYTES);
+  shake256_inc_absorb(&state, buf.coeffs, K*POLYW1_PACKEDBYTES);
+  shake256_inc_finalize(&state);
+  shake256_inc_squeeze(buf.coeffs, SEEDBYTES, &state);
+  shake256_inc_ctx_release(&state);
+  for(i = 0; i < SEEDBYTES; ++i)
+    if(buf.coeffs[i] != sig[i])
+      return -1;
+
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_verify_expanded
+*
+* Description: Verifies signature against a public key expanded
+*              by crypto_sign_expand_pk.
+*
+* Arguments:   - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+*              - const expanded_pk *epk: pointer to expanded public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const expanded_pk *epk) {
+  uint8_t mu[CRHBYTES];
+  shake256incctx state;
+
+  /* Compute CRH(tr, msg) */
+  shake256_inc_init(&state);
+  shake256_inc_absorb(&state, epk->tr, SEEDBYTES);
+  shake256_inc_absorb(&state, m, mlen);
+  shake256_inc_finalize(&state);
+  shake256_inc_squeeze(mu, CRHBYTES, &state);
+  shake256_inc_ctx_release(&state);
+
+  return verify_mu(sig, siglen, mu, epk);
+}
+
 /*************************************************
 * Name:        crypto_sign_open
 *
@@ -529,3 +733,92 @@ badsig:
 
   return -1;
 }
+
+/*************************************************
+* Name:        crypto_sign_stream_init_sk
+*
+* Description: Starts computing mu = CRH(tr, msg) for a message that is
+*              passed in pieces; absorbs tr taken from the secret key.
+*              The message is absorbed with OQS_SHA3_shake256_inc_absorb
+*              and signed by crypto_sign_signature_stream.
+*
+* Arguments:   - OQS_SHA3_shake256_inc_ctx *state: pointer to output hash state
+*              - const uint8_t *sk: pointer to bit-packed secret key
+**************************************************/
+void crypto_sign_stream_init_sk(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sk) {
+  /* tr follows rho and key in the packed secret key */
+  OQS_SHA3_shake256_inc_init(state);
+  OQS_SHA3_shake256_inc_absorb(state, sk + 2*SEEDBYTES, SEEDBYTES);
+}
+
+/*************************************************
+* Name:        crypto_sign_signature_stream
+*
+* Description: Finishes a message started with crypto_sign_stream_init_sk
+*              and computes its signature. Releases the hash state.
+*
+* Arguments:   - uint8_t *sig:   pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - OQS_SHA3_shake256_inc_ctx *state: pointer to hash state that absorbed the message
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_signature_stream(uint8_t *sig, size_t *siglen, OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sk) {
+  uint8_t mu[CRHBYTES];
+  expanded_sk esk;
+
+  OQS_SHA3_shake256_inc_finalize(state);
+  OQS_SHA3_shake256_inc_squeeze(mu, CRHBYTES, state);
+  OQS_SHA3_shake256_inc_ctx_release(state);
+
+  crypto_sign_expand_sk(&esk, sk);
+  return signature_mu(sig, siglen, mu, &esk);
+}
+
+/*************************************************
+* Name:        crypto_sign_stream_init_pk
+*
+* Description: Starts computing mu = CRH(H(rho, t1), msg) for a message
+*              that is passed in pieces. The message is absorbed with
+*              OQS_SHA3_shake256_inc_absorb and the signature is checked
+*              by crypto_sign_verify_stream.
+*
+* Arguments:   - OQS_SHA3_shake256_inc_ctx *state: pointer to output hash state
+*              - const uint8_t *pk: pointer to bit-packed public key
+**************************************************/
+void crypto_sign_stream_init_pk(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *pk) {
+  uint8_t tr[SEEDBYTES];
+
+  shake256(tr, SEEDBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+  OQS_SHA3_shake256_inc_init(state);
+  OQS_SHA3_shake256_inc_absorb(state, tr, SEEDBYTES);
+}
+
+/*************************************************
+* Name:        crypto_sign_verify_stream
+*
+* Description: Finishes a message started with crypto_sign_stream_init_pk
+*              and verifies its signature. Releases the hash state.
+*
+* Arguments:   - const uint8_t *sig: pointer to input signature
+*              - size_t siglen: length of signature
+*              - OQS_SHA3_shake256_inc_ctx *state: pointer to hash state that absorbed the message
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int crypto_sign_verify_stream(const uint8_t *sig, size_t siglen, OQS_SHA3_shake256_inc_ctx *state, const uint8_t *pk) {
+  uint8_t mu[CRHBYTES];
+  expanded_pk epk;
+
+  OQS_SHA3_shake256_inc_finalize(state);
+  OQS_SHA3_shake256_inc_squeeze(mu, CRHBYTES, state);
+  OQS_SHA3_shake256_inc_ctx_release(state);
+
+  if(siglen != CRYPTO_BYTES)
+    return -1;
+
+  crypto_sign_expand_pk(&epk, pk);
+  return verify_mu(sig, siglen, mu, &epk);
+}
@@ -9,33 +9,69 @@
 #define OQS_SIG_dilithium_2_length_public_key 1312
 #define OQS_SIG_dilithium_2_length_secret_key 2528
 #define OQS_SIG_dilithium_2_length_signature 2420
+#define OQS_SIG_dilithium_2_length_expanded_public_key 20512
+#define OQS_SIG_dilithium_2_length_expanded_secret_key 28736
 
 OQS_SIG *OQS_SIG_dilithium_2_new(void);
 OQS_API OQS_STATUS OQS_SIG_dilithium_2_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_dilithium_2_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_dilithium_2_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_2_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_2_verify_expanded(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_2_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_2_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_2_stream_sign_init(void *state, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_2_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_2_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_dilithium_2_stream_sign_final(uint8_t *signature, size_t *signature_len, void *state);
+OQS_API OQS_STATUS OQS_SIG_dilithium_2_stream_verify_final(void *state);
+OQS_API void OQS_SIG_dilithium_2_stream_release(void *state);
 #endif
 
 #if defined(OQS_ENABLE_SIG_dilithium_3)
 #define OQS_SIG_dilithium_3_length_public_key 1952
 #define OQS_SIG_dilithium_3_length_secret_key 4000
 #define OQS_SIG_dilithium_3_length_signature 3293
+#define OQS_SIG_dilithium_3_length_expanded_public_key 36896
+#define OQS_SIG_dilithium_3_length_expanded_secret_key 48192
 
 OQS_SIG *OQS_SIG_dilithium_3_new(void);
 OQS_API OQS_STATUS OQS_SIG_dilithium_3_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_dilithium_3_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_dilithium_3_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_3_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_3_verify_expanded(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_3_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_3_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_3_stream_sign_init(void *state, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_3_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_3_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_dilithium_3_stream_sign_final(uint8_t *signature, size_t *signature_len, void *state);
+OQS_API OQS_STATUS OQS_SIG_dilithium_3_stream_verify_final(void *state);
+OQS_API void OQS_SIG_dilithium_3_stream_release(void *state);
 #endif
 
 #if defined(OQS_ENABLE_SIG_dilithium_5)
 #define OQS_SIG_dilithium_5_length_public_key 2592
 #define OQS_SIG_dilithium_5_length_secret_key 4864
 #define OQS_SIG_dilithium_5_length_signature 4595
+#define OQS_SIG_dilithium_5_length_expanded_public_key 65568
+#define OQS_SIG_dilithium_5_length_expanded_secret_key 80960
 
 OQS_SIG *OQS_SIG_dilithium_5_new(void);
 OQS_API OQS_STATUS OQS_SIG_dilithium_5_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_dilithium_5_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_dilithium_5_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_5_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_5_verify_expanded(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_5_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_5_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_5_stream_sign_init(void *state, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_5_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_5_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_dilithium_5_stream_sign_final(uint8_t *signature, size_t *signature_len, void *state);
+OQS_API OQS_STATUS OQS_SIG_dilithium_5_stream_verify_final(void *state);
+OQS_API void OQS_SIG_dilithium_5_stream_release(void *state);
 #endif
 
 #endif
@@ -4,6 +4,7 @@
 
 #include <stddef.h>
 #include <string.h>
+#include <oqs/sig_falcon.h>
 
 #include "api.h"
 #include "inner.h"
@@ -12,6 +13,9 @@
 
 #include "randombytes.h"
 
+/* The liboqs wrapper advertises the B0 matrix and LDL tree as the expanded key length */
+_Static_assert(OQS_SIG_falcon_1024_length_expanded_secret_key == ((10 + 5) << 10) * sizeof(fpr), "the expanded key does not match the advertised length");
+
 /*
  * Encoding formats (nnnn = log of degree, 9 for Falcon-512, 10 for Falcon-1024)
  *
@@ -109,36 +113,16 @@ PQCLEAN_FALCON1024_AVX2_crypto_sign_keypair(
 }
 
 /*
- * Compute the signature. nonce[] receives the nonce and must have length
- * NONCELEN bytes. sigbuf[] receives the signature value (without nonce
- * or header byte), with *sigbuflen providing the maximum value length and
- * receiving the actual value length.
- *
- * If a signature could be computed but not encoded because it would
- * exceed the output buffer size, then an error is returned.
+ * Decode the private key (f, g, F) and recompute G. The tmp[] array
+ * must have room for at least 72*1024 bytes and 64-bit alignment.
  *
  * Return value: 0 on success, -1 on error.
  */
 static int
-do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
-        const uint8_t *m, size_t mlen, const uint8_t *sk) {
-    union {
-        uint8_t b[72 * 1024];
-        uint64_t dummy_u64;
-        fpr dummy_fpr;
-    } tmp;
-    int8_t f[1024], g[1024], F[1024], G[1024];
-    struct {
-        int16_t sig[1024];
-        uint16_t hm[1024];
-    } r;
-    unsigned char seed[48];
-    inner_shake256_context sc;
+decode_privkey(int8_t *f, int8_t *g, int8_t *F, int8_t *G,
+               const uint8_t *sk, uint8_t *tmp) {
     size_t u, v;
 
-    /*
-     * Decode the private key.
-     */
     if (sk[0] != 0x50 + 10) {
         return -1;
     }
@@ -167,9 +151,22 @@ do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
     if (u != PQCLEAN_FALCON1024_AVX2_CRYPTO_SECRETKEYBYTES) {
         return -1;
     }
-    if (!PQCLEAN_FALCON1024_AVX2_complete_private(G, f, g, F, 10, tmp.b)) {
+    if (!PQCLEAN_FALCON1024_AVX2_complete_private(G, f, g, F, 10, tmp)) {
         return -1;
     }
+    return 0;
+}
+
+/*
+ * Create a random nonce (40 bytes) into nonce[], hash nonce + message
+ * into hm[], then seed the RNG used by the Gaussian sampler. The tmp[]
+ * array must have room for at least 2*1024 bytes.
+ */
+static void
+prepare_sign(uint8_t *nonce, uint16_t *hm, inner_shake256_context *rng,
+             const uint8_t *m, size_t mlen, uint8_t *tmp) {
+    unsigned char seed[48];
+    inner_shake256_context sc;
 
     /*
      * Create a random nonce (40 bytes).
@@ -183,16 +180,53 @@ do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
     inner_shake256_inject(&sc, nonce, NONCELEN);
     inner_shake256_inject(&sc, m, mlen);
     inner_shake256_flip(&sc);
-    PQCLEAN_FALCON1024_AVX2_hash_to_point_ct(&sc, r.hm, 10, tmp.b);
+    PQCLEAN_FALCON1024_AVX2_hash_to_point_ct(&sc, hm, 10, tmp);
     inner_shake256_ctx_release(&sc);
 
     /*
      * Initialize a RNG.
      */
     randombytes(seed, sizeof seed);
-    inner_shake256_init(&sc);
-    inner_shake256_inject(&sc, seed, sizeof seed);
-    inner_shake256_flip(&sc);
+    inner_shake256_init(rng);
+    inner_shake256_inject(rng, seed, sizeof seed);
+    inner_shake256_flip(rng);
+}
+
+/*
+ * Compute the signature. nonce[] receives the nonce and must have length
+ * NONCELEN bytes. sigbuf[] receives the signature value (without nonce
+ * or header byte), with *sigbuflen providing the maximum value length and
+ * receiving the actual value length.
+ *
+ * If a signature could be computed but not encoded because it would
+ * exceed the output buffer size, then an error is returned.
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+static int
+do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
+        const uint8_t *m, size_t mlen, const uint8_t *sk) {
+    union {
+        uint8_t b[72 * 1024];
+        uint64_t dummy_u64;
+        fpr dummy_fpr;
+    } tmp;
+    int8_t f[1024], g[1024], F[1024], G[1024];
+    struct {
+        int16_t sig[1024];
+        uint16_t hm[1024];
+    } r;
+    inner_shake256_context sc;
+    size_t v;
+
+    /*
+     * Decode the private key.
+     */
+    if (decode_privkey(f, g, F, G, sk, tmp.b) < 0) {
+        return -1;
+    }
+
+    prepare_sign(nonce, r.hm, &sc, m, mlen, tmp.b);
 
     /*
      * Compute and return the signature.
@@ -207,6 +241,41 @@ do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
     return -1;
 }
 
+/*
+ * Same as do_sign(), but with a private key already expanded into the
+ * B0 matrix and LDL tree by PQCLEAN_FALCON1024_AVX2_expand_privkey(), so that
+ * the tree is not rebuilt for each signature.
+ */
+static int
+do_sign_tree(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
+             const uint8_t *m, size_t mlen, const fpr *expanded_key) {
+    union {
+        uint8_t b[48 * 1024];
+        uint64_t dummy_u64;
+        fpr dummy_fpr;
+    } tmp;
+    struct {
+        int16_t sig[1024];
+        uint16_t hm[1024];
+    } r;
+    inner_shake256_context sc;
+    size_t v;
+
+    prepare_sign(nonce, r.hm, &sc, m, mlen, tmp.b);
+
+    /*
+     * Compute and return the signature.
+     */
+    PQCLEAN_FALCON1024_AVX2_sign_tree(r.sig, &sc, expanded_key, r.hm, 10, tmp.b);
+    v = PQCLEAN_FALCON1024_AVX2_comp_encode(sigbuf, *sigbuflen, r.sig, 10);
+    if (v != 0) {
+        inner_shake256_ctx_release(&sc);
+        *sigbuflen = v;
+        return 0;
+    }
+    return -1;
+}
+
 /*
  * Verify a sigature. The nonce has size NONCELEN bytes. sigbuf[]
  * (of size sigbuflen) contains the signature value, not including the
@@ -297,6 +366,40 @@ PQCLEAN_FALCON1024_AVX2_crypto_sign_signature(
     return 0;
 }
 
+/* see api.h */
+int
+PQCLEAN_FALCON1024_AVX2_crypto_sign_expand_sk(
+    uint8_t *esk, const uint8_t *sk) {
+    union {
+        uint8_t b[72 * 1024];
+        uint64_t dummy_u64;
+        fpr dummy_fpr;
+    } tmp;
+    int8_t f[1024], g[1024], F[1024], G[1024];
+
+    if (decode_privkey(f, g, F, G, sk, tmp.b) < 0) {
+        return -1;
+    }
+    PQCLEAN_FALCON1024_AVX2_expand_privkey((fpr *)(void *)esk, f, g, F, G, 10, tmp.b);
+    return 0;
+}
+
+/* see api.h */
+int
+PQCLEAN_FALCON1024_AVX2_crypto_sign_signature_expanded(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *esk) {
+    size_t vlen;
+
+    vlen = PQCLEAN_FALCON1024_AVX2_CRYPTO_BYTES - NONCELEN - 1;
+    if (do_sign_tree(sig + 1, sig + 1 + NONCELEN, &vlen, m, mlen, (const fpr *)(const void *)esk) < 0) {
+        return -1;
+    }
+    sig[0] = 0x30 + 10;
+    *siglen = 1 + NONCELEN + vlen;
+    return 0;
+}
+
 /* see api.h */
 int
 PQCLEAN_FALCON1024_AVX2_crypto_sign_verify(
@@ -7,6 +7,7 @@
 #define PQCLEAN_FALCONPADDED1024_AVX2_CRYPTO_SECRETKEYBYTES   2305
 #define PQCLEAN_FALCONPADDED1024_AVX2_CRYPTO_PUBLICKEYBYTES   1793
 #define PQCLEAN_FALCONPADDED1024_AVX2_CRYPTO_BYTES            1280
+#define PQCLEAN_FALCONPADDED1024_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES 122880
 
 #define PQCLEAN_FALCONPADDED1024_AVX2_CRYPTO_ALGNAME          "Falcon-padded-1024"
 
@@ -35,6 +36,31 @@ int PQCLEAN_FALCONPADDED1024_AVX2_crypto_sign_signature(
     uint8_t *sig, size_t *siglen,
     const uint8_t *m, size_t mlen, const uint8_t *sk);
 
+/*
+ * Expand a private key (sk) into the B0 matrix and LDL tree used by the
+ * signing sampler. The expanded key is written into esk[], of size
+ * PQCLEAN_FALCONPADDED1024_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES bytes, which must
+ * have 64-bit alignment. The expanded key holds platform-dependent
+ * floating-point values and must not be stored or exchanged; it is
+ * meant to be reused across signatures in one process.
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+int PQCLEAN_FALCONPADDED1024_AVX2_crypto_sign_expand_sk(
+    uint8_t *esk, const uint8_t *sk);
+
+/*
+ * Same as PQCLEAN_FALCONPADDED1024_AVX2_crypto_sign_signature(), but
+ * using a private key expanded by
+ * PQCLEAN_FALCONPADDED1024_AVX2_crypto_sign_expand_sk(); the LDL tree is
+ * then not recomputed for each signature.
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+int PQCLEAN_FALCONPADDED1024_AVX2_crypto_sign_signature_expanded(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *esk);
+
 /*
  * Verify a signature (sig, siglen) on a message (m, mlen) with a given
  * public key (pk).
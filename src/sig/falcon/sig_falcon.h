@@ -9,44 +9,56 @@
 #define OQS_SIG_falcon_512_length_public_key 897
 #define OQS_SIG_falcon_512_length_secret_key 1281
 #define OQS_SIG_falcon_512_length_signature 752
+#define OQS_SIG_falcon_512_length_expanded_secret_key 57344
 
 OQS_SIG *OQS_SIG_falcon_512_new(void);
 OQS_API OQS_STATUS OQS_SIG_falcon_512_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_falcon_512_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_falcon_512_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_512_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_512_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_falcon_1024)
 #define OQS_SIG_falcon_1024_length_public_key 1793
 #define OQS_SIG_falcon_1024_length_secret_key 2305
 #define OQS_SIG_falcon_1024_length_signature 1462
+#define OQS_SIG_falcon_1024_length_expanded_secret_key 122880
 
 OQS_SIG *OQS_SIG_falcon_1024_new(void);
 OQS_API OQS_STATUS OQS_SIG_falcon_1024_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_falcon_1024_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_falcon_1024_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_falcon_padded_512)
 #define OQS_SIG_falcon_padded_512_length_public_key 897
 #define OQS_SIG_falcon_padded_512_length_secret_key 1281
 #define OQS_SIG_falcon_padded_512_length_signature 666
+#define OQS_SIG_falcon_padded_512_length_expanded_secret_key 57344
 
 OQS_SIG *OQS_SIG_falcon_padded_512_new(void);
 OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_falcon_padded_1024)
 #define OQS_SIG_falcon_padded_1024_length_public_key 1793
 #define OQS_SIG_falcon_padded_1024_length_secret_key 2305
 #define OQS_SIG_falcon_padded_1024_length_signature 1280
+#define OQS_SIG_falcon_padded_1024_length_expanded_secret_key 122880
 
 OQS_SIG *OQS_SIG_falcon_padded_1024_new(void);
 OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key);
 #endif
 
 #endif
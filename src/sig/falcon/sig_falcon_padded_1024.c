@@ -25,6 +25,27 @@ OQS_SIG *OQS_SIG_falcon_padded_1024_new(void) {
 	sig->keypair = OQS_SIG_falcon_padded_1024_keypair;
 	sig->sign = OQS_SIG_falcon_padded_1024_sign;
 	sig->verify = OQS_SIG_falcon_padded_1024_verify;
+	sig->length_expanded_public_key = 0;
+	sig->public_key_expand = NULL;
+	sig->verify_expanded = NULL;
+#if defined(OQS_ENABLE_SIG_falcon_padded_1024_aarch64)
+	/* The aarch64 implementation has no expanded-key signing; sign with the secret key */
+	sig->length_expanded_secret_key = 0;
+	sig->secret_key_expand = NULL;
+	sig->sign_expanded = NULL;
+#else
+	sig->length_expanded_secret_key = OQS_SIG_falcon_padded_1024_length_expanded_secret_key;
+	sig->secret_key_expand = OQS_SIG_falcon_padded_1024_secret_key_expand;
+	sig->sign_expanded = OQS_SIG_falcon_padded_1024_sign_expanded;
+#endif
+	sig->length_stream_state = 0;
+	sig->stream_sign_init = NULL;
+	sig->stream_verify_init = NULL;
+	sig->stream_update = NULL;
+	sig->stream_sign_final = NULL;
+	sig->stream_verify_final = NULL;
+	sig->stream_release = NULL;
+	sig->sign_parallel = NULL;
 
 	return sig;
 }
@@ -32,11 +53,15 @@ OQS_SIG *OQS_SIG_falcon_padded_1024_new(void) {
 extern int PQCLEAN_FALCONPADDED1024_CLEAN_crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
 extern int PQCLEAN_FALCONPADDED1024_CLEAN_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int PQCLEAN_FALCONPADDED1024_CLEAN_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int PQCLEAN_FALCONPADDED1024_CLEAN_crypto_sign_expand_sk(uint8_t *esk, const uint8_t *sk);
+extern int PQCLEAN_FALCONPADDED1024_CLEAN_crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk);
 
 #if defined(OQS_ENABLE_SIG_falcon_padded_1024_avx2)
 extern int PQCLEAN_FALCONPADDED1024_AVX2_crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
 extern int PQCLEAN_FALCONPADDED1024_AVX2_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int PQCLEAN_FALCONPADDED1024_AVX2_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int PQCLEAN_FALCONPADDED1024_AVX2_crypto_sign_expand_sk(uint8_t *esk, const uint8_t *sk);
+extern int PQCLEAN_FALCONPADDED1024_AVX2_crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk);
 #endif
 
 #if defined(OQS_ENABLE_SIG_falcon_padded_1024_aarch64)
@@ -123,4 +148,36 @@ OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_verify(const uint8_t *message, siz
 #endif
 }
 
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key) {
+#if defined(OQS_ENABLE_SIG_falcon_padded_1024_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCONPADDED1024_AVX2_crypto_sign_expand_sk(expanded_secret_key, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCONPADDED1024_CLEAN_crypto_sign_expand_sk(expanded_secret_key, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_FALCONPADDED1024_CLEAN_crypto_sign_expand_sk(expanded_secret_key, secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key) {
+#if defined(OQS_ENABLE_SIG_falcon_padded_1024_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCONPADDED1024_AVX2_crypto_sign_signature_expanded(signature, signature_len, message, message_len, expanded_secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCONPADDED1024_CLEAN_crypto_sign_signature_expanded(signature, signature_len, message, message_len, expanded_secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_FALCONPADDED1024_CLEAN_crypto_sign_signature_expanded(signature, signature_len, message, message_len, expanded_secret_key);
+#endif
+}
+
 #endif
@@ -2,6 +2,11 @@
 
 #include <api.h>
 #include <mayo.h>
+#include <oqs/sig_mayo.h>
+
+/* The liboqs wrapper advertises these layouts as the expanded key lengths */
+_Static_assert(OQS_SIG_mayo_2_length_expanded_public_key == CRYPTO_EXPANDEDPUBLICKEYBYTES, "the expanded key does not match the advertised length");
+_Static_assert(OQS_SIG_mayo_2_length_expanded_secret_key == CRYPTO_EXPANDEDSECRETKEYBYTES, "the expanded key does not match the advertised length");
 
 #ifdef ENABLE_PARAMS_DYNAMIC
 #define MAYO_PARAMS &MAYO_2
@@ -44,3 +49,28 @@ crypto_sign_verify(const unsigned char *sig, size_t siglen,
     return mayo_verify(MAYO_PARAMS, m, mlen, sig, pk);
 }
 
+int
+crypto_sign_expand_sk(unsigned char *esk, const unsigned char *sk) {
+    return mayo_expand_sk_for_signing(MAYO_PARAMS, sk, esk);
+}
+
+int
+crypto_sign_signature_expanded(unsigned char *sig,
+              size_t *siglen, const unsigned char *m,
+              size_t mlen, const unsigned char *esk) {
+    return mayo_sign_signature_expanded(MAYO_PARAMS, sig, siglen, m, mlen, esk);
+}
+
+int
+crypto_sign_expand_pk(unsigned char *epk, const unsigned char *pk) {
+    return mayo_expand_pk_for_verification(MAYO_PARAMS, pk, epk);
+}
+
+int
+crypto_sign_verify_expanded(const unsigned char *sig, size_t siglen,
+                   const unsigned char *m, size_t mlen,
+                   const unsigned char *epk) {
+    if (siglen != CRYPTO_BYTES)
+        return -1;
+    return mayo_verify_expanded(MAYO_PARAMS, m, mlen, sig, epk);
+}
@@ -8,6 +8,8 @@
 #define CRYPTO_SECRETKEYBYTES 24
 #define CRYPTO_PUBLICKEYBYTES 5488
 #define CRYPTO_BYTES 180
+#define CRYPTO_EXPANDEDSECRETKEYBYTES 93684
+#define CRYPTO_EXPANDEDPUBLICKEYBYTES 98592
 
 #define CRYPTO_ALGNAME "MAYO-2"
 
@@ -39,5 +41,25 @@ crypto_sign_verify(const unsigned char *sig, size_t siglen,
                    const unsigned char *m, size_t mlen,
                    const unsigned char *pk);
 
+#define crypto_sign_expand_sk MAYO_NAMESPACE(crypto_sign_expand_sk)
+int
+crypto_sign_expand_sk(unsigned char *esk, const unsigned char *sk);
+
+#define crypto_sign_signature_expanded MAYO_NAMESPACE(crypto_sign_signature_expanded)
+int
+crypto_sign_signature_expanded(unsigned char *sig,
+              size_t *siglen, const unsigned char *m,
+              size_t mlen, const unsigned char *esk);
+
+#define crypto_sign_expand_pk MAYO_NAMESPACE(crypto_sign_expand_pk)
+int
+crypto_sign_expand_pk(unsigned char *epk, const unsigned char *pk);
+
+#define crypto_sign_verify_expanded MAYO_NAMESPACE(crypto_sign_verify_expanded)
+int
+crypto_sign_verify_expanded(const unsigned char *sig, size_t siglen,
+                   const unsigned char *m, size_t mlen,
+                   const unsigned char *epk);
+
 #endif /* api_h */
 
@@ -431,5 +431,73 @@ int mayo_verify(const mayo_params_t *p, const unsigned char *m,
                 size_t mlen, const unsigned char *sig,
                 const unsigned char *pk);
 
+/**
+ * Mayo expand secret key for repeated signing.
+ *
+ * Performs Mayo.expandSK() and stores the result as P1 || L || O || seed_sk,
+ * with P1 and L in host byte order, so that mayo_sign_signature_expanded
+ * can use it in place. The caller is responsible to allocate esk_bytes of
+ * 8-byte aligned memory to hold esk.
+ *
+ * @param[in] p Mayo parameter set
+ * @param[in] csk Compacted secret key
+ * @param[out] esk Expanded secret key
+ * @return int status code
+ */
+#define mayo_expand_sk_for_signing MAYO_NAMESPACE(mayo_expand_sk_for_signing)
+int mayo_expand_sk_for_signing(const mayo_params_t *p, const unsigned char *csk,
+                               unsigned char *esk);
+
+/**
+ * MAYO signature generation with an expanded secret key.
+ *
+ * Same as mayo_sign_signature(), but skips Mayo.expandSK().
+ *
+ * @param[in] p Mayo parameter set
+ * @param[out] sig Signature
+ * @param[out] siglen Pointer to the length of sig
+ * @param[in] m Message to be signed
+ * @param[in] mlen Message length
+ * @param[in] esk Secret key expanded by mayo_expand_sk_for_signing()
+ * @return int status code
+ */
+#define mayo_sign_signature_expanded MAYO_NAMESPACE(mayo_sign_signature_expanded)
+int mayo_sign_signature_expanded(const mayo_params_t *p, unsigned char *sig,
+              size_t *siglen, const unsigned char *m,
+              size_t mlen, const unsigned char *esk);
+
+/**
+ * Mayo expand public key for repeated verification.
+ *
+ * Same as mayo_expand_pk(), but leaves P1, P2 and P3 in host byte order so
+ * that mayo_verify_expanded can use them in place. The caller is responsible
+ * to allocate epk_bytes of 8-byte aligned memory to hold epk.
+ *
+ * @param[in] p Mayo parameter set
+ * @param[in] cpk Compacted public key
+ * @param[out] epk Expanded public key
+ * @return int status code
+ */
+#define mayo_expand_pk_for_verification MAYO_NAMESPACE(mayo_expand_pk_for_verification)
+int mayo_expand_pk_for_verification(const mayo_params_t *p, const unsigned char *cpk,
+                                    unsigned char *epk);
+
+/**
+ * Mayo verify signature with an expanded public key.
+ *
+ * Same as mayo_verify(), but skips Mayo.expandPK().
+ *
+ * @param[in] p Mayo parameter set
+ * @param[in] m Message
+ * @param[in] mlen Message length
+ * @param[in] sig Signature
+ * @param[in] epk Public key expanded by mayo_expand_pk_for_verification()
+ * @return int 0 if verification succeeded, 1 otherwise.
+ */
+#define mayo_verify_expanded MAYO_NAMESPACE(mayo_verify_expanded)
+int mayo_verify_expanded(const mayo_params_t *p, const unsigned char *m,
+                size_t mlen, const unsigned char *sig,
+                const unsigned char *epk);
+
 #endif
 
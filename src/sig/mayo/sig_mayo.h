@@ -9,44 +9,68 @@
 #define OQS_SIG_mayo_1_length_public_key 1168
 #define OQS_SIG_mayo_1_length_secret_key 24
 #define OQS_SIG_mayo_1_length_signature 321
+#define OQS_SIG_mayo_1_length_expanded_public_key 70752
+#define OQS_SIG_mayo_1_length_expanded_secret_key 69856
 
 OQS_SIG *OQS_SIG_mayo_1_new(void);
 OQS_API OQS_STATUS OQS_SIG_mayo_1_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_mayo_1_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_mayo_1_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_1_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_1_verify_expanded(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_1_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_1_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_mayo_2)
 #define OQS_SIG_mayo_2_length_public_key 5488
 #define OQS_SIG_mayo_2_length_secret_key 24
 #define OQS_SIG_mayo_2_length_signature 180
+#define OQS_SIG_mayo_2_length_expanded_public_key 98592
+#define OQS_SIG_mayo_2_length_expanded_secret_key 93684
 
 OQS_SIG *OQS_SIG_mayo_2_new(void);
 OQS_API OQS_STATUS OQS_SIG_mayo_2_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_mayo_2_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_mayo_2_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_2_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_2_verify_expanded(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_2_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_2_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_mayo_3)
 #define OQS_SIG_mayo_3_length_public_key 2656
 #define OQS_SIG_mayo_3_length_secret_key 32
 #define OQS_SIG_mayo_3_length_signature 577
+#define OQS_SIG_mayo_3_length_expanded_public_key 237600
+#define OQS_SIG_mayo_3_length_expanded_secret_key 235437
 
 OQS_SIG *OQS_SIG_mayo_3_new(void);
 OQS_API OQS_STATUS OQS_SIG_mayo_3_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_mayo_3_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_mayo_3_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_3_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_3_verify_expanded(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_3_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_3_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_mayo_5)
 #define OQS_SIG_mayo_5_length_public_key 5008
 #define OQS_SIG_mayo_5_length_secret_key 40
 #define OQS_SIG_mayo_5_length_signature 838
+#define OQS_SIG_mayo_5_length_expanded_public_key 570304
+#define OQS_SIG_mayo_5_length_expanded_secret_key 566078
 
 OQS_SIG *OQS_SIG_mayo_5_new(void);
 OQS_API OQS_STATUS OQS_SIG_mayo_5_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_mayo_5_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_mayo_5_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_5_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_5_verify_expanded(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_5_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_5_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key);
 #endif
 
 #endif
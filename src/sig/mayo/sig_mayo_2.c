@@ -25,6 +25,20 @@ OQS_SIG *OQS_SIG_mayo_2_new(void) {
 	sig->keypair = OQS_SIG_mayo_2_keypair;
 	sig->sign = OQS_SIG_mayo_2_sign;
 	sig->verify = OQS_SIG_mayo_2_verify;
+	sig->length_expanded_public_key = OQS_SIG_mayo_2_length_expanded_public_key;
+	sig->public_key_expand = OQS_SIG_mayo_2_public_key_expand;
+	sig->verify_expanded = OQS_SIG_mayo_2_verify_expanded;
+	sig->length_expanded_secret_key = OQS_SIG_mayo_2_length_expanded_secret_key;
+	sig->secret_key_expand = OQS_SIG_mayo_2_secret_key_expand;
+	sig->sign_expanded = OQS_SIG_mayo_2_sign_expanded;
+	sig->length_stream_state = 0;
+	sig->stream_sign_init = NULL;
+	sig->stream_verify_init = NULL;
+	sig->stream_update = NULL;
+	sig->stream_sign_final = NULL;
+	sig->stream_verify_final = NULL;
+	sig->stream_release = NULL;
+	sig->sign_parallel = NULL;
 
 	return sig;
 }
@@ -32,11 +46,19 @@ OQS_SIG *OQS_SIG_mayo_2_new(void) {
 extern int pqmayo_MAYO_2_opt_crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
 extern int pqmayo_MAYO_2_opt_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int pqmayo_MAYO_2_opt_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int pqmayo_MAYO_2_opt_crypto_sign_expand_pk(uint8_t *epk, const uint8_t *pk);
+extern int pqmayo_MAYO_2_opt_crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *epk);
+extern int pqmayo_MAYO_2_opt_crypto_sign_expand_sk(uint8_t *esk, const uint8_t *sk);
+extern int pqmayo_MAYO_2_opt_crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk);
 
 #if defined(OQS_ENABLE_SIG_mayo_2_avx2)
 extern int pqmayo_MAYO_2_avx2_crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
 extern int pqmayo_MAYO_2_avx2_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int pqmayo_MAYO_2_avx2_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int pqmayo_MAYO_2_avx2_crypto_sign_expand_pk(uint8_t *epk, const uint8_t *pk);
+extern int pqmayo_MAYO_2_avx2_crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *epk);
+extern int pqmayo_MAYO_2_avx2_crypto_sign_expand_sk(uint8_t *esk, const uint8_t *sk);
+extern int pqmayo_MAYO_2_avx2_crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk);
 #endif
 
 OQS_API OQS_STATUS OQS_SIG_mayo_2_keypair(uint8_t *public_key, uint8_t *secret_key) {
@@ -87,4 +109,68 @@ OQS_API OQS_STATUS OQS_SIG_mayo_2_verify(const uint8_t *message, size_t message_
 #endif
 }
 
+OQS_API OQS_STATUS OQS_SIG_mayo_2_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key) {
+#if defined(OQS_ENABLE_SIG_mayo_2_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqmayo_MAYO_2_avx2_crypto_sign_expand_pk(expanded_public_key, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqmayo_MAYO_2_opt_crypto_sign_expand_pk(expanded_public_key, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqmayo_MAYO_2_opt_crypto_sign_expand_pk(expanded_public_key, public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_mayo_2_verify_expanded(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *expanded_public_key) {
+#if defined(OQS_ENABLE_SIG_mayo_2_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqmayo_MAYO_2_avx2_crypto_sign_verify_expanded(signature, signature_len, message, message_len, expanded_public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqmayo_MAYO_2_opt_crypto_sign_verify_expanded(signature, signature_len, message, message_len, expanded_public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqmayo_MAYO_2_opt_crypto_sign_verify_expanded(signature, signature_len, message, message_len, expanded_public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_mayo_2_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key) {
+#if defined(OQS_ENABLE_SIG_mayo_2_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqmayo_MAYO_2_avx2_crypto_sign_expand_sk(expanded_secret_key, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqmayo_MAYO_2_opt_crypto_sign_expand_sk(expanded_secret_key, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqmayo_MAYO_2_opt_crypto_sign_expand_sk(expanded_secret_key, secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_mayo_2_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key) {
+#if defined(OQS_ENABLE_SIG_mayo_2_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqmayo_MAYO_2_avx2_crypto_sign_signature_expanded(signature, signature_len, message, message_len, expanded_secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqmayo_MAYO_2_opt_crypto_sign_signature_expanded(signature, signature_len, message, message_len, expanded_secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqmayo_MAYO_2_opt_crypto_sign_signature_expanded(signature, signature_len, message, message_len, expanded_secret_key);
+#endif
+}
+
 #endif
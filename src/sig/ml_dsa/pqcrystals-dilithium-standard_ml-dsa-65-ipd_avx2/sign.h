@@ -6,6 +6,24 @@
 #include "params.h"
 #include "polyvec.h"
 #include "poly.h"
+#include "fips202.h"
+
+/* Public key unpacked, hashed and expanded once, for repeated verification */
+typedef struct {
+  polyvecl mat[K];
+  polyveck t1;
+  uint8_t tr[TRBYTES];
+} expanded_pk;
+
+/* Secret key unpacked and expanded once, for repeated signing */
+typedef struct {
+  polyvecl mat[K];
+  polyvecl s1;
+  polyveck s2;
+  polyveck t0;
+  uint8_t tr[TRBYTES];
+  uint8_t key[SEEDBYTES];
+} expanded_sk;
 
 #define challenge DILITHIUM_NAMESPACE(challenge)
 void challenge(poly *c, const uint8_t seed[SEEDBYTES]);
@@ -18,6 +36,14 @@ int crypto_sign_signature(uint8_t *sig, size_t *siglen,
                           const uint8_t *m, size_t mlen,
                           const uint8_t *sk);
 
+#define crypto_sign_expand_sk DILITHIUM_NAMESPACE(expand_sk)
+int crypto_sign_expand_sk(expanded_sk *esk, const uint8_t *sk);
+
+#define crypto_sign_signature_expanded DILITHIUM_NAMESPACE(signature_expanded)
+int crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const expanded_sk *esk);
+
 #define crypto_sign DILITHIUM_NAMESPACETOP
 int crypto_sign(uint8_t *sm, size_t *smlen,
                 const uint8_t *m, size_t mlen,
@@ -28,9 +54,33 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen,
                        const uint8_t *m, size_t mlen,
                        const uint8_t *pk);
 
+#define crypto_sign_expand_pk DILITHIUM_NAMESPACE(expand_pk)
+int crypto_sign_expand_pk(expanded_pk *epk, const uint8_t *pk);
+
+#define crypto_sign_verify_expanded DILITHIUM_NAMESPACE(verify_expanded)
+int crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen,
+                                const uint8_t *m, size_t mlen,
+                                const expanded_pk *epk);
+
 #define crypto_sign_open DILITHIUM_NAMESPACE(open)
 int crypto_sign_open(uint8_t *m, size_t *mlen,
                      const uint8_t *sm, size_t smlen,
                      const uint8_t *pk);
 
+#define crypto_sign_stream_init_sk DILITHIUM_NAMESPACE(stream_init_sk)
+void crypto_sign_stream_init_sk(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sk);
+
+#define crypto_sign_signature_stream DILITHIUM_NAMESPACE(signature_stream)
+int crypto_sign_signature_stream(uint8_t *sig, size_t *siglen,
+                                 OQS_SHA3_shake256_inc_ctx *state,
+                                 const uint8_t *sk);
+
+#define crypto_sign_stream_init_pk DILITHIUM_NAMESPACE(stream_init_pk)
+void crypto_sign_stream_init_pk(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *pk);
+
+#define crypto_sign_verify_stream DILITHIUM_NAMESPACE(verify_stream)
+int crypto_sign_verify_stream(const uint8_t *sig, size_t siglen,
+                              OQS_SHA3_shake256_inc_ctx *state,
+                              const uint8_t *pk);
+
 #endif
@@ -1,4 +1,6 @@
 #include <stdint.h>
+#include <string.h>
+#include <oqs/sig_ml_dsa.h>
 #include "params.h"
 #include "sign.h"
 #include "packing.h"
@@ -8,6 +10,17 @@
 #include "symmetric.h"
 #include "fips202.h"
 
+/* The liboqs wrappers advertise these layouts as the expanded key lengths */
+#if DILITHIUM_MODE == 2
+#define OQS_LENGTH_EXPANDED(s) OQS_SIG_ml_dsa_44_ipd_length_expanded_##s
+#elif DILITHIUM_MODE == 3
+#define OQS_LENGTH_EXPANDED(s) OQS_SIG_ml_dsa_65_ipd_length_expanded_##s
+#elif DILITHIUM_MODE == 5
+#define OQS_LENGTH_EXPANDED(s) OQS_SIG_ml_dsa_87_ipd_length_expanded_##s
+#endif
+_Static_assert(sizeof(expanded_pk) == OQS_LENGTH_EXPANDED(public_key), "expanded_pk does not match the advertised length");
+_Static_assert(sizeof(expanded_sk) == OQS_LENGTH_EXPANDED(secret_key), "expanded_sk does not match the advertised length");
+
 /*************************************************
 * Name:        crypto_sign_keypair
 *
@@ -65,48 +78,65 @@ int crypto_sign_keypair(uint8_t *pk, uint8_t *sk) {
 }
 
 /*************************************************
-* Name:        crypto_sign_signature
+* Name:        crypto_sign_expand_sk
 *
-* Description: Computes signature.
+* Description: Unpacks a secret key and precomputes the matrix A and
+*              s1, s2, t0 in NTT domain, for use with
+*              crypto_sign_signature_expanded
+*
+* Arguments:   - expanded_sk *esk: pointer to output expanded secret key
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_expand_sk(expanded_sk *esk, const uint8_t *sk)
+{
+  uint8_t rho[SEEDBYTES];
+
+  unpack_sk(rho, esk->tr, esk->key, &esk->t0, &esk->s1, &esk->s2, sk);
+  polyvec_matrix_expand(esk->mat, rho);
+  polyvecl_ntt(&esk->s1);
+  polyveck_ntt(&esk->s2);
+  polyveck_ntt(&esk->t0);
+  return 0;
+}
+
+/*************************************************
+* Name:        signature_mu
+*
+* Description: Computes signature over a message representative
+*              mu = CRH(tr, msg) with an expanded secret key.
 *
 * Arguments:   - uint8_t *sig:   pointer to output signature (of length CRYPTO_BYTES)
 *              - size_t *siglen: pointer to output length of signature
-*              - uint8_t *m:     pointer to message to be signed
-*              - size_t mlen:    length of message
-*              - uint8_t *sk:    pointer to bit-packed secret key
+*              - const uint8_t *crh: pointer to mu (of length CRHBYTES)
+*              - const expanded_sk *esk: pointer to expanded secret key
 *
 * Returns 0 (success)
 **************************************************/
-int crypto_sign_signature(uint8_t *sig,
-                          size_t *siglen,
-                          const uint8_t *m,
-                          size_t mlen,
-                          const uint8_t *sk)
+static int signature_mu(uint8_t *sig,
+                        size_t *siglen,
+                        const uint8_t crh[CRHBYTES],
+                        const expanded_sk *esk)
 {
   unsigned int n;
-  uint8_t seedbuf[2*SEEDBYTES + TRBYTES + RNDBYTES + 2*CRHBYTES];
-  uint8_t *rho, *tr, *key, *mu, *rhoprime, *rnd;
+  uint8_t seedbuf[SEEDBYTES + RNDBYTES + 2*CRHBYTES];
+  uint8_t *key, *mu, *rhoprime, *rnd;
   uint16_t nonce = 0;
-  polyvecl mat[K], s1, y, z;
-  polyveck t0, s2, w1, w0, h;
+  polyvecl y, z;
+  polyveck w1, w0, h;
   poly cp;
   shake256incctx state;
 
-  rho = seedbuf;
-  tr = rho + SEEDBYTES;
-  key = tr + TRBYTES;
+  key = seedbuf;
   rnd = key + SEEDBYTES;
   mu = rnd + RNDBYTES;
   rhoprime = mu + CRHBYTES;
-  unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
+  memcpy(key, esk->key, SEEDBYTES);
 
 
-  /* Compute mu = CRH(tr, msg) */
+  memcpy(mu, crh, CRHBYTES);
   shake256_inc_init(&state);
-  shake256_inc_absorb(&state, tr, TRBYTES);
-  shake256_inc_absorb(&state, m, mlen);
-  shake256_inc_finalize(&state);
-  shake256_inc_squeeze(mu, CRHBYTES, &state);
 
 #ifdef DILITHIUM_RANDOMIZED_SIGNING
   randombytes(rnd, RNDBYTES);
@@ -116,12 +146,6 @@ int crypto_sign_signature(uint8_t *sig,
 #endif
   shake256(rhoprime, CRHBYTES, key, SEEDBYTES + RNDBYTES + CRHBYTES);
 
-  /* Expand matrix and transform vectors */
-  polyvec_matrix_expand(mat, rho);
-  polyvecl_ntt(&s1);
-  polyveck_ntt(&s2);
-  polyveck_ntt(&t0);
-
 rej:
   /* Sample intermediate vector y */
   polyvecl_uniform_gamma1(&y, rhoprime, nonce++);
@@ -129,7 +153,7 @@ rej:
   /* Matrix-vector multiplication */
   z = y;
   polyvecl_ntt(&z);
-  polyvec_matrix_pointwise_montgomery(&w1, mat, &z);
+  polyvec_matrix_pointwise_montgomery(&w1, esk->mat, &z);
   polyveck_reduce(&w1);
   polyveck_invntt_tomont(&w1);
 
@@ -147,7 +171,7 @@ rej:
   poly_ntt(&cp);
 
   /* Compute z, reject if it reveals secret */
-  polyvecl_pointwise_poly_montgomery(&z, &cp, &s1);
+  polyvecl_pointwise_poly_montgomery(&z, &cp, &esk->s1);
   polyvecl_invntt_tomont(&z);
   polyvecl_add(&z, &z, &y);
   polyvecl_reduce(&z);
@@ -156,7 +180,7 @@ rej:
 
   /* Check that subtracting cs2 does not change high bits of w and low bits
    * do not reveal secret information */
-  polyveck_pointwise_poly_montgomery(&h, &cp, &s2);
+  polyveck_pointwise_poly_montgomery(&h, &cp, &esk->s2);
   polyveck_invntt_tomont(&h);
   polyveck_sub(&w0, &w0, &h);
   polyveck_reduce(&w0);
@@ -164,7 +188,7 @@ rej:
     goto rej;
 
   /* Compute hints for w1 */
-  polyveck_pointwise_poly_montgomery(&h, &cp, &t0);
+  polyveck_pointwise_poly_montgomery(&h, &cp, &esk->t0);
   polyveck_invntt_tomont(&h);
   polyveck_reduce(&h);
   if(polyveck_chknorm(&h, GAMMA2))
@@ -183,6 +207,65 @@ rej:
   return 0;
 }
 
+/*************************************************
+* Name:        crypto_sign_signature_expanded
+*
+* Description: Computes signature with a secret key expanded
+*              by crypto_sign_expand_sk.
+*
+* Arguments:   - uint8_t *sig:   pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m:     pointer to message to be signed
+*              - size_t mlen:    length of message
+*              - const expanded_sk *esk: pointer to expanded secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_signature_expanded(uint8_t *sig,
+                                   size_t *siglen,
+                                   const uint8_t *m,
+                                   size_t mlen,
+                                   const expanded_sk *esk)
+{
+  uint8_t mu[CRHBYTES];
+  shake256incctx state;
+
+  /* Compute mu = CRH(tr, msg) */
+  shake256_inc_init(&state);
+  shake256_inc_absorb(&state, esk->tr, TRBYTES);
+  shake256_inc_absorb(&state, m, mlen);
+  shake256_inc_finalize(&state);
+  shake256_inc_squeeze(mu, CRHBYTES, &state);
+  shake256_inc_ctx_release(&state);
+
+  return signature_mu(sig, siglen, mu, esk);
+}
+
+/*************************************************
+* Name:        crypto_sign_signature
+*
+* Description: Computes signature.
+*
+* Arguments:   - uint8_t *sig:   pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m:     pointer to message to be signed
+*              - size_t mlen:    length of message
+*              - uint8_t *sk:    pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_signature(uint8_t *sig,
+                          size_t *siglen,
+                          const uint8_t *m,
+                          size_t mlen,
+                          const uint8_t *sk)
+{
+  expanded_sk esk;
+
+  crypto_sign_expand_sk(&esk, sk);
+  return crypto_sign_signature_expanded(sig, siglen, m, mlen, &esk);
+}
+
 /*************************************************
 * Name:        crypto_sign
 *
@@ -296,6 +379,133 @@ int crypto_sign_verify(const uint8_t *sig,
   return 0;
 }
 
+/*************************************************
+* Name:        crypto_sign_expand_pk
+*
+* Description: Precomputes tr, the matrix A and t1*2^d in NTT domain
+*              from a public key, for use with crypto_sign_verify_expanded
+*
+* Arguments:   - expanded_pk *epk: pointer to output expanded public key
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_expand_pk(expanded_pk *epk, const uint8_t *pk)
+{
+  uint8_t rho[SEEDBYTES];
+
+  unpack_pk(rho, &epk->t1, pk);
+  shake256(epk->tr, TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+  polyvec_matrix_expand(epk->mat, rho);
+
+  polyveck_shiftl(&epk->t1);
+  polyveck_ntt(&epk->t1);
+  return 0;
+}
+
+/*************************************************
+* Name:        verify_mu
+*
+* Description: Verifies signature over a message representative
+*              mu = CRH(tr, msg) with an expanded public key.
+*
+* Arguments:   - const uint8_t *sig: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *mu: pointer to mu (of length CRHBYTES)
+*              - const expanded_pk *epk: pointer to expanded public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+static int verify_mu(const uint8_t *sig,
+                     size_t siglen,
+                     const uint8_t mu[CRHBYTES],
+                     const expanded_pk *epk)
+{
+  unsigned int i;
+  uint8_t buf[K*POLYW1_PACKEDBYTES];
+  uint8_t c[CTILDEBYTES];
+  uint8_t c2[CTILDEBYTES];
+  poly cp;
+  polyvecl z;
+  polyveck t1, w1, h;
+  shake256incctx state;
+
+  if(siglen != CRYPTO_BYTES)
+    return -1;
+
+  if(unpack_sig(c, &z, &h, sig))
+    return -1;
+  if(polyvecl_chknorm(&z, GAMMA1 - BETA))
+    return -1;
+
+  shake256_inc_init(&state);
+
+  /* Matrix-vector multiplication; compute Az - c2^dt1 */
+  poly_challenge(&cp, c);
+
+  polyvecl_ntt(&z);
+  polyvec_matrix_pointwise_montgomery(&w1, epk->mat, &z);
+
+  poly_ntt(&cp);
+  polyveck_pointwise_poly_montgomery(&t1, &cp, &epk->t1);
+
+  polyveck_sub(&w1, &w1, &t1);
+  polyveck_reduce(&w1);
+  polyveck_invntt_tomont(&w1);
+
+  /* Reconstruct w1 */
+  polyveck_caddq(&w1);
+  polyveck_use_hint(&w1, &w1, &h);
+  polyveck_pack_w1(buf, &w1);
+
+  /* Call random oracle and verify challenge */
+  shake256_inc_ctx_reset(&state);
+  shake256_inc_absorb(&state, mu, CRHBYTES);
+  shake256_inc_absorb(&state, buf, K*POLYW1_PACKEDBYTES);
+  shake256_inc_finalize(&state);
+  shake256_inc_squeeze(c2, CTILDEBYTES, &state);
+  shake256_inc_ctx_release(&state);
+  for(i = 0; i < CTILDEBYTES; ++i)
+    if(c[i] != c2[i])
+      return -1;
+
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_verify_expanded
+*
+* Description: Verifies signature against a public key expanded
+*              by crypto_sign_expand_pk.
+*
+* Arguments:   - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+*              - const expanded_pk *epk: pointer to expanded public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int crypto_sign_verify_expanded(const uint8_t *sig,
+                                size_t siglen,
+                                const uint8_t *m,
+                                size_t mlen,
+                                const expanded_pk *epk)
+{
+  uint8_t mu[CRHBYTES];
+  shake256incctx state;
+
+  /* Compute CRH(tr, msg) */
+  shake256_inc_init(&state);
+  shake256_inc_absorb(&state, epk->tr, TRBYTES);
+  shake256_inc_absorb(&state, m, mlen);
+  shake256_inc_finalize(&state);
+  shake256_inc_squeeze(mu, CRHBYTES, &state);
+  shake256_inc_ctx_release(&state);
+
+  return verify_mu(sig, siglen, mu, epk);
+}
+
 /*************************************************
 * Name:        crypto_sign_open
 *
@@ -339,3 +549,104 @@ badsig:
 
   return -1;
 }
+
+/*************************************************
+* Name:        crypto_sign_stream_init_sk
+*
+* Description: Starts computing mu = CRH(tr, msg) for a message that is
+*              passed in pieces; absorbs tr taken from the secret key.
+*              The message is absorbed with OQS_SHA3_shake256_inc_absorb
+*              and signed by crypto_sign_signature_stream.
+*
+* Arguments:   - OQS_SHA3_shake256_inc_ctx *state: pointer to output hash state
+*              - const uint8_t *sk: pointer to bit-packed secret key
+**************************************************/
+void crypto_sign_stream_init_sk(OQS_SHA3_shake256_inc_ctx *state,
+                                const uint8_t *sk)
+{
+  /* tr follows rho and key in the packed secret key */
+  OQS_SHA3_shake256_inc_init(state);
+  OQS_SHA3_shake256_inc_absorb(state, sk + 2*SEEDBYTES, TRBYTES);
+}
+
+/*************************************************
+* Name:        crypto_sign_signature_stream
+*
+* Description: Finishes a message started with crypto_sign_stream_init_sk
+*              and computes its signature. Releases the hash state.
+*
+* Arguments:   - uint8_t *sig:   pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - OQS_SHA3_shake256_inc_ctx *state: pointer to hash state that absorbed the message
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_signature_stream(uint8_t *sig,
+                                 size_t *siglen,
+                                 OQS_SHA3_shake256_inc_ctx *state,
+                                 const uint8_t *sk)
+{
+  uint8_t mu[CRHBYTES];
+  expanded_sk esk;
+
+  OQS_SHA3_shake256_inc_finalize(state);
+  OQS_SHA3_shake256_inc_squeeze(mu, CRHBYTES, state);
+  OQS_SHA3_shake256_inc_ctx_release(state);
+
+  crypto_sign_expand_sk(&esk, sk);
+  return signature_mu(sig, siglen, mu, &esk);
+}
+
+/*************************************************
+* Name:        crypto_sign_stream_init_pk
+*
+* Description: Starts computing mu = CRH(H(rho, t1), msg) for a message
+*              that is passed in pieces. The message is absorbed with
+*              OQS_SHA3_shake256_inc_absorb and the signature is checked
+*              by crypto_sign_verify_stream.
+*
+* Arguments:   - OQS_SHA3_shake256_inc_ctx *state: pointer to output hash state
+*              - const uint8_t *pk: pointer to bit-packed public key
+**************************************************/
+void crypto_sign_stream_init_pk(OQS_SHA3_shake256_inc_ctx *state,
+                                const uint8_t *pk)
+{
+  uint8_t tr[TRBYTES];
+
+  shake256(tr, TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+  OQS_SHA3_shake256_inc_init(state);
+  OQS_SHA3_shake256_inc_absorb(state, tr, TRBYTES);
+}
+
+/*************************************************
+* Name:        crypto_sign_verify_stream
+*
+* Description: Finishes a message started with crypto_sign_stream_init_pk
+*              and verifies its signature. Releases the hash state.
+*
+* Arguments:   - const uint8_t *sig: pointer to input signature
+*              - size_t siglen: length of signature
+*              - OQS_SHA3_shake256_inc_ctx *state: pointer to hash state that absorbed the message
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int crypto_sign_verify_stream(const uint8_t *sig,
+                              size_t siglen,
+                              OQS_SHA3_shake256_inc_ctx *state,
+                              const uint8_t *pk)
+{
+  uint8_t mu[CRHBYTES];
+  expanded_pk epk;
+
+  OQS_SHA3_shake256_inc_finalize(state);
+  OQS_SHA3_shake256_inc_squeeze(mu, CRHBYTES, state);
+  OQS_SHA3_shake256_inc_ctx_release(state);
+
+  if(siglen != CRYPTO_BYTES)
+    return -1;
+
+  crypto_sign_expand_pk(&epk, pk);
+  return verify_mu(sig, siglen, mu, &epk);
+}
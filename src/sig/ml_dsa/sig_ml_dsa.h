@@ -9,57 +9,129 @@
 #define OQS_SIG_ml_dsa_44_ipd_length_public_key 1312
 #define OQS_SIG_ml_dsa_44_ipd_length_secret_key 2560
 #define OQS_SIG_ml_dsa_44_ipd_length_signature 2420
+#define OQS_SIG_ml_dsa_44_ipd_length_expanded_public_key 20544
+#define OQS_SIG_ml_dsa_44_ipd_length_expanded_secret_key 28768
 
 OQS_SIG *OQS_SIG_ml_dsa_44_ipd_new(void);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_ipd_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_ipd_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_ipd_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_ipd_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_ipd_verify_expanded(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_ipd_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_ipd_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_ipd_stream_sign_init(void *state, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_ipd_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_ipd_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_ipd_stream_sign_final(uint8_t *signature, size_t *signature_len, void *state);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_ipd_stream_verify_final(void *state);
+OQS_API void OQS_SIG_ml_dsa_44_ipd_stream_release(void *state);
 
 #define OQS_SIG_ml_dsa_44_length_public_key OQS_SIG_ml_dsa_44_ipd_length_public_key
 #define OQS_SIG_ml_dsa_44_length_secret_key OQS_SIG_ml_dsa_44_ipd_length_secret_key
 #define OQS_SIG_ml_dsa_44_length_signature OQS_SIG_ml_dsa_44_ipd_length_signature
+#define OQS_SIG_ml_dsa_44_length_expanded_public_key OQS_SIG_ml_dsa_44_ipd_length_expanded_public_key
+#define OQS_SIG_ml_dsa_44_length_expanded_secret_key OQS_SIG_ml_dsa_44_ipd_length_expanded_secret_key
 OQS_SIG *OQS_SIG_ml_dsa_44_new(void);
 #define OQS_SIG_ml_dsa_44_keypair OQS_SIG_ml_dsa_44_ipd_keypair
 #define OQS_SIG_ml_dsa_44_sign OQS_SIG_ml_dsa_44_ipd_sign
 #define OQS_SIG_ml_dsa_44_verify OQS_SIG_ml_dsa_44_ipd_verify
+#define OQS_SIG_ml_dsa_44_public_key_expand OQS_SIG_ml_dsa_44_ipd_public_key_expand
+#define OQS_SIG_ml_dsa_44_verify_expanded OQS_SIG_ml_dsa_44_ipd_verify_expanded
+#define OQS_SIG_ml_dsa_44_secret_key_expand OQS_SIG_ml_dsa_44_ipd_secret_key_expand
+#define OQS_SIG_ml_dsa_44_sign_expanded OQS_SIG_ml_dsa_44_ipd_sign_expanded
+#define OQS_SIG_ml_dsa_44_stream_sign_init OQS_SIG_ml_dsa_44_ipd_stream_sign_init
+#define OQS_SIG_ml_dsa_44_stream_verify_init OQS_SIG_ml_dsa_44_ipd_stream_verify_init
+#define OQS_SIG_ml_dsa_44_stream_update OQS_SIG_ml_dsa_44_ipd_stream_update
+#define OQS_SIG_ml_dsa_44_stream_sign_final OQS_SIG_ml_dsa_44_ipd_stream_sign_final
+#define OQS_SIG_ml_dsa_44_stream_verify_final OQS_SIG_ml_dsa_44_ipd_stream_verify_final
+#define OQS_SIG_ml_dsa_44_stream_release OQS_SIG_ml_dsa_44_ipd_stream_release
 #endif
 
 #if defined(OQS_ENABLE_SIG_ml_dsa_65_ipd) || defined(OQS_ENABLE_SIG_ml_dsa_65)
 #define OQS_SIG_ml_dsa_65_ipd_length_public_key 1952
 #define OQS_SIG_ml_dsa_65_ipd_length_secret_key 4032
 #define OQS_SIG_ml_dsa_65_ipd_length_signature 3309
+#define OQS_SIG_ml_dsa_65_ipd_length_expanded_public_key 36928
+#define OQS_SIG_ml_dsa_65_ipd_length_expanded_secret_key 48224
 
 OQS_SIG *OQS_SIG_ml_dsa_65_ipd_new(void);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_verify_expanded(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_stream_sign_init(void *state, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_stream_sign_final(uint8_t *signature, size_t *signature_len, void *state);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_stream_verify_final(void *state);
+OQS_API void OQS_SIG_ml_dsa_65_ipd_stream_release(void *state);
 
 #define OQS_SIG_ml_dsa_65_length_public_key OQS_SIG_ml_dsa_65_ipd_length_public_key
 #define OQS_SIG_ml_dsa_65_length_secret_key OQS_SIG_ml_dsa_65_ipd_length_secret_key
 #define OQS_SIG_ml_dsa_65_length_signature OQS_SIG_ml_dsa_65_ipd_length_signature
+#define OQS_SIG_ml_dsa_65_length_expanded_public_key OQS_SIG_ml_dsa_65_ipd_length_expanded_public_key
+#define OQS_SIG_ml_dsa_65_length_expanded_secret_key OQS_SIG_ml_dsa_65_ipd_length_expanded_secret_key
 OQS_SIG *OQS_SIG_ml_dsa_65_new(void);
 #define OQS_SIG_ml_dsa_65_keypair OQS_SIG_ml_dsa_65_ipd_keypair
 #define OQS_SIG_ml_dsa_65_sign OQS_SIG_ml_dsa_65_ipd_sign
 #define OQS_SIG_ml_dsa_65_verify OQS_SIG_ml_dsa_65_ipd_verify
+#define OQS_SIG_ml_dsa_65_public_key_expand OQS_SIG_ml_dsa_65_ipd_public_key_expand
+#define OQS_SIG_ml_dsa_65_verify_expanded OQS_SIG_ml_dsa_65_ipd_verify_expanded
+#define OQS_SIG_ml_dsa_65_secret_key_expand OQS_SIG_ml_dsa_65_ipd_secret_key_expand
+#define OQS_SIG_ml_dsa_65_sign_expanded OQS_SIG_ml_dsa_65_ipd_sign_expanded
+#define OQS_SIG_ml_dsa_65_stream_sign_init OQS_SIG_ml_dsa_65_ipd_stream_sign_init
+#define OQS_SIG_ml_dsa_65_stream_verify_init OQS_SIG_ml_dsa_65_ipd_stream_verify_init
+#define OQS_SIG_ml_dsa_65_stream_update OQS_SIG_ml_dsa_65_ipd_stream_update
+#define OQS_SIG_ml_dsa_65_stream_sign_final OQS_SIG_ml_dsa_65_ipd_stream_sign_final
+#define OQS_SIG_ml_dsa_65_stream_verify_final OQS_SIG_ml_dsa_65_ipd_stream_verify_final
+#define OQS_SIG_ml_dsa_65_stream_release OQS_SIG_ml_dsa_65_ipd_stream_release
 #endif
 
 #if defined(OQS_ENABLE_SIG_ml_dsa_87_ipd) || defined(OQS_ENABLE_SIG_ml_dsa_87)
 #define OQS_SIG_ml_dsa_87_ipd_length_public_key 2592
 #define OQS_SIG_ml_dsa_87_ipd_length_secret_key 4896
 #define OQS_SIG_ml_dsa_87_ipd_length_signature 4627
+#define OQS_SIG_ml_dsa_87_ipd_length_expanded_public_key 65600
+#define OQS_SIG_ml_dsa_87_ipd_length_expanded_secret_key 80992
 
 OQS_SIG *OQS_SIG_ml_dsa_87_ipd_new(void);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_ipd_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_ipd_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_ipd_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_ipd_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_ipd_verify_expanded(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *expanded_public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_ipd_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_ipd_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_ipd_stream_sign_init(void *state, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_ipd_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_ipd_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_ipd_stream_sign_final(uint8_t *signature, size_t *signature_len, void *state);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_ipd_stream_verify_final(void *state);
+OQS_API void OQS_SIG_ml_dsa_87_ipd_stream_release(void *state);
 
 #define OQS_SIG_ml_dsa_87_length_public_key OQS_SIG_ml_dsa_87_ipd_length_public_key
 #define OQS_SIG_ml_dsa_87_length_secret_key OQS_SIG_ml_dsa_87_ipd_length_secret_key
 #define OQS_SIG_ml_dsa_87_length_signature OQS_SIG_ml_dsa_87_ipd_length_signature
+#define OQS_SIG_ml_dsa_87_length_expanded_public_key OQS_SIG_ml_dsa_87_ipd_length_expanded_public_key
+#define OQS_SIG_ml_dsa_87_length_expanded_secret_key OQS_SIG_ml_dsa_87_ipd_length_expanded_secret_key
 OQS_SIG *OQS_SIG_ml_dsa_87_new(void);
 #define OQS_SIG_ml_dsa_87_keypair OQS_SIG_ml_dsa_87_ipd_keypair
 #define OQS_SIG_ml_dsa_87_sign OQS_SIG_ml_dsa_87_ipd_sign
 #define OQS_SIG_ml_dsa_87_verify OQS_SIG_ml_dsa_87_ipd_verify
+#define OQS_SIG_ml_dsa_87_public_key_expand OQS_SIG_ml_dsa_87_ipd_public_key_expand
+#define OQS_SIG_ml_dsa_87_verify_expanded OQS_SIG_ml_dsa_87_ipd_verify_expanded
+#define OQS_SIG_ml_dsa_87_secret_key_expand OQS_SIG_ml_dsa_87_ipd_secret_key_expand
+#define OQS_SIG_ml_dsa_87_sign_expanded OQS_SIG_ml_dsa_87_ipd_sign_expanded
+#define OQS_SIG_ml_dsa_87_stream_sign_init OQS_SIG_ml_dsa_87_ipd_stream_sign_init
+#define OQS_SIG_ml_dsa_87_stream_verify_init OQS_SIG_ml_dsa_87_ipd_stream_verify_init
+#define OQS_SIG_ml_dsa_87_stream_update OQS_SIG_ml_dsa_87_ipd_stream_update
+#define OQS_SIG_ml_dsa_87_stream_sign_final OQS_SIG_ml_dsa_87_ipd_stream_sign_final
+#define OQS_SIG_ml_dsa_87_stream_verify_final OQS_SIG_ml_dsa_87_ipd_stream_verify_final
+#define OQS_SIG_ml_dsa_87_stream_release OQS_SIG_ml_dsa_87_ipd_stream_release
 #endif
 
 #endif
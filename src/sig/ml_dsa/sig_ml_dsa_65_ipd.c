@@ -1,11 +1,23 @@
 // SPDX-License-Identifier: MIT
 
 #include <stdlib.h>
+#include <string.h>
 
+#include <oqs/sha3.h>
 #include <oqs/sig_ml_dsa.h>
 
 #if defined(OQS_ENABLE_SIG_ml_dsa_65_ipd) || defined(OQS_ENABLE_SIG_ml_dsa_65)
 
+/* State of a streaming signing or verification operation */
+typedef struct {
+	/* mu = CRH(tr, msg), absorbing the message */
+	OQS_SHA3_shake256_inc_ctx mu_state;
+	/* Secret key when signing, public key when verifying */
+	uint8_t key[OQS_SIG_ml_dsa_65_ipd_length_secret_key];
+	/* Signature being verified */
+	uint8_t signature[OQS_SIG_ml_dsa_65_ipd_length_signature];
+} OQS_SIG_ml_dsa_65_ipd_stream_state;
+
 #if defined(OQS_ENABLE_SIG_ml_dsa_65_ipd)
 
 OQS_SIG *OQS_SIG_ml_dsa_65_ipd_new(void) {
@@ -27,6 +39,20 @@ OQS_SIG *OQS_SIG_ml_dsa_65_ipd_new(void) {
 	sig->keypair = OQS_SIG_ml_dsa_65_ipd_keypair;
 	sig->sign = OQS_SIG_ml_dsa_65_ipd_sign;
 	sig->verify = OQS_SIG_ml_dsa_65_ipd_verify;
+	sig->length_expanded_public_key = OQS_SIG_ml_dsa_65_ipd_length_expanded_public_key;
+	sig->public_key_expand = OQS_SIG_ml_dsa_65_ipd_public_key_expand;
+	sig->verify_expanded = OQS_SIG_ml_dsa_65_ipd_verify_expanded;
+	sig->length_expanded_secret_key = OQS_SIG_ml_dsa_65_ipd_length_expanded_secret_key;
+	sig->secret_key_expand = OQS_SIG_ml_dsa_65_ipd_secret_key_expand;
+	sig->sign_expanded = OQS_SIG_ml_dsa_65_ipd_sign_expanded;
+	sig->length_stream_state = sizeof(OQS_SIG_ml_dsa_65_ipd_stream_state);
+	sig->stream_sign_init = OQS_SIG_ml_dsa_65_ipd_stream_sign_init;
+	sig->stream_verify_init = OQS_SIG_ml_dsa_65_ipd_stream_verify_init;
+	sig->stream_update = OQS_SIG_ml_dsa_65_ipd_stream_update;
+	sig->stream_sign_final = OQS_SIG_ml_dsa_65_ipd_stream_sign_final;
+	sig->stream_verify_final = OQS_SIG_ml_dsa_65_ipd_stream_verify_final;
+	sig->stream_release = OQS_SIG_ml_dsa_65_ipd_stream_release;
+	sig->sign_parallel = NULL;
 
 	return sig;
 }
@@ -53,6 +79,20 @@ OQS_SIG *OQS_SIG_ml_dsa_65_new(void) {
 	sig->keypair = OQS_SIG_ml_dsa_65_ipd_keypair;
 	sig->sign = OQS_SIG_ml_dsa_65_ipd_sign;
 	sig->verify = OQS_SIG_ml_dsa_65_ipd_verify;
+	sig->length_expanded_public_key = OQS_SIG_ml_dsa_65_length_expanded_public_key;
+	sig->public_key_expand = OQS_SIG_ml_dsa_65_public_key_expand;
+	sig->verify_expanded = OQS_SIG_ml_dsa_65_verify_expanded;
+	sig->length_expanded_secret_key = OQS_SIG_ml_dsa_65_length_expanded_secret_key;
+	sig->secret_key_expand = OQS_SIG_ml_dsa_65_secret_key_expand;
+	sig->sign_expanded = OQS_SIG_ml_dsa_65_sign_expanded;
+	sig->length_stream_state = sizeof(OQS_SIG_ml_dsa_65_ipd_stream_state);
+	sig->stream_sign_init = OQS_SIG_ml_dsa_65_stream_sign_init;
+	sig->stream_verify_init = OQS_SIG_ml_dsa_65_stream_verify_init;
+	sig->stream_update = OQS_SIG_ml_dsa_65_stream_update;
+	sig->stream_sign_final = OQS_SIG_ml_dsa_65_stream_sign_final;
+	sig->stream_verify_final = OQS_SIG_ml_dsa_65_stream_verify_final;
+	sig->stream_release = OQS_SIG_ml_dsa_65_stream_release;
+	sig->sign_parallel = NULL;
 
 	return sig;
 }
@@ -61,11 +101,27 @@ OQS_SIG *OQS_SIG_ml_dsa_65_new(void) {
 extern int pqcrystals_ml_dsa_65_ipd_ref_keypair(uint8_t *pk, uint8_t *sk);
 extern int pqcrystals_ml_dsa_65_ipd_ref_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int pqcrystals_ml_dsa_65_ipd_ref_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_65_ipd_ref_expand_pk(uint8_t *epk, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_65_ipd_ref_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *epk);
+extern int pqcrystals_ml_dsa_65_ipd_ref_expand_sk(uint8_t *esk, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_65_ipd_ref_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk);
+extern void pqcrystals_ml_dsa_65_ipd_ref_stream_init_sk(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_65_ipd_ref_signature_stream(uint8_t *sig, size_t *siglen, OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sk);
+extern void pqcrystals_ml_dsa_65_ipd_ref_stream_init_pk(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_65_ipd_ref_verify_stream(const uint8_t *sig, size_t siglen, OQS_SHA3_shake256_inc_ctx *state, const uint8_t *pk);
 
 #if defined(OQS_ENABLE_SIG_ml_dsa_65_ipd_avx2) || defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
 extern int pqcrystals_ml_dsa_65_ipd_avx2_keypair(uint8_t *pk, uint8_t *sk);
 extern int pqcrystals_ml_dsa_65_ipd_avx2_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int pqcrystals_ml_dsa_65_ipd_avx2_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_65_ipd_avx2_expand_pk(uint8_t *epk, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_65_ipd_avx2_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *epk);
+extern int pqcrystals_ml_dsa_65_ipd_avx2_expand_sk(uint8_t *esk, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_65_ipd_avx2_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk);
+extern void pqcrystals_ml_dsa_65_ipd_avx2_stream_init_sk(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_65_ipd_avx2_signature_stream(uint8_t *sig, size_t *siglen, OQS_SHA3_shake256_inc_ctx *state, const uint8_t *sk);
+extern void pqcrystals_ml_dsa_65_ipd_avx2_stream_init_pk(OQS_SHA3_shake256_inc_ctx *state, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_65_ipd_avx2_verify_stream(const uint8_t *sig, size_t siglen, OQS_SHA3_shake256_inc_ctx *state, const uint8_t *pk);
 #endif
 
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_keypair(uint8_t *public_key, uint8_t *secret_key) {
@@ -116,4 +172,163 @@ OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_verify(const uint8_t *message, size_t m
 #endif
 }
 
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_public_key_expand(uint8_t *expanded_public_key, const uint8_t *public_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_65_ipd_avx2) || defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_avx2_expand_pk(expanded_public_key, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_ref_expand_pk(expanded_public_key, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_ref_expand_pk(expanded_public_key, public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_verify_expanded(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *expanded_public_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_65_ipd_avx2) || defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_avx2_verify_expanded(signature, signature_len, message, message_len, expanded_public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_ref_verify_expanded(signature, signature_len, message, message_len, expanded_public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_ref_verify_expanded(signature, signature_len, message, message_len, expanded_public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_secret_key_expand(uint8_t *expanded_secret_key, const uint8_t *secret_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_65_ipd_avx2) || defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_avx2_expand_sk(expanded_secret_key, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_ref_expand_sk(expanded_secret_key, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_ref_expand_sk(expanded_secret_key, secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_sign_expanded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_65_ipd_avx2) || defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_avx2_signature_expanded(signature, signature_len, message, message_len, expanded_secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_ref_signature_expanded(signature, signature_len, message, message_len, expanded_secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_ref_signature_expanded(signature, signature_len, message, message_len, expanded_secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_stream_sign_init(void *state, const uint8_t *secret_key) {
+	OQS_SIG_ml_dsa_65_ipd_stream_state *stream = state;
+
+	memcpy(stream->key, secret_key, OQS_SIG_ml_dsa_65_ipd_length_secret_key);
+#if defined(OQS_ENABLE_SIG_ml_dsa_65_ipd_avx2) || defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		pqcrystals_ml_dsa_65_ipd_avx2_stream_init_sk(&stream->mu_state, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		pqcrystals_ml_dsa_65_ipd_ref_stream_init_sk(&stream->mu_state, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	pqcrystals_ml_dsa_65_ipd_ref_stream_init_sk(&stream->mu_state, secret_key);
+#endif
+
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	OQS_SIG_ml_dsa_65_ipd_stream_state *stream = state;
+
+	if (signature_len != OQS_SIG_ml_dsa_65_ipd_length_signature) {
+		return OQS_ERROR;
+	}
+	memcpy(stream->key, public_key, OQS_SIG_ml_dsa_65_ipd_length_public_key);
+	memcpy(stream->signature, signature, OQS_SIG_ml_dsa_65_ipd_length_signature);
+#if defined(OQS_ENABLE_SIG_ml_dsa_65_ipd_avx2) || defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		pqcrystals_ml_dsa_65_ipd_avx2_stream_init_pk(&stream->mu_state, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		pqcrystals_ml_dsa_65_ipd_ref_stream_init_pk(&stream->mu_state, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	pqcrystals_ml_dsa_65_ipd_ref_stream_init_pk(&stream->mu_state, public_key);
+#endif
+
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_stream_update(void *state, const uint8_t *chunk, size_t chunk_len) {
+	OQS_SIG_ml_dsa_65_ipd_stream_state *stream = state;
+
+	OQS_SHA3_shake256_inc_absorb(&stream->mu_state, chunk, chunk_len);
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_stream_sign_final(uint8_t *signature, size_t *signature_len, void *state) {
+	OQS_SIG_ml_dsa_65_ipd_stream_state *stream = state;
+
+#if defined(OQS_ENABLE_SIG_ml_dsa_65_ipd_avx2) || defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_avx2_signature_stream(signature, signature_len, &stream->mu_state, stream->key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_ref_signature_stream(signature, signature_len, &stream->mu_state, stream->key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_ref_signature_stream(signature, signature_len, &stream->mu_state, stream->key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_ipd_stream_verify_final(void *state) {
+	OQS_SIG_ml_dsa_65_ipd_stream_state *stream = state;
+
+#if defined(OQS_ENABLE_SIG_ml_dsa_65_ipd_avx2) || defined(OQS_ENABLE_SIG_ml_dsa_65_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_avx2_verify_stream(stream->signature, OQS_SIG_ml_dsa_65_ipd_length_signature, &stream->mu_state, stream->key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_ref_verify_stream(stream->signature, OQS_SIG_ml_dsa_65_ipd_length_signature, &stream->mu_state, stream->key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_65_ipd_ref_verify_stream(stream->signature, OQS_SIG_ml_dsa_65_ipd_length_signature, &stream->mu_state, stream->key);
+#endif
+}
+
+OQS_API void OQS_SIG_ml_dsa_65_ipd_stream_release(void *state) {
+	OQS_SIG_ml_dsa_65_ipd_stream_state *stream = state;
+
+	OQS_SHA3_shake256_inc_ctx_release(&stream->mu_state);
+}
+
 #endif
@@ -2,8 +2,8 @@
 
 #include <assert.h>
 #include <stdlib.h>
-#if defined(_WIN32)
 #include <string.h>
+#if defined(_WIN32)
 #define strcasecmp _stricmp
 #else
 #include <strings.h>
@@ -771,6 +771,19 @@ OQS_API OQS_STATUS OQS_SIG_sign(const OQS_SIG *sig, uint8_t *signature, size_t *
 	}
 }
 
+OQS_API OQS_STATUS OQS_SIG_sign_parallel(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool) {
+	if (pool == NULL) {
+		pool = OQS_THREADPOOL_get_default();
+	}
+	if (sig == NULL) {
+		return OQS_ERROR;
+	} else if (sig->sign_parallel == NULL) {
+		return sig->sign(signature, signature_len, message, message_len, secret_key) == OQS_SUCCESS ? OQS_SUCCESS : OQS_ERROR;
+	} else {
+		return sig->sign_parallel(signature, signature_len, message, message_len, secret_key, pool) == OQS_SUCCESS ? OQS_SUCCESS : OQS_ERROR;
+	}
+}
+
 OQS_API OQS_STATUS OQS_SIG_verify(const OQS_SIG *sig, const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
 	if (sig == NULL || sig->verify(message, message_len, signature, signature_len, public_key) != OQS_SUCCESS) {
 		return OQS_ERROR;
@@ -779,6 +792,212 @@ OQS_API OQS_STATUS OQS_SIG_verify(const OQS_SIG *sig, const uint8_t *message, si
 	}
 }
 
+struct OQS_SIG_expanded_public_key {
+	/* Algorithm the key was expanded for */
+	const char *method_name;
+	/* Expanded form, or a plain copy of the public key if the scheme has none */
+	uint8_t *data;
+};
+
+struct OQS_SIG_expanded_secret_key {
+	/* Algorithm the key was expanded for */
+	const char *method_name;
+	/* Expanded form, or a plain copy of the secret key if the scheme has none */
+	uint8_t *data;
+	size_t length;
+};
+
+static size_t expanded_key_alloc_length(size_t length) {
+	// OQS_MEM_aligned_alloc wants a size that is a multiple of the alignment
+	return (length + OQS_SIG_EXPANDED_KEY_ALIGNMENT - 1) & ~((size_t) OQS_SIG_EXPANDED_KEY_ALIGNMENT - 1);
+}
+
+OQS_API OQS_SIG_expanded_public_key *OQS_SIG_public_key_expand(const OQS_SIG *sig, const uint8_t *public_key) {
+	if (sig == NULL || public_key == NULL) {
+		return NULL;
+	}
+	OQS_SIG_expanded_public_key *expanded_public_key = OQS_MEM_malloc(sizeof(OQS_SIG_expanded_public_key));
+	if (expanded_public_key == NULL) {
+		return NULL;
+	}
+	expanded_public_key->method_name = sig->method_name;
+	size_t length = sig->public_key_expand != NULL ? sig->length_expanded_public_key : sig->length_public_key;
+	expanded_public_key->data = OQS_MEM_aligned_alloc(OQS_SIG_EXPANDED_KEY_ALIGNMENT, expanded_key_alloc_length(length));
+	if (expanded_public_key->data == NULL) {
+		OQS_MEM_insecure_free(expanded_public_key);
+		return NULL;
+	}
+	if (sig->public_key_expand == NULL) {
+		memcpy(expanded_public_key->data, public_key, sig->length_public_key);
+	} else if (sig->public_key_expand(expanded_public_key->data, public_key) != OQS_SUCCESS) {
+		OQS_SIG_expanded_public_key_free(expanded_public_key);
+		return NULL;
+	}
+	return expanded_public_key;
+}
+
+OQS_API OQS_STATUS OQS_SIG_verify_expanded(const OQS_SIG *sig, const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const OQS_SIG_expanded_public_key *expanded_public_key) {
+	if (sig == NULL || expanded_public_key == NULL || strcmp(sig->method_name, expanded_public_key->method_name) != 0) {
+		return OQS_ERROR;
+	} else if (sig->verify_expanded == NULL) {
+		return sig->verify(message, message_len, signature, signature_len, expanded_public_key->data) == OQS_SUCCESS ? OQS_SUCCESS : OQS_ERROR;
+	} else {
+		return sig->verify_expanded(message, message_len, signature, signature_len, expanded_public_key->data) == OQS_SUCCESS ? OQS_SUCCESS : OQS_ERROR;
+	}
+}
+
+OQS_API void OQS_SIG_expanded_public_key_free(OQS_SIG_expanded_public_key *expanded_public_key) {
+	if (expanded_public_key == NULL) {
+		return;
+	}
+	OQS_MEM_aligned_free(expanded_public_key->data);
+	OQS_MEM_insecure_free(expanded_public_key);
+}
+
+OQS_API OQS_SIG_expanded_secret_key *OQS_SIG_secret_key_expand(const OQS_SIG *sig, const uint8_t *secret_key) {
+	if (sig == NULL || secret_key == NULL) {
+		return NULL;
+	}
+	OQS_SIG_expanded_secret_key *expanded_secret_key = OQS_MEM_malloc(sizeof(OQS_SIG_expanded_secret_key));
+	if (expanded_secret_key == NULL) {
+		return NULL;
+	}
+	expanded_secret_key->method_name = sig->method_name;
+	expanded_secret_key->length = expanded_key_alloc_length(sig->secret_key_expand != NULL ? sig->length_expanded_secret_key : sig->length_secret_key);
+	expanded_secret_key->data = OQS_MEM_aligned_alloc(OQS_SIG_EXPANDED_KEY_ALIGNMENT, expanded_secret_key->length);
+	if (expanded_secret_key->data == NULL) {
+		OQS_MEM_insecure_free(expanded_secret_key);
+		return NULL;
+	}
+	if (sig->secret_key_expand == NULL) {
+		memcpy(expanded_secret_key->data, secret_key, sig->length_secret_key);
+	} else if (sig->secret_key_expand(expanded_secret_key->data, secret_key) != OQS_SUCCESS) {
+		OQS_SIG_expanded_secret_key_free(expanded_secret_key);
+		return NULL;
+	}
+	return expanded_secret_key;
+}
+
+OQS_API OQS_STATUS OQS_SIG_sign_expanded(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const OQS_SIG_expanded_secret_key *expanded_secret_key) {
+	if (sig == NULL || expanded_secret_key == NULL || strcmp(sig->method_name, expanded_secret_key->method_name) != 0) {
+		return OQS_ERROR;
+	} else if (sig->sign_expanded == NULL) {
+		return sig->sign(signature, signature_len, message, message_len, expanded_secret_key->data) == OQS_SUCCESS ? OQS_SUCCESS : OQS_ERROR;
+	} else {
+		return sig->sign_expanded(signature, signature_len, message, message_len, expanded_secret_key->data) == OQS_SUCCESS ? OQS_SUCCESS : OQS_ERROR;
+	}
+}
+
+OQS_API void OQS_SIG_expanded_secret_key_free(OQS_SIG_expanded_secret_key *expanded_secret_key) {
+	if (expanded_secret_key == NULL) {
+		return;
+	}
+	OQS_MEM_cleanse(expanded_secret_key->data, expanded_secret_key->length);
+	OQS_MEM_aligned_free(expanded_secret_key->data);
+	OQS_MEM_insecure_free(expanded_secret_key);
+}
+
+struct OQS_SIG_STREAM {
+	/* Algorithm the stream was started for */
+	const OQS_SIG *sig;
+	/* Whether the stream signs (true) or verifies (false) */
+	bool sign;
+	/* Whether the scheme's final call has consumed the state */
+	bool finished;
+	/* Scheme-specific state, sig->length_stream_state bytes */
+	void *state;
+};
+
+OQS_API bool OQS_SIG_STREAM_supported(const OQS_SIG *sig, bool sign) {
+	if (sig == NULL || sig->length_stream_state == 0) {
+		return false;
+	}
+	return sign ? sig->stream_sign_init != NULL : sig->stream_verify_init != NULL;
+}
+
+static OQS_SIG_STREAM *stream_new(const OQS_SIG *sig, bool sign) {
+	OQS_SIG_STREAM *stream = OQS_MEM_malloc(sizeof(OQS_SIG_STREAM));
+	if (stream == NULL) {
+		return NULL;
+	}
+	stream->sig = sig;
+	stream->sign = sign;
+	// until the scheme's init call succeeds there is nothing to release
+	stream->finished = true;
+	stream->state = OQS_MEM_malloc(sig->length_stream_state);
+	if (stream->state == NULL) {
+		OQS_MEM_insecure_free(stream);
+		return NULL;
+	}
+	return stream;
+}
+
+OQS_API OQS_SIG_STREAM *OQS_SIG_STREAM_sign_init(const OQS_SIG *sig, const uint8_t *secret_key) {
+	if (secret_key == NULL || !OQS_SIG_STREAM_supported(sig, true)) {
+		return NULL;
+	}
+	OQS_SIG_STREAM *stream = stream_new(sig, true);
+	if (stream == NULL) {
+		return NULL;
+	}
+	if (sig->stream_sign_init(stream->state, secret_key) != OQS_SUCCESS) {
+		OQS_SIG_STREAM_free(stream);
+		return NULL;
+	}
+	stream->finished = false;
+	return stream;
+}
+
+OQS_API OQS_SIG_STREAM *OQS_SIG_STREAM_verify_init(const OQS_SIG *sig, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	if (signature == NULL || public_key == NULL || !OQS_SIG_STREAM_supported(sig, false)) {
+		return NULL;
+	}
+	OQS_SIG_STREAM *stream = stream_new(sig, false);
+	if (stream == NULL) {
+		return NULL;
+	}
+	if (sig->stream_verify_init(stream->state, signature, signature_len, public_key) != OQS_SUCCESS) {
+		OQS_SIG_STREAM_free(stream);
+		return NULL;
+	}
+	stream->finished = false;
+	return stream;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STREAM_update(OQS_SIG_STREAM *stream, const uint8_t *chunk, size_t chunk_len) {
+	if (stream == NULL || stream->finished || (chunk == NULL && chunk_len != 0)) {
+		return OQS_ERROR;
+	}
+	return stream->sig->stream_update(stream->state, chunk, chunk_len) == OQS_SUCCESS ? OQS_SUCCESS : OQS_ERROR;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STREAM_sign_final(OQS_SIG_STREAM *stream, uint8_t *signature, size_t *signature_len) {
+	if (stream == NULL || stream->finished || !stream->sign) {
+		return OQS_ERROR;
+	}
+	stream->finished = true;
+	return stream->sig->stream_sign_final(signature, signature_len, stream->state) == OQS_SUCCESS ? OQS_SUCCESS : OQS_ERROR;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STREAM_verify_final(OQS_SIG_STREAM *stream) {
+	if (stream == NULL || stream->finished || stream->sign) {
+		return OQS_ERROR;
+	}
+	stream->finished = true;
+	return stream->sig->stream_verify_final(stream->state) == OQS_SUCCESS ? OQS_SUCCESS : OQS_ERROR;
+}
+
+OQS_API void OQS_SIG_STREAM_free(OQS_SIG_STREAM *stream) {
+	if (stream == NULL) {
+		return;
+	}
+	if (!stream->finished) {
+		stream->sig->stream_release(stream->state);
+	}
+	OQS_MEM_secure_free(stream->state, stream->sig->length_stream_state);
+	OQS_MEM_insecure_free(stream);
+}
+
 OQS_API void OQS_SIG_free(OQS_SIG *sig) {
 	OQS_MEM_insecure_free(sig);
 }
@@ -233,8 +233,178 @@ typedef struct OQS_SIG {
 	 */
 	OQS_STATUS (*verify)(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 
+	/** The length, in bytes, of expanded public keys for this signature scheme, or 0 if it has no expanded form. */
+	size_t length_expanded_public_key;
+
+	/**
+	 * Public key expansion algorithm, precomputing everything verification derives
+	 * from the public key alone.
+	 *
+	 * Optional: may be NULL, in which case `length_expanded_public_key` is 0 and
+	 * OQS_SIG_public_key_expand keeps a copy of the public key instead.
+	 *
+	 * @param[out] expanded_public_key The expanded public key, `length_expanded_public_key`
+	 *             bytes aligned to OQS_SIG_EXPANDED_KEY_ALIGNMENT.
+	 * @param[in] public_key The public key represented as a byte string.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*public_key_expand)(uint8_t *expanded_public_key, const uint8_t *public_key);
+
+	/**
+	 * Signature verification algorithm against a public key expanded by `public_key_expand`.
+	 *
+	 * Optional: NULL exactly when `public_key_expand` is NULL.
+	 *
+	 * @param[in] message The message represented as a byte string.
+	 * @param[in] message_len The length of the message.
+	 * @param[in] signature The signature on the message represented as a byte string.
+	 * @param[in] signature_len The length of the signature.
+	 * @param[in] expanded_public_key The expanded public key.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*verify_expanded)(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *expanded_public_key);
+
+	/** The length, in bytes, of expanded secret keys for this signature scheme, or 0 if it has no expanded form. */
+	size_t length_expanded_secret_key;
+
+	/**
+	 * Secret key expansion algorithm, precomputing everything signing derives
+	 * from the secret key alone.
+	 *
+	 * Optional: may be NULL, in which case `length_expanded_secret_key` is 0 and
+	 * OQS_SIG_secret_key_expand keeps a copy of the secret key instead.
+	 *
+	 * @param[out] expanded_secret_key The expanded secret key, `length_expanded_secret_key`
+	 *             bytes aligned to OQS_SIG_EXPANDED_KEY_ALIGNMENT.
+	 * @param[in] secret_key The secret key represented as a byte string.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*secret_key_expand)(uint8_t *expanded_secret_key, const uint8_t *secret_key);
+
+	/**
+	 * Signature generation algorithm with a secret key expanded by `secret_key_expand`.
+	 *
+	 * Optional: NULL exactly when `secret_key_expand` is NULL.
+	 *
+	 * @param[out] signature The signature on the message represented as a byte string.
+	 * @param[out] signature_len The actual length of the signature.
+	 * @param[in] message The message to sign represented as a byte string.
+	 * @param[in] message_len The length of the message to sign.
+	 * @param[in] expanded_secret_key The expanded secret key.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*sign_expanded)(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *expanded_secret_key);
+
+	/** The length, in bytes, of the state of a streaming signing or verification operation, or 0 if the scheme cannot hash messages incrementally. */
+	size_t length_stream_state;
+
+	/**
+	 * Starts a streaming signing operation.
+	 *
+	 * Optional: may be NULL if the scheme has to see the whole message before it
+	 * can start hashing it, in which case OQS_SIG_STREAM_sign_init fails.
+	 *
+	 * @param[out] state The stream state, `length_stream_state` bytes.
+	 * @param[in] secret_key The secret key represented as a byte string.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*stream_sign_init)(void *state, const uint8_t *secret_key);
+
+	/**
+	 * Starts a streaming verification operation.
+	 *
+	 * Optional: may be NULL, in which case OQS_SIG_STREAM_verify_init fails.
+	 *
+	 * @param[out] state The stream state, `length_stream_state` bytes.
+	 * @param[in] signature The signature to verify represented as a byte string.
+	 * @param[in] signature_len The length of the signature.
+	 * @param[in] public_key The public key represented as a byte string.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*stream_verify_init)(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+
+	/**
+	 * Absorbs the next chunk of the message into a stream started by `stream_sign_init`
+	 * or `stream_verify_init`.
+	 *
+	 * @param[in,out] state The stream state.
+	 * @param[in] chunk The next part of the message.
+	 * @param[in] chunk_len The length of the chunk.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*stream_update)(void *state, const uint8_t *chunk, size_t chunk_len);
+
+	/**
+	 * Finishes a stream started by `stream_sign_init` and signs the message.
+	 * Releases any resources held by the state.
+	 *
+	 * @param[out] signature The signature on the message represented as a byte string.
+	 * @param[out] signature_len The actual length of the signature.
+	 * @param[in,out] state The stream state.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*stream_sign_final)(uint8_t *signature, size_t *signature_len, void *state);
+
+	/**
+	 * Finishes a stream started by `stream_verify_init` and verifies the signature.
+	 * Releases any resources held by the state.
+	 *
+	 * @param[in,out] state The stream state.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*stream_verify_final)(void *state);
+
+	/**
+	 * Releases any resources held by a stream that was abandoned before its final call.
+	 *
+	 * @param[in,out] state The stream state.
+	 */
+	void (*stream_release)(void *state);
+
+	/**
+	 * Signature generation algorithm spreading its work over several threads.
+	 *
+	 * Optional: may be NULL, in which case OQS_SIG_sign_parallel signs in the
+	 * calling thread only.
+	 *
+	 * @param[out] signature The signature on the message represented as a byte string.
+	 * @param[out] signature_len The actual length of the signature.
+	 * @param[in] message The message to sign represented as a byte string.
+	 * @param[in] message_len The length of the message to sign.
+	 * @param[in] secret_key The secret key represented as a byte string.
+	 * @param[in] pool The thread pool to submit work to; NULL signs in the calling thread.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*sign_parallel)(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool);
+
 } OQS_SIG;
 
+/** Alignment, in bytes, required of buffers holding expanded keys. */
+#define OQS_SIG_EXPANDED_KEY_ALIGNMENT 32
+
+/**
+ * Opaque handle to a public key expanded for repeated verification.
+ *
+ * Created by OQS_SIG_public_key_expand and released with OQS_SIG_expanded_public_key_free.
+ */
+typedef struct OQS_SIG_expanded_public_key OQS_SIG_expanded_public_key;
+
+/**
+ * Opaque handle to a secret key expanded for repeated signing.
+ *
+ * Created by OQS_SIG_secret_key_expand and released with OQS_SIG_expanded_secret_key_free.
+ */
+typedef struct OQS_SIG_expanded_secret_key OQS_SIG_expanded_secret_key;
+
+/**
+ * Opaque handle to a signing or verification operation over a message that is
+ * passed in pieces.
+ *
+ * Created by OQS_SIG_STREAM_sign_init or OQS_SIG_STREAM_verify_init and released
+ * with OQS_SIG_STREAM_free.
+ */
+typedef struct OQS_SIG_STREAM OQS_SIG_STREAM;
+
 /**
  * Constructs an OQS_SIG object for a particular algorithm.
  *
@@ -277,6 +447,26 @@ OQS_API OQS_STATUS OQS_SIG_keypair(const OQS_SIG *sig, uint8_t *public_key, uint
  */
 OQS_API OQS_STATUS OQS_SIG_sign(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 
+/**
+ * Signature generation algorithm submitting its work to a thread pool.
+ *
+ * Only SPHINCS+ currently splits its work: the FORS trees and the subtrees of
+ * the hypertree layers are built concurrently, and only the WOTS signatures
+ * that chain the layers together are computed in order. The result is the same
+ * signature that OQS_SIG_sign would produce from the same randomness. Other
+ * algorithms, and pools that run one task at a time, sign in the calling thread.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[out] signature The signature on the message represented as a byte string.
+ * @param[out] signature_len The length of the signature.
+ * @param[in] message The message to sign represented as a byte string.
+ * @param[in] message_len The length of the message to sign.
+ * @param[in] secret_key The secret key represented as a byte string.
+ * @param[in] pool The thread pool to use, or NULL for the one set with OQS_THREADPOOL_set_default.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_sign_parallel(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool);
+
 /**
  * Signature verification algorithm.
  *
@@ -290,6 +480,161 @@ OQS_API OQS_STATUS OQS_SIG_sign(const OQS_SIG *sig, uint8_t *signature, size_t *
  */
 OQS_API OQS_STATUS OQS_SIG_verify(const OQS_SIG *sig, const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 
+/**
+ * Public key expansion.
+ *
+ * Precomputes, once, the parts of verification that depend only on the public key
+ * (for ML-DSA and Dilithium: tr = H(pk), the sampled matrix A and t1*2^d, both in
+ * the NTT domain), so that repeated verifications against the same key with
+ * OQS_SIG_verify_expanded only do the per-signature work. For signature schemes
+ * without an expanded form the handle simply holds a copy of the public key.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[in] public_key The public key represented as a byte string.
+ * @return A new expanded public key, or NULL on error. Must be freed with
+ *         OQS_SIG_expanded_public_key_free.
+ */
+OQS_API OQS_SIG_expanded_public_key *OQS_SIG_public_key_expand(const OQS_SIG *sig, const uint8_t *public_key);
+
+/**
+ * Signature verification algorithm against an expanded public key.
+ *
+ * Accepts exactly the signatures OQS_SIG_verify accepts for the original public key.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[in] message The message represented as a byte string.
+ * @param[in] message_len The length of the message.
+ * @param[in] signature The signature on the message represented as a byte string.
+ * @param[in] signature_len The length of the signature.
+ * @param[in] expanded_public_key The public key, expanded for the same algorithm as `sig`.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_verify_expanded(const OQS_SIG *sig, const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const OQS_SIG_expanded_public_key *expanded_public_key);
+
+/**
+ * Frees an expanded public key created by OQS_SIG_public_key_expand.
+ *
+ * @param[in] expanded_public_key The expanded public key to free; may be NULL.
+ */
+OQS_API void OQS_SIG_expanded_public_key_free(OQS_SIG_expanded_public_key *expanded_public_key);
+
+/**
+ * Secret key expansion.
+ *
+ * Precomputes, once, the parts of signing that depend only on the secret key, so
+ * that repeated signing with OQS_SIG_sign_expanded only pays for the per-message
+ * work. For ML-DSA and Dilithium this is the sampled matrix A and the secret
+ * vectors s1, s2 and t0, all in the NTT domain, together with tr and the signing
+ * seed. For signature schemes without an expanded form the handle simply holds a
+ * copy of the secret key.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[in] secret_key The secret key represented as a byte string.
+ * @return A new expanded secret key, or NULL on error. Must be freed with
+ *         OQS_SIG_expanded_secret_key_free.
+ */
+OQS_API OQS_SIG_expanded_secret_key *OQS_SIG_secret_key_expand(const OQS_SIG *sig, const uint8_t *secret_key);
+
+/**
+ * Signature generation algorithm with an expanded secret key.
+ *
+ * Produces the same kind of signature as OQS_SIG_sign.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[out] signature The signature on the message represented as a byte string.
+ * @param[out] signature_len The length of the signature.
+ * @param[in] message The message to sign represented as a byte string.
+ * @param[in] message_len The length of the message to sign.
+ * @param[in] expanded_secret_key The secret key, expanded for the same algorithm as `sig`.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_sign_expanded(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const OQS_SIG_expanded_secret_key *expanded_secret_key);
+
+/**
+ * Zeroizes and frees an expanded secret key created by OQS_SIG_secret_key_expand.
+ *
+ * @param[in] expanded_secret_key The expanded secret key to free; may be NULL.
+ */
+OQS_API void OQS_SIG_expanded_secret_key_free(OQS_SIG_expanded_secret_key *expanded_secret_key);
+
+/**
+ * Indicates whether an algorithm can sign and verify messages passed in pieces.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[in] sign Whether to ask about signing (true) or verification (false).
+ * @return true if OQS_SIG_STREAM_sign_init (respectively OQS_SIG_STREAM_verify_init)
+ *         is available for this algorithm, false otherwise.
+ */
+OQS_API bool OQS_SIG_STREAM_supported(const OQS_SIG *sig, bool sign);
+
+/**
+ * Starts signing a message that is passed in pieces.
+ *
+ * Only available for schemes that hash the message incrementally: ML-DSA and
+ * Dilithium. The memory held by the stream does not depend on the length of the
+ * message, so arbitrarily large inputs can be signed while they are being read.
+ * The resulting signature is the same kind of signature as from OQS_SIG_sign.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme; must
+ *            outlive the stream.
+ * @param[in] secret_key The secret key represented as a byte string.
+ * @return A new stream, or NULL if the algorithm does not support streaming
+ *         signing or on error. Must be freed with OQS_SIG_STREAM_free.
+ */
+OQS_API OQS_SIG_STREAM *OQS_SIG_STREAM_sign_init(const OQS_SIG *sig, const uint8_t *secret_key);
+
+/**
+ * Starts verifying a signature on a message that is passed in pieces.
+ *
+ * Available for ML-DSA, Dilithium and SPHINCS+. The signature is needed up front
+ * because SPHINCS+ hashes its randomizer before the message.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme; must
+ *            outlive the stream.
+ * @param[in] signature The signature to verify represented as a byte string.
+ * @param[in] signature_len The length of the signature.
+ * @param[in] public_key The public key represented as a byte string.
+ * @return A new stream, or NULL if the algorithm does not support streaming
+ *         verification, the signature has the wrong length, or on error. Must be
+ *         freed with OQS_SIG_STREAM_free.
+ */
+OQS_API OQS_SIG_STREAM *OQS_SIG_STREAM_verify_init(const OQS_SIG *sig, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+
+/**
+ * Passes the next piece of the message to a stream.
+ *
+ * @param[in] stream The stream, not yet finished.
+ * @param[in] chunk The next part of the message.
+ * @param[in] chunk_len The length of the chunk.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_STREAM_update(OQS_SIG_STREAM *stream, const uint8_t *chunk, size_t chunk_len);
+
+/**
+ * Finishes a stream started by OQS_SIG_STREAM_sign_init and signs the message.
+ *
+ * @param[in] stream The stream, not yet finished.
+ * @param[out] signature The signature on the message represented as a byte string.
+ * @param[out] signature_len The length of the signature.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_STREAM_sign_final(OQS_SIG_STREAM *stream, uint8_t *signature, size_t *signature_len);
+
+/**
+ * Finishes a stream started by OQS_SIG_STREAM_verify_init and verifies the signature.
+ *
+ * @param[in] stream The stream, not yet finished.
+ * @return OQS_SUCCESS if the signature is valid for the message, OQS_ERROR otherwise.
+ */
+OQS_API OQS_STATUS OQS_SIG_STREAM_verify_final(OQS_SIG_STREAM *stream);
+
+/**
+ * Zeroizes and frees a stream, whether or not it was finished.
+ *
+ * @param[in] stream The stream to free; may be NULL.
+ */
+OQS_API void OQS_SIG_STREAM_free(OQS_SIG_STREAM *stream);
+
 /**
  * Frees an OQS_SIG object that was constructed by OQS_SIG_new.
  *
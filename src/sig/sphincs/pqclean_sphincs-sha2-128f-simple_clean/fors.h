@@ -16,6 +16,26 @@ void fors_sign(unsigned char *sig, unsigned char *pk,
                const spx_ctx *ctx,
                const uint32_t fors_addr[8]);
 
+/**
+ * Computes the part of a FORS signature that comes from the i-th tree: the
+ * selected secret key element and its authentication path, written at
+ * sig + i * (SPX_FORS_HEIGHT + 1) * SPX_N, and the root of the tree, written
+ * at roots + i * SPX_N. Calls for different trees are independent.
+ */
+#define fors_sign_tree SPX_NAMESPACE(fors_sign_tree)
+void fors_sign_tree(unsigned char *sig, unsigned char *roots,
+                    const unsigned char *m,
+                    const spx_ctx *ctx,
+                    const uint32_t fors_addr[8], uint32_t i);
+
+/**
+ * Hashes the SPX_FORS_TREES tree roots into the FORS public key.
+ */
+#define fors_pk_from_roots SPX_NAMESPACE(fors_pk_from_roots)
+void fors_pk_from_roots(unsigned char *pk, const unsigned char *roots,
+                        const spx_ctx *ctx,
+                        const uint32_t fors_addr[8]);
+
 /**
  * Derives the FORS public key from a signature.
  * This can be used for verification by comparing to a known public key, or to
@@ -41,6 +41,35 @@ void merkle_sign(uint8_t *sig, unsigned char *root,
                tree_addr, &info);
 }
 
+/*
+ * This computes the root node and the authentication path of a subtree, but
+ * not the WOTS signature, which wots_sign adds once the message is known.
+ * As the result does not depend on the message, the subtrees of all hypertree
+ * layers can be built independently of each other.
+ */
+void merkle_gen_auth_path(unsigned char *auth_path, unsigned char *root,
+                          const spx_ctx *ctx,
+                          uint32_t wots_addr[8], uint32_t tree_addr[8],
+                          uint32_t idx_leaf) {
+    struct leaf_info_x1 info = { 0 };
+    unsigned steps[ SPX_WOTS_LEN ] = { 0 };
+
+    info.wots_steps = steps;
+
+    set_type(&tree_addr[0], SPX_ADDR_TYPE_HASHTREE);
+    set_type(&info.pk_addr[0], SPX_ADDR_TYPE_WOTSPK);
+    copy_subtree_addr(&info.leaf_addr[0], wots_addr);
+    copy_subtree_addr(&info.pk_addr[0], wots_addr);
+
+    info.wots_sign_leaf = ~0U; /* Do not sign with any of the leaves */
+
+    treehashx1(root, auth_path, ctx,
+               idx_leaf, 0,
+               SPX_TREE_HEIGHT,
+               wots_gen_leafx1,
+               tree_addr, &info);
+}
+
 /* Compute root node of the top-most subtree. */
 void merkle_gen_root(unsigned char *root, const spx_ctx *ctx) {
     /* We do not need the auth path in key generation, but it simplifies the
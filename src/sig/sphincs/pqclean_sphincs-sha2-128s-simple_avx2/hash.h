@@ -6,6 +6,14 @@
 
 #include "context.h"
 #include "params.h"
+#include "sha2.h"
+
+/* State of H_msg while it absorbs R || PK || M in pieces */
+#if SPX_SHA512
+typedef sha512ctx spx_msg_state;
+#else
+typedef sha256ctx spx_msg_state;
+#endif
 
 #define prf_addr SPX_NAMESPACE(prf_addr)
 void prf_addr(unsigned char *out, const spx_ctx *ctx,
@@ -23,6 +31,13 @@ void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
                   const unsigned char *m, size_t mlen,
                   const spx_ctx *ctx);
 
+#define hash_message_final SPX_NAMESPACE(hash_message_final)
+void hash_message_final(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
+                        const unsigned char *R, const unsigned char *pk,
+                        spx_msg_state *state,
+                        const unsigned char *m, size_t mlen,
+                        const spx_ctx *ctx);
+
 #   define SPX_SHA256_ADDR_BYTES 22
 
 #   define mgf1_256 SPX_NAMESPACE(mgf1_256)
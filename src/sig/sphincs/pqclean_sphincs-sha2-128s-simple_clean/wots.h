@@ -16,6 +16,17 @@ void wots_pk_from_sig(unsigned char *pk,
                       const unsigned char *sig, const unsigned char *msg,
                       const spx_ctx *ctx, uint32_t addr[8]);
 
+/**
+ * Signs an n-byte message with the WOTS key pair at addr, deriving the secret
+ * key from sk_seed. addr must have the layer, tree and keypair set; the chain,
+ * hash and type fields are overwritten.
+ *
+ * Writes the signature, SPX_WOTS_BYTES bytes, to 'sig'.
+ */
+#define wots_sign SPX_NAMESPACE(wots_sign)
+void wots_sign(unsigned char *sig, const unsigned char *msg,
+               const spx_ctx *ctx, uint32_t addr[8]);
+
 /*
  * Compute the chain lengths needed for a given message hash
  */
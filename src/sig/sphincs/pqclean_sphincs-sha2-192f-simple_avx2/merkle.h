@@ -14,6 +14,14 @@ void merkle_sign(uint8_t *sig, unsigned char *root,
                  uint32_t wots_addr[8], uint32_t tree_addr[8],
                  uint32_t idx_leaf);
 
+/* Compute the root node and the authentication path of a subtree, without */
+/* the WOTS signature; unlike merkle_sign this does not depend on the message */
+#define merkle_gen_auth_path SPX_NAMESPACE(merkle_gen_auth_path)
+void merkle_gen_auth_path(unsigned char *auth_path, unsigned char *root,
+                          const spx_ctx *ctx,
+                          uint32_t wots_addr[8], uint32_t tree_addr[8],
+                          uint32_t idx_leaf);
+
 /* Compute the root node of the top-most subtree. */
 #define merkle_gen_root SPX_NAMESPACE(merkle_gen_root)
 void merkle_gen_root(unsigned char *root, const spx_ctx *ctx);
@@ -4,6 +4,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "hash.h"
 #include "params.h"
 
 #define CRYPTO_ALGNAME "SPHINCS+"
@@ -61,6 +62,24 @@ int crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
 int crypto_sign_signature(uint8_t *sig, size_t *siglen,
                           const uint8_t *m, size_t mlen, const uint8_t *sk);
 
+/**
+ * Runs task(arg, 0), ..., task(arg, count - 1), in any order and possibly
+ * concurrently, and returns once all of them have finished.
+ */
+typedef void (*spx_run_tasks_fn)(void *executor,
+                                 void (*task)(void *arg, size_t index),
+                                 void *arg, size_t count);
+
+/**
+ * Returns an array containing a detached signature, computed as independent
+ * tasks (one per FORS tree and one per hypertree layer) that are handed to
+ * run_tasks. The signature is the same as from crypto_sign_signature.
+ */
+#define crypto_sign_signature_tasks SPX_NAMESPACE(crypto_sign_signature_tasks)
+int crypto_sign_signature_tasks(uint8_t *sig, size_t *siglen,
+                                const uint8_t *m, size_t mlen, const uint8_t *sk,
+                                spx_run_tasks_fn run_tasks, void *executor);
+
 /**
  * Verifies a detached signature and message under a given public key.
  */
@@ -68,6 +87,16 @@ int crypto_sign_signature(uint8_t *sig, size_t *siglen,
 int crypto_sign_verify(const uint8_t *sig, size_t siglen,
                        const uint8_t *m, size_t mlen, const uint8_t *pk);
 
+/**
+ * Verifies a detached signature on a message that was hashed in pieces:
+ * msg_state has absorbed R || PK and a prefix of the message, and m
+ * holds the rest. Releases msg_state.
+ */
+#define crypto_sign_verify_stream SPX_NAMESPACE(crypto_sign_verify_stream)
+int crypto_sign_verify_stream(const uint8_t *sig, size_t siglen,
+                              spx_msg_state *msg_state,
+                              const uint8_t *m, size_t mlen, const uint8_t *pk);
+
 /**
  * Returns an array containing the signature followed by the message.
  */
@@ -46,6 +46,41 @@ void merkle_sign(uint8_t *sig, unsigned char *root,
                tree_addrx8, &info);
 }
 
+/*
+ * This computes the root node and the authentication path of a subtree, but
+ * not the WOTS signature, which wots_sign adds once the message is known.
+ * As the result does not depend on the message, the subtrees of all hypertree
+ * layers can be built independently of each other.
+ */
+void merkle_gen_auth_path(unsigned char *auth_path, unsigned char *root,
+                          const spx_ctx *ctx,
+                          uint32_t wots_addr[8], uint32_t tree_addr[8],
+                          uint32_t idx_leaf) {
+    uint32_t tree_addrx8[8 * 8] = { 0 };
+    int j;
+    struct leaf_info_x8 info = { 0 };
+    unsigned steps[ SPX_WOTS_LEN ] = { 0 };
+
+    info.wots_steps = steps;
+
+    for (j = 0; j < 8; j++) {
+        set_type(&tree_addrx8[8 * j], SPX_ADDR_TYPE_HASHTREE);
+        set_type(&info.leaf_addr[8 * j], SPX_ADDR_TYPE_WOTS);
+        set_type(&info.pk_addr[8 * j], SPX_ADDR_TYPE_WOTSPK);
+        copy_subtree_addr(&tree_addrx8[8 * j], tree_addr);
+        copy_subtree_addr(&info.leaf_addr[8 * j], wots_addr);
+        copy_subtree_addr(&info.pk_addr[8 * j], wots_addr);
+    }
+
+    info.wots_sign_leaf = ~0U; /* Do not sign with any of the leaves */
+
+    treehashx8(root, auth_path, ctx,
+               idx_leaf, 0,
+               SPX_TREE_HEIGHT,
+               wots_gen_leafx8,
+               tree_addrx8, &info);
+}
+
 /* Compute root node of the top-most subtree. */
 /* Again, in this file because wots_gen_leaf is most of the work */
 void merkle_gen_root(unsigned char *root, const spx_ctx *ctx) {
@@ -145,14 +145,15 @@ void gen_message_random(unsigned char *R, const unsigned char *sk_prf,
 }
 
 /**
- * Computes the message hash using R, the public key, and the message.
- * Outputs the message digest and the index of the leaf. The index is split in
- * the tree index and the leaf index, for convenient copying to an address.
+ * Completes hash_message for a message that was absorbed in pieces:
+ * state has absorbed R || PK and a prefix of the message, and m holds
+ * the rest. Releases state.
  */
-void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
-                  const unsigned char *R, const unsigned char *pk,
-                  const unsigned char *m, size_t mlen,
-                  const spx_ctx *ctx) {
+void hash_message_final(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
+                        const unsigned char *R, const unsigned char *pk,
+                        spx_msg_state *state,
+                        const unsigned char *m, size_t mlen,
+                        const spx_ctx *ctx) {
     (void)ctx;
 #define SPX_TREE_BITS (SPX_TREE_HEIGHT * (SPX_D - 1))
 #define SPX_TREE_BYTES ((SPX_TREE_BITS + 7) / 8)
@@ -161,14 +162,45 @@ void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
 #define SPX_DGST_BYTES (SPX_FORS_MSG_BYTES + SPX_TREE_BYTES + SPX_LEAF_BYTES)
 
     unsigned char seed[2 * SPX_N + SPX_SHAX_OUTPUT_BYTES];
+    unsigned char buf[SPX_DGST_BYTES];
+    unsigned char *bufp = buf;
+
+    // seed: SHA-X(R ‖ PK.seed ‖ PK.root ‖ M)
+    shaX_inc_finalize(seed + 2 * SPX_N, state, m, mlen);
 
+    // H_msg: MGF1-SHA-X(R ‖ PK.seed ‖ seed)
+    memcpy(seed, R, SPX_N);
+    memcpy(seed + SPX_N, pk, SPX_N);
+
+    /* By doing this in two steps, we prevent hashing the message twice;
+       otherwise each iteration in MGF1 would hash the message again. */
+    mgf1_X(bufp, SPX_DGST_BYTES, seed, 2 * SPX_N + SPX_SHAX_OUTPUT_BYTES);
+
+    memcpy(digest, bufp, SPX_FORS_MSG_BYTES);
+    bufp += SPX_FORS_MSG_BYTES;
+
+    *tree = bytes_to_ull(bufp, SPX_TREE_BYTES);
+    *tree &= (~(uint64_t)0) >> (64 - SPX_TREE_BITS);
+    bufp += SPX_TREE_BYTES;
+
+    *leaf_idx = (uint32_t)bytes_to_ull(bufp, SPX_LEAF_BYTES);
+    *leaf_idx &= (~(uint32_t)0) >> (32 - SPX_LEAF_BITS);
+}
+
+/**
+ * Computes the message hash using R, the public key, and the message.
+ * Outputs the message digest and the index of the leaf. The index is split in
+ * the tree index and the leaf index, for convenient copying to an address.
+ */
+void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
+                  const unsigned char *R, const unsigned char *pk,
+                  const unsigned char *m, size_t mlen,
+                  const spx_ctx *ctx) {
     /* Round to nearest multiple of SPX_SHAX_BLOCK_BYTES */
 #define SPX_INBLOCKS (((SPX_N + SPX_PK_BYTES + SPX_SHAX_BLOCK_BYTES - 1) & \
                        -SPX_SHAX_BLOCK_BYTES) / SPX_SHAX_BLOCK_BYTES)
     unsigned char inbuf[SPX_INBLOCKS * SPX_SHAX_BLOCK_BYTES];
 
-    unsigned char buf[SPX_DGST_BYTES];
-    unsigned char *bufp = buf;
     shaXstate state;
 
     shaX_inc_init(&state);
@@ -180,7 +212,8 @@ void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
     /* If R + pk + message cannot fill up an entire block */
     if (SPX_N + SPX_PK_BYTES + mlen < SPX_INBLOCKS * SPX_SHAX_BLOCK_BYTES) {
         memcpy(inbuf + SPX_N + SPX_PK_BYTES, m, mlen);
-        shaX_inc_finalize(seed + 2 * SPX_N, &state, inbuf, SPX_N + SPX_PK_BYTES + mlen);
+        hash_message_final(digest, tree, leaf_idx, R, pk, &state,
+                           inbuf, SPX_N + SPX_PK_BYTES + mlen, ctx);
     }
     /* Otherwise first fill a block, so that finalize only uses the message */
     else {
@@ -190,24 +223,6 @@ void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
 
         m += SPX_INBLOCKS * SPX_SHAX_BLOCK_BYTES - SPX_N - SPX_PK_BYTES;
         mlen -= SPX_INBLOCKS * SPX_SHAX_BLOCK_BYTES - SPX_N - SPX_PK_BYTES;
-        shaX_inc_finalize(seed + 2 * SPX_N, &state, m, (size_t)mlen);
+        hash_message_final(digest, tree, leaf_idx, R, pk, &state, m, mlen, ctx);
     }
-
-    // H_msg: MGF1-SHA-X(R ‖ PK.seed ‖ seed)
-    memcpy(seed, R, SPX_N);
-    memcpy(seed + SPX_N, pk, SPX_N);
-
-    /* By doing this in two steps, we prevent hashing the message twice;
-       otherwise each iteration in MGF1 would hash the message again. */
-    mgf1_X(bufp, SPX_DGST_BYTES, seed, 2 * SPX_N + SPX_SHAX_OUTPUT_BYTES);
-
-    memcpy(digest, bufp, SPX_FORS_MSG_BYTES);
-    bufp += SPX_FORS_MSG_BYTES;
-
-    *tree = bytes_to_ull(bufp, SPX_TREE_BYTES);
-    *tree &= (~(uint64_t)0) >> (64 - SPX_TREE_BITS);
-    bufp += SPX_TREE_BYTES;
-
-    *leaf_idx = (uint32_t)bytes_to_ull(bufp, SPX_LEAF_BYTES);
-    *leaf_idx &= (~(uint32_t)0) >> (32 - SPX_LEAF_BITS);
 }
@@ -43,14 +43,17 @@ void gen_message_random(unsigned char *R, const unsigned char *sk_prf,
 }
 
 /**
- * Computes the message hash using R, the public key, and the message.
- * Outputs the message digest and the index of the leaf. The index is split in
- * the tree index and the leaf index, for convenient copying to an address.
+ * Completes hash_message for a message that was absorbed in pieces:
+ * state has absorbed R || PK and a prefix of the message, and m holds
+ * the rest. Releases state.
  */
-void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
-                  const unsigned char *R, const unsigned char *pk,
-                  const unsigned char *m, size_t mlen,
-                  const spx_ctx *ctx) {
+void hash_message_final(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
+                        const unsigned char *R, const unsigned char *pk,
+                        spx_msg_state *state,
+                        const unsigned char *m, size_t mlen,
+                        const spx_ctx *ctx) {
+    (void)R;
+    (void)pk;
     (void)ctx;
 #define SPX_TREE_BITS (SPX_TREE_HEIGHT * (SPX_D - 1))
 #define SPX_TREE_BYTES ((SPX_TREE_BITS + 7) / 8)
@@ -60,15 +63,11 @@ void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
 
     unsigned char buf[SPX_DGST_BYTES];
     unsigned char *bufp = buf;
-    shake256incctx s_inc;
 
-    shake256_inc_init(&s_inc);
-    shake256_inc_absorb(&s_inc, R, SPX_N);
-    shake256_inc_absorb(&s_inc, pk, SPX_PK_BYTES);
-    shake256_inc_absorb(&s_inc, m, mlen);
-    shake256_inc_finalize(&s_inc);
-    shake256_inc_squeeze(buf, SPX_DGST_BYTES, &s_inc);
-    shake256_inc_ctx_release(&s_inc);
+    OQS_SHA3_shake256_inc_absorb(state, m, mlen);
+    OQS_SHA3_shake256_inc_finalize(state);
+    OQS_SHA3_shake256_inc_squeeze(buf, SPX_DGST_BYTES, state);
+    OQS_SHA3_shake256_inc_ctx_release(state);
 
     memcpy(digest, bufp, SPX_FORS_MSG_BYTES);
     bufp += SPX_FORS_MSG_BYTES;
@@ -80,3 +79,20 @@ void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
     *leaf_idx = (uint32_t)bytes_to_ull(bufp, SPX_LEAF_BYTES);
     *leaf_idx &= (~(uint32_t)0) >> (32 - SPX_LEAF_BITS);
 }
+
+/**
+ * Computes the message hash using R, the public key, and the message.
+ * Outputs the message digest and the index of the leaf. The index is split in
+ * the tree index and the leaf index, for convenient copying to an address.
+ */
+void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
+                  const unsigned char *R, const unsigned char *pk,
+                  const unsigned char *m, size_t mlen,
+                  const spx_ctx *ctx) {
+    shake256incctx s_inc;
+
+    shake256_inc_init(&s_inc);
+    shake256_inc_absorb(&s_inc, R, SPX_N);
+    shake256_inc_absorb(&s_inc, pk, SPX_PK_BYTES);
+    hash_message_final(digest, tree, leaf_idx, R, pk, &s_inc.ctx, m, mlen, ctx);
+}
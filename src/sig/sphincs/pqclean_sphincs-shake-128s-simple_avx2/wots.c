@@ -173,6 +173,30 @@ void wots_pk_from_sig(unsigned char *pk,
     gen_chains(pk, sig, start, steps, ctx, addr);
 }
 
+/**
+ * Signs an n-byte message with the WOTS key pair at addr, walking each chain
+ * from its secret key element up to the step given by the message.
+ */
+void wots_sign(unsigned char *sig, const unsigned char *msg,
+               const spx_ctx *ctx, uint32_t addr[8]) {
+    unsigned int steps[SPX_WOTS_LEN];
+    unsigned int start[SPX_WOTS_LEN] = { 0 };
+    unsigned char sk[SPX_WOTS_BYTES];
+    uint32_t i;
+
+    chain_lengths(steps, msg);
+
+    set_hash_addr(addr, 0);
+    set_type(addr, SPX_ADDR_TYPE_WOTSPRF);
+    for (i = 0; i < SPX_WOTS_LEN; i++) {
+        set_chain_addr(addr, i);
+        prf_addr(sk + i * SPX_N, ctx, addr);
+    }
+
+    set_type(addr, SPX_ADDR_TYPE_WOTS);
+    gen_chains(sig, sk, start, steps, ctx, addr);
+}
+
 /*
  * This generates 4 sequential WOTS public keys
  * It also generates the WOTS signature if leaf_info indicates
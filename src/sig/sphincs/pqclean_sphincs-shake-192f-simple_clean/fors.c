@@ -60,52 +60,69 @@ static void message_to_indices(uint32_t *indices, const unsigned char *m) {
 }
 
 /**
- * Signs a message m, deriving the secret key from sk_seed and the FTS address.
- * Assumes m contains at least SPX_FORS_HEIGHT * SPX_FORS_TREES bits.
+ * Computes the secret key element and the authentication path that the i-th
+ * tree contributes to the FORS signature of m, together with the tree root.
  */
-void fors_sign(unsigned char *sig, unsigned char *pk,
-               const unsigned char *m,
-               const spx_ctx *ctx,
-               const uint32_t fors_addr[8]) {
+void fors_sign_tree(unsigned char *sig, unsigned char *roots,
+                    const unsigned char *m,
+                    const spx_ctx *ctx,
+                    const uint32_t fors_addr[8], uint32_t i) {
     uint32_t indices[SPX_FORS_TREES];
-    unsigned char roots[SPX_FORS_TREES * SPX_N];
     uint32_t fors_tree_addr[8] = {0};
     struct fors_gen_leaf_info fors_info = {0};
     uint32_t *fors_leaf_addr = fors_info.leaf_addrx;
-    uint32_t fors_pk_addr[8] = {0};
-    uint32_t idx_offset;
-    unsigned int i;
+    uint32_t idx_offset = i * (1 << SPX_FORS_HEIGHT);
 
     copy_keypair_addr(fors_tree_addr, fors_addr);
     copy_keypair_addr(fors_leaf_addr, fors_addr);
 
-    copy_keypair_addr(fors_pk_addr, fors_addr);
-    set_type(fors_pk_addr, SPX_ADDR_TYPE_FORSPK);
-
     message_to_indices(indices, m);
+    sig += i * (SPX_FORS_HEIGHT + 1) * SPX_N;
 
-    for (i = 0; i < SPX_FORS_TREES; i++) {
-        idx_offset = i * (1 << SPX_FORS_HEIGHT);
+    /* Include the secret key part that produces the selected leaf node. */
+    set_tree_height(fors_tree_addr, 0);
+    set_tree_index(fors_tree_addr, indices[i] + idx_offset);
+    set_type(fors_tree_addr, SPX_ADDR_TYPE_FORSPRF);
+    fors_gen_sk(sig, ctx, fors_tree_addr);
+    set_type(fors_tree_addr, SPX_ADDR_TYPE_FORSTREE);
+    sig += SPX_N;
 
-        set_tree_height(fors_tree_addr, 0);
-        set_tree_index(fors_tree_addr, indices[i] + idx_offset);
-        set_type(fors_tree_addr, SPX_ADDR_TYPE_FORSPRF);
+    /* Compute the authentication path for this leaf node. */
+    treehashx1(roots + i * SPX_N, sig, ctx,
+               indices[i], idx_offset, SPX_FORS_HEIGHT, fors_gen_leafx1,
+               fors_tree_addr, &fors_info);
+}
 
-        /* Include the secret key part that produces the selected leaf node. */
-        fors_gen_sk(sig, ctx, fors_tree_addr);
-        set_type(fors_tree_addr, SPX_ADDR_TYPE_FORSTREE);
-        sig += SPX_N;
+/**
+ * Hashes horizontally across all tree roots to derive the FORS public key.
+ */
+void fors_pk_from_roots(unsigned char *pk, const unsigned char *roots,
+                        const spx_ctx *ctx,
+                        const uint32_t fors_addr[8]) {
+    uint32_t fors_pk_addr[8] = {0};
 
-        /* Compute the authentication path for this leaf node. */
-        treehashx1(roots + i * SPX_N, sig, ctx,
-                   indices[i], idx_offset, SPX_FORS_HEIGHT, fors_gen_leafx1,
-                   fors_tree_addr, &fors_info);
+    copy_keypair_addr(fors_pk_addr, fors_addr);
+    set_type(fors_pk_addr, SPX_ADDR_TYPE_FORSPK);
 
-        sig += SPX_N * SPX_FORS_HEIGHT;
+    thash(pk, roots, SPX_FORS_TREES, ctx, fors_pk_addr);
+}
+
+/**
+ * Signs a message m, deriving the secret key from sk_seed and the FTS address.
+ * Assumes m contains at least SPX_FORS_HEIGHT * SPX_FORS_TREES bits.
+ */
+void fors_sign(unsigned char *sig, unsigned char *pk,
+               const unsigned char *m,
+               const spx_ctx *ctx,
+               const uint32_t fors_addr[8]) {
+    unsigned char roots[SPX_FORS_TREES * SPX_N];
+    uint32_t i;
+
+    for (i = 0; i < SPX_FORS_TREES; i++) {
+        fors_sign_tree(sig, roots, m, ctx, fors_addr, i);
     }
 
-    /* Hash horizontally across all tree roots to derive the public key. */
-    thash(pk, roots, SPX_FORS_TREES, ctx, fors_pk_addr);
+    fors_pk_from_roots(pk, roots, ctx, fors_addr);
 }
 
 /**
@@ -5,8 +5,12 @@
 #include <stdint.h>
 
 #include "context.h"
+#include "fips202.h"
 #include "params.h"
 
+/* State of H_msg while it absorbs R || PK || M in pieces */
+typedef OQS_SHA3_shake256_inc_ctx spx_msg_state;
+
 #define prf_addr SPX_NAMESPACE(prf_addr)
 void prf_addr(unsigned char *out, const spx_ctx *ctx,
               const uint32_t addr[8]);
@@ -23,4 +27,11 @@ void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
                   const unsigned char *m, size_t mlen,
                   const spx_ctx *ctx);
 
+#define hash_message_final SPX_NAMESPACE(hash_message_final)
+void hash_message_final(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
+                        const unsigned char *R, const unsigned char *pk,
+                        spx_msg_state *state,
+                        const unsigned char *m, size_t mlen,
+                        const spx_ctx *ctx);
+
 #endif
@@ -156,28 +156,74 @@ int crypto_sign_signature(uint8_t *sig, size_t *siglen,
     return 0;
 }
 
+/* The work of crypto_sign_signature_tasks, shared by all of its tasks */
+typedef struct {
+    const spx_ctx *ctx;
+    uint8_t *sig; /* points just past R */
+    const uint8_t *mhash;
+    uint32_t fors_addr[8];
+    uint64_t tree[SPX_D];
+    uint32_t idx_leaf[SPX_D];
+    uint8_t fors_roots[SPX_FORS_TREES * SPX_N];
+    uint8_t layer_roots[SPX_D * SPX_N];
+} sign_tasks;
+
 /**
- * Verifies a detached signature and message under a given public key.
+ * Task i < SPX_D builds the subtree of layer i, the others each build one
+ * FORS tree. None of them depends on the message signed by a WOTS key.
  */
-int crypto_sign_verify(const uint8_t *sig, size_t siglen,
-                       const uint8_t *m, size_t mlen, const uint8_t *pk) {
+static void sign_task(void *arg, size_t index) {
+    sign_tasks *t = arg;
+    uint32_t wots_addr[8] = {0};
+    uint32_t tree_addr[8] = {0};
+    uint32_t layer;
+
+    if (index >= SPX_D) {
+        fors_sign_tree(t->sig, t->fors_roots, t->mhash, t->ctx, t->fors_addr,
+                       (uint32_t)(index - SPX_D));
+        return;
+    }
+
+    layer = (uint32_t)index;
+    set_type(wots_addr, SPX_ADDR_TYPE_WOTS);
+    set_type(tree_addr, SPX_ADDR_TYPE_HASHTREE);
+
+    set_layer_addr(tree_addr, layer);
+    set_tree_addr(tree_addr, t->tree[layer]);
+
+    copy_subtree_addr(wots_addr, tree_addr);
+    set_keypair_addr(wots_addr, t->idx_leaf[layer]);
+
+    merkle_gen_auth_path(t->sig + SPX_FORS_BYTES
+                         + layer * (SPX_WOTS_BYTES + SPX_TREE_HEIGHT * SPX_N)
+                         + SPX_WOTS_BYTES,
+                         t->layer_roots + layer * SPX_N,
+                         t->ctx, wots_addr, tree_addr, t->idx_leaf[layer]);
+}
+
+/**
+ * Returns an array containing a detached signature, computed as independent
+ * tasks handed to run_tasks.
+ */
+int crypto_sign_signature_tasks(uint8_t *sig, size_t *siglen,
+                                const uint8_t *m, size_t mlen, const uint8_t *sk,
+                                spx_run_tasks_fn run_tasks, void *executor) {
     spx_ctx ctx;
-    const uint8_t *pub_root = pk + SPX_N;
+    sign_tasks tasks;
+
+    const uint8_t *sk_prf = sk + SPX_N;
+    const uint8_t *pk = sk + 2 * SPX_N;
+
+    uint8_t optrand[SPX_N];
     uint8_t mhash[SPX_FORS_MSG_BYTES];
-    uint8_t wots_pk[SPX_WOTS_BYTES];
     uint8_t root[SPX_N];
-    uint8_t leaf[SPX_N];
-    unsigned int i;
+    uint32_t i;
     uint64_t tree;
     uint32_t idx_leaf;
     uint32_t wots_addr[8] = {0};
     uint32_t tree_addr[8] = {0};
-    uint32_t wots_pk_addr[8] = {0};
-
-    if (siglen != SPX_BYTES) {
-        return -1;
-    }
 
+    memcpy(ctx.sk_seed, sk, SPX_N);
     memcpy(ctx.pub_seed, pk, SPX_N);
 
     /* This hook allows the hash function instantiation to do whatever
@@ -186,18 +232,88 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen,
 
     set_type(wots_addr, SPX_ADDR_TYPE_WOTS);
     set_type(tree_addr, SPX_ADDR_TYPE_HASHTREE);
-    set_type(wots_pk_addr, SPX_ADDR_TYPE_WOTSPK);
 
-    /* Derive the message digest and leaf index from R || PK || M. */
-    /* The additional SPX_N is a result of the hash domain separator. */
+    /* Optionally, signing can be made non-deterministic using optrand.
+       This can help counter side-channel attacks that would benefit from
+       getting a large number of traces when the signer uses the same nodes. */
+    randombytes(optrand, SPX_N);
+    /* Compute the digest randomization value. */
+    gen_message_random(sig, sk_prf, optrand, m, mlen, &ctx);
+
+    /* Derive the message digest and leaf index from R, PK and M. */
     hash_message(mhash, &tree, &idx_leaf, sig, pk, m, mlen, &ctx);
     sig += SPX_N;
 
+    set_tree_addr(wots_addr, tree);
+    set_keypair_addr(wots_addr, idx_leaf);
+
+    tasks.ctx = &ctx;
+    tasks.sig = sig;
+    tasks.mhash = mhash;
+    memcpy(tasks.fors_addr, wots_addr, sizeof(wots_addr));
+    for (i = 0; i < SPX_D; i++) {
+        tasks.tree[i] = tree;
+        tasks.idx_leaf[i] = idx_leaf;
+
+        /* Update the indices for the next layer. */
+        idx_leaf = (tree & ((1 << SPX_TREE_HEIGHT) - 1));
+        tree = tree >> SPX_TREE_HEIGHT;
+    }
+
+    /* Build the FORS trees and the subtrees of all layers, which yields
+       everything but the WOTS signatures. */
+    run_tasks(executor, sign_task, &tasks, SPX_D + SPX_FORS_TREES);
+
+    fors_pk_from_roots(root, tasks.fors_roots, &ctx, tasks.fors_addr);
+    sig += SPX_FORS_BYTES;
+
+    /* Each layer signs the root of the layer below, starting from the FORS
+       public key. */
+    for (i = 0; i < SPX_D; i++) {
+        set_layer_addr(tree_addr, i);
+        set_tree_addr(tree_addr, tasks.tree[i]);
+
+        copy_subtree_addr(wots_addr, tree_addr);
+        set_keypair_addr(wots_addr, tasks.idx_leaf[i]);
+
+        wots_sign(sig, root, &ctx, wots_addr);
+        memcpy(root, tasks.layer_roots + i * SPX_N, SPX_N);
+        sig += SPX_WOTS_BYTES + SPX_TREE_HEIGHT * SPX_N;
+    }
+
+    free_hash_function(&ctx);
+
+    *siglen = SPX_BYTES;
+
+    return 0;
+}
+
+/**
+ * Verifies the FORS signature and the hypertree part of a detached signature,
+ * given the message digest and leaf index derived from R || PK || M.
+ * sig points just past R.
+ */
+static int verify_digest(const uint8_t *sig, const uint8_t *pk,
+                         const uint8_t *mhash, uint64_t tree, uint32_t idx_leaf,
+                         const spx_ctx *ctx) {
+    const uint8_t *pub_root = pk + SPX_N;
+    uint8_t wots_pk[SPX_WOTS_BYTES];
+    uint8_t root[SPX_N];
+    uint8_t leaf[SPX_N];
+    unsigned int i;
+    uint32_t wots_addr[8] = {0};
+    uint32_t tree_addr[8] = {0};
+    uint32_t wots_pk_addr[8] = {0};
+
+    set_type(wots_addr, SPX_ADDR_TYPE_WOTS);
+    set_type(tree_addr, SPX_ADDR_TYPE_HASHTREE);
+    set_type(wots_pk_addr, SPX_ADDR_TYPE_WOTSPK);
+
     /* Layer correctly defaults to 0, so no need to set_layer_addr */
     set_tree_addr(wots_addr, tree);
     set_keypair_addr(wots_addr, idx_leaf);
 
-    fors_pk_from_sig(root, sig, mhash, &ctx, wots_addr);
+    fors_pk_from_sig(root, sig, mhash, ctx, wots_addr);
     sig += SPX_FORS_BYTES;
 
     /* For each subtree.. */
@@ -213,15 +329,15 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen,
         /* The WOTS public key is only correct if the signature was correct. */
         /* Initially, root is the FORS pk, but on subsequent iterations it is
            the root of the subtree below the currently processed subtree. */
-        wots_pk_from_sig(wots_pk, sig, root, &ctx, wots_addr);
+        wots_pk_from_sig(wots_pk, sig, root, ctx, wots_addr);
         sig += SPX_WOTS_BYTES;
 
         /* Compute the leaf node using the WOTS public key. */
-        thash(leaf, wots_pk, SPX_WOTS_LEN, &ctx, wots_pk_addr);
+        thash(leaf, wots_pk, SPX_WOTS_LEN, ctx, wots_pk_addr);
 
         /* Compute the root node of this subtree. */
         compute_root(root, leaf, idx_leaf, 0, sig, SPX_TREE_HEIGHT,
-                     &ctx, tree_addr);
+                     ctx, tree_addr);
         sig += SPX_TREE_HEIGHT * SPX_N;
 
         /* Update the indices for the next layer. */
@@ -229,9 +345,6 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen,
         tree = tree >> SPX_TREE_HEIGHT;
     }
 
-    // cleanup
-    free_hash_function(&ctx);
-
     /* Check if the root node equals the root node in the public key. */
     if (memcmp(root, pub_root, SPX_N) != 0) {
         return -1;
@@ -240,6 +353,68 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen,
     return 0;
 }
 
+/**
+ * Verifies a detached signature and message under a given public key.
+ */
+int crypto_sign_verify(const uint8_t *sig, size_t siglen,
+                       const uint8_t *m, size_t mlen, const uint8_t *pk) {
+    spx_ctx ctx;
+    uint8_t mhash[SPX_FORS_MSG_BYTES];
+    uint64_t tree;
+    uint32_t idx_leaf;
+    int ret;
+
+    if (siglen != SPX_BYTES) {
+        return -1;
+    }
+
+    memcpy(ctx.pub_seed, pk, SPX_N);
+
+    /* This hook allows the hash function instantiation to do whatever
+       preparation or computation it needs, based on the public seed. */
+    initialize_hash_function(&ctx);
+
+    /* Derive the message digest and leaf index from R || PK || M. */
+    /* The additional SPX_N is a result of the hash domain separator. */
+    hash_message(mhash, &tree, &idx_leaf, sig, pk, m, mlen, &ctx);
+
+    ret = verify_digest(sig + SPX_N, pk, mhash, tree, idx_leaf, &ctx);
+
+    // cleanup
+    free_hash_function(&ctx);
+
+    return ret;
+}
+
+/**
+ * Verifies a detached signature on a message that was hashed in pieces.
+ */
+int crypto_sign_verify_stream(const uint8_t *sig, size_t siglen,
+                              spx_msg_state *msg_state,
+                              const uint8_t *m, size_t mlen, const uint8_t *pk) {
+    spx_ctx ctx;
+    uint8_t mhash[SPX_FORS_MSG_BYTES];
+    uint64_t tree;
+    uint32_t idx_leaf;
+    int ret;
+
+    memcpy(ctx.pub_seed, pk, SPX_N);
+    initialize_hash_function(&ctx);
+
+    /* Always complete the message hash, so that msg_state is released. */
+    hash_message_final(mhash, &tree, &idx_leaf, sig, pk, msg_state, m, mlen, &ctx);
+
+    if (siglen != SPX_BYTES) {
+        ret = -1;
+    } else {
+        ret = verify_digest(sig + SPX_N, pk, mhash, tree, idx_leaf, &ctx);
+    }
+
+    free_hash_function(&ctx);
+
+    return ret;
+}
+
 /**
  * Returns an array containing the signature followed by the message.
  */
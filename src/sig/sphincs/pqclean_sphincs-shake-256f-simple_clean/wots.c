@@ -87,6 +87,29 @@ void chain_lengths(unsigned int *lengths, const unsigned char *msg) {
     wots_checksum(lengths + SPX_WOTS_LEN1, lengths);
 }
 
+/**
+ * Signs an n-byte message with the WOTS key pair at addr, walking each chain
+ * from its secret key element up to the step given by the message.
+ */
+void wots_sign(unsigned char *sig, const unsigned char *msg,
+               const spx_ctx *ctx, uint32_t addr[8]) {
+    unsigned int lengths[SPX_WOTS_LEN];
+    unsigned char sk[SPX_N];
+    uint32_t i;
+
+    chain_lengths(lengths, msg);
+
+    for (i = 0; i < SPX_WOTS_LEN; i++) {
+        set_chain_addr(addr, i);
+        set_hash_addr(addr, 0);
+        set_type(addr, SPX_ADDR_TYPE_WOTSPRF);
+        prf_addr(sk, ctx, addr);
+
+        set_type(addr, SPX_ADDR_TYPE_WOTS);
+        gen_chain(sig + i * SPX_N, sk, 0, lengths[i], ctx, addr);
+    }
+}
+
 /**
  * Takes a WOTS signature and an n-byte message, computes a WOTS public key.
  *
@@ -46,6 +46,41 @@ void merkle_sign(uint8_t *sig, unsigned char *root,
                tree_addrx4, &info);
 }
 
+/*
+ * This computes the root node and the authentication path of a subtree, but
+ * not the WOTS signature, which wots_sign adds once the message is known.
+ * As the result does not depend on the message, the subtrees of all hypertree
+ * layers can be built independently of each other.
+ */
+void merkle_gen_auth_path(unsigned char *auth_path, unsigned char *root,
+                          const spx_ctx *ctx,
+                          uint32_t wots_addr[8], uint32_t tree_addr[8],
+                          uint32_t idx_leaf) {
+    uint32_t tree_addrx4[4 * 8] = { 0 };
+    int j;
+    struct leaf_info_x4 info = { 0 };
+    unsigned steps[ SPX_WOTS_LEN ] = { 0 };
+
+    info.wots_steps = steps;
+
+    for (j = 0; j < 4; j++) {
+        set_type(&tree_addrx4[8 * j], SPX_ADDR_TYPE_HASHTREE);
+        set_type(&info.leaf_addr[8 * j], SPX_ADDR_TYPE_WOTS);
+        set_type(&info.pk_addr[8 * j], SPX_ADDR_TYPE_WOTSPK);
+        copy_subtree_addr(&tree_addrx4[8 * j], tree_addr);
+        copy_subtree_addr(&info.leaf_addr[8 * j], wots_addr);
+        copy_subtree_addr(&info.pk_addr[8 * j], wots_addr);
+    }
+
+    info.wots_sign_leaf = ~0U; /* Do not sign with any of the leaves */
+
+    treehashx4(root, auth_path, ctx,
+               idx_leaf, 0,
+               SPX_TREE_HEIGHT,
+               wots_gen_leafx4,
+               tree_addrx4, &info);
+}
+
 /* Compute root node of the top-most subtree. */
 void merkle_gen_root(unsigned char *root, const spx_ctx *ctx) {
     /* We do not need the auth path in key generation, but it simplifies the
@@ -14,6 +14,11 @@ OQS_SIG *OQS_SIG_sphincs_sha2_128f_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128f_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128f_simple_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128f_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128f_simple_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128f_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128f_simple_stream_verify_final(void *state);
+OQS_API void OQS_SIG_sphincs_sha2_128f_simple_stream_release(void *state);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128f_simple_sign_parallel(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_sha2_128s_simple)
@@ -25,6 +30,11 @@ OQS_SIG *OQS_SIG_sphincs_sha2_128s_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128s_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128s_simple_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128s_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128s_simple_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128s_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128s_simple_stream_verify_final(void *state);
+OQS_API void OQS_SIG_sphincs_sha2_128s_simple_stream_release(void *state);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128s_simple_sign_parallel(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_sha2_192f_simple)
@@ -36,6 +46,11 @@ OQS_SIG *OQS_SIG_sphincs_sha2_192f_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_stream_verify_final(void *state);
+OQS_API void OQS_SIG_sphincs_sha2_192f_simple_stream_release(void *state);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_sign_parallel(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_sha2_192s_simple)
@@ -47,6 +62,11 @@ OQS_SIG *OQS_SIG_sphincs_sha2_192s_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_stream_verify_final(void *state);
+OQS_API void OQS_SIG_sphincs_sha2_192s_simple_stream_release(void *state);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_sign_parallel(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_sha2_256f_simple)
@@ -58,6 +78,11 @@ OQS_SIG *OQS_SIG_sphincs_sha2_256f_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256f_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256f_simple_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256f_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256f_simple_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256f_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256f_simple_stream_verify_final(void *state);
+OQS_API void OQS_SIG_sphincs_sha2_256f_simple_stream_release(void *state);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256f_simple_sign_parallel(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_sha2_256s_simple)
@@ -69,6 +94,11 @@ OQS_SIG *OQS_SIG_sphincs_sha2_256s_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256s_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256s_simple_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256s_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256s_simple_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256s_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256s_simple_stream_verify_final(void *state);
+OQS_API void OQS_SIG_sphincs_sha2_256s_simple_stream_release(void *state);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256s_simple_sign_parallel(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_shake_128f_simple)
@@ -80,6 +110,11 @@ OQS_SIG *OQS_SIG_sphincs_shake_128f_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128f_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128f_simple_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128f_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128f_simple_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128f_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128f_simple_stream_verify_final(void *state);
+OQS_API void OQS_SIG_sphincs_shake_128f_simple_stream_release(void *state);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128f_simple_sign_parallel(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_shake_128s_simple)
@@ -91,6 +126,11 @@ OQS_SIG *OQS_SIG_sphincs_shake_128s_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128s_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128s_simple_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128s_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128s_simple_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128s_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128s_simple_stream_verify_final(void *state);
+OQS_API void OQS_SIG_sphincs_shake_128s_simple_stream_release(void *state);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128s_simple_sign_parallel(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_shake_192f_simple)
@@ -102,6 +142,11 @@ OQS_SIG *OQS_SIG_sphincs_shake_192f_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192f_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192f_simple_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192f_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192f_simple_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192f_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192f_simple_stream_verify_final(void *state);
+OQS_API void OQS_SIG_sphincs_shake_192f_simple_stream_release(void *state);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192f_simple_sign_parallel(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_shake_192s_simple)
@@ -113,6 +158,11 @@ OQS_SIG *OQS_SIG_sphincs_shake_192s_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192s_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192s_simple_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192s_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192s_simple_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192s_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192s_simple_stream_verify_final(void *state);
+OQS_API void OQS_SIG_sphincs_shake_192s_simple_stream_release(void *state);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192s_simple_sign_parallel(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_shake_256f_simple)
@@ -124,6 +174,11 @@ OQS_SIG *OQS_SIG_sphincs_shake_256f_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256f_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256f_simple_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256f_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256f_simple_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256f_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256f_simple_stream_verify_final(void *state);
+OQS_API void OQS_SIG_sphincs_shake_256f_simple_stream_release(void *state);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256f_simple_sign_parallel(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_shake_256s_simple)
@@ -135,6 +190,11 @@ OQS_SIG *OQS_SIG_sphincs_shake_256s_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256s_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256s_simple_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256s_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256s_simple_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256s_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256s_simple_stream_verify_final(void *state);
+OQS_API void OQS_SIG_sphincs_shake_256s_simple_stream_release(void *state);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256s_simple_sign_parallel(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool);
 #endif
 
 #endif
@@ -1,11 +1,26 @@
 // SPDX-License-Identifier: MIT
 
 #include <stdlib.h>
+#include <string.h>
 
+#include <oqs/sha2.h>
 #include <oqs/sig_sphincs.h>
 
+#include "sphincs_threads.h"
+
 #if defined(OQS_ENABLE_SIG_sphincs_sha2_192f_simple)
 
+/* State of a streaming verification operation */
+typedef struct {
+	/* H_msg state, absorbing R || PK || M */
+	OQS_SHA2_sha512_ctx msg_state;
+	/* Input not yet absorbed into msg_state, less than one SHA-512 block */
+	uint8_t block[128];
+	size_t block_len;
+	uint8_t public_key[OQS_SIG_sphincs_sha2_192f_simple_length_public_key];
+	uint8_t signature[OQS_SIG_sphincs_sha2_192f_simple_length_signature];
+} OQS_SIG_sphincs_sha2_192f_simple_stream_state;
+
 OQS_SIG *OQS_SIG_sphincs_sha2_192f_simple_new(void) {
 
 	OQS_SIG *sig = OQS_MEM_malloc(sizeof(OQS_SIG));
@@ -25,6 +40,20 @@ OQS_SIG *OQS_SIG_sphincs_sha2_192f_simple_new(void) {
 	sig->keypair = OQS_SIG_sphincs_sha2_192f_simple_keypair;
 	sig->sign = OQS_SIG_sphincs_sha2_192f_simple_sign;
 	sig->verify = OQS_SIG_sphincs_sha2_192f_simple_verify;
+	sig->length_expanded_public_key = 0;
+	sig->public_key_expand = NULL;
+	sig->verify_expanded = NULL;
+	sig->length_expanded_secret_key = 0;
+	sig->secret_key_expand = NULL;
+	sig->sign_expanded = NULL;
+	sig->length_stream_state = sizeof(OQS_SIG_sphincs_sha2_192f_simple_stream_state);
+	sig->stream_sign_init = NULL;
+	sig->stream_verify_init = OQS_SIG_sphincs_sha2_192f_simple_stream_verify_init;
+	sig->stream_update = OQS_SIG_sphincs_sha2_192f_simple_stream_update;
+	sig->stream_sign_final = NULL;
+	sig->stream_verify_final = OQS_SIG_sphincs_sha2_192f_simple_stream_verify_final;
+	sig->stream_release = OQS_SIG_sphincs_sha2_192f_simple_stream_release;
+	sig->sign_parallel = OQS_SIG_sphincs_sha2_192f_simple_sign_parallel;
 
 	return sig;
 }
@@ -32,11 +61,15 @@ OQS_SIG *OQS_SIG_sphincs_sha2_192f_simple_new(void) {
 extern int PQCLEAN_SPHINCSSHA2192FSIMPLE_CLEAN_crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
 extern int PQCLEAN_SPHINCSSHA2192FSIMPLE_CLEAN_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int PQCLEAN_SPHINCSSHA2192FSIMPLE_CLEAN_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int PQCLEAN_SPHINCSSHA2192FSIMPLE_CLEAN_crypto_sign_verify_stream(const uint8_t *sig, size_t siglen, OQS_SHA2_sha512_ctx *msg_state, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int PQCLEAN_SPHINCSSHA2192FSIMPLE_CLEAN_crypto_sign_signature_tasks(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk, OQS_SIG_sphincs_task_runner run_tasks, void *executor);
 
 #if defined(OQS_ENABLE_SIG_sphincs_sha2_192f_simple_avx2)
 extern int PQCLEAN_SPHINCSSHA2192FSIMPLE_AVX2_crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
 extern int PQCLEAN_SPHINCSSHA2192FSIMPLE_AVX2_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int PQCLEAN_SPHINCSSHA2192FSIMPLE_AVX2_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int PQCLEAN_SPHINCSSHA2192FSIMPLE_AVX2_crypto_sign_verify_stream(const uint8_t *sig, size_t siglen, OQS_SHA2_sha512_ctx *msg_state, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int PQCLEAN_SPHINCSSHA2192FSIMPLE_AVX2_crypto_sign_signature_tasks(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk, OQS_SIG_sphincs_task_runner run_tasks, void *executor);
 #endif
 
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_keypair(uint8_t *public_key, uint8_t *secret_key) {
@@ -87,4 +120,97 @@ OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_verify(const uint8_t *messag
 #endif
 }
 
+static void OQS_SIG_sphincs_sha2_192f_simple_stream_absorb(OQS_SIG_sphincs_sha2_192f_simple_stream_state *stream, const uint8_t *in, size_t inlen) {
+	size_t inblocks;
+
+	if (stream->block_len > 0) {
+		size_t fill = sizeof(stream->block) - stream->block_len;
+		if (fill > inlen) {
+			fill = inlen;
+		}
+		memcpy(stream->block + stream->block_len, in, fill);
+		stream->block_len += fill;
+		in += fill;
+		inlen -= fill;
+		if (stream->block_len < sizeof(stream->block)) {
+			return;
+		}
+		OQS_SHA2_sha512_inc_blocks(&stream->msg_state, stream->block, 1);
+		stream->block_len = 0;
+	}
+	inblocks = inlen / sizeof(stream->block);
+	if (inblocks > 0) {
+		OQS_SHA2_sha512_inc_blocks(&stream->msg_state, in, inblocks);
+	}
+	stream->block_len = inlen - inblocks * sizeof(stream->block);
+	memcpy(stream->block, in + inblocks * sizeof(stream->block), stream->block_len);
+}
+
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_stream_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	OQS_SIG_sphincs_sha2_192f_simple_stream_state *stream = state;
+
+	if (signature_len != OQS_SIG_sphincs_sha2_192f_simple_length_signature) {
+		return OQS_ERROR;
+	}
+	memcpy(stream->public_key, public_key, OQS_SIG_sphincs_sha2_192f_simple_length_public_key);
+	memcpy(stream->signature, signature, OQS_SIG_sphincs_sha2_192f_simple_length_signature);
+
+	/* The signature starts with the n-byte randomizer R; the public key is 2n bytes */
+	OQS_SHA2_sha512_inc_init(&stream->msg_state);
+	stream->block_len = 0;
+	OQS_SIG_sphincs_sha2_192f_simple_stream_absorb(stream, signature, OQS_SIG_sphincs_sha2_192f_simple_length_public_key / 2);
+	OQS_SIG_sphincs_sha2_192f_simple_stream_absorb(stream, public_key, OQS_SIG_sphincs_sha2_192f_simple_length_public_key);
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len) {
+	OQS_SIG_sphincs_sha2_192f_simple_stream_state *stream = state;
+
+	OQS_SIG_sphincs_sha2_192f_simple_stream_absorb(stream, chunk, chunk_len);
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_stream_verify_final(void *state) {
+	OQS_SIG_sphincs_sha2_192f_simple_stream_state *stream = state;
+
+#if defined(OQS_ENABLE_SIG_sphincs_sha2_192f_simple_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192FSIMPLE_AVX2_crypto_sign_verify_stream(stream->signature, OQS_SIG_sphincs_sha2_192f_simple_length_signature, &stream->msg_state, stream->block, stream->block_len, stream->public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192FSIMPLE_CLEAN_crypto_sign_verify_stream(stream->signature, OQS_SIG_sphincs_sha2_192f_simple_length_signature, &stream->msg_state, stream->block, stream->block_len, stream->public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192FSIMPLE_CLEAN_crypto_sign_verify_stream(stream->signature, OQS_SIG_sphincs_sha2_192f_simple_length_signature, &stream->msg_state, stream->block, stream->block_len, stream->public_key);
+#endif
+}
+
+OQS_API void OQS_SIG_sphincs_sha2_192f_simple_stream_release(void *state) {
+	OQS_SIG_sphincs_sha2_192f_simple_stream_state *stream = state;
+
+	OQS_SHA2_sha512_inc_ctx_release(&stream->msg_state);
+}
+
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_sign_parallel(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key, OQS_THREADPOOL *pool) {
+	if (OQS_THREADPOOL_concurrency(pool) <= 1) {
+		return OQS_SIG_sphincs_sha2_192f_simple_sign(signature, signature_len, message, message_len, secret_key);
+	}
+#if defined(OQS_ENABLE_SIG_sphincs_sha2_192f_simple_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192FSIMPLE_AVX2_crypto_sign_signature_tasks(signature, signature_len, message, message_len, secret_key, OQS_SIG_sphincs_run_tasks, pool);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192FSIMPLE_CLEAN_crypto_sign_signature_tasks(signature, signature_len, message, message_len, secret_key, OQS_SIG_sphincs_run_tasks, pool);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192FSIMPLE_CLEAN_crypto_sign_signature_tasks(signature, signature_len, message, message_len, secret_key, OQS_SIG_sphincs_run_tasks, pool);
+#endif
+}
+
 #endif
@@ -0,0 +1,9 @@
+// SPDX-License-Identifier: MIT
+
+#include <oqs/common.h>
+
+#include "sphincs_threads.h"
+
+void OQS_SIG_sphincs_run_tasks(void *executor, void (*task)(void *arg, size_t index), void *arg, size_t count) {
+	OQS_THREADPOOL_run((OQS_THREADPOOL *)executor, task, arg, count);
+}
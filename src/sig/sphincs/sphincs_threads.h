@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef OQS_SIG_SPHINCS_THREADS_H
+#define OQS_SIG_SPHINCS_THREADS_H
+
+#include <stddef.h>
+
+/** Runs task(arg, 0), ..., task(arg, count - 1) and returns once all of them have finished. */
+typedef void (*OQS_SIG_sphincs_task_runner)(void *executor, void (*task)(void *arg, size_t index), void *arg, size_t count);
+
+/**
+ * Task runner for crypto_sign_signature_tasks that submits the tasks to the
+ * OQS_THREADPOOL passed as `executor`.
+ */
+void OQS_SIG_sphincs_run_tasks(void *executor, void (*task)(void *arg, size_t index), void *arg, size_t count);
+
+#endif // OQS_SIG_SPHINCS_THREADS_H
@@ -155,8 +155,9 @@ void hss_init_extra_info( struct hss_extra_info *p ) {
     if (p) memset( p, 0, sizeof *p );
 }
 
-void hss_extra_info_set_threads( struct hss_extra_info *p, int num_threads ) {
-    if (p) p->num_threads = num_threads;
+void hss_extra_info_set_thread_pool( struct hss_extra_info *p,
+                                     struct OQS_THREADPOOL *thread_pool ) {
+    if (p) p->thread_pool = thread_pool;
 }
 
 bool hss_extra_info_test_last_signature( struct hss_extra_info *p ) {
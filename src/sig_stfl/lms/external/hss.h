@@ -402,8 +402,11 @@ enum hss_error_code {
  * to and from the above routines (without requiring us to add each
  * one as an additional parameter
  */
+struct OQS_THREADPOOL;
+
 struct hss_extra_info {
-    int num_threads;     /* Number of threads we're allowed to ues */
+    struct OQS_THREADPOOL *thread_pool; /* Pool the work may be split */
+                         /* across; NULL runs it in the calling thread */
     bool last_signature; /* Set if we just signed the last signature */
                          /* allowed by this private key */
     enum hss_error_code error_code; /* The more recent error detected */
@@ -412,7 +415,8 @@ struct hss_extra_info {
 /* Accessor APIs in case someone doesn't feel comfortable about reaching */
 /* into the structure */
 void hss_init_extra_info( struct hss_extra_info * );
-void hss_extra_info_set_threads( struct hss_extra_info *, int );
+void hss_extra_info_set_thread_pool( struct hss_extra_info *,
+                                     struct OQS_THREADPOOL * );
 bool hss_extra_info_test_last_signature( struct hss_extra_info * );
 enum hss_error_code hss_extra_info_test_error_code( struct hss_extra_info * );
 
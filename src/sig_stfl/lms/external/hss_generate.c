@@ -628,7 +628,7 @@ bool hss_generate_working_key(
     float est_total = estimate_total_cost( order, count_order );
 
     /* Estimate how much we should target each work item should take */
-    unsigned num_tracks = 4 * hss_thread_num_tracks(info->num_threads);
+    unsigned num_tracks = 4 * hss_thread_num_tracks(info->thread_pool);
     if (num_tracks == 0) num_tracks = 4;   /* Divide by 0; just say no */
     float est_max_per_work_item = est_total / num_tracks;
 
@@ -672,12 +672,12 @@ bool hss_generate_working_key(
 #endif
 
     /* Now, generate all the nodes we've listed in parallel */
-    struct thread_collection *col = hss_thread_init(info->num_threads);
+    struct thread_collection *col = hss_thread_init(info->thread_pool);
     enum hss_error_code got_error = hss_error_none;
 
        /* We use this to decide the granularity of the requests we make */
 #if DO_FLOATING_POINT
-    unsigned core_target = 5 * hss_thread_num_tracks(info->num_threads);
+    unsigned core_target = 5 * hss_thread_num_tracks(info->thread_pool);
     float prev_cost = 0;
 #endif
 
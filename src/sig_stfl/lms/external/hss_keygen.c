@@ -171,7 +171,7 @@ bool hss_generate_private_key(
     /* First of all, figure out the appropriate level to compute up to */
     /* in parallel.  We'll do the lower of the bottom-most level that */
     /* appears in the aux data, and 4*log2 of the number of core we have */
-    unsigned num_cores = hss_thread_num_tracks(info->num_threads);
+    unsigned num_cores = hss_thread_num_tracks(info->thread_pool);
     unsigned level;
     unsigned char *dest = 0;  /* The area we actually write to */
     void *temp_buffer = 0;  /* The buffer we need to free when done */
@@ -213,7 +213,7 @@ bool hss_generate_private_key(
      * allowing that is why we use this funky thread_collection and details
      * structure
      */
-    struct thread_collection *col = hss_thread_init(info->num_threads);
+    struct thread_collection *col = hss_thread_init(info->thread_pool);
 
     struct intermed_tree_detail details;
         /* Set the values in the details structure that are constant */
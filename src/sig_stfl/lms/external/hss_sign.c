@@ -507,7 +507,7 @@ bool hss_generate_signature(
        /* Ok, now actually generate the signature */
 
     /* We'll be doing several things in parallel */
-    struct thread_collection *col = hss_thread_init(info->num_threads);
+    struct thread_collection *col = hss_thread_init(info->thread_pool);
     enum hss_error_code got_error = hss_error_none;
 
     /* Generate the signature */
@@ -35,14 +35,18 @@
 /* This is our abstract object that stands for a set of threads */
 struct thread_collection;
 
+/* The liboqs thread pool the work items are run on (see oqs/common.h) */
+struct OQS_THREADPOOL;
+
 /*
  * This is called to initialize a set of threads, and returns the identifier.
  * Note that this cannot fail; if it returns 0, it's not a failure; instead,
  * it's a valid return (which essentially means we're running in nonthreaded
  * mode)
- * The integer passed is a recommendation on the number of threads
+ * The pool passed is the one the work items are handed to; NULL (or a pool
+ * that can run only one task at a time) runs them in the calling thread
  */
-struct thread_collection *hss_thread_init(int);
+struct thread_collection *hss_thread_init(struct OQS_THREADPOOL *pool);
 
 /*
  * This issues another work item to our collection of threads.  At some point
@@ -132,6 +136,6 @@ void hss_thread_after_write(struct thread_collection *collect);
  *
  * The value passed is the value we'll pass to hss_thread_init
  */
-unsigned hss_thread_num_tracks(int num_threads);
+unsigned hss_thread_num_tracks(struct OQS_THREADPOOL *pool);
 
 #endif /* HSS_THREAD_H_ */
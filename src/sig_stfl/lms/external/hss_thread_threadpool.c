@@ -0,0 +1,211 @@
+// SPDX-License-Identifier: MIT
+#include "hss_thread.h"
+
+#include <string.h>
+#include <oqs/common.h>
+
+#if defined(OQS_USE_PTHREADS)
+#include <pthread.h>
+#endif
+
+/*
+ * This is an implementation of our threaded abstraction on top of the
+ * liboqs OQS_THREADPOOL.  Rather than spawning threads of our own, we queue
+ * up the work items issued, and hss_thread_done hands them to the pool as a
+ * single batch.  The pool is either backed by persistent liboqs worker
+ * threads, or by the application's own executor, so the application decides
+ * how many threads (if any) we get to use
+ *
+ * The API doesn't promise when a work item runs, only that it has completed
+ * by the time hss_thread_done returns; running them all from
+ * hss_thread_done is within that contract
+ *
+ * Without pthreads we have no lock to offer hss_thread_before_write, and so
+ * we run everything in the calling thread
+ */
+
+#define MAX_TRACKS 64   /* Never split the work into more tracks than */
+                        /* this, no matter how large the pool is */
+
+#define MIN_DETAIL 16   /* So the alignment kludge we do doesn't waste space */
+
+struct work_item {
+    struct work_item *link;    /* They're in a linked list */
+
+    void (*function)(const void *detail,   /* Function to call */
+                             struct thread_collection *col);
+
+       /* The detail structure that we pass to the function */
+       /* We'll malloc enough space to hold the entire structure */
+    union {                    /* union here so that the detail array is */
+        void *align1;          /* correctly aligned for various datatypes */
+        long long align2;
+        void (*align3)(void);
+        unsigned char detail[MIN_DETAIL];
+    } x;
+};
+
+struct thread_collection {
+    struct OQS_THREADPOOL *pool; /* Where the work items are run */
+#if defined(OQS_USE_PTHREADS)
+    pthread_mutex_t write_lock; /* Must be locked before common user data is */
+                                /* written */
+#endif
+
+        /*
+         * Queue (FIFO) of work items submitted; we hand them to the pool in
+         * the order they were issued (which isn't something the interface
+         * guarantees; however it doesn't interfere with the request ordering
+         * we ask applications to make)
+         */
+    struct work_item *top_work_queue;
+    struct work_item *end_work_queue;
+    size_t num_work;
+};
+
+/* What the pool tasks see: the queued work items, by index */
+struct work_batch {
+    struct thread_collection *col;
+    struct work_item **items;
+};
+
+/*
+ * Allocate a thread control structure
+ */
+struct thread_collection *hss_thread_init(struct OQS_THREADPOOL *pool) {
+#if defined(OQS_USE_PTHREADS)
+    if (OQS_THREADPOOL_concurrency(pool) <= 1) return 0; /* Not an error: */
+                                    /* an indication to run single threaded */
+
+    struct thread_collection *col = OQS_MEM_malloc( sizeof *col );
+    if (!col) return 0;  /* On malloc failure, run single threaded */
+
+    if (0 != pthread_mutex_init( &col->write_lock, 0 )) {
+        OQS_MEM_insecure_free(col);
+        return 0;
+    }
+
+    col->pool = pool;
+    col->top_work_queue = 0;
+    col->end_work_queue = 0;
+    col->num_work = 0;
+
+    return col;
+#else
+    (void)pool;
+    return 0;
+#endif
+}
+
+/*
+ * This adds function/details to the list of things that need to be done
+ * It either queues it up for the pool, or (if we can't) just does it itself
+ */
+void hss_thread_issue_work(struct thread_collection *col,
+            void (*function)(const void *detail,
+                             struct thread_collection *col),
+            const void *detail, size_t size_detail_structure) {
+
+    /* If we're running in single-threaded mode */
+    if (!col) {
+        function( detail, col );
+        return;
+    }
+
+    /* Allocate a work structure to hold this request */
+    size_t extra_space;
+    if (size_detail_structure < MIN_DETAIL) extra_space = 0;
+    else extra_space = size_detail_structure - MIN_DETAIL;
+    struct work_item *w = OQS_MEM_malloc(sizeof *w + extra_space);
+
+    if (!w) {
+        /* Can't allocate the work structure; fall back to single-threaded */
+        function( detail, col );
+        return;
+    }
+    w->function = function;
+    memcpy( w->x.detail, detail, size_detail_structure );
+
+    /* Only the issuing thread touches the queue, so no lock is needed */
+    w->link = 0;
+    if (col->end_work_queue) {
+        col->end_work_queue->link = w;
+    }
+    col->end_work_queue = w;
+    if (!col->top_work_queue) col->top_work_queue = w;
+    col->num_work += 1;
+}
+
+/*
+ * This is the task the pool runs, once for each queued work item
+ */
+static void run_work_item(void *arg, size_t index) {
+    const struct work_batch *batch = arg;
+    struct work_item *w = batch->items[index];
+
+    (w->function)(w->x.detail, batch->col);
+}
+
+/*
+ * This will run all the work items we've queued, and wait for them to
+ * complete
+ */
+void hss_thread_done(struct thread_collection *col) {
+    if (!col) return;
+
+    struct work_item *w, *next;
+    struct work_batch batch;
+    batch.col = col;
+    batch.items = OQS_MEM_malloc( col->num_work * sizeof *batch.items );
+
+    if (batch.items) {
+        size_t i = 0;
+        for (w = col->top_work_queue; w; w = w->link) {
+            batch.items[i++] = w;
+        }
+        OQS_THREADPOOL_run( col->pool, run_work_item, &batch, col->num_work );
+        OQS_MEM_insecure_free(batch.items);
+    } else {
+        /* Can't index the queue; fall back to single-threaded */
+        for (w = col->top_work_queue; w; w = w->link) {
+            (w->function)(w->x.detail, col);
+        }
+    }
+
+    /* Ok, all the work items have finished; tear things down */
+    for (w = col->top_work_queue; w; w = next) {
+        next = w->link;
+        OQS_MEM_insecure_free(w);
+    }
+#if defined(OQS_USE_PTHREADS)
+    pthread_mutex_destroy( &col->write_lock );
+#endif
+    OQS_MEM_insecure_free(col);
+}
+
+void hss_thread_before_write(struct thread_collection *col) {
+#if defined(OQS_USE_PTHREADS)
+    if (!col) return;
+    pthread_mutex_lock( &col->write_lock );
+#else
+    (void)col;
+#endif
+}
+
+void hss_thread_after_write(struct thread_collection *col) {
+#if defined(OQS_USE_PTHREADS)
+    if (!col) return;
+    pthread_mutex_unlock( &col->write_lock );
+#else
+    (void)col;
+#endif
+}
+
+unsigned hss_thread_num_tracks(struct OQS_THREADPOOL *pool) {
+    size_t num_tracks = OQS_THREADPOOL_concurrency(pool);
+#if !defined(OQS_USE_PTHREADS)
+    num_tracks = 1;
+#endif
+    if (num_tracks >= MAX_TRACKS) return MAX_TRACKS;
+    return (unsigned)num_tracks;
+}
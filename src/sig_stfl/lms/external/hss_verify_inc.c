@@ -64,7 +64,7 @@ bool hss_validate_signature_init(
     /* Validate the upper levels of the signature */
     struct thread_collection *col = NULL;
     if (levels > 1) {
-        col = hss_thread_init(info->num_threads);
+        col = hss_thread_init(info->thread_pool);
         enum hss_error_code got_error = hss_error_none;
         struct verify_detail detail;
         detail.got_error = &got_error;
@@ -13,7 +13,7 @@
 #define hss_hash_length LMS_NAMESPACE(hss_hash_length)
 #define hss_init_hash_context LMS_NAMESPACE(hss_init_hash_context)
 #define hss_update_hash_context LMS_NAMESPACE(hss_update_hash_context)
-#define hss_extra_info_set_threads LMS_NAMESPACE(hss_extra_info_set_threads)
+#define hss_extra_info_set_thread_pool LMS_NAMESPACE(hss_extra_info_set_thread_pool)
 #define hss_extra_info_test_error_code LMS_NAMESPACE(hss_extra_info_test_error_code)
 #define hss_extra_info_test_last_signature LMS_NAMESPACE(hss_extra_info_test_last_signature)
 #define hss_generate_child_seed_I_value LMS_NAMESPACE(hss_generate_child_seed_I_value)
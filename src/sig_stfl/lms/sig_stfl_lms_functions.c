@@ -52,6 +52,15 @@ typedef struct OQS_LMS_KEY_DATA {
 	void *context;
 } oqs_lms_key_data;
 
+/*
+ * Hands the hss library the pool to build trees on: the one set on the
+ * secret key, or else the default pool (if any).
+ */
+static void lms_init_extra_info(struct hss_extra_info *info, OQS_THREADPOOL *pool) {
+	hss_init_extra_info(info);
+	hss_extra_info_set_thread_pool(info, pool != NULL ? pool : OQS_THREADPOOL_get_default());
+}
+
 #ifndef OQS_ALLOW_LMS_KEY_AND_SIG_GEN
 OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign(UNUSED uint8_t *signature, UNUSED size_t *signature_length, UNUSED const uint8_t *message,
         UNUSED size_t message_len, UNUSED OQS_SIG_STFL_SECRET_KEY *secret_key) {
@@ -65,7 +74,6 @@ OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign(uint8_t *signature, size_t *signatu
 	oqs_lms_key_data *lms_key_data = NULL;
 	uint8_t *sk_key_buf = NULL;
 	size_t sk_key_buf_len = 0;
-	void *context;
 
 	if (secret_key == NULL || message == NULL || signature == NULL || signature_length == NULL) {
 		return OQS_ERROR;
@@ -105,8 +113,7 @@ OQS_API OQS_STATUS OQS_SIG_STFL_alg_lms_sign(uint8_t *signature, size_t *signatu
 		goto err;
 	}
 
-	context = secret_key->context;
-	rc_keyupdate = secret_key->secure_store_scrt_key(sk_key_buf, sk_key_buf_len, context);
+	rc_keyupdate = OQS_SIG_STFL_SECRET_KEY_store(secret_key, sk_key_buf, sk_key_buf_len);
 	if (rc_keyupdate != OQS_SUCCESS) {
 		goto err;
 	}
@@ -193,6 +200,7 @@ OQS_API OQS_STATUS OQS_SIG_STFL_lms_sigs_total(unsigned long long *total, const
 	uint8_t *priv_key = NULL;
 	oqs_lms_key_data *oqs_key_data = NULL;
 	struct hss_working_key *working_key = NULL;
+	struct hss_extra_info info;
 
 	if (total == NULL  || secret_key == NULL) {
 		return OQS_ERROR;
@@ -208,11 +216,12 @@ OQS_API OQS_STATUS OQS_SIG_STFL_lms_sigs_total(unsigned long long *total, const
 		return OQS_ERROR;
 	}
 
+	lms_init_extra_info(&info, secret_key->thread_pool);
 	working_key = hss_load_private_key(NULL, priv_key,
 	                                   0,
 	                                   NULL,
 	                                   0,
-	                                   0);
+	                                   &info);
 	if (!working_key) {
 		return OQS_ERROR;
 	}
@@ -245,6 +254,7 @@ int oqs_sig_stfl_lms_keypair(uint8_t *pk, OQS_SIG_STFL_SECRET_KEY *sk, const uin
 
 	size_t len_public_key = 60;
 	oqs_lms_key_data *oqs_key_data = NULL;
+	struct hss_extra_info info;
 
 	if (!pk || !sk || !oid) {
 		return -1;
@@ -513,6 +523,7 @@ int oqs_sig_stfl_lms_keypair(uint8_t *pk, OQS_SIG_STFL_SECRET_KEY *sk, const uin
 	 *
 	 * This returns true on success, false on failure
 	 */
+	lms_init_extra_info(&info, sk->thread_pool);
 	b_ret = hss_generate_private_key(
 	            LMS_randombytes,
 	            oqs_key_data->levels,
@@ -522,7 +533,7 @@ int oqs_sig_stfl_lms_keypair(uint8_t *pk, OQS_SIG_STFL_SECRET_KEY *sk, const uin
 	            oqs_key_data->sec_key,
 	            oqs_key_data->public_key, len_public_key,
 	            oqs_key_data->aux_data, oqs_key_data->len_aux_data,
-	            NULL);
+	            &info);
 	if (b_ret) {
 		memcpy(pk, oqs_key_data->public_key, len_public_key);
 		sk->secret_key_data = oqs_key_data;
@@ -556,17 +567,19 @@ int oqs_sig_stfl_lms_sign(OQS_SIG_STFL_SECRET_KEY *sk,
 	oqs_lms_key_data *oqs_key_data = NULL;
 	struct hss_working_key *w = NULL;
 	struct hss_sign_inc ctx;
+	struct hss_extra_info info;
 	if (sk) {
 		oqs_key_data = sk->secret_key_data;
 		priv_key = oqs_key_data->sec_key;
 	} else {
 		return -1;
 	}
+	lms_init_extra_info(&info, sk->thread_pool);
 	w = hss_load_private_key(NULL, priv_key,
 	                         0,
 	                         NULL,
 	                         0,
-	                         0);
+	                         &info);
 	if (!w) {
 		hss_free_working_key(w);
 		return 0;
@@ -594,7 +607,7 @@ int oqs_sig_stfl_lms_sign(OQS_SIG_STFL_SECRET_KEY *sk,
 	    NULL,                 /* Routine to update the */
 	    priv_key,       /* private key */
 	    sig, sig_len,         /* Where to place the signature */
-	    0);
+	    &info);
 
 	(void)hss_sign_update(
 	    &ctx,           /* Incremental signing context */
@@ -605,7 +618,7 @@ int oqs_sig_stfl_lms_sign(OQS_SIG_STFL_SECRET_KEY *sk,
 	             &ctx,               /* Incremental signing context */
 	             w,                  /* Working key */
 	             sig,                /* Signature */
-	             0);
+	             &info);
 
 	if (!status) {
 		hss_free_working_key(w);
@@ -627,12 +640,15 @@ int oqs_sig_stfl_lms_verify(const uint8_t *m, size_t mlen,
                             const uint8_t *pk) {
 
 	struct hss_validate_inc ctx;
+	struct hss_extra_info info;
+
+	lms_init_extra_info(&info, NULL);
 	(void)hss_validate_signature_init(
 	    &ctx,               /* Incremental validate context */
 	    (const unsigned char *)pk,                /* Public key */
 	    (const unsigned char *)signature,
 	    (size_t)signature_len,       /* Signature */
-	    0);                 /* Use the defaults for extra info */
+	    &info);
 
 	(void)hss_validate_signature_update(
 	    &ctx,           /* Incremental validate context */
@@ -642,7 +658,7 @@ int oqs_sig_stfl_lms_verify(const uint8_t *m, size_t mlen,
 	bool status = hss_validate_signature_finalize(
 	                  &ctx,               /* Incremental validate context */
 	                  (const unsigned char *)signature,                /* Signature */
-	                  0);                 /* Use the defaults for extra info */
+	                  &info);
 
 	if (status) {
 		/* Signature verified */
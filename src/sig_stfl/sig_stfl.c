@@ -2,8 +2,8 @@
 
 #include <assert.h>
 #include <stdlib.h>
-#if defined(_WIN32)
 #include <string.h>
+#if defined(_WIN32)
 #define strcasecmp _stricmp
 #else
 #include <strings.h>
@@ -1517,6 +1517,8 @@ OQS_API void OQS_SIG_STFL_SECRET_KEY_free(OQS_SIG_STFL_SECRET_KEY *sk) {
 	/* Call object specific free */
 	sk->free_key(sk);
 
+	OQS_SIG_STFL_SECRET_KEY_SET_delta_store(sk, 0);
+
 	/* Free sk object */
 	OQS_MEM_secure_free(sk, sizeof(*sk));
 }
@@ -1546,6 +1548,240 @@ OQS_API OQS_STATUS OQS_SIG_STFL_SECRET_KEY_deserialize(OQS_SIG_STFL_SECRET_KEY *
 	return sk->deserialize_key(sk, sk_buf, sk_buf_len, context);
 }
 
+/* State of the delta store mode, see OQS_SIG_STFL_SECRET_KEY_SET_delta_store. */
+typedef struct {
+	/* Maximum number of delta records between two snapshots */
+	unsigned int compact_interval;
+	/* Delta records written since the last snapshot */
+	unsigned int deltas;
+	/* Key as of the last record handed to the store callback */
+	uint8_t *image;
+	size_t image_len;
+} stfl_store_log;
+
+#define STORE_RECORD_HEADER_LEN 5
+#define STORE_DELTA_RUN_HEADER_LEN 8
+/* Equal bytes between two changed runs are copied rather than starting a new run
+ * as long as that is no longer than a run header. */
+#define STORE_DELTA_MAX_GAP STORE_DELTA_RUN_HEADER_LEN
+
+static void store_put_u32(uint8_t *out, size_t value) {
+	out[0] = (uint8_t)(value >> 24);
+	out[1] = (uint8_t)(value >> 16);
+	out[2] = (uint8_t)(value >> 8);
+	out[3] = (uint8_t)value;
+}
+
+static size_t store_get_u32(const uint8_t *in) {
+	return ((size_t)in[0] << 24) | ((size_t)in[1] << 16) | ((size_t)in[2] << 8) | (size_t)in[3];
+}
+
+/*
+ * Encode the changes from prev to next (both len bytes) as a delta body.
+ * With out == NULL only the length of the body is computed.
+ */
+static size_t store_delta_encode(uint8_t *out, const uint8_t *prev, const uint8_t *next, size_t len) {
+	size_t out_len = 4;
+	size_t i = 0;
+
+	if (out != NULL) {
+		store_put_u32(out, len);
+	}
+	while (i < len) {
+		if (prev[i] == next[i]) {
+			i++;
+			continue;
+		}
+		size_t start = i, end = i + 1, gap = 0;
+		for (size_t j = end; j < len && gap <= STORE_DELTA_MAX_GAP; j++) {
+			if (prev[j] != next[j]) {
+				end = j + 1;
+				gap = 0;
+			} else {
+				gap++;
+			}
+		}
+		if (out != NULL) {
+			store_put_u32(out + out_len, start);
+			store_put_u32(out + out_len + 4, end - start);
+			memcpy(out + out_len + STORE_DELTA_RUN_HEADER_LEN, next + start, end - start);
+		}
+		out_len += STORE_DELTA_RUN_HEADER_LEN + end - start;
+		i = end;
+	}
+	return out_len;
+}
+
+static void store_log_set_image(stfl_store_log *log, uint8_t *image, size_t image_len) {
+	OQS_MEM_secure_free(log->image, log->image_len);
+	log->image = image;
+	log->image_len = image == NULL ? 0 : image_len;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_SECRET_KEY_SET_delta_store(OQS_SIG_STFL_SECRET_KEY *sk, unsigned int compact_interval) {
+	stfl_store_log *log;
+
+	if (sk == NULL) {
+		return OQS_ERROR;
+	}
+	log = sk->store_log;
+	if (compact_interval == 0) {
+		if (log != NULL) {
+			store_log_set_image(log, NULL, 0);
+			OQS_MEM_insecure_free(log);
+			sk->store_log = NULL;
+		}
+		return OQS_SUCCESS;
+	}
+	if (log == NULL) {
+		log = OQS_MEM_calloc(1, sizeof(stfl_store_log));
+		if (log == NULL) {
+			return OQS_ERROR;
+		}
+		sk->store_log = log;
+	}
+	log->compact_interval = compact_interval;
+	return OQS_SUCCESS;
+}
+
+OQS_STATUS OQS_SIG_STFL_SECRET_KEY_store(OQS_SIG_STFL_SECRET_KEY *sk, uint8_t *sk_buf, size_t sk_buf_len) {
+	stfl_store_log *log;
+	uint8_t *record, *image;
+	size_t body_len = 0, record_len;
+	int snapshot;
+	OQS_STATUS status;
+
+	if (sk == NULL || sk_buf == NULL || sk->secure_store_scrt_key == NULL) {
+		return OQS_ERROR;
+	}
+	log = sk->store_log;
+	if (log == NULL) {
+		return sk->secure_store_scrt_key(sk_buf, sk_buf_len, sk->context);
+	}
+	if (sk_buf_len == 0 || sk_buf_len > 0xFFFFFFFFu - STORE_RECORD_HEADER_LEN) {
+		return OQS_ERROR;
+	}
+
+	snapshot = log->image == NULL || log->image_len != sk_buf_len || log->deltas >= log->compact_interval;
+	if (!snapshot) {
+		body_len = store_delta_encode(NULL, log->image, sk_buf, sk_buf_len);
+		snapshot = body_len >= sk_buf_len;
+	}
+	if (snapshot) {
+		body_len = sk_buf_len;
+	}
+
+	record_len = STORE_RECORD_HEADER_LEN + body_len;
+	record = OQS_MEM_malloc(record_len);
+	if (record == NULL) {
+		return OQS_ERROR;
+	}
+	record[0] = snapshot ? OQS_SIG_STFL_STORE_RECORD_SNAPSHOT : OQS_SIG_STFL_STORE_RECORD_DELTA;
+	store_put_u32(record + 1, body_len);
+	if (snapshot) {
+		memcpy(record + STORE_RECORD_HEADER_LEN, sk_buf, sk_buf_len);
+	} else {
+		store_delta_encode(record + STORE_RECORD_HEADER_LEN, log->image, sk_buf, sk_buf_len);
+	}
+
+	status = sk->secure_store_scrt_key(record, record_len, sk->context);
+	OQS_MEM_secure_free(record, record_len);
+	if (status != OQS_SUCCESS) {
+		return status;
+	}
+
+	/* Remember what the log now holds; without an image the next record is a snapshot. */
+	if (log->image_len == sk_buf_len) {
+		memcpy(log->image, sk_buf, sk_buf_len);
+	} else {
+		image = OQS_MEM_malloc(sk_buf_len);
+		if (image != NULL) {
+			memcpy(image, sk_buf, sk_buf_len);
+		}
+		store_log_set_image(log, image, sk_buf_len);
+	}
+	log->deltas = snapshot ? 0 : log->deltas + 1;
+	return OQS_SUCCESS;
+}
+
+OQS_API OQS_STATUS OQS_SIG_STFL_SECRET_KEY_replay(OQS_SIG_STFL_SECRET_KEY *sk, const uint8_t *log, size_t log_len, void *context) {
+	uint8_t *image = NULL;
+	size_t image_len = 0, pos = 0;
+	unsigned int deltas = 0;
+	stfl_store_log *store_log;
+	OQS_STATUS status = OQS_ERROR;
+
+	if (sk == NULL || log == NULL || sk->deserialize_key == NULL) {
+		return OQS_ERROR;
+	}
+
+	while (pos < log_len) {
+		if (log_len - pos < STORE_RECORD_HEADER_LEN) {
+			goto err;
+		}
+		const uint8_t type = log[pos];
+		const size_t body_len = store_get_u32(log + pos + 1);
+		const uint8_t *body = log + pos + STORE_RECORD_HEADER_LEN;
+		if (body_len > log_len - pos - STORE_RECORD_HEADER_LEN) {
+			goto err;
+		}
+
+		if (type == OQS_SIG_STFL_STORE_RECORD_SNAPSHOT) {
+			if (body_len == 0) {
+				goto err;
+			}
+			if (body_len != image_len) {
+				OQS_MEM_secure_free(image, image_len);
+				image_len = 0;
+				image = OQS_MEM_malloc(body_len);
+				if (image == NULL) {
+					goto err;
+				}
+				image_len = body_len;
+			}
+			memcpy(image, body, body_len);
+			deltas = 0;
+		} else if (type == OQS_SIG_STFL_STORE_RECORD_DELTA) {
+			if (image == NULL || body_len < 4 || store_get_u32(body) != image_len) {
+				goto err;
+			}
+			for (size_t off = 4; off < body_len;) {
+				if (body_len - off < STORE_DELTA_RUN_HEADER_LEN) {
+					goto err;
+				}
+				const size_t start = store_get_u32(body + off);
+				const size_t len = store_get_u32(body + off + 4);
+				off += STORE_DELTA_RUN_HEADER_LEN;
+				if (len > body_len - off || start > image_len || len > image_len - start) {
+					goto err;
+				}
+				memcpy(image + start, body + off, len);
+				off += len;
+			}
+			deltas++;
+		} else {
+			goto err;
+		}
+		pos += STORE_RECORD_HEADER_LEN + body_len;
+	}
+	if (image == NULL) {
+		goto err;
+	}
+
+	status = sk->deserialize_key(sk, image, image_len, context);
+	store_log = sk->store_log;
+	if (status == OQS_SUCCESS && store_log != NULL) {
+		/* Continue the log where it ended. */
+		store_log_set_image(store_log, image, image_len);
+		store_log->deltas = deltas;
+		return OQS_SUCCESS;
+	}
+
+err:
+	OQS_MEM_secure_free(image, image_len);
+	return status;
+}
+
 /*  OQS_SIG_STFL_SECRET_KEY_SET_lock callback function*/
 OQS_API void OQS_SIG_STFL_SECRET_KEY_SET_lock(OQS_SIG_STFL_SECRET_KEY *sk, lock_key lock) {
 	if (sk == NULL) {
@@ -1570,6 +1806,14 @@ OQS_API void OQS_SIG_STFL_SECRET_KEY_SET_mutex(OQS_SIG_STFL_SECRET_KEY *sk, void
 	sk->mutex = mutex;
 }
 
+/*  OQS_SIG_STFL_SECRET_KEY_SET_threadpool */
+OQS_API void OQS_SIG_STFL_SECRET_KEY_SET_threadpool(OQS_SIG_STFL_SECRET_KEY *sk, OQS_THREADPOOL *pool) {
+	if (sk == NULL) {
+		return;
+	}
+	sk->thread_pool = pool;
+}
+
 /* OQS_SIG_STFL_SECRET_KEY_lock  */
 OQS_STATUS OQS_SIG_STFL_SECRET_KEY_lock(OQS_SIG_STFL_SECRET_KEY *sk) {
 	if (sk == NULL) {
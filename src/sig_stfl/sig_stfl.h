@@ -145,6 +145,18 @@ typedef struct OQS_SIG_STFL_SECRET_KEY OQS_SIG_STFL_SECRET_KEY;
  */
 typedef OQS_STATUS (*secure_store_sk)(uint8_t *sk_buf, size_t buf_len, void *context);
 
+/**
+ * Record types passed to the store callback in delta store mode.
+ *
+ * Every record is `type (1 byte) || body_len (4 bytes, big-endian) || body`.
+ * A snapshot body is the full serialized secret key. A delta body is
+ * `key_len (4 bytes)` followed by runs of `offset (4 bytes) || len (4 bytes) || bytes`
+ * that patch the key produced by the preceding records. All integers are big-endian.
+ */
+#define OQS_SIG_STFL_STORE_RECORD_SNAPSHOT 0x01
+/** Delta record, see OQS_SIG_STFL_STORE_RECORD_SNAPSHOT. */
+#define OQS_SIG_STFL_STORE_RECORD_DELTA 0x02
+
 /**
  * Application provided function to lock secret key object serialize access
  * @param[in] mutex pointer to mutex struct
@@ -411,6 +423,20 @@ typedef struct OQS_SIG_STFL_SECRET_KEY {
 	 * @return None.
 	 */
 	void (*set_scrt_key_store_cb)(OQS_SIG_STFL_SECRET_KEY *sk, secure_store_sk store_cb, void *context);
+
+	/**
+	 * Thread pool the scheme may split key generation and signing with this key across.
+	 * NULL, the default, selects the pool set with OQS_THREADPOOL_set_default, if any.
+	 * Set with OQS_SIG_STFL_SECRET_KEY_SET_threadpool.
+	 */
+	OQS_THREADPOOL *thread_pool;
+
+	/**
+	 * State of the delta store mode: the last key image handed to the store callback
+	 * and the compaction policy. NULL while every update stores the full key.
+	 * Managed by OQS_SIG_STFL_SECRET_KEY_SET_delta_store.
+	 */
+	void *store_log;
 } OQS_SIG_STFL_SECRET_KEY;
 
 /**
@@ -575,6 +601,20 @@ OQS_API void OQS_SIG_STFL_SECRET_KEY_SET_unlock(OQS_SIG_STFL_SECRET_KEY *sk, unl
  */
 OQS_API void OQS_SIG_STFL_SECRET_KEY_SET_mutex(OQS_SIG_STFL_SECRET_KEY *sk, void *mutex);
 
+/**
+ * Set the thread pool used for key generation and signing with a secret key.
+ *
+ * The pool's tasks only build Merkle (sub)trees; the generated keys and signatures are identical
+ * to the single-threaded ones. LMS uses the pool for key generation and signing, XMSS for key
+ * generation only. With neither this pool nor a default pool (see OQS_THREADPOOL_set_default),
+ * all work runs in the calling thread.
+ *
+ * @param[in] sk Pointer to the secret key; may be set before calling `OQS_SIG_STFL_keypair`.
+ * @param[in] pool The pool, which must outlive its use by `sk`; NULL selects the default pool.
+ * @return None.
+ */
+OQS_API void OQS_SIG_STFL_SECRET_KEY_SET_threadpool(OQS_SIG_STFL_SECRET_KEY *sk, OQS_THREADPOOL *pool);
+
 /**
  * Lock the secret key to ensure exclusive access in a concurrent environment.
  *
@@ -633,6 +673,56 @@ OQS_STATUS OQS_SIG_STFL_SECRET_KEY_unlock(OQS_SIG_STFL_SECRET_KEY *sk);
  */
 OQS_API void OQS_SIG_STFL_SECRET_KEY_SET_store_cb(OQS_SIG_STFL_SECRET_KEY *sk, secure_store_sk store_cb, void *context);
 
+/**
+ * Switch the store callback of a secret key to log records instead of full keys.
+ *
+ * By default every Signing operation hands the complete serialized key to the store callback.
+ * In delta store mode the callback receives a record instead (see OQS_SIG_STFL_STORE_RECORD_SNAPSHOT):
+ * a snapshot of the full key, or a delta holding only the bytes that changed since the previous
+ * record, such as the index and the updated tree nodes. The application appends the records to
+ * a log and rebuilds the key with OQS_SIG_STFL_SECRET_KEY_replay.
+ *
+ * The first record is always a snapshot. After `compact_interval` consecutive deltas, or whenever a
+ * delta would not be smaller than the key, a snapshot is written again. Records before a snapshot
+ * are no longer needed, so the application may start a new log at every snapshot.
+ *
+ * @param[in] sk Pointer to the secret key.
+ * @param[in] compact_interval Maximum number of delta records between two snapshots; 0 turns delta
+ *                             store mode off and restores full-key storage.
+ * @return OQS_SUCCESS on success, or OQS_ERROR if the delta state could not be allocated.
+ *
+ * @attention Each record must be persisted atomically: replay rejects a log ending in a truncated record.
+ */
+OQS_API OQS_STATUS OQS_SIG_STFL_SECRET_KEY_SET_delta_store(OQS_SIG_STFL_SECRET_KEY *sk, unsigned int compact_interval);
+
+/**
+ * Rebuild a secret key from a log of store records.
+ *
+ * Applies the records written in delta store mode, in order, starting from a snapshot, and
+ * deserializes the resulting key into `sk` as OQS_SIG_STFL_SECRET_KEY_deserialize does.
+ * If `sk` is itself in delta store mode, the next record it writes is a delta against the replayed key.
+ *
+ * @param[out] sk Pointer to the secret key object to populate.
+ * @param[in] log The concatenated records.
+ * @param[in] log_len Length of `log` in bytes.
+ * @param[in] context Application-specific data used to maintain context about the secret key.
+ * @return OQS_SUCCESS on success; OQS_ERROR if the log is empty, malformed or truncated, or does not start with a snapshot.
+ */
+OQS_API OQS_STATUS OQS_SIG_STFL_SECRET_KEY_replay(OQS_SIG_STFL_SECRET_KEY *sk, const uint8_t *log, size_t log_len, void *context);
+
+/**
+ * Pass an updated serialized secret key to the store callback of `sk`.
+ *
+ * Used by the stateful schemes after every Signing operation. The buffer is handed to the
+ * callback unchanged, or turned into a log record first when delta store mode is on.
+ *
+ * @param[in] sk Pointer to the secret key whose store callback is invoked.
+ * @param[in] sk_buf The serialized secret key.
+ * @param[in] sk_buf_len Length of `sk_buf` in bytes.
+ * @return The status returned by the store callback, or OQS_ERROR if no callback is set.
+ */
+OQS_STATUS OQS_SIG_STFL_SECRET_KEY_store(OQS_SIG_STFL_SECRET_KEY *sk, uint8_t *sk_buf, size_t sk_buf_len);
+
 /**
  * Serialize the stateful secret key data into a byte array.
  *
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: (Apache-2.0 OR MIT) AND CC0-1.0
 #include <oqs/sha2.h>
 #include <oqs/sha3.h>
+#include <oqs/sha3x4.h>
 #include "core_hash.h"
 #include <string.h>
 
@@ -37,3 +38,44 @@ int core_hash(const xmss_params *params,
 
 	return 0;
 }
+
+int core_hash_x4(const xmss_params *params,
+                 unsigned char *const out[4],
+                 const unsigned char *const in[4], unsigned long long inlen) {
+
+	(void)params;
+#if HASH == XMSS_CORE_HASH_SHA256_N24
+	unsigned char buf[4][32];
+	int j;
+	OQS_SHA2_sha256_x4(buf[0], buf[1], buf[2], buf[3], in[0], in[1], in[2], in[3], inlen);
+	for (j = 0; j < 4; j++) {
+		memcpy(out[j], buf[j], 24);
+	}
+
+#elif HASH == XMSS_CORE_HASH_SHAKE256_N24
+	OQS_SHA3_shake256_x4(out[0], out[1], out[2], out[3], 24, in[0], in[1], in[2], in[3], inlen);
+
+#elif HASH == XMSS_CORE_HASH_SHA256_N32
+	OQS_SHA2_sha256_x4(out[0], out[1], out[2], out[3], in[0], in[1], in[2], in[3], inlen);
+
+#elif HASH == XMSS_CORE_HASH_SHAKE128_N32
+	OQS_SHA3_shake128_x4(out[0], out[1], out[2], out[3], 32, in[0], in[1], in[2], in[3], inlen);
+
+#elif HASH == XMSS_CORE_HASH_SHAKE256_N32
+	OQS_SHA3_shake256_x4(out[0], out[1], out[2], out[3], 32, in[0], in[1], in[2], in[3], inlen);
+
+#elif HASH == XMSS_CORE_HASH_SHA512_N64
+	/* There is no multi-lane SHA-512; hash the lanes one after another. */
+	int j;
+	for (j = 0; j < 4; j++) {
+		OQS_SHA2_sha512(out[j], in[j], inlen);
+	}
+
+#elif HASH == XMSS_CORE_HASH_SHAKE256_N64
+	OQS_SHA3_shake256_x4(out[0], out[1], out[2], out[3], 64, in[0], in[1], in[2], in[3], inlen);
+#else
+	return -1;
+#endif
+
+	return 0;
+}
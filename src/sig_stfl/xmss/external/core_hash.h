@@ -21,4 +21,13 @@ int core_hash(const xmss_params *params,
               unsigned char *out,
               const unsigned char *in, unsigned long long inlen);
 
+/*
+ * Hashes four equal-length inputs at once; out[j] receives the same value as
+ * core_hash(params, out[j], in[j], inlen).
+ */
+#define core_hash_x4 XMSS_PARAMS_INNER_CORE_HASH(core_hash_x4)
+int core_hash_x4(const xmss_params *params,
+                 unsigned char *const out[4],
+                 const unsigned char *const in[4], unsigned long long inlen);
+
 #endif
@@ -152,3 +152,155 @@ int thash_f(const xmss_params *params,
 
     return ret;
 }
+
+/*
+ * Four-lane variant of prf(): computes PRF(key, in[j]) for j = 0..3.
+ * buf has to hold 4 * (padding_len + n + 32) bytes.
+ */
+static int prf_x4(const xmss_params *params,
+                  unsigned char *const out[4], unsigned char in[4][32],
+                  const unsigned char *key,
+                  unsigned char *buf)
+{
+    const unsigned int inlen = params->padding_len + params->n + 32;
+    const unsigned char *lanes[4];
+    unsigned int j;
+
+    for (j = 0; j < 4; j++) {
+        unsigned char *lane = buf + j*inlen;
+        ull_to_bytes(lane, params->padding_len, XMSS_HASH_PADDING_PRF);
+        memcpy(lane + params->padding_len, key, params->n);
+        memcpy(lane + params->padding_len + params->n, in[j], 32);
+        lanes[j] = lane;
+    }
+
+    return core_hash_x4(params, out, lanes, inlen);
+}
+
+/*
+ * Four-lane variant of prf_keygen(): computes PRF_keygen(key, in[j]) for
+ * j = 0..3. buf has to hold 4 * (padding_len + 2*n + 32) bytes.
+ */
+int prf_keygen_x4(const xmss_params *params,
+                  unsigned char *const out[4], const unsigned char *const in[4],
+                  const unsigned char *key,
+                  unsigned char *buf)
+{
+    const unsigned int inlen = params->padding_len + 2*params->n + 32;
+    const unsigned char *lanes[4];
+    unsigned int j;
+
+    for (j = 0; j < 4; j++) {
+        unsigned char *lane = buf + j*inlen;
+        ull_to_bytes(lane, params->padding_len, XMSS_HASH_PADDING_PRF_KEYGEN);
+        memcpy(lane + params->padding_len, key, params->n);
+        memcpy(lane + params->padding_len + params->n, in[j], params->n + 32);
+        lanes[j] = lane;
+    }
+
+    return core_hash_x4(params, out, lanes, inlen);
+}
+
+/**
+ * Four-lane variant of thash_h(); lane j hashes in[j] under addr[j].
+ */
+int thash_h_x4(const xmss_params *params,
+               unsigned char *const out[4], const unsigned char *const in[4],
+               const unsigned char *pub_seed, uint32_t addr[4][8],
+               unsigned char *buf)
+{
+    const unsigned int inlen = params->padding_len + 3 * params->n;
+    unsigned char *bitmask = buf + 4 * inlen;
+    unsigned char *prf_buf = bitmask + 4 * 2 * params->n;
+
+    unsigned char addr_as_bytes[4][32];
+    unsigned char *keys[4];
+    unsigned char *masks[4];
+    unsigned char *masks_hi[4];
+    const unsigned char *lanes[4];
+    unsigned int i, j;
+
+    for (j = 0; j < 4; j++) {
+        /* Set the function padding. */
+        ull_to_bytes(buf + j*inlen, params->padding_len, XMSS_HASH_PADDING_H);
+        keys[j] = buf + j*inlen + params->padding_len;
+        masks[j] = bitmask + j*2*params->n;
+        masks_hi[j] = masks[j] + params->n;
+        lanes[j] = buf + j*inlen;
+    }
+
+    /* Generate the n-byte keys. */
+    for (j = 0; j < 4; j++) {
+        set_key_and_mask(addr[j], 0);
+        addr_to_bytes(addr_as_bytes[j], addr[j]);
+    }
+    prf_x4(params, keys, addr_as_bytes, pub_seed, prf_buf);
+
+    /* Generate the 2n-byte masks. */
+    for (j = 0; j < 4; j++) {
+        set_key_and_mask(addr[j], 1);
+        addr_to_bytes(addr_as_bytes[j], addr[j]);
+    }
+    prf_x4(params, masks, addr_as_bytes, pub_seed, prf_buf);
+
+    for (j = 0; j < 4; j++) {
+        set_key_and_mask(addr[j], 2);
+        addr_to_bytes(addr_as_bytes[j], addr[j]);
+    }
+    prf_x4(params, masks_hi, addr_as_bytes, pub_seed, prf_buf);
+
+    for (j = 0; j < 4; j++) {
+        for (i = 0; i < 2 * params->n; i++) {
+            buf[j*inlen + params->padding_len + params->n + i] = in[j][i] ^ masks[j][i];
+        }
+    }
+    return core_hash_x4(params, out, lanes, inlen);
+}
+
+/**
+ * Four-lane variant of thash_f(); lane j hashes in[j] under addr[j].
+ */
+int thash_f_x4(const xmss_params *params,
+               unsigned char *const out[4], const unsigned char *const in[4],
+               const unsigned char *pub_seed, uint32_t addr[4][8],
+               unsigned char *buf)
+{
+    const unsigned int inlen = params->padding_len + 2 * params->n;
+    unsigned char *bitmask = buf + 4 * inlen;
+    unsigned char *prf_buf = bitmask + 4 * params->n;
+
+    unsigned char addr_as_bytes[4][32];
+    unsigned char *keys[4];
+    unsigned char *masks[4];
+    const unsigned char *lanes[4];
+    unsigned int i, j;
+
+    for (j = 0; j < 4; j++) {
+        /* Set the function padding. */
+        ull_to_bytes(buf + j*inlen, params->padding_len, XMSS_HASH_PADDING_F);
+        keys[j] = buf + j*inlen + params->padding_len;
+        masks[j] = bitmask + j*params->n;
+        lanes[j] = buf + j*inlen;
+    }
+
+    /* Generate the n-byte keys. */
+    for (j = 0; j < 4; j++) {
+        set_key_and_mask(addr[j], 0);
+        addr_to_bytes(addr_as_bytes[j], addr[j]);
+    }
+    prf_x4(params, keys, addr_as_bytes, pub_seed, prf_buf);
+
+    /* Generate the n-byte masks. */
+    for (j = 0; j < 4; j++) {
+        set_key_and_mask(addr[j], 1);
+        addr_to_bytes(addr_as_bytes[j], addr[j]);
+    }
+    prf_x4(params, masks, addr_as_bytes, pub_seed, prf_buf);
+
+    for (j = 0; j < 4; j++) {
+        for (i = 0; i < params->n; i++) {
+            buf[j*inlen + params->padding_len + params->n + i] = in[j][i] ^ masks[j][i];
+        }
+    }
+    return core_hash_x4(params, out, lanes, inlen);
+}
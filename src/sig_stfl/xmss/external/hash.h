@@ -21,6 +21,16 @@ int prf_keygen(const xmss_params *params,
         const unsigned char *key,
         unsigned char *buf);
 
+/*
+ * Four-lane variant of prf_keygen().
+ * buf has to hold 4 * (padding_len + 2*n + 32) bytes.
+ */
+#define prf_keygen_x4 XMSS_INNER_NAMESPACE(prf_keygen_x4)
+int prf_keygen_x4(const xmss_params *params,
+                  unsigned char *const out[4], const unsigned char *const in[4],
+                  const unsigned char *key,
+                  unsigned char *buf);
+
 #define h_msg XMSS_INNER_NAMESPACE(h_msg)
 int h_msg(const xmss_params *params,
           unsigned char *out,
@@ -39,6 +49,23 @@ int thash_f(const xmss_params *params,
             const unsigned char *pub_seed, uint32_t addr[8],
             unsigned char *buf);
 
+/*
+ * Four-lane variants of thash_h() and thash_f(): lane j computes the same
+ * value as the single-lane call on out[j], in[j] and addr[j].
+ * buf has to hold 4 * (2*padding_len + 6*n + 32) bytes.
+ */
+#define thash_h_x4 XMSS_INNER_NAMESPACE(thash_h_x4)
+int thash_h_x4(const xmss_params *params,
+               unsigned char *const out[4], const unsigned char *const in[4],
+               const unsigned char *pub_seed, uint32_t addr[4][8],
+               unsigned char *buf);
+
+#define thash_f_x4 XMSS_INNER_NAMESPACE(thash_f_x4)
+int thash_f_x4(const xmss_params *params,
+               unsigned char *const out[4], const unsigned char *const in[4],
+               const unsigned char *pub_seed, uint32_t addr[4][8],
+               unsigned char *buf);
+
 #define hash_message XMSS_INNER_NAMESPACE(hash_message)
 int hash_message(const xmss_params *params, unsigned char *out,
                  const unsigned char *R, const unsigned char *root,
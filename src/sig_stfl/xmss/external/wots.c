@@ -146,6 +146,59 @@ void wots_pkgen(const xmss_params *params,
     OQS_MEM_secure_free(buf, buf_size);
 }
 
+/**
+ * Four-lane variant of wots_pkgen(). Computes the WOTS public keys for the
+ * four addresses in addr under the same seed; pk[j] receives the same value as
+ * wots_pkgen(params, pk[j], seed, pub_seed, addr[j]).
+ */
+void wots_pkgen_x4(const xmss_params *params,
+                   unsigned char *const pk[4], const unsigned char *seed,
+                   const unsigned char *pub_seed, uint32_t addr[4][8])
+{
+    unsigned int i, j, k;
+    const unsigned int in_len = params->n + 32;
+    const size_t buf_size = 4 * (2 * params->padding_len + 6 * params->n + 64);
+    unsigned char *buf = OQS_MEM_malloc(buf_size);
+    unsigned char *out[4];
+    const unsigned char *in[4];
+    if (buf == NULL) {
+        return;
+    }
+
+    /* The WOTS+ private keys are derived from the seed, as in expand_seed. */
+    for (j = 0; j < 4; j++) {
+        set_hash_addr(addr[j], 0);
+        set_key_and_mask(addr[j], 0);
+        memcpy(buf + j*in_len, pub_seed, params->n);
+        in[j] = buf + j*in_len;
+    }
+    for (i = 0; i < params->wots_len; i++) {
+        for (j = 0; j < 4; j++) {
+            set_chain_addr(addr[j], i);
+            addr_to_bytes(buf + j*in_len + params->n, addr[j]);
+            out[j] = pk[j] + i*params->n;
+        }
+        prf_keygen_x4(params, out, in, seed, buf + 4*in_len);
+    }
+
+    /* Every chain runs from 0 to w - 1, so the lanes stay in lockstep. */
+    for (i = 0; i < params->wots_len; i++) {
+        for (j = 0; j < 4; j++) {
+            set_chain_addr(addr[j], i);
+            out[j] = pk[j] + i*params->n;
+            in[j] = out[j];
+        }
+        for (k = 0; k < params->wots_w - 1; k++) {
+            for (j = 0; j < 4; j++) {
+                set_hash_addr(addr[j], k);
+            }
+            thash_f_x4(params, out, in, pub_seed, addr, buf);
+        }
+    }
+
+    OQS_MEM_secure_free(buf, buf_size);
+}
+
 /**
  * Takes a n-byte message and the 32-byte seed for the private key to compute a
  * signature that is placed at 'sig'.
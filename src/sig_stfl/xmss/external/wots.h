@@ -18,6 +18,15 @@ void wots_pkgen(const xmss_params *params,
                 unsigned char *pk, const unsigned char *seed,
                 const unsigned char *pub_seed, uint32_t addr[8]);
 
+/**
+ * Four-lane variant of wots_pkgen(): pk[j] receives the public key for
+ * addr[j]. Used to generate four leaves at a time during key generation.
+ */
+#define wots_pkgen_x4 XMSS_INNER_NAMESPACE(wots_pkgen_x4)
+void wots_pkgen_x4(const xmss_params *params,
+                   unsigned char *const pk[4], const unsigned char *seed,
+                   const unsigned char *pub_seed, uint32_t addr[4][8]);
+
 /**
  * Takes a n-byte message and the 32-byte seed for the private key to compute a
  * signature that is placed at 'sig'.
@@ -28,17 +28,21 @@ it falls back to the regular XMSS core functions. */
  * @param oid The `oid` parameter is an identifier for the XMSS variant to be used. It is used to
  * determine the parameters for the XMSS algorithm, such as the tree height and the number of signature
  * iterations. The `oid` value is typically encoded as a 32-bit integer
+ * @param pool Thread pool used to compute the tree leaves; NULL runs single-threaded.
+ * The generated key pair does not depend on the pool.
  * 
  * @return an integer value. If the function executes successfully, it will return 0. If there is an
  * error, it will return -1.
  */
 #ifndef OQS_ALLOW_XMSS_KEY_AND_SIG_GEN
-int xmss_keypair(XMSS_UNUSED_ATT unsigned char *pk, XMSS_UNUSED_ATT unsigned char *sk, XMSS_UNUSED_ATT const uint32_t oid)
+int xmss_keypair(XMSS_UNUSED_ATT unsigned char *pk, XMSS_UNUSED_ATT unsigned char *sk, XMSS_UNUSED_ATT const uint32_t oid,
+                 XMSS_UNUSED_ATT struct OQS_THREADPOOL *pool)
 {
     return -1;
 }
 #else
-int xmss_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid)
+int xmss_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid,
+                 struct OQS_THREADPOOL *pool)
 {
     xmss_params params;
     unsigned int i;
@@ -53,7 +57,7 @@ int xmss_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid)
         i.e. not just for interoperability, but also for internal use. */
         sk[XMSS_OID_LEN - i - 1] = (oid >> (8 * i)) & 0xFF;
     }
-    return xmss_core_keypair(&params, pk + XMSS_OID_LEN, sk + XMSS_OID_LEN);
+    return xmss_core_keypair(&params, pk + XMSS_OID_LEN, sk + XMSS_OID_LEN, pool);
 }
 #endif
 
@@ -194,7 +198,8 @@ int xmss_total_signatures(unsigned long long *max, const unsigned  char *sk)
     return 0;
 }
 
-int xmssmt_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid)
+int xmssmt_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid,
+                   struct OQS_THREADPOOL *pool)
 {
     xmss_params params;
     unsigned int i;
@@ -206,7 +211,7 @@ int xmssmt_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid)
         pk[XMSS_OID_LEN - i - 1] = (oid >> (8 * i)) & 0xFF;
         sk[XMSS_OID_LEN - i - 1] = (oid >> (8 * i)) & 0xFF;
     }
-    return xmssmt_core_keypair(&params, pk + XMSS_OID_LEN, sk + XMSS_OID_LEN);
+    return xmssmt_core_keypair(&params, pk + XMSS_OID_LEN, sk + XMSS_OID_LEN, pool);
 }
 
 int xmssmt_sign(unsigned char *sk,
@@ -5,13 +5,18 @@
 #include <stdint.h>
 #include "namespace.h"
 
+struct OQS_THREADPOOL;
+
 /**
  * Generates a XMSS key pair for a given parameter set.
  * Format sk: [OID || (32bit) idx || SK_SEED || SK_PRF || PUB_SEED || root]
  * Format pk: [OID || root || PUB_SEED]
+ * The tree leaves are computed on pool (see oqs/common.h), or in the calling
+ * thread if it is NULL; the key does not depend on the pool.
  */
 #define xmss_keypair XMSS_NAMESPACE(xmss_keypair)
-int xmss_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid);
+int xmss_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid,
+                 struct OQS_THREADPOOL *pool);
 
 /**
  * Signs a message using an XMSS secret key.
@@ -52,9 +57,12 @@ int xmss_total_signatures(unsigned long long *max, const unsigned  char *sk);
  * Generates a XMSSMT key pair for a given parameter set.
  * Format sk: [OID || (ceil(h/8) bit) idx || SK_SEED || SK_PRF || PUB_SEED || root]
  * Format pk: [OID || root || PUB_SEED]
+ * The tree leaves are computed on pool (see oqs/common.h), or in the calling
+ * thread if it is NULL; the key does not depend on the pool.
  */
 #define xmssmt_keypair XMSS_NAMESPACE(xmssmt_keypair)
-int xmssmt_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid);
+int xmssmt_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid,
+                   struct OQS_THREADPOOL *pool);
 
 /**
  * Signs a message using an XMSSMT secret key.
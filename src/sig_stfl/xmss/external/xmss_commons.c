@@ -50,6 +50,57 @@ static void l_tree(const xmss_params *params,
     memcpy(leaf, wots_pk, params->n);
 }
 
+/**
+ * Four-lane variant of l_tree(). All lanes share the same tree shape, so
+ * only the L-tree addresses differ.
+ */
+static void l_tree_x4(const xmss_params *params,
+                      unsigned char *leaf, unsigned char *const wots_pk[4],
+                      const unsigned char *pub_seed, uint32_t addr[4][8],
+                      unsigned char *thash_buf)
+{
+    unsigned int l = params->wots_len;
+    unsigned int parent_nodes;
+    unsigned char *out[4];
+    const unsigned char *in[4];
+    uint32_t i;
+    uint32_t height = 0;
+    unsigned int j;
+
+    for (j = 0; j < 4; j++) {
+        set_tree_height(addr[j], height);
+    }
+
+    while (l > 1) {
+        parent_nodes = l >> 1;
+        for (i = 0; i < parent_nodes; i++) {
+            for (j = 0; j < 4; j++) {
+                set_tree_index(addr[j], i);
+                out[j] = wots_pk[j] + i*params->n;
+                in[j] = wots_pk[j] + (i*2)*params->n;
+            }
+            thash_h_x4(params, out, in, pub_seed, addr, thash_buf);
+        }
+        if (l & 1) {
+            for (j = 0; j < 4; j++) {
+                memcpy(wots_pk[j] + (l >> 1)*params->n,
+                       wots_pk[j] + (l - 1)*params->n, params->n);
+            }
+            l = (l >> 1) + 1;
+        }
+        else {
+            l = l >> 1;
+        }
+        height++;
+        for (j = 0; j < 4; j++) {
+            set_tree_height(addr[j], height);
+        }
+    }
+    for (j = 0; j < 4; j++) {
+        memcpy(leaf + j*params->n, wots_pk[j], params->n);
+    }
+}
+
 /**
  * Computes a root node given a leaf and an auth path
  */
@@ -122,6 +173,32 @@ void gen_leaf_wots(const xmss_params *params, unsigned char *leaf,
     OQS_MEM_insecure_free(pk);
 }
 
+/**
+ * Four-lane variant of gen_leaf_wots(): writes the four leaves for
+ * ltree_addr[j] / ots_addr[j] to leaf + j*n.
+ */
+void gen_leaf_wots_x4(const xmss_params *params, unsigned char *leaf,
+                      const unsigned char *sk_seed, const unsigned char *pub_seed,
+                      uint32_t ltree_addr[4][8], uint32_t ots_addr[4][8])
+{
+    unsigned char *buf = OQS_MEM_malloc(4 * params->wots_sig_bytes + 4 * (2 * params->padding_len + 6 * params->n + 32));
+    unsigned char *pk[4];
+    unsigned int j;
+    if (buf == NULL) {
+        return;
+    }
+    unsigned char *thash_buf = buf + 4 * params->wots_sig_bytes;
+
+    for (j = 0; j < 4; j++) {
+        pk[j] = buf + j * params->wots_sig_bytes;
+    }
+
+    wots_pkgen_x4(params, pk, sk_seed, pub_seed, ots_addr);
+
+    l_tree_x4(params, leaf, pk, pub_seed, ltree_addr, thash_buf);
+
+    OQS_MEM_insecure_free(buf);
+}
 
 /**
  * Verifies a given message signature pair under a given public key.
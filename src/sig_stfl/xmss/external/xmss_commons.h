@@ -15,6 +15,15 @@ void gen_leaf_wots(const xmss_params *params, unsigned char *leaf,
                    const unsigned char *sk_seed, const unsigned char *pub_seed,
                    uint32_t ltree_addr[8], uint32_t ots_addr[8]);
 
+/**
+ * Computes four leaves at once; leaf j is written to leaf + j*n and is the
+ * same as gen_leaf_wots() for ltree_addr[j] and ots_addr[j].
+ */
+#define gen_leaf_wots_x4 XMSS_INNER_NAMESPACE(gen_leaf_wots_x4)
+void gen_leaf_wots_x4(const xmss_params *params, unsigned char *leaf,
+                      const unsigned char *sk_seed, const unsigned char *pub_seed,
+                      uint32_t ltree_addr[4][8], uint32_t ots_addr[4][8]);
+
 /**
  * Verifies a given message signature pair under a given public key.
  * Note that this assumes a pk without an OID, i.e. [root || PUB_SEED]
@@ -4,6 +4,8 @@
 
 #include "params.h"
 
+struct OQS_THREADPOOL;
+
 /**
  * Given a set of parameters, this function returns the size of the secret key.
  * This is implementation specific, as varying choices in tree traversal will
@@ -18,10 +20,12 @@ unsigned long long xmss_xmssmt_core_sk_bytes(const xmss_params *params);
  * Generates a XMSS key pair for a given parameter set.
  * Format sk: [(32bit) index || SK_SEED || SK_PRF || PUB_SEED || root]
  * Format pk: [root || PUB_SEED], omitting algorithm OID.
+ * Leaves are computed on pool, or serially if it is NULL.
  */
 #define xmss_core_keypair XMSS_INNER_NAMESPACE(xmss_core_keypair)
 int xmss_core_keypair(const xmss_params *params,
-                      unsigned char *pk, unsigned char *sk);
+                      unsigned char *pk, unsigned char *sk,
+                      struct OQS_THREADPOOL *pool);
 
 /**
  * Signs a message. Returns an array containing the signature followed by the
@@ -47,10 +51,12 @@ int xmss_core_sign_open(const xmss_params *params,
  * Generates a XMSSMT key pair for a given parameter set.
  * Format sk: [(ceil(h/8) bit) index || SK_SEED || SK_PRF || PUB_SEED || root]
  * Format pk: [root || PUB_SEED] omitting algorithm OID.
+ * Leaves are computed on pool, or serially if it is NULL.
  */
 #define xmssmt_core_keypair XMSS_INNER_NAMESPACE(xmssmt_core_keypair)
 int xmssmt_core_keypair(const xmss_params *params,
-                        unsigned char *pk, unsigned char *sk);
+                        unsigned char *pk, unsigned char *sk,
+                        struct OQS_THREADPOOL *pool);
 
 /*
  * Derives a XMSSMT key pair for a given parameter set.
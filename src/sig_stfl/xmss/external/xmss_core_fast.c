@@ -3,6 +3,7 @@
 #include <string.h>
 #include <stdint.h>
 #include <oqs/rand.h>
+#include <oqs/common.h>
 
 #include "hash.h"
 #include "hash_address.h"
@@ -215,39 +216,123 @@ static int treehash_minheight_on_stack(const xmss_params *params,
     return r;
 }
 
+/* Number of leaves computed by one pool task; a multiple of four. */
+#define XMSS_LEAF_BATCH 256
+/* Upper bound on the pool tasks in one batch of leaves. */
+#define XMSS_MAX_THREADS 64
+
+typedef struct {
+    const xmss_params *params;
+    unsigned char *leaves;
+    uint32_t first;
+    uint32_t count;
+    const unsigned char *sk_seed;
+    const unsigned char *pub_seed;
+    const uint32_t *addr;
+} leaf_job;
+
+/*
+ * Computes the leaves first .. first+count-1 of the subtree at addr into
+ * job->leaves, four at a time where possible.
+ */
+static void gen_leaf_range(const leaf_job *job)
+{
+    const xmss_params *params = job->params;
+    uint32_t ots_addr[4][8];
+    uint32_t ltree_addr[4][8];
+    uint32_t j = 0;
+    unsigned int l;
+
+    for (l = 0; l < 4; l++) {
+        memset(ots_addr[l], 0, sizeof(ots_addr[l]));
+        memset(ltree_addr[l], 0, sizeof(ltree_addr[l]));
+        // only copy layer and tree address parts
+        copy_subtree_addr(ots_addr[l], job->addr);
+        set_type(ots_addr[l], 0);
+        copy_subtree_addr(ltree_addr[l], job->addr);
+        set_type(ltree_addr[l], 1);
+    }
+
+    for (; j + 4 <= job->count; j += 4) {
+        for (l = 0; l < 4; l++) {
+            set_ltree_addr(ltree_addr[l], job->first + j + l);
+            set_ots_addr(ots_addr[l], job->first + j + l);
+        }
+        gen_leaf_wots_x4(params, job->leaves + j*params->n, job->sk_seed, job->pub_seed, ltree_addr, ots_addr);
+    }
+    for (; j < job->count; j++) {
+        set_ltree_addr(ltree_addr[0], job->first + j);
+        set_ots_addr(ots_addr[0], job->first + j);
+        gen_leaf_wots(params, job->leaves + j*params->n, job->sk_seed, job->pub_seed, ltree_addr[0], ots_addr[0]);
+    }
+}
+
+/* Computes the index-th block of XMSS_LEAF_BATCH leaves of a leaf_job. */
+static void gen_leaf_block(void *arg, size_t index)
+{
+    leaf_job job = *(const leaf_job *)arg;
+    uint32_t offset = (uint32_t)index * XMSS_LEAF_BATCH;
+
+    job.leaves += offset*job.params->n;
+    job.first += offset;
+    job.count = job.count - offset < XMSS_LEAF_BATCH ? job.count - offset : XMSS_LEAF_BATCH;
+    gen_leaf_range(&job);
+}
+
+/*
+ * Computes count consecutive leaves starting at first. The leaves are
+ * independent, so the range is handed to pool as one task per block of
+ * XMSS_LEAF_BATCH leaves; the output does not depend on the split.
+ */
+static void gen_leaves(const xmss_params *params, unsigned char *leaves,
+                       uint32_t first, uint32_t count,
+                       const unsigned char *sk_seed, const unsigned char *pub_seed,
+                       const uint32_t addr[8], OQS_THREADPOOL *pool)
+{
+    leaf_job job = {params, leaves, first, count, sk_seed, pub_seed, addr};
+
+    if (count > XMSS_LEAF_BATCH) {
+        OQS_THREADPOOL_run(pool, gen_leaf_block, &job, (count + XMSS_LEAF_BATCH - 1) / XMSS_LEAF_BATCH);
+        return;
+    }
+    gen_leaf_range(&job);
+}
+
 /**
  * Merkle's TreeHash algorithm. The address only needs to initialize the first 78 bits of addr. Everything else will be set by treehash.
- * Currently only used for key generation.
+ * Currently only used for key generation. Leaves are generated ahead of the
+ * stack in batches of one XMSS_LEAF_BATCH block per pool thread, so the pool
+ * is dispatched to once per batch rather than once per block.
  *
  */
 static void treehash_init(const xmss_params *params,
                           unsigned char *node, int height, int index,
                           bds_state *state, const unsigned char *sk_seed,
-                          const unsigned char *pub_seed, const uint32_t addr[8])
+                          const unsigned char *pub_seed, const uint32_t addr[8],
+                          OQS_THREADPOOL *pool)
 {
-    // use three different addresses because at this point we use all three formats in parallel
-    uint32_t ots_addr[8] = {0};
-    uint32_t ltree_addr[8] = {0};
     uint32_t node_addr[8] = {0};
-    // only copy layer and tree address parts
-    copy_subtree_addr(ots_addr, addr);
-    // type = ots
-    set_type(ots_addr, 0);
-    copy_subtree_addr(ltree_addr, addr);
-    set_type(ltree_addr, 1);
     copy_subtree_addr(node_addr, addr);
     set_type(node_addr, 2);
 
     /* The subtree has at most 2^20 leafs, so uint32_t suffices. */
     uint32_t idx = index;
     uint32_t lastnode = index +(1<<height), i;
+    uint32_t batch_first = idx, batch_count = 0;
+    size_t batch_blocks = OQS_THREADPOOL_concurrency(pool);
+    if (batch_blocks > XMSS_MAX_THREADS) {
+        batch_blocks = XMSS_MAX_THREADS;
+    }
+    const uint32_t batch_size = (uint32_t)batch_blocks * XMSS_LEAF_BATCH;
     const size_t thash_buf_size = 2 * params->padding_len + 6 * params->n + 32;
     const size_t stack_size = ((height+1)*params->n)* sizeof(unsigned char);
+    const size_t leaves_size = batch_size * params->n;
     unsigned char *stack = OQS_MEM_calloc((height+1)*params->n, sizeof(unsigned char));
     unsigned int *stacklevels = OQS_MEM_malloc((height + 1)*sizeof(unsigned int));
     unsigned char *thash_buf = OQS_MEM_malloc(thash_buf_size);
+    unsigned char *leaves = OQS_MEM_malloc(leaves_size);
 
-    if (stack == NULL || stacklevels == NULL || thash_buf == NULL) {
+    if (stack == NULL || stacklevels == NULL || thash_buf == NULL || leaves == NULL) {
         return;
     }
 
@@ -262,9 +347,12 @@ static void treehash_init(const xmss_params *params,
 
     i = 0;
     for (; idx < lastnode; idx++) {
-        set_ltree_addr(ltree_addr, idx);
-        set_ots_addr(ots_addr, idx);
-        gen_leaf_wots(params, stack+stackoffset*params->n, sk_seed, pub_seed, ltree_addr, ots_addr);
+        if (idx == batch_first + batch_count) {
+            batch_first = idx;
+            batch_count = lastnode - idx < batch_size ? lastnode - idx : batch_size;
+            gen_leaves(params, leaves, batch_first, batch_count, sk_seed, pub_seed, addr, pool);
+        }
+        memcpy(stack+stackoffset*params->n, leaves + (idx - batch_first)*params->n, params->n);
         stacklevels[stackoffset] = 0;
         stackoffset++;
         if (params->tree_height - params->bds_k > 0 && i == 3) {
@@ -297,6 +385,7 @@ static void treehash_init(const xmss_params *params,
     OQS_MEM_insecure_free(stacklevels);
     OQS_MEM_secure_free(stack, stack_size);
     OQS_MEM_secure_free(thash_buf, thash_buf_size);
+    OQS_MEM_insecure_free(leaves);
 }
 
 static void treehash_update(const xmss_params *params,
@@ -582,7 +671,8 @@ unsigned long long xmss_xmssmt_core_sk_bytes(const xmss_params *params)
  * Format pk: [root || PUB_SEED] omitting algo oid.
  */
 int xmss_core_keypair(const xmss_params *params,
-                      unsigned char *pk, unsigned char *sk)
+                      unsigned char *pk, unsigned char *sk,
+                      struct OQS_THREADPOOL *pool)
 {
     uint32_t addr[8] = {0};
 
@@ -614,7 +704,7 @@ int xmss_core_keypair(const xmss_params *params,
     memcpy(pk + params->n, sk + params->index_bytes + 3*params->n, params->n);
 
     // Compute root
-    treehash_init(params, pk, params->tree_height, 0, &state, sk + params->index_bytes, sk + params->index_bytes + 3*params->n, addr);
+    treehash_init(params, pk, params->tree_height, 0, &state, sk + params->index_bytes, sk + params->index_bytes + 3*params->n, addr, pool);
     // copy root to sk
     memcpy(sk + params->index_bytes + 2*params->n, pk, params->n);
 
@@ -802,7 +892,8 @@ cleanup:
  * Format pk: [root || PUB_SEED] omitting algo oid.
  */
 int xmssmt_core_keypair(const xmss_params *params,
-                        unsigned char *pk, unsigned char *sk)
+                        unsigned char *pk, unsigned char *sk,
+                        struct OQS_THREADPOOL *pool)
 {
     uint32_t addr[8] = {0};
     unsigned int i;
@@ -844,12 +935,12 @@ int xmssmt_core_keypair(const xmss_params *params,
     // Set up state and compute wots signatures for all but topmost tree root
     for (i = 0; i < params->d - 1; i++) {
         // Compute seed for OTS key pair
-        treehash_init(params, pk, params->tree_height, 0, states + i, sk+params->index_bytes, pk+params->n, addr);
+        treehash_init(params, pk, params->tree_height, 0, states + i, sk+params->index_bytes, pk+params->n, addr, pool);
         set_layer_addr(addr, (i+1));
         wots_sign(params, wots_sigs + i*params->wots_sig_bytes, pk, sk + params->index_bytes, pk+params->n, addr);
     }
     // Address now points to the single tree on layer d-1
-    treehash_init(params, pk, params->tree_height, 0, states + i, sk+params->index_bytes, pk+params->n, addr);
+    treehash_init(params, pk, params->tree_height, 0, states + i, sk+params->index_bytes, pk+params->n, addr, pool);
     memcpy(sk + params->index_bytes + 2*params->n, pk, params->n);
 
     xmssmt_serialize_state(params, sk, states);
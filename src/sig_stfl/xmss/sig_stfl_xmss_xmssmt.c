@@ -60,7 +60,7 @@ OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmss##xmss_v##_keypair(XMSS_UNUSED_ATT uint8
                 return OQS_ERROR;\
         }\
 \
-        if (xmss##mt##_keypair(public_key, secret_key->secret_key_data, OQS_SIG_STFL_alg_xmss##xmss_v##_oid)) {\
+        if (xmss##mt##_keypair(public_key, secret_key->secret_key_data, OQS_SIG_STFL_alg_xmss##xmss_v##_oid, secret_key->thread_pool != NULL ? secret_key->thread_pool : OQS_THREADPOOL_get_default())) {\
                 return OQS_ERROR;\
         }\
 \
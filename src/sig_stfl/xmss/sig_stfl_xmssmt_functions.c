@@ -58,7 +58,7 @@ OQS_API OQS_STATUS OQS_SIG_STFL_alg_xmssmt_sign(uint8_t *signature, size_t *sign
 	}
 
 	// Store updated private key securely
-	status = secret_key->secure_store_scrt_key(sk_key_buf_ptr, sk_key_buf_len, secret_key->context);
+	status = OQS_SIG_STFL_SECRET_KEY_store(secret_key, sk_key_buf_ptr, sk_key_buf_len);
 	OQS_MEM_secure_free(sk_key_buf_ptr, sk_key_buf_len);
 
 err:
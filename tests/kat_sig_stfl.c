@@ -148,6 +148,96 @@ void fprint_l_str(FILE *fp, const char *S, const uint8_t *A, size_t L) {
 	fprintf(fp, "\n");
 }
 
+#ifdef OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+/* Bytes handed out by replay_randombytes, in order. */
+static uint8_t replay_buf[3 * 64];
+static size_t replay_len = 0;
+static size_t replay_pos = 0;
+
+static void replay_randombytes(uint8_t *random_array, size_t bytes_to_read) {
+	size_t avail = replay_len - replay_pos;
+	size_t n = bytes_to_read < avail ? bytes_to_read : avail;
+	memcpy(random_array, replay_buf + replay_pos, n);
+	memset(random_array + n, 0, bytes_to_read - n);
+	replay_pos += n;
+}
+
+/* XMSS parameter sets whose key pair is cheap enough to rebuild here. */
+static bool is_xmss_regen(const char *method_name) {
+	return (0 == strcmp(method_name, OQS_SIG_STFL_alg_xmss_sha256_h10))
+	       || (0 == strcmp(method_name, OQS_SIG_STFL_alg_xmss_sha512_h10))
+	       || (0 == strcmp(method_name, OQS_SIG_STFL_alg_xmss_shake128_h10))
+	       || (0 == strcmp(method_name, OQS_SIG_STFL_alg_xmss_shake256_h10))
+	       || (0 == strcmp(method_name, OQS_SIG_STFL_alg_xmss_sha256_h10_192))
+	       || (0 == strcmp(method_name, OQS_SIG_STFL_alg_xmss_shake256_h10_192))
+	       || (0 == strcmp(method_name, OQS_SIG_STFL_alg_xmss_shake256_h10_256))
+	       || (0 == strcmp(method_name, OQS_SIG_STFL_alg_xmssmt_sha256_h20_4))
+	       || (0 == strcmp(method_name, OQS_SIG_STFL_alg_xmssmt_shake128_h20_4));
+}
+
+/*
+ * XMSS key generation draws SK_SEED || SK_PRF and then PUB_SEED from the RNG.
+ * Feed it the seeds of the KAT secret key and check that it rebuilds exactly
+ * the KAT key pair, with and without worker threads.
+ */
+static OQS_STATUS xmss_keygen_replay(const OQS_SIG_STFL *sig, const uint8_t *pk_kat, const uint8_t *sk_kat) {
+	const size_t oid_len = 4;
+	const size_t n = (sig->length_public_key - oid_len) / 2;
+	const uint8_t *root = pk_kat + oid_len;
+	const uint8_t *pub_seed = root + n;
+	OQS_SIG_STFL_SECRET_KEY *sk = NULL;
+	uint8_t *pk = NULL;
+	size_t index_bytes;
+	OQS_THREADPOOL *pools[2] = {NULL, NULL};
+	OQS_STATUS ret = OQS_ERROR;
+
+	/* sk = [OID || idx || SK_SEED || SK_PRF || root || PUB_SEED || state] */
+	for (index_bytes = 1; index_bytes <= 8; index_bytes++) {
+		const uint8_t *seeds = sk_kat + oid_len + index_bytes;
+		if (!memcmp(seeds + 2 * n, root, n) && !memcmp(seeds + 3 * n, pub_seed, n)) {
+			break;
+		}
+	}
+	if (index_bytes > 8 || 3 * n > sizeof(replay_buf)) {
+		fprintf(stderr, "[kat_stfl_sig] %s ERROR: unexpected secret key layout\n", sig->method_name);
+		return OQS_ERROR;
+	}
+
+	pk = OQS_MEM_malloc(sig->length_public_key);
+	sk = OQS_SIG_STFL_SECRET_KEY_new(sig->method_name);
+	pools[1] = OQS_THREADPOOL_new(4);
+	if (pk == NULL || sk == NULL || pools[1] == NULL) {
+		goto cleanup;
+	}
+
+	OQS_randombytes_custom_algorithm(&replay_randombytes);
+	for (size_t i = 0; i < sizeof(pools) / sizeof(pools[0]); i++) {
+		memcpy(replay_buf, sk_kat + oid_len + index_bytes, 2 * n);
+		memcpy(replay_buf + 2 * n, pub_seed, n);
+		replay_len = 3 * n;
+		replay_pos = 0;
+
+		OQS_SIG_STFL_SECRET_KEY_SET_threadpool(sk, pools[i]);
+		if (OQS_SIG_STFL_keypair(sig, pk, sk) != OQS_SUCCESS) {
+			fprintf(stderr, "[kat_stfl_sig] %s ERROR: OQS_SIG_STFL_keypair failed!\n", sig->method_name);
+			goto cleanup;
+		}
+		if (memcmp(pk, pk_kat, sig->length_public_key) || memcmp(sk->secret_key_data, sk_kat, sig->length_secret_key)) {
+			fprintf(stderr, "[kat_stfl_sig] %s ERROR: key pair generated with %zu thread(s) differs from KAT\n", sig->method_name, OQS_THREADPOOL_concurrency(pools[i]));
+			goto cleanup;
+		}
+	}
+	ret = OQS_SUCCESS;
+
+cleanup:
+	OQS_randombytes_custom_algorithm(&OQS_randombytes_nist_kat);
+	OQS_MEM_insecure_free(pk);
+	OQS_SIG_STFL_SECRET_KEY_free(sk);
+	OQS_THREADPOOL_free(pools[1]);
+	return ret;
+}
+#endif
+
 OQS_STATUS sig_stfl_kat(const char *method_name, const char *katfile) {
 
 	uint8_t seed[48];
@@ -206,6 +296,12 @@ OQS_STATUS sig_stfl_kat(const char *method_name, const char *katfile) {
 		goto err;
 	}
 
+#ifdef OQS_ALLOW_STFL_KEY_AND_SIG_GEN
+	if (is_xmss_regen(method_name) && xmss_keygen_replay(sig, public_key, secret_key->secret_key_data) != OQS_SUCCESS) {
+		goto err;
+	}
+#endif
+
 	fh = stdout;
 
 	OQS_fprintBstr(fh, "pk = ", public_key, sig->length_public_key);
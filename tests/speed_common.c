@@ -19,6 +19,7 @@
 #include <oqs/aes.h>
 #include <oqs/sha2.h>
 #include <oqs/sha3.h>
+#include <oqs/sha3x4.h>
 
 static const uint8_t test_aes128_key[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f};
 static const uint8_t test_aes256_key[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f};
@@ -26,6 +27,7 @@ static const uint8_t test_aes256_key[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x
 static OQS_STATUS speed_aes128(uint64_t duration, size_t message_len) {
 	uint8_t *message = NULL;
 	uint8_t *ciphertext = NULL;
+	uint8_t nonce[12] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
 	void *schedule = NULL;
 
 	message = OQS_MEM_malloc(message_len);
@@ -49,6 +51,10 @@ static OQS_STATUS speed_aes128(uint64_t duration, size_t message_len) {
 	TIME_OPERATION_SECONDS(OQS_AES128_ECB_enc(message, message_len, test_aes128_key, ciphertext), "OQS_AES128_ECB_enc", duration);
 	OQS_AES128_free_schedule(schedule);
 
+	OQS_AES128_CTR_inc_init(test_aes128_key, &schedule);
+	TIME_OPERATION_SECONDS(OQS_AES128_CTR_inc_stream_iv(nonce, 12, schedule, ciphertext, message_len), "OQS_AES128_CTR_inc_stream_iv", duration);
+	OQS_AES128_free_schedule(schedule);
+
 	OQS_MEM_insecure_free(message);
 	OQS_MEM_insecure_free(ciphertext);
 
@@ -102,19 +108,30 @@ static OQS_STATUS speed_aes256(uint64_t duration, size_t message_len) {
 
 static OQS_STATUS speed_sha256(uint64_t duration, size_t message_len) {
 	uint8_t *message = NULL;
-	uint8_t output[32];
+	uint8_t output[8 * 32];
 
-	message = OQS_MEM_malloc(message_len);
+	// eight messages back to back for the multi-lane API
+	message = OQS_MEM_malloc(8 * message_len);
 	if (message == NULL) {
 		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
 		return OQS_ERROR;
 	}
 
-	OQS_randombytes(message, message_len);
+	OQS_randombytes(message, 8 * message_len);
 
 	// main SHA2-256 API
 	TIME_OPERATION_SECONDS(OQS_SHA2_sha256(output, message, message_len), "OQS_SHA2_sha256", duration);
 
+	// multi-lane SHA2-256 API; each operation hashes 4 or 8 messages
+	TIME_OPERATION_SECONDS(OQS_SHA2_sha256_x4(output, output + 32, output + 64, output + 96,
+	                       message, message + message_len, message + 2 * message_len, message + 3 * message_len, message_len),
+	                       "OQS_SHA2_sha256_x4", duration);
+	TIME_OPERATION_SECONDS(OQS_SHA2_sha256_x8(output, output + 32, output + 64, output + 96,
+	                       output + 128, output + 160, output + 192, output + 224,
+	                       message, message + message_len, message + 2 * message_len, message + 3 * message_len,
+	                       message + 4 * message_len, message + 5 * message_len, message + 6 * message_len, message + 7 * message_len, message_len),
+	                       "OQS_SHA2_sha256_x8", duration);
+
 	OQS_MEM_insecure_free(message);
 
 	return OQS_SUCCESS;
@@ -193,23 +210,34 @@ static OQS_STATUS speed_shake128(uint64_t duration, size_t message_len, size_t o
 	uint8_t *message = NULL;
 	uint8_t *output = NULL;
 
-	message = OQS_MEM_malloc(message_len);
+	// eight messages and outputs back to back for the parallel APIs
+	message = OQS_MEM_malloc(8 * message_len);
 	if (message == NULL) {
 		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
 		return OQS_ERROR;
 	}
-	output = OQS_MEM_malloc(output_len);
+	output = OQS_MEM_malloc(8 * output_len);
 	if (output == NULL) {
 		OQS_MEM_insecure_free(message);
 		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
 		return OQS_ERROR;
 	}
 
-	OQS_randombytes(message, message_len);
+	OQS_randombytes(message, 8 * message_len);
 
 	// main SHAKE-128 API
 	TIME_OPERATION_SECONDS(OQS_SHA3_shake128(output, output_len, message, message_len), "OQS_SHA3_shake128", duration);
 
+	// parallel SHAKE-128 APIs; each operation processes 4 or 8 messages
+	TIME_OPERATION_SECONDS(OQS_SHA3_shake128_x4(output, output + output_len, output + 2 * output_len, output + 3 * output_len, output_len,
+	                       message, message + message_len, message + 2 * message_len, message + 3 * message_len, message_len),
+	                       "OQS_SHA3_shake128_x4", duration);
+	TIME_OPERATION_SECONDS(OQS_SHA3_shake128_x8(output, output + output_len, output + 2 * output_len, output + 3 * output_len,
+	                       output + 4 * output_len, output + 5 * output_len, output + 6 * output_len, output + 7 * output_len, output_len,
+	                       message, message + message_len, message + 2 * message_len, message + 3 * message_len,
+	                       message + 4 * message_len, message + 5 * message_len, message + 6 * message_len, message + 7 * message_len, message_len),
+	                       "OQS_SHA3_shake128_x8", duration);
+
 	OQS_MEM_insecure_free(message);
 	OQS_MEM_insecure_free(output);
 
@@ -220,29 +248,65 @@ static OQS_STATUS speed_shake256(uint64_t duration, size_t message_len, size_t o
 	uint8_t *message = NULL;
 	uint8_t *output = NULL;
 
-	message = OQS_MEM_malloc(message_len);
+	// eight messages and outputs back to back for the parallel APIs
+	message = OQS_MEM_malloc(8 * message_len);
 	if (message == NULL) {
 		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
 		return OQS_ERROR;
 	}
-	output = OQS_MEM_malloc(output_len);
+	output = OQS_MEM_malloc(8 * output_len);
 	if (output == NULL) {
 		OQS_MEM_insecure_free(message);
 		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
 		return OQS_ERROR;
 	}
 
-	OQS_randombytes(message, message_len);
+	OQS_randombytes(message, 8 * message_len);
 
 	// main SHAKE-256 API
 	TIME_OPERATION_SECONDS(OQS_SHA3_shake256(output, output_len, message, message_len), "OQS_SHA3_shake256", duration);
 
+	// parallel SHAKE-256 APIs; each operation processes 4 or 8 messages
+	TIME_OPERATION_SECONDS(OQS_SHA3_shake256_x4(output, output + output_len, output + 2 * output_len, output + 3 * output_len, output_len,
+	                       message, message + message_len, message + 2 * message_len, message + 3 * message_len, message_len),
+	                       "OQS_SHA3_shake256_x4", duration);
+	TIME_OPERATION_SECONDS(OQS_SHA3_shake256_x8(output, output + output_len, output + 2 * output_len, output + 3 * output_len,
+	                       output + 4 * output_len, output + 5 * output_len, output + 6 * output_len, output + 7 * output_len, output_len,
+	                       message, message + message_len, message + 2 * message_len, message + 3 * message_len,
+	                       message + 4 * message_len, message + 5 * message_len, message + 6 * message_len, message + 7 * message_len, message_len),
+	                       "OQS_SHA3_shake256_x8", duration);
+
 	OQS_MEM_insecure_free(message);
 	OQS_MEM_insecure_free(output);
 
 	return OQS_SUCCESS;
 }
 
+static OQS_STATUS speed_randombytes(uint64_t duration, size_t output_len) {
+	uint8_t *output = OQS_MEM_malloc(output_len);
+	OQS_STATUS ret = OQS_SUCCESS;
+	if (output == NULL) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		return OQS_ERROR;
+	}
+
+	OQS_randombytes_switch_algorithm(OQS_RAND_alg_system);
+	TIME_OPERATION_SECONDS(OQS_randombytes(output, output_len), "OQS_randombytes (system)", duration);
+	if (OQS_randombytes_switch_algorithm(OQS_RAND_alg_buffered) != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_randombytes_switch_algorithm failed\n");
+		ret = OQS_ERROR;
+	} else {
+		TIME_OPERATION_SECONDS(OQS_randombytes(output, output_len), "OQS_randombytes (buffered)", duration);
+	}
+	if (OQS_randombytes_switch_algorithm(OQS_RAND_alg_openssl) == OQS_SUCCESS) {
+		TIME_OPERATION_SECONDS(OQS_randombytes(output, output_len), "OQS_randombytes (OpenSSL)", duration);
+	}
+	OQS_randombytes_switch_algorithm(OQS_RAND_alg_system);
+
+	OQS_MEM_secure_free(output, output_len);
+	return ret;
+}
+
 static OQS_STATUS printAlgs(void) {
 	printf("aes128\n");
 	printf("aes256\n");
@@ -252,6 +316,7 @@ static OQS_STATUS printAlgs(void) {
 	printf("sha3\n");
 	printf("shake128\n");
 	printf("shake256\n");
+	printf("randombytes\n");
 	return OQS_SUCCESS;
 }
 
@@ -386,6 +451,11 @@ int main(int argc, char **argv) {
 			if (rc != OQS_SUCCESS) {
 				ret = EXIT_FAILURE;
 			}
+		} else if (strcmp(single_alg, "randombytes") == 0) {
+			rc = speed_randombytes(duration, output_len);
+			if (rc != OQS_SUCCESS) {
+				ret = EXIT_FAILURE;
+			}
 		} else {
 			fprintf(stderr, "ERROR: Algorithm not recognized. Try --help for help or --algs for a list of algorithms\n");
 			return EXIT_FAILURE;
@@ -435,6 +505,11 @@ int main(int argc, char **argv) {
 			ret = EXIT_FAILURE;
 		}
 
+		rc = speed_randombytes(duration, output_len);
+		if (rc != OQS_SUCCESS) {
+			ret = EXIT_FAILURE;
+		}
+
 	}
 	PRINT_TIMER_FOOTER
 
@@ -33,14 +33,23 @@ static void fullcycletest(OQS_KEM *kem, uint8_t *public_key, uint8_t *secret_key
 
 }
 
-static OQS_STATUS kem_speed_wrapper(const char *method_name, uint64_t duration, bool printInfo, bool doFullCycle) {
+/* number of key pairs generated per call when timing keypair_batch */
+#define KEYGEN_BATCH 32
+#define KEYGEN_BATCH_STR "32"
+
+static OQS_STATUS kem_speed_wrapper(const char *method_name, uint64_t duration, bool printInfo, bool doFullCycle, size_t threads) {
 
 	OQS_KEM *kem = NULL;
+	OQS_THREADPOOL *pool = NULL;
+	OQS_KEM_expanded_public_key *expanded_public_key = NULL;
+	OQS_KEM_expanded_secret_key *expanded_secret_key = NULL;
 	uint8_t *public_key = NULL;
 	uint8_t *secret_key = NULL;
 	uint8_t *ciphertext = NULL;
 	uint8_t *shared_secret_e = NULL;
 	uint8_t *shared_secret_d = NULL;
+	uint8_t *public_keys = NULL;
+	uint8_t *secret_keys = NULL;
 	OQS_STATUS ret = OQS_ERROR;
 
 	kem = OQS_KEM_new(method_name);
@@ -64,6 +73,33 @@ static OQS_STATUS kem_speed_wrapper(const char *method_name, uint64_t duration,
 		TIME_OPERATION_SECONDS(OQS_KEM_keypair(kem, public_key, secret_key), "keygen", duration)
 		TIME_OPERATION_SECONDS(OQS_KEM_encaps(kem, ciphertext, shared_secret_e, public_key), "encaps", duration)
 		TIME_OPERATION_SECONDS(OQS_KEM_decaps(kem, shared_secret_d, ciphertext, secret_key), "decaps", duration)
+		if (kem->public_key_expand != NULL && kem->secret_key_expand != NULL) {
+			expanded_public_key = OQS_KEM_public_key_expand(kem, public_key);
+			expanded_secret_key = OQS_KEM_secret_key_expand(kem, secret_key);
+			if (expanded_public_key == NULL || expanded_secret_key == NULL) {
+				fprintf(stderr, "ERROR: expanding the key pair failed\n");
+				goto err;
+			}
+			TIME_OPERATION_SECONDS(OQS_KEM_encaps_expanded(kem, ciphertext, shared_secret_e, expanded_public_key), "encaps_expanded", duration)
+			TIME_OPERATION_SECONDS(OQS_KEM_decaps_expanded(kem, shared_secret_d, ciphertext, expanded_secret_key), "decaps_expanded", duration)
+		}
+		if (kem->keypair_batch != NULL) {
+			public_keys = OQS_MEM_malloc(KEYGEN_BATCH * kem->length_public_key);
+			secret_keys = OQS_MEM_malloc(KEYGEN_BATCH * kem->length_secret_key);
+			if (public_keys == NULL || secret_keys == NULL) {
+				fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+				goto err;
+			}
+			TIME_OPERATION_SECONDS(OQS_KEM_keypair_batch(kem, public_keys, secret_keys, KEYGEN_BATCH), "keygen_batch (" KEYGEN_BATCH_STR " keys)", duration)
+		}
+		if (kem->keypair_parallel != NULL && threads > 1) {
+			pool = OQS_THREADPOOL_new(threads);
+			if (pool == NULL) {
+				fprintf(stderr, "ERROR: OQS_THREADPOOL_new failed\n");
+				goto err;
+			}
+			TIME_OPERATION_SECONDS(OQS_KEM_keypair_parallel(kem, public_key, secret_key, pool), "keygen_parallel", duration)
+		}
 	} else {
 		TIME_OPERATION_SECONDS(fullcycletest(kem, public_key, secret_key, ciphertext, shared_secret_e, shared_secret_d), "fullcycletest", duration)
 	}
@@ -79,11 +115,16 @@ err:
 	ret = OQS_ERROR;
 
 cleanup:
+	OQS_THREADPOOL_free(pool);
+	OQS_KEM_expanded_public_key_free(expanded_public_key);
+	OQS_KEM_expanded_secret_key_free(expanded_secret_key);
 	if (kem != NULL) {
 		OQS_MEM_secure_free(secret_key, kem->length_secret_key);
 		OQS_MEM_secure_free(shared_secret_e, kem->length_shared_secret);
 		OQS_MEM_secure_free(shared_secret_d, kem->length_shared_secret);
+		OQS_MEM_secure_free(secret_keys, KEYGEN_BATCH * kem->length_secret_key);
 	}
+	OQS_MEM_insecure_free(public_keys);
 	OQS_MEM_insecure_free(public_key);
 	OQS_MEM_insecure_free(ciphertext);
 	OQS_KEM_free(kem);
@@ -113,6 +154,7 @@ int main(int argc, char **argv) {
 	uint64_t duration = 3;
 	bool printKemInfo = false;
 	bool doFullCycle = false;
+	size_t threads = 1;
 
 	OQS_KEM *single_kem = NULL;
 
@@ -137,6 +179,14 @@ int main(int argc, char **argv) {
 					continue;
 				}
 			}
+		} else if ((strcmp(argv[i], "--threads") == 0) || (strcmp(argv[i], "-t") == 0)) {
+			if (i < argc - 1) {
+				threads = (size_t)strtol(argv[i + 1], NULL, 10);
+				if (threads > 0) {
+					i += 1;
+					continue;
+				}
+			}
 		} else if ((strcmp(argv[i], "--help") == 0) || (strcmp(argv[i], "-h") == 0)) {
 			printUsage = true;
 			break;
@@ -168,6 +218,8 @@ int main(int argc, char **argv) {
 		fprintf(stderr, " -i                Print info (sizes, security level) about each KEM\n");
 		fprintf(stderr, "--fullcycle\n");
 		fprintf(stderr, " -f                Do full keygen-encaps-decaps cycle for each KEM\n");
+		fprintf(stderr, "--threads n\n");
+		fprintf(stderr, " -t n              Also time key generation with up to n threads where supported, default n=1\n");
 		fprintf(stderr, "\n");
 		fprintf(stderr, "<alg>              Only run the specified KEM method; must be one of the algorithms output by --algs\n");
 		return EXIT_FAILURE;
@@ -180,14 +232,14 @@ int main(int argc, char **argv) {
 
 	PRINT_TIMER_HEADER
 	if (single_kem != NULL) {
-		rc = kem_speed_wrapper(single_kem->method_name, duration, printKemInfo, doFullCycle);
+		rc = kem_speed_wrapper(single_kem->method_name, duration, printKemInfo, doFullCycle, threads);
 		if (rc != OQS_SUCCESS) {
 			ret = EXIT_FAILURE;
 		}
 		OQS_KEM_free(single_kem);
 	} else {
 		for (size_t i = 0; i < OQS_KEM_algs_length; i++) {
-			rc = kem_speed_wrapper(OQS_KEM_alg_identifier(i), duration, printKemInfo, doFullCycle);
+			rc = kem_speed_wrapper(OQS_KEM_alg_identifier(i), duration, printKemInfo, doFullCycle, threads);
 			if (rc != OQS_SUCCESS) {
 				ret = EXIT_FAILURE;
 			}
@@ -32,9 +32,12 @@ static void fullcycle(OQS_SIG *sig, uint8_t *public_key, uint8_t *secret_key, ui
 	}
 }
 
-static OQS_STATUS sig_speed_wrapper(const char *method_name, uint64_t duration, bool printInfo, bool doFullCycle) {
+static OQS_STATUS sig_speed_wrapper(const char *method_name, uint64_t duration, bool printInfo, bool doFullCycle, size_t threads) {
 
 	OQS_SIG *sig = NULL;
+	OQS_SIG_expanded_public_key *expanded_public_key = NULL;
+	OQS_SIG_expanded_secret_key *expanded_secret_key = NULL;
+	OQS_THREADPOOL *pool = NULL;
 	uint8_t *public_key = NULL;
 	uint8_t *secret_key = NULL;
 	uint8_t *message = NULL;
@@ -65,6 +68,30 @@ static OQS_STATUS sig_speed_wrapper(const char *method_name, uint64_t duration,
 		TIME_OPERATION_SECONDS(OQS_SIG_keypair(sig, public_key, secret_key), "keypair", duration)
 		TIME_OPERATION_SECONDS(OQS_SIG_sign(sig, signature, &signature_len, message, message_len, secret_key), "sign", duration)
 		TIME_OPERATION_SECONDS(OQS_SIG_verify(sig, message, message_len, signature, signature_len, public_key), "verify", duration)
+		if (sig->sign_expanded != NULL) {
+			expanded_secret_key = OQS_SIG_secret_key_expand(sig, secret_key);
+			if (expanded_secret_key == NULL) {
+				fprintf(stderr, "ERROR: OQS_SIG_secret_key_expand failed\n");
+				goto err;
+			}
+			TIME_OPERATION_SECONDS(OQS_SIG_sign_expanded(sig, signature, &signature_len, message, message_len, expanded_secret_key), "sign_expanded", duration)
+		}
+		if (sig->verify_expanded != NULL) {
+			expanded_public_key = OQS_SIG_public_key_expand(sig, public_key);
+			if (expanded_public_key == NULL) {
+				fprintf(stderr, "ERROR: OQS_SIG_public_key_expand failed\n");
+				goto err;
+			}
+			TIME_OPERATION_SECONDS(OQS_SIG_verify_expanded(sig, message, message_len, signature, signature_len, expanded_public_key), "verify_expanded", duration)
+		}
+		if (sig->sign_parallel != NULL && threads > 1) {
+			pool = OQS_THREADPOOL_new(threads);
+			if (pool == NULL) {
+				fprintf(stderr, "ERROR: OQS_THREADPOOL_new failed\n");
+				goto err;
+			}
+			TIME_OPERATION_SECONDS(OQS_SIG_sign_parallel(sig, signature, &signature_len, message, message_len, secret_key, pool), "sign_parallel", duration)
+		}
 	} else {
 		TIME_OPERATION_SECONDS(fullcycle(sig, public_key, secret_key, signature, signature_len, message, message_len), "fullcycle", duration)
 	}
@@ -84,6 +111,9 @@ err:
 	ret = OQS_ERROR;
 
 cleanup:
+	OQS_SIG_expanded_public_key_free(expanded_public_key);
+	OQS_SIG_expanded_secret_key_free(expanded_secret_key);
+	OQS_THREADPOOL_free(pool);
 	if (sig != NULL) {
 		OQS_MEM_secure_free(secret_key, sig->length_secret_key);
 	}
@@ -117,6 +147,7 @@ int main(int argc, char **argv) {
 	uint64_t duration = 3;
 	bool printSigInfo = false;
 	bool doFullCycle = false;
+	size_t threads = 1;
 
 	OQS_SIG *single_sig = NULL;
 
@@ -141,6 +172,14 @@ int main(int argc, char **argv) {
 					continue;
 				}
 			}
+		} else if ((strcmp(argv[i], "--threads") == 0) || (strcmp(argv[i], "-t") == 0)) {
+			if (i < argc - 1) {
+				threads = (size_t)strtol(argv[i + 1], NULL, 10);
+				if (threads > 0) {
+					i += 1;
+					continue;
+				}
+			}
 		} else if ((strcmp(argv[i], "--help") == 0) || (strcmp(argv[i], "-h") == 0)) {
 			printUsage = true;
 			break;
@@ -172,6 +211,8 @@ int main(int argc, char **argv) {
 		fprintf(stderr, " -i                Print info (sizes, security level) about each SIG\n");
 		fprintf(stderr, "--fullcycle\n");
 		fprintf(stderr, " -f                Test full keygen-sign-verify cycle of each SIG\n");
+		fprintf(stderr, "--threads n\n");
+		fprintf(stderr, " -t n              Also time signing with up to n threads where supported, default n=1\n");
 		fprintf(stderr, "\n");
 		fprintf(stderr, "<alg>              Only run the specified SIG method; must be one of the algorithms output by --algs\n");
 		OQS_destroy();
@@ -185,7 +226,7 @@ int main(int argc, char **argv) {
 
 	PRINT_TIMER_HEADER
 	if (single_sig != NULL) {
-		rc = sig_speed_wrapper(single_sig->method_name, duration, printSigInfo, doFullCycle);
+		rc = sig_speed_wrapper(single_sig->method_name, duration, printSigInfo, doFullCycle, threads);
 		if (rc != OQS_SUCCESS) {
 			ret = EXIT_FAILURE;
 		}
@@ -193,7 +234,7 @@ int main(int argc, char **argv) {
 
 	} else {
 		for (size_t i = 0; i < OQS_SIG_algs_length; i++) {
-			rc = sig_speed_wrapper(OQS_SIG_alg_identifier(i), duration, printSigInfo, doFullCycle);
+			rc = sig_speed_wrapper(OQS_SIG_alg_identifier(i), duration, printSigInfo, doFullCycle, threads);
 			if (rc != OQS_SUCCESS) {
 				ret = EXIT_FAILURE;
 			}
@@ -27,9 +27,11 @@ OQS_STATUS dummy_secure_storage(uint8_t *sk_buf, size_t sk_buf_len, void *contex
 
 // reset secret key: some schemes fail to create a new secret key over a previous secret key
 OQS_SIG_STFL_SECRET_KEY *reset_secret_key(OQS_SIG_STFL *sig, OQS_SIG_STFL_SECRET_KEY *secret_key) {
+	OQS_THREADPOOL *pool = secret_key->thread_pool;
 	OQS_SIG_STFL_SECRET_KEY_free(secret_key);
 	secret_key = OQS_SIG_STFL_SECRET_KEY_new(sig->method_name);
 	OQS_SIG_STFL_SECRET_KEY_SET_store_cb(secret_key, &dummy_secure_storage, secret_key);
+	OQS_SIG_STFL_SECRET_KEY_SET_threadpool(secret_key, pool);
 	return secret_key;
 }
 
@@ -48,10 +50,11 @@ static void fullcycle(OQS_SIG_STFL *sig, uint8_t *public_key, OQS_SIG_STFL_SECRE
 	}
 }
 
-static OQS_STATUS sig_speed_wrapper(const char *method_name, uint64_t duration, bool printInfo, bool doFullCycle) {
+static OQS_STATUS sig_speed_wrapper(const char *method_name, uint64_t duration, bool printInfo, bool doFullCycle, unsigned int num_threads) {
 	OQS_SIG_STFL *sig = NULL;
 	uint8_t *public_key = NULL;
 	OQS_SIG_STFL_SECRET_KEY *secret_key = NULL;
+	OQS_THREADPOOL *pool = NULL;
 	uint8_t *message = NULL;
 	uint8_t *signature = NULL;
 	size_t message_len = 50;
@@ -98,25 +101,41 @@ static OQS_STATUS sig_speed_wrapper(const char *method_name, uint64_t duration,
 
 	printf("%-36s | %10s | %14s | %15s | %10s | %25s | %10s\n", sig->method_name, "", "", "", "", "", "");
 	if (!doFullCycle) {
-		// benchmark keygen: need to reset secret key between calls
-		OQS_STATUS status = 0;
-		TIME_OPERATION_SECONDS_MAXIT({ status = OQS_SIG_STFL_keypair(sig, public_key, secret_key); }, "keypair", duration, 1, {
-			if (status != OQS_SUCCESS) {
-				printf("keygen error. Exiting.\n");
-				exit(-1);
-			}
-			secret_key = reset_secret_key(sig, secret_key);
-		})
-		// benchmark sign: need to generate new secret key after available signatures have been exhausted
-		unsigned long long max_sigs;
-		OQS_SIG_STFL_sigs_total(sig, &max_sigs, secret_key);
-		TIME_OPERATION_SECONDS_MAXIT({ status = OQS_SIG_STFL_sign(sig, signature, &signature_len, message, message_len, secret_key); }, "sign", duration, max_sigs, {
-			if (status != OQS_SUCCESS) {
-				printf("sign error. Exiting.\n");
-				exit(-1);
+		// benchmark keygen and sign single-threaded, then again with worker threads if requested
+		for (unsigned int pass = 0; pass < (num_threads > 1 ? 2u : 1u); pass++) {
+			char keypair_name[32] = "keypair";
+			char sign_name[32] = "sign";
+			if (pass > 0) {
+				snprintf(keypair_name, sizeof(keypair_name), "keypair (%u threads)", num_threads);
+				snprintf(sign_name, sizeof(sign_name), "sign (%u threads)", num_threads);
+				pool = OQS_THREADPOOL_new(num_threads);
+				if (pool == NULL) {
+					fprintf(stderr, "ERROR: OQS_THREADPOOL_new failed\n");
+					goto err;
+				}
+				secret_key = reset_secret_key(sig, secret_key);
+				OQS_SIG_STFL_SECRET_KEY_SET_threadpool(secret_key, pool);
 			}
-			OQS_SIG_STFL_keypair(sig, public_key, secret_key);
-		})
+			// benchmark keygen: need to reset secret key between calls
+			OQS_STATUS status = 0;
+			TIME_OPERATION_SECONDS_MAXIT({ status = OQS_SIG_STFL_keypair(sig, public_key, secret_key); }, keypair_name, duration, 1, {
+				if (status != OQS_SUCCESS) {
+					printf("keygen error. Exiting.\n");
+					exit(-1);
+				}
+				secret_key = reset_secret_key(sig, secret_key);
+			})
+			// benchmark sign: need to generate new secret key after available signatures have been exhausted
+			unsigned long long max_sigs;
+			OQS_SIG_STFL_sigs_total(sig, &max_sigs, secret_key);
+			TIME_OPERATION_SECONDS_MAXIT({ status = OQS_SIG_STFL_sign(sig, signature, &signature_len, message, message_len, secret_key); }, sign_name, duration, max_sigs, {
+				if (status != OQS_SUCCESS) {
+					printf("sign error. Exiting.\n");
+					exit(-1);
+				}
+				OQS_SIG_STFL_keypair(sig, public_key, secret_key);
+			})
+		}
 		// benchmark verification
 		TIME_OPERATION_SECONDS({ OQS_SIG_STFL_verify(sig, message, message_len, signature, signature_len, public_key); }, "verify", duration)
 	} else {
@@ -141,6 +160,7 @@ cleanup:
 	if (sig != NULL) {
 		OQS_SIG_STFL_SECRET_KEY_free(secret_key);
 	}
+	OQS_THREADPOOL_free(pool);
 	OQS_MEM_insecure_free(public_key);
 	OQS_MEM_insecure_free(signature);
 	OQS_MEM_insecure_free(message);
@@ -172,6 +192,7 @@ int main(int argc, char **argv) {
 	bool printSigInfo = false;
 	bool doFullCycle = false;
 	bool onlyMaxSigs10 = false;
+	unsigned int num_threads = 0;
 
 	OQS_SIG_STFL *single_sig = NULL;
 
@@ -205,6 +226,14 @@ int main(int argc, char **argv) {
 		} else if ((strcmp(argv[i], "--fullcycle") == 0) || (strcmp(argv[i], "-f") == 0)) {
 			doFullCycle = true;
 			continue;
+		} else if ((strcmp(argv[i], "--threads") == 0) || (strcmp(argv[i], "-t") == 0)) {
+			if (i < argc - 1) {
+				num_threads = (unsigned int)strtoul(argv[i + 1], NULL, 10);
+				if (num_threads > 0) {
+					i += 1;
+					continue;
+				}
+			}
 		} else if ((strcmp(argv[i], "--limit10") == 0) || (strcmp(argv[i], "-l") == 0)) {
 			onlyMaxSigs10 = true;
 			continue;
@@ -232,6 +261,8 @@ int main(int argc, char **argv) {
 		fprintf(stderr, " -f                Test full keygen-sign-verify cycle of each SIG\n");
 		fprintf(stderr, "--limit10          Test only algorithms with 2^10 max signatures\n");
 		fprintf(stderr, " -l\n");
+		fprintf(stderr, "--threads n\n");
+		fprintf(stderr, " -t n              Also benchmark keygen and sign with up to n worker threads per secret key\n");
 		fprintf(stderr, "\n");
 		fprintf(stderr, "<alg>              Only run the specified SIG method; must be one of the algorithms output by --algs\n");
 		OQS_destroy();
@@ -245,7 +276,7 @@ int main(int argc, char **argv) {
 
 	PRINT_TIMER_HEADER
 	if (single_sig != NULL) {
-		rc = sig_speed_wrapper(single_sig->method_name, duration, printSigInfo, doFullCycle);
+		rc = sig_speed_wrapper(single_sig->method_name, duration, printSigInfo, doFullCycle, num_threads);
 		if (rc != OQS_SUCCESS) {
 			ret = EXIT_FAILURE;
 		}
@@ -256,7 +287,7 @@ int main(int argc, char **argv) {
 			if (onlyMaxSigs10 > 0 && strstr(OQS_SIG_STFL_alg_identifier(i), "_10") == NULL && strstr(OQS_SIG_STFL_alg_identifier(i), "H10") == NULL) {
 				continue;
 			}
-			rc = sig_speed_wrapper(OQS_SIG_STFL_alg_identifier(i), duration, printSigInfo, doFullCycle);
+			rc = sig_speed_wrapper(OQS_SIG_STFL_alg_identifier(i), duration, printSigInfo, doFullCycle, num_threads);
 			if (rc != OQS_SUCCESS) {
 				ret = EXIT_FAILURE;
 			}
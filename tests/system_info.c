@@ -75,8 +75,17 @@ static void print_platform_info(void) {
     stmt_c
 #endif
 
-#if defined(OQS_DIST_ARM64_V8_BUILD)
-#define SHA2_C_OR_ARM(stmt_c, stmt_arm) \
+#if defined(OQS_DIST_X86_64_BUILD)
+#define SHA2_C_OR_NI_OR_ARM(stmt_c, stmt_ni, stmt_arm) \
+    do { \
+        if (OQS_CPU_has_extension(OQS_CPU_EXT_SHA_NI)) {  \
+            stmt_ni; \
+        } else { \
+            stmt_c; \
+        } \
+    } while(0)
+#elif defined(OQS_DIST_ARM64_V8_BUILD)
+#define SHA2_C_OR_NI_OR_ARM(stmt_c, stmt_ni, stmt_arm) \
     do { \
         if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_SHA2)) {  \
             stmt_arm; \
@@ -84,11 +93,14 @@ static void print_platform_info(void) {
             stmt_c; \
         } \
     } while(0)
+#elif defined(OQS_USE_SHA_NI_INSTRUCTIONS)
+#define SHA2_C_OR_NI_OR_ARM(stmt_c, stmt_ni, stmt_arm) \
+    stmt_ni
 #elif defined(OQS_USE_ARM_SHA2_INSTRUCTIONS)
-#define SHA2_C_OR_ARM(stmt_c, stmt_arm) \
+#define SHA2_C_OR_NI_OR_ARM(stmt_c, stmt_ni, stmt_arm) \
     stmt_arm
 #else
-#define SHA2_C_OR_ARM(stmt_c, stmt_arm) \
+#define SHA2_C_OR_NI_OR_ARM(stmt_c, stmt_ni, stmt_arm) \
     stmt_c
 #endif
 
@@ -123,6 +135,9 @@ static void print_cpu_extensions(void) {
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_VPCLMULQDQ)) {
 		printf(" VPCLMULQDQ");
 	}
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_VAES)) {
+		printf(" VAES");
+	}
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
 		printf(" POPCNT");
 	}
@@ -135,6 +150,9 @@ static void print_cpu_extensions(void) {
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_SSE3)) {
 		printf(" SSE3");
 	}
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_SHA_NI)) {
+		printf(" SHA_NI");
+	}
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_AES)) {
 		printf(" AES");
 	}
@@ -185,6 +203,9 @@ static void print_cpu_extensions(void) {
 #ifdef OQS_USE_SSE3_INSTRUCTIONS
 	printf(" SSE3");
 #endif
+#ifdef OQS_USE_SHA_NI_INSTRUCTIONS
+	printf(" SHA_NI");
+#endif
 #ifdef OQS_USE_ARM_AES_INSTRUCTIONS
 	printf(" AES");
 #endif
@@ -240,8 +261,9 @@ static void print_oqs_configuration(void) {
 #if defined(OQS_USE_SHA2_OPENSSL)
 	printf("SHA-2:            OpenSSL\n");
 #else
-	SHA2_C_OR_ARM(
+	SHA2_C_OR_NI_OR_ARM(
 	    printf("SHA-2:            C\n"),
+	    printf("SHA-2:            NI\n"),
 	    printf("SHA-2:            C and ARM CRYPTO extensions\n")
 	);
 #endif
@@ -115,6 +115,92 @@ static int test_aes256ctr_correctness(void) {
 	return EXIT_SUCCESS;
 }
 
+/* Bulk ECB and CTR, which process many blocks at once, must agree with block-by-block ECB */
+#define BULK_BLOCKS 37
+
+static void ctr_reference(const void *schedule, void (*ecb_enc_sch)(const uint8_t *, const size_t, const void *, uint8_t *), const uint8_t iv[16], uint8_t *out) {
+	uint8_t block[16];
+	for (size_t i = 0; i < BULK_BLOCKS; i++) {
+		uint64_t ctr = 0;
+		memcpy(block, iv, 16);
+		for (int j = 8; j < 16; j++) {
+			ctr = (ctr << 8) | block[j];
+		}
+		ctr += i;
+		for (int j = 15; j >= 8; j--) {
+			block[j] = (uint8_t)ctr;
+			ctr >>= 8;
+		}
+		ecb_enc_sch(block, 16, schedule, out + 16 * i);
+	}
+}
+
+static int test_aes_bulk_consistency(const char *name, const uint8_t *key, void (*load_schedule)(const uint8_t *, void **), void (*free_schedule)(void *), void (*ecb_enc_sch)(const uint8_t *, const size_t, const void *, uint8_t *), void (*ctr_stream_iv)(const uint8_t *, size_t, const void *, uint8_t *, size_t)) {
+	static const size_t lengths[] = {1, 15, 16, 17, 63, 64, 65, 127, 128, 129, 255, 256, 257, 16 * BULK_BLOCKS - 3, 16 * BULK_BLOCKS};
+	uint8_t iv[16];
+	uint8_t plaintext[16 * BULK_BLOCKS];
+	uint8_t expected[16 * BULK_BLOCKS];
+	uint8_t derived[16 * BULK_BLOCKS];
+	void *schedule = NULL;
+	int ret = EXIT_FAILURE;
+
+	for (size_t i = 0; i < sizeof(plaintext); i++) {
+		plaintext[i] = (uint8_t)(7 * i + 1);
+	}
+	for (size_t i = 0; i < sizeof(iv); i++) {
+		iv[i] = (uint8_t)(0xf0 + i);
+	}
+	load_schedule(key, &schedule);
+
+	for (size_t i = 0; i < BULK_BLOCKS; i++) {
+		ecb_enc_sch(plaintext + 16 * i, 16, schedule, expected + 16 * i);
+	}
+	ecb_enc_sch(plaintext, sizeof(plaintext), schedule, derived);
+	if (memcmp(expected, derived, sizeof(expected)) != 0) {
+		printf("%s bulk ECB does not match block-by-block ECB\n", name);
+		goto end;
+	}
+
+	ctr_reference(schedule, ecb_enc_sch, iv, expected);
+	for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+		memset(derived, 0, sizeof(derived));
+		ctr_stream_iv(iv, 16, schedule, derived, lengths[i]);
+		if (memcmp(expected, derived, lengths[i]) != 0) {
+			printf("%s CTR keystream of %zu bytes does not match\n", name, lengths[i]);
+			goto end;
+		}
+	}
+	ret = EXIT_SUCCESS;
+
+end:
+	free_schedule(schedule);
+	return ret;
+}
+
+static int test_aes256ctr_blks_consistency(void) {
+	uint8_t iv[16];
+	uint8_t expected[16 * BULK_BLOCKS];
+	uint8_t derived[16 * BULK_BLOCKS];
+	void *schedule = NULL;
+	int ret = EXIT_SUCCESS;
+
+	for (size_t i = 0; i < sizeof(iv); i++) {
+		iv[i] = (uint8_t)(0xf0 + i);
+	}
+	OQS_AES256_CTR_inc_init(test_aes256_key, &schedule);
+	ctr_reference(schedule, OQS_AES256_ECB_enc_sch, iv, expected);
+	OQS_AES256_CTR_inc_iv(iv, 16, schedule);
+	OQS_AES256_CTR_inc_stream_blks(schedule, derived, 3);
+	OQS_AES256_CTR_inc_stream_blks(schedule, derived + 16 * 3, 20);
+	OQS_AES256_CTR_inc_stream_blks(schedule, derived + 16 * 23, BULK_BLOCKS - 23);
+	if (memcmp(expected, derived, sizeof(expected)) != 0) {
+		printf("test_aes256ctr_blks_consistency keystream does not match\n");
+		ret = EXIT_FAILURE;
+	}
+	OQS_AES256_free_schedule(schedule);
+	return ret;
+}
+
 static void speed_aes128(void) {
 	uint8_t ciphertext[16];
 	void *schedule = NULL, *schedule_dec = NULL;
@@ -197,6 +283,13 @@ int main(int argc, char **argv) {
 		return EXIT_FAILURE;
 	}
 
+	if (test_aes_bulk_consistency("AES128", test_aes128_key, OQS_AES128_ECB_load_schedule, OQS_AES128_free_schedule, OQS_AES128_ECB_enc_sch, OQS_AES128_CTR_inc_stream_iv) != EXIT_SUCCESS ||
+	        test_aes_bulk_consistency("AES256", test_aes256_key, OQS_AES256_ECB_load_schedule, OQS_AES256_free_schedule, OQS_AES256_ECB_enc_sch, OQS_AES256_CTR_inc_stream_iv) != EXIT_SUCCESS ||
+	        test_aes256ctr_blks_consistency() != EXIT_SUCCESS) {
+		OQS_destroy();
+		return EXIT_FAILURE;
+	}
+
 	if (!aes_callback_called) {
 		printf("AES callback was not called\n");
 		OQS_destroy();
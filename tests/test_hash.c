@@ -245,6 +245,59 @@ static int do_sha512(void) {
 	return 0;
 }
 
+/* Hash the message in every lane of OQS_SHA2_sha256_x4/_x8, with lane i
+ * having its last byte xored with i, and check each lane against
+ * OQS_SHA2_sha256. Prints the lane 0 hash. */
+static int do_sha256_multi(size_t lanes) {
+	// read message from stdin
+	uint8_t *msg;
+	size_t msg_len;
+	if (read_stdin(&msg, &msg_len) != 0) {
+		fprintf(stderr, "ERROR reading from stdin\n");
+		return -1;
+	}
+
+	uint8_t *msgs = OQS_MEM_malloc(8 * msg_len + 1);
+	if (msgs == NULL) {
+		OQS_MEM_insecure_free(msg);
+		return -1;
+	}
+	uint8_t *in[8];
+	uint8_t output[8][32];
+	uint8_t output_single[32];
+	for (size_t i = 0; i < 8; i++) {
+		in[i] = msgs + i * msg_len;
+		memcpy(in[i], msg, msg_len);
+		if (msg_len > 0) {
+			in[i][msg_len - 1] ^= (uint8_t) i;
+		}
+	}
+
+	if (lanes == 4) {
+		OQS_SHA2_sha256_x4(output[0], output[1], output[2], output[3],
+		                   in[0], in[1], in[2], in[3], msg_len);
+	} else {
+		OQS_SHA2_sha256_x8(output[0], output[1], output[2], output[3],
+		                   output[4], output[5], output[6], output[7],
+		                   in[0], in[1], in[2], in[3], in[4], in[5], in[6], in[7], msg_len);
+	}
+
+	for (size_t i = 0; i < lanes; i++) {
+		OQS_SHA2_sha256(output_single, in[i], msg_len);
+		if (memcmp(output[i], output_single, 32) != 0) {
+			fprintf(stderr, "ERROR: lane %zu of sha256_x%zu does not match sha256\n", i, lanes);
+			OQS_MEM_insecure_free(msgs);
+			OQS_MEM_insecure_free(msg);
+			return -2;
+		}
+	}
+
+	print_hex(output[0], 32);
+	OQS_MEM_insecure_free(msgs);
+	OQS_MEM_insecure_free(msg);
+	return 0;
+}
+
 static int do_arbitrary_hash(void (*hash)(uint8_t *, const uint8_t *, size_t), size_t hash_len) {
 	// read message from stdin
 	uint8_t *msg;
@@ -280,6 +333,7 @@ int main(int argc, char **argv) {
 	if (argc != 2) {
 		fprintf(stderr, "Usage: test_hash algname\n");
 		fprintf(stderr, "  algname: sha256, sha384, sha512, sha256inc, sha384inc, sha512inc\n");
+		fprintf(stderr, "           sha256x4, sha256x8\n");
 		fprintf(stderr, "           sha3_256, sha3_384, sha3_512\n");
 		fprintf(stderr, "  test_hash reads input from stdin and outputs hash value as hex string to stdout");
 		printf("\n");
@@ -295,6 +349,10 @@ int main(int argc, char **argv) {
 		ret = do_sha384();
 	} else if (strcmp(hash_alg, "sha512inc") == 0) {
 		ret = do_sha512();
+	} else if (strcmp(hash_alg, "sha256x4") == 0) {
+		ret = do_sha256_multi(4);
+	} else if (strcmp(hash_alg, "sha256x8") == 0) {
+		ret = do_sha256_multi(8);
 	} else if (strcmp(hash_alg, "sha256") == 0) {
 		ret = do_arbitrary_hash(&OQS_SHA2_sha256, 32);
 	} else if (strcmp(hash_alg, "sha384") == 0) {
@@ -9,6 +9,7 @@
 
 #if OQS_USE_PTHREADS
 #include <pthread.h>
+#include <time.h>
 #endif
 
 #ifdef OQS_ENABLE_TEST_CONSTANT_TIME
@@ -182,6 +183,738 @@ cleanup:
 	return ret;
 }
 
+#define KEM_TEST_BATCH_COUNT 3
+
+static OQS_STATUS kem_test_batch(const char *method_name) {
+
+	OQS_KEM *kem = NULL;
+	uint8_t *public_keys = NULL;
+	uint8_t *secret_keys = NULL;
+	uint8_t *ciphertexts = NULL;
+	uint8_t *shared_secrets_e = NULL;
+	uint8_t *shared_secrets_d = NULL;
+	uint8_t *shared_secret = NULL;
+	OQS_STATUS rc, ret = OQS_ERROR;
+
+	kem = OQS_KEM_new(method_name);
+	if (kem == NULL) {
+		fprintf(stderr, "ERROR: OQS_KEM_new failed\n");
+		goto err;
+	}
+
+	public_keys = OQS_MEM_malloc(2 * kem->length_public_key);
+	secret_keys = OQS_MEM_malloc(2 * kem->length_secret_key);
+	ciphertexts = OQS_MEM_malloc(KEM_TEST_BATCH_COUNT * kem->length_ciphertext);
+	shared_secrets_e = OQS_MEM_malloc(KEM_TEST_BATCH_COUNT * kem->length_shared_secret);
+	shared_secrets_d = OQS_MEM_malloc(KEM_TEST_BATCH_COUNT * kem->length_shared_secret);
+	shared_secret = OQS_MEM_malloc(kem->length_shared_secret);
+	if ((public_keys == NULL) || (secret_keys == NULL) || (ciphertexts == NULL) || (shared_secrets_e == NULL) || (shared_secrets_d == NULL) || (shared_secret == NULL)) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		goto err;
+	}
+
+	rc = OQS_KEM_keypair_batch(kem, public_keys, secret_keys, 2);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_KEM_keypair_batch failed\n");
+		goto err;
+	}
+
+	OQS_TEST_CT_DECLASSIFY(public_keys, 2 * kem->length_public_key);
+	if (memcmp(public_keys, public_keys + kem->length_public_key, kem->length_public_key) == 0) {
+		fprintf(stderr, "ERROR: OQS_KEM_keypair_batch returned identical public keys\n");
+		goto err;
+	}
+
+	rc = OQS_KEM_encaps_batch(kem, ciphertexts, shared_secrets_e, public_keys, KEM_TEST_BATCH_COUNT);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_KEM_encaps_batch failed\n");
+		goto err;
+	}
+
+	OQS_TEST_CT_DECLASSIFY(ciphertexts, KEM_TEST_BATCH_COUNT * kem->length_ciphertext);
+	rc = OQS_KEM_decaps_batch(kem, shared_secrets_d, ciphertexts, secret_keys, KEM_TEST_BATCH_COUNT);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_KEM_decaps_batch failed\n");
+		goto err;
+	}
+
+	OQS_TEST_CT_DECLASSIFY(shared_secrets_e, KEM_TEST_BATCH_COUNT * kem->length_shared_secret);
+	OQS_TEST_CT_DECLASSIFY(shared_secrets_d, KEM_TEST_BATCH_COUNT * kem->length_shared_secret);
+	if (memcmp(shared_secrets_e, shared_secrets_d, KEM_TEST_BATCH_COUNT * kem->length_shared_secret) != 0) {
+		fprintf(stderr, "ERROR: batched shared secrets are not equal\n");
+		goto err;
+	}
+
+	// a batched encapsulation must be accepted by the single-shot decapsulation
+	rc = OQS_KEM_decaps(kem, shared_secret, ciphertexts + (KEM_TEST_BATCH_COUNT - 1) * kem->length_ciphertext, secret_keys);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	OQS_TEST_CT_DECLASSIFY(shared_secret, kem->length_shared_secret);
+	if (rc != OQS_SUCCESS || memcmp(shared_secret, shared_secrets_e + (KEM_TEST_BATCH_COUNT - 1) * kem->length_shared_secret, kem->length_shared_secret) != 0) {
+		fprintf(stderr, "ERROR: batched and single-shot operations disagree\n");
+		goto err;
+	}
+	printf("batched shared secrets are equal\n");
+
+	ret = OQS_SUCCESS;
+	goto cleanup;
+
+err:
+	ret = OQS_ERROR;
+
+cleanup:
+	if (kem != NULL) {
+		OQS_MEM_secure_free(secret_keys, 2 * kem->length_secret_key);
+		OQS_MEM_secure_free(shared_secrets_e, KEM_TEST_BATCH_COUNT * kem->length_shared_secret);
+		OQS_MEM_secure_free(shared_secrets_d, KEM_TEST_BATCH_COUNT * kem->length_shared_secret);
+		OQS_MEM_secure_free(shared_secret, kem->length_shared_secret);
+	}
+	OQS_MEM_insecure_free(public_keys);
+	OQS_MEM_insecure_free(ciphertexts);
+	OQS_KEM_free(kem);
+
+	return ret;
+}
+
+static OQS_STATUS kem_test_expanded(const char *method_name) {
+
+	OQS_KEM *kem = NULL;
+	OQS_KEM_expanded_public_key *expanded_public_key = NULL;
+	OQS_KEM_expanded_secret_key *expanded_secret_key = NULL;
+	uint8_t *public_key = NULL;
+	uint8_t *secret_key = NULL;
+	uint8_t *ciphertext = NULL;
+	uint8_t *shared_secret_e = NULL;
+	uint8_t *shared_secret_d = NULL;
+	OQS_STATUS rc, ret = OQS_ERROR;
+
+	kem = OQS_KEM_new(method_name);
+	if (kem == NULL) {
+		fprintf(stderr, "ERROR: OQS_KEM_new failed\n");
+		goto err;
+	}
+
+	public_key = OQS_MEM_malloc(kem->length_public_key);
+	secret_key = OQS_MEM_malloc(kem->length_secret_key);
+	ciphertext = OQS_MEM_malloc(kem->length_ciphertext);
+	shared_secret_e = OQS_MEM_malloc(kem->length_shared_secret);
+	shared_secret_d = OQS_MEM_malloc(kem->length_shared_secret);
+	if ((public_key == NULL) || (secret_key == NULL) || (ciphertext == NULL) || (shared_secret_e == NULL) || (shared_secret_d == NULL)) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		goto err;
+	}
+
+	rc = OQS_KEM_keypair(kem, public_key, secret_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_KEM_keypair failed\n");
+		goto err;
+	}
+
+	OQS_TEST_CT_DECLASSIFY(public_key, kem->length_public_key);
+	expanded_public_key = OQS_KEM_public_key_expand(kem, public_key);
+	if (expanded_public_key == NULL) {
+		fprintf(stderr, "ERROR: OQS_KEM_public_key_expand failed\n");
+		goto err;
+	}
+
+	// the expanded key must be reusable
+	for (int i = 0; i < 2; i++) {
+		rc = OQS_KEM_encaps_expanded(kem, ciphertext, shared_secret_e, expanded_public_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_KEM_encaps_expanded failed\n");
+			goto err;
+		}
+
+		OQS_TEST_CT_DECLASSIFY(ciphertext, kem->length_ciphertext);
+		rc = OQS_KEM_decaps(kem, shared_secret_d, ciphertext, secret_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		OQS_TEST_CT_DECLASSIFY(shared_secret_e, kem->length_shared_secret);
+		OQS_TEST_CT_DECLASSIFY(shared_secret_d, kem->length_shared_secret);
+		if (rc != OQS_SUCCESS || memcmp(shared_secret_e, shared_secret_d, kem->length_shared_secret) != 0) {
+			fprintf(stderr, "ERROR: shared secrets from expanded public key are not equal\n");
+			goto err;
+		}
+	}
+	printf("shared secrets from expanded public key are equal\n");
+
+	expanded_secret_key = OQS_KEM_secret_key_expand(kem, secret_key);
+	if (expanded_secret_key == NULL) {
+		fprintf(stderr, "ERROR: OQS_KEM_secret_key_expand failed\n");
+		goto err;
+	}
+
+	rc = OQS_KEM_decaps_expanded(kem, shared_secret_d, ciphertext, expanded_secret_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	OQS_TEST_CT_DECLASSIFY(shared_secret_d, kem->length_shared_secret);
+	if (rc != OQS_SUCCESS || memcmp(shared_secret_e, shared_secret_d, kem->length_shared_secret) != 0) {
+		fprintf(stderr, "ERROR: shared secrets from expanded secret key are not equal\n");
+		goto err;
+	}
+
+	// an invalid encapsulation must be handled exactly as by OQS_KEM_decaps
+	OQS_randombytes(ciphertext, kem->length_ciphertext);
+	OQS_TEST_CT_DECLASSIFY(ciphertext, kem->length_ciphertext);
+	rc = OQS_KEM_decaps(kem, shared_secret_e, ciphertext, secret_key);
+	OQS_STATUS rc_expanded = OQS_KEM_decaps_expanded(kem, shared_secret_d, ciphertext, expanded_secret_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	OQS_TEST_CT_DECLASSIFY(&rc_expanded, sizeof rc_expanded);
+	OQS_TEST_CT_DECLASSIFY(shared_secret_e, kem->length_shared_secret);
+	OQS_TEST_CT_DECLASSIFY(shared_secret_d, kem->length_shared_secret);
+	if (rc != rc_expanded || (rc == OQS_SUCCESS && memcmp(shared_secret_e, shared_secret_d, kem->length_shared_secret) != 0)) {
+		fprintf(stderr, "ERROR: OQS_KEM_decaps_expanded and OQS_KEM_decaps disagree on wrong input\n");
+		goto err;
+	}
+	printf("shared secrets from expanded secret key are equal\n");
+
+	ret = OQS_SUCCESS;
+	goto cleanup;
+
+err:
+	ret = OQS_ERROR;
+
+cleanup:
+	OQS_KEM_expanded_public_key_free(expanded_public_key);
+	OQS_KEM_expanded_secret_key_free(expanded_secret_key);
+	if (kem != NULL) {
+		OQS_MEM_secure_free(secret_key, kem->length_secret_key);
+		OQS_MEM_secure_free(shared_secret_e, kem->length_shared_secret);
+		OQS_MEM_secure_free(shared_secret_d, kem->length_shared_secret);
+	}
+	OQS_MEM_insecure_free(public_key);
+	OQS_MEM_insecure_free(ciphertext);
+	OQS_KEM_free(kem);
+
+	return ret;
+}
+
+#ifdef OQS_ENABLE_TEST_CONSTANT_TIME
+static void TEST_KEM_randombytes(uint8_t *random_array, size_t bytes_to_read);
+#endif
+
+/* Deterministic randomness, so that two encapsulations can be compared */
+static uint64_t kem_test_seed;
+
+static void kem_test_seeded_randombytes(uint8_t *random_array, size_t bytes_to_read) {
+	for (size_t i = 0; i < bytes_to_read; i++) {
+		// splitmix64
+		uint64_t z = (kem_test_seed += 0x9e3779b97f4a7c15ULL);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+		random_array[i] = (uint8_t)(z ^ (z >> 31));
+	}
+}
+
+static void kem_test_restore_randombytes(void) {
+#ifdef OQS_ENABLE_TEST_CONSTANT_TIME
+	OQS_randombytes_custom_algorithm(&TEST_KEM_randombytes);
+#else
+	OQS_randombytes_switch_algorithm("system");
+#endif
+}
+
+/* More keypairs than one internal chunk of a batched key generation holds */
+#define KEM_TEST_KEYPAIR_BATCH_COUNT 40
+/* The randombytes call, counted from 0, that kem_test_degenerate_randombytes spoils */
+#define KEM_TEST_DEGENERATE_DRAW 2
+
+static size_t kem_test_draws;
+
+/* Seeded randomness, except that one draw has every 32-bit word equal to 2^29.
+ * sntrup761 maps such words to 0, and its third draw is g of the second key,
+ * which then has no inverse in R3: the batched key generation has to fall back
+ * to inverting and resampling one key at a time. */
+static void kem_test_degenerate_randombytes(uint8_t *random_array, size_t bytes_to_read) {
+	if (kem_test_draws++ == KEM_TEST_DEGENERATE_DRAW) {
+		for (size_t i = 0; i < bytes_to_read; i++) {
+			random_array[i] = (i % 4 == 3) ? 0x20 : 0x00;
+		}
+	} else {
+		kem_test_seeded_randombytes(random_array, bytes_to_read);
+	}
+}
+
+/* Checks that every keypair of a batch works and differs from the previous one */
+static OQS_STATUS kem_test_keypairs(const OQS_KEM *kem, const uint8_t *public_keys, const uint8_t *secret_keys, size_t count, uint8_t *ciphertext, uint8_t *shared_secret_e, uint8_t *shared_secret_d) {
+	OQS_STATUS rc;
+
+	for (size_t i = 0; i < count; i++) {
+		const uint8_t *public_key = public_keys + i * kem->length_public_key;
+		if (i > 0 && memcmp(public_key, public_key - kem->length_public_key, kem->length_public_key) == 0) {
+			fprintf(stderr, "ERROR: OQS_KEM_keypair_batch returned identical public keys\n");
+			return OQS_ERROR;
+		}
+		rc = OQS_KEM_encaps(kem, ciphertext, shared_secret_e, public_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_KEM_encaps failed\n");
+			return OQS_ERROR;
+		}
+		OQS_TEST_CT_DECLASSIFY(ciphertext, kem->length_ciphertext);
+		rc = OQS_KEM_decaps(kem, shared_secret_d, ciphertext, secret_keys + i * kem->length_secret_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		OQS_TEST_CT_DECLASSIFY(shared_secret_e, kem->length_shared_secret);
+		OQS_TEST_CT_DECLASSIFY(shared_secret_d, kem->length_shared_secret);
+		if (rc != OQS_SUCCESS || memcmp(shared_secret_e, shared_secret_d, kem->length_shared_secret) != 0) {
+			fprintf(stderr, "ERROR: shared secrets from batched keypair %zu are not equal\n", i);
+			return OQS_ERROR;
+		}
+	}
+	return OQS_SUCCESS;
+}
+
+/* Only run for schemes with a batched key generation of their own; the generic
+ * one-at-a-time fallback is covered by kem_test_batch */
+static OQS_STATUS kem_test_keypair_batch(const char *method_name) {
+
+	OQS_KEM *kem = NULL;
+	uint8_t *public_keys = NULL;
+	uint8_t *secret_keys = NULL;
+	uint8_t *ciphertext = NULL;
+	uint8_t *shared_secret_e = NULL;
+	uint8_t *shared_secret_d = NULL;
+	OQS_STATUS rc, ret = OQS_ERROR;
+
+	kem = OQS_KEM_new(method_name);
+	if (kem == NULL) {
+		fprintf(stderr, "ERROR: OQS_KEM_new failed\n");
+		goto err;
+	}
+	if (kem->keypair_batch == NULL) {
+		ret = OQS_SUCCESS;
+		goto cleanup;
+	}
+
+	public_keys = OQS_MEM_malloc(KEM_TEST_KEYPAIR_BATCH_COUNT * kem->length_public_key);
+	secret_keys = OQS_MEM_malloc(KEM_TEST_KEYPAIR_BATCH_COUNT * kem->length_secret_key);
+	ciphertext = OQS_MEM_malloc(kem->length_ciphertext);
+	shared_secret_e = OQS_MEM_malloc(kem->length_shared_secret);
+	shared_secret_d = OQS_MEM_malloc(kem->length_shared_secret);
+	if ((public_keys == NULL) || (secret_keys == NULL) || (ciphertext == NULL) || (shared_secret_e == NULL) || (shared_secret_d == NULL)) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		goto err;
+	}
+
+	rc = OQS_KEM_keypair_batch(kem, public_keys, secret_keys, KEM_TEST_KEYPAIR_BATCH_COUNT);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_KEM_keypair_batch failed\n");
+		goto err;
+	}
+	OQS_TEST_CT_DECLASSIFY(public_keys, KEM_TEST_KEYPAIR_BATCH_COUNT * kem->length_public_key);
+	if (kem_test_keypairs(kem, public_keys, secret_keys, KEM_TEST_KEYPAIR_BATCH_COUNT, ciphertext, shared_secret_e, shared_secret_d) != OQS_SUCCESS) {
+		goto err;
+	}
+
+	OQS_randombytes_custom_algorithm(&kem_test_degenerate_randombytes);
+	kem_test_seed = 0;
+	kem_test_draws = 0;
+	rc = OQS_KEM_keypair_batch(kem, public_keys, secret_keys, KEM_TEST_KEYPAIR_BATCH_COUNT);
+	kem_test_restore_randombytes();
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_KEM_keypair_batch failed with degenerate randomness\n");
+		goto err;
+	}
+	OQS_TEST_CT_DECLASSIFY(public_keys, KEM_TEST_KEYPAIR_BATCH_COUNT * kem->length_public_key);
+	if (kem_test_keypairs(kem, public_keys, secret_keys, KEM_TEST_KEYPAIR_BATCH_COUNT, ciphertext, shared_secret_e, shared_secret_d) != OQS_SUCCESS) {
+		goto err;
+	}
+	printf("shared secrets from %d batched keypairs are equal\n", KEM_TEST_KEYPAIR_BATCH_COUNT);
+
+	ret = OQS_SUCCESS;
+	goto cleanup;
+
+err:
+	ret = OQS_ERROR;
+
+cleanup:
+	if (kem != NULL) {
+		OQS_MEM_secure_free(secret_keys, KEM_TEST_KEYPAIR_BATCH_COUNT * kem->length_secret_key);
+		OQS_MEM_secure_free(shared_secret_e, kem->length_shared_secret);
+		OQS_MEM_secure_free(shared_secret_d, kem->length_shared_secret);
+	}
+	OQS_MEM_insecure_free(public_keys);
+	OQS_MEM_insecure_free(ciphertext);
+	OQS_KEM_free(kem);
+
+	return ret;
+}
+
+struct public_key_source {
+	const uint8_t *public_key;
+	size_t length;
+	size_t offset;
+	size_t reads;
+};
+
+static OQS_STATUS kem_test_read_public_key(void *context, uint8_t *buffer, size_t length) {
+	struct public_key_source *source = context;
+	if (length > source->length - source->offset) {
+		return OQS_ERROR;
+	}
+	memcpy(buffer, source->public_key + source->offset, length);
+	source->offset += length;
+	source->reads++;
+	return OQS_SUCCESS;
+}
+
+static OQS_STATUS kem_test_fail_public_key(void *context, uint8_t *buffer, size_t length) {
+	(void)context;
+	(void)buffer;
+	(void)length;
+	return OQS_ERROR;
+}
+
+static OQS_STATUS kem_test_stream(const char *method_name) {
+
+	OQS_KEM *kem = NULL;
+	uint8_t *public_key = NULL;
+	uint8_t *secret_key = NULL;
+	uint8_t *ciphertext = NULL;
+	uint8_t *ciphertext_stream = NULL;
+	uint8_t *shared_secret = NULL;
+	uint8_t *shared_secret_stream = NULL;
+	struct public_key_source source;
+	OQS_STATUS rc, rc_stream, ret = OQS_ERROR;
+
+	kem = OQS_KEM_new(method_name);
+	if (kem == NULL) {
+		fprintf(stderr, "ERROR: OQS_KEM_new failed\n");
+		goto err;
+	}
+
+	public_key = OQS_MEM_malloc(kem->length_public_key);
+	secret_key = OQS_MEM_malloc(kem->length_secret_key);
+	ciphertext = OQS_MEM_malloc(kem->length_ciphertext);
+	ciphertext_stream = OQS_MEM_malloc(kem->length_ciphertext);
+	shared_secret = OQS_MEM_malloc(kem->length_shared_secret);
+	shared_secret_stream = OQS_MEM_malloc(kem->length_shared_secret);
+	if ((public_key == NULL) || (secret_key == NULL) || (ciphertext == NULL) || (ciphertext_stream == NULL) || (shared_secret == NULL) || (shared_secret_stream == NULL)) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		goto err;
+	}
+
+	rc = OQS_KEM_keypair(kem, public_key, secret_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_KEM_keypair failed\n");
+		goto err;
+	}
+	OQS_TEST_CT_DECLASSIFY(public_key, kem->length_public_key);
+
+	source.public_key = public_key;
+	source.length = kem->length_public_key;
+	source.offset = 0;
+	source.reads = 0;
+
+	OQS_randombytes_custom_algorithm(&kem_test_seeded_randombytes);
+	kem_test_seed = 0;
+	rc = OQS_KEM_encaps(kem, ciphertext, shared_secret, public_key);
+	kem_test_seed = 0;
+	rc_stream = OQS_KEM_encaps_stream(kem, ciphertext_stream, shared_secret_stream, &kem_test_read_public_key, &source);
+	kem_test_restore_randombytes();
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	OQS_TEST_CT_DECLASSIFY(&rc_stream, sizeof rc_stream);
+	if (rc != OQS_SUCCESS || rc_stream != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_KEM_encaps or OQS_KEM_encaps_stream failed\n");
+		goto err;
+	}
+	if (source.offset != source.length) {
+		fprintf(stderr, "ERROR: OQS_KEM_encaps_stream read %zu of %zu public key bytes\n", source.offset, source.length);
+		goto err;
+	}
+
+	OQS_TEST_CT_DECLASSIFY(ciphertext, kem->length_ciphertext);
+	OQS_TEST_CT_DECLASSIFY(ciphertext_stream, kem->length_ciphertext);
+	OQS_TEST_CT_DECLASSIFY(shared_secret, kem->length_shared_secret);
+	OQS_TEST_CT_DECLASSIFY(shared_secret_stream, kem->length_shared_secret);
+	if (memcmp(ciphertext, ciphertext_stream, kem->length_ciphertext) != 0 || memcmp(shared_secret, shared_secret_stream, kem->length_shared_secret) != 0) {
+		fprintf(stderr, "ERROR: OQS_KEM_encaps_stream and OQS_KEM_encaps disagree\n");
+		goto err;
+	}
+
+	rc = OQS_KEM_encaps_stream(kem, ciphertext_stream, shared_secret_stream, &kem_test_fail_public_key, NULL);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_ERROR) {
+		fprintf(stderr, "ERROR: OQS_KEM_encaps_stream ignored a failing public key reader\n");
+		goto err;
+	}
+	printf("streamed encapsulation matches OQS_KEM_encaps (%zu reads)\n", source.reads);
+
+	ret = OQS_SUCCESS;
+	goto cleanup;
+
+err:
+	ret = OQS_ERROR;
+
+cleanup:
+	if (kem != NULL) {
+		OQS_MEM_secure_free(secret_key, kem->length_secret_key);
+		OQS_MEM_secure_free(shared_secret, kem->length_shared_secret);
+		OQS_MEM_secure_free(shared_secret_stream, kem->length_shared_secret);
+	}
+	OQS_MEM_insecure_free(public_key);
+	OQS_MEM_insecure_free(ciphertext);
+	OQS_MEM_insecure_free(ciphertext_stream);
+	OQS_KEM_free(kem);
+
+	return ret;
+}
+
+static void kem_test_reverse_executor(void *context, OQS_THREADPOOL_task task, void *arg, size_t count) {
+	size_t *calls = context;
+	for (size_t i = count; i > 0; i--) {
+		task(arg, i - 1);
+		(*calls)++;
+	}
+}
+
+static OQS_STATUS kem_test_parallel_keypair(const char *method_name) {
+
+	OQS_KEM *kem = NULL;
+	uint8_t *public_key = NULL;
+	uint8_t *secret_key = NULL;
+	uint8_t *public_key_parallel = NULL;
+	uint8_t *secret_key_parallel = NULL;
+	uint8_t *public_key_custom = NULL;
+	uint8_t *secret_key_custom = NULL;
+	OQS_THREADPOOL *pool = NULL;
+	OQS_THREADPOOL *custom_pool = NULL;
+	size_t custom_calls = 0;
+	OQS_STATUS rc, rc_parallel, rc_custom, ret = OQS_ERROR;
+
+	kem = OQS_KEM_new(method_name);
+	if (kem == NULL) {
+		fprintf(stderr, "ERROR: OQS_KEM_new failed\n");
+		goto err;
+	}
+
+	public_key = OQS_MEM_malloc(kem->length_public_key);
+	secret_key = OQS_MEM_malloc(kem->length_secret_key);
+	public_key_parallel = OQS_MEM_malloc(kem->length_public_key);
+	secret_key_parallel = OQS_MEM_malloc(kem->length_secret_key);
+	public_key_custom = OQS_MEM_malloc(kem->length_public_key);
+	secret_key_custom = OQS_MEM_malloc(kem->length_secret_key);
+	if ((public_key == NULL) || (secret_key == NULL) || (public_key_parallel == NULL) || (secret_key_parallel == NULL) || (public_key_custom == NULL) || (secret_key_custom == NULL)) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		goto err;
+	}
+
+	pool = OQS_THREADPOOL_new(3);
+	custom_pool = OQS_THREADPOOL_new_custom(&kem_test_reverse_executor, &custom_calls, 4);
+	if ((pool == NULL) || (custom_pool == NULL)) {
+		fprintf(stderr, "ERROR: OQS_THREADPOOL_new failed\n");
+		goto err;
+	}
+
+	OQS_randombytes_custom_algorithm(&kem_test_seeded_randombytes);
+	kem_test_seed = 0;
+	rc = OQS_KEM_keypair(kem, public_key, secret_key);
+	kem_test_seed = 0;
+	rc_parallel = OQS_KEM_keypair_parallel(kem, public_key_parallel, secret_key_parallel, pool);
+	kem_test_seed = 0;
+	rc_custom = OQS_KEM_keypair_parallel(kem, public_key_custom, secret_key_custom, custom_pool);
+	kem_test_restore_randombytes();
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	OQS_TEST_CT_DECLASSIFY(&rc_parallel, sizeof rc_parallel);
+	OQS_TEST_CT_DECLASSIFY(&rc_custom, sizeof rc_custom);
+	if (rc != OQS_SUCCESS || rc_parallel != OQS_SUCCESS || rc_custom != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_KEM_keypair or OQS_KEM_keypair_parallel failed\n");
+		goto err;
+	}
+
+	OQS_TEST_CT_DECLASSIFY(public_key, kem->length_public_key);
+	OQS_TEST_CT_DECLASSIFY(public_key_parallel, kem->length_public_key);
+	OQS_TEST_CT_DECLASSIFY(public_key_custom, kem->length_public_key);
+	OQS_TEST_CT_DECLASSIFY(secret_key, kem->length_secret_key);
+	OQS_TEST_CT_DECLASSIFY(secret_key_parallel, kem->length_secret_key);
+	OQS_TEST_CT_DECLASSIFY(secret_key_custom, kem->length_secret_key);
+	if (memcmp(public_key, public_key_parallel, kem->length_public_key) != 0 || memcmp(secret_key, secret_key_parallel, kem->length_secret_key) != 0) {
+		fprintf(stderr, "ERROR: OQS_KEM_keypair_parallel and OQS_KEM_keypair disagree\n");
+		goto err;
+	}
+	if (memcmp(public_key, public_key_custom, kem->length_public_key) != 0 || memcmp(secret_key, secret_key_custom, kem->length_secret_key) != 0) {
+		fprintf(stderr, "ERROR: OQS_KEM_keypair_parallel with a custom executor and OQS_KEM_keypair disagree\n");
+		goto err;
+	}
+	if (kem->keypair_parallel != NULL && custom_calls == 0) {
+		fprintf(stderr, "ERROR: OQS_KEM_keypair_parallel did not use the custom executor\n");
+		goto err;
+	}
+	printf("parallel key generation matches OQS_KEM_keypair (%zu custom executor tasks)\n", custom_calls);
+
+	ret = OQS_SUCCESS;
+	goto cleanup;
+
+err:
+	ret = OQS_ERROR;
+
+cleanup:
+	if (kem != NULL) {
+		OQS_MEM_secure_free(secret_key, kem->length_secret_key);
+		OQS_MEM_secure_free(secret_key_parallel, kem->length_secret_key);
+		OQS_MEM_secure_free(secret_key_custom, kem->length_secret_key);
+	}
+	OQS_MEM_insecure_free(public_key);
+	OQS_MEM_insecure_free(public_key_parallel);
+	OQS_MEM_insecure_free(public_key_custom);
+	OQS_THREADPOOL_free(pool);
+	OQS_THREADPOOL_free(custom_pool);
+	OQS_KEM_free(kem);
+
+	return ret;
+}
+
+/* more keypairs are taken than the pool holds, so some may come from the fallback path */
+#define KEM_TEST_KEYPOOL_CAPACITY 4
+#define KEM_TEST_KEYPOOL_TAKES 5
+/* how long to wait for the refill thread to fill the pool for the first time */
+#define KEM_TEST_KEYPOOL_WAIT_MS 600000
+
+/* Waits until the pool is full, or the wait times out */
+static size_t kem_test_keypool_wait_full(const OQS_KEM_KEYPOOL *pool) {
+	size_t available = OQS_KEM_KEYPOOL_available(pool);
+#if OQS_USE_PTHREADS
+	const struct timespec poll_interval = {0, 1000000};
+	for (size_t waited = 0; available < KEM_TEST_KEYPOOL_CAPACITY && waited < KEM_TEST_KEYPOOL_WAIT_MS; waited++) {
+		nanosleep(&poll_interval, NULL);
+		available = OQS_KEM_KEYPOOL_available(pool);
+	}
+#endif
+	return available;
+}
+
+static OQS_STATUS kem_test_keypool(const char *method_name) {
+
+	OQS_KEM *kem = NULL;
+	OQS_KEM_KEYPOOL *pool = NULL;
+	uint8_t *public_key = NULL;
+	uint8_t *secret_key = NULL;
+	uint8_t *previous_public_key = NULL;
+	uint8_t *ciphertext = NULL;
+	uint8_t *shared_secret_e = NULL;
+	uint8_t *shared_secret_d = NULL;
+	size_t available;
+	OQS_STATUS rc, ret = OQS_ERROR;
+
+	kem = OQS_KEM_new(method_name);
+	if (kem == NULL) {
+		fprintf(stderr, "ERROR: OQS_KEM_new failed\n");
+		goto err;
+	}
+
+	public_key = OQS_MEM_malloc(kem->length_public_key);
+	secret_key = OQS_MEM_malloc(kem->length_secret_key);
+	previous_public_key = OQS_MEM_calloc(1, kem->length_public_key);
+	ciphertext = OQS_MEM_malloc(kem->length_ciphertext);
+	shared_secret_e = OQS_MEM_malloc(kem->length_shared_secret);
+	shared_secret_d = OQS_MEM_malloc(kem->length_shared_secret);
+	if ((public_key == NULL) || (secret_key == NULL) || (previous_public_key == NULL) || (ciphertext == NULL) || (shared_secret_e == NULL) || (shared_secret_d == NULL)) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		goto err;
+	}
+
+	pool = OQS_KEM_KEYPOOL_new(kem, KEM_TEST_KEYPOOL_CAPACITY);
+	if (pool == NULL) {
+		fprintf(stderr, "ERROR: OQS_KEM_KEYPOOL_new failed\n");
+		goto err;
+	}
+	available = kem_test_keypool_wait_full(pool);
+	if (available != KEM_TEST_KEYPOOL_CAPACITY) {
+		fprintf(stderr, "ERROR: OQS_KEM_KEYPOOL_available returned %zu for a full pool\n", available);
+		goto err;
+	}
+
+	for (size_t i = 0; i < KEM_TEST_KEYPOOL_TAKES; i++) {
+		rc = OQS_KEM_KEYPOOL_take(pool, public_key, secret_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_KEM_KEYPOOL_take failed\n");
+			goto err;
+		}
+		/* nothing refills the pool until half of it or more has been taken */
+		available = OQS_KEM_KEYPOOL_available(pool);
+		if (i + 1 < KEM_TEST_KEYPOOL_CAPACITY - KEM_TEST_KEYPOOL_CAPACITY / 2 && available != KEM_TEST_KEYPOOL_CAPACITY - i - 1) {
+			fprintf(stderr, "ERROR: OQS_KEM_KEYPOOL_available returned %zu after %zu keypairs were taken\n", available, i + 1);
+			goto err;
+		}
+		if (available > KEM_TEST_KEYPOOL_CAPACITY) {
+			fprintf(stderr, "ERROR: OQS_KEM_KEYPOOL_available returned %zu for a pool of %d\n", available, KEM_TEST_KEYPOOL_CAPACITY);
+			goto err;
+		}
+		OQS_TEST_CT_DECLASSIFY(public_key, kem->length_public_key);
+		if (memcmp(public_key, previous_public_key, kem->length_public_key) == 0) {
+			fprintf(stderr, "ERROR: OQS_KEM_KEYPOOL_take returned the same public key twice\n");
+			goto err;
+		}
+		memcpy(previous_public_key, public_key, kem->length_public_key);
+
+		rc = OQS_KEM_encaps(kem, ciphertext, shared_secret_e, public_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_KEM_encaps failed\n");
+			goto err;
+		}
+		OQS_TEST_CT_DECLASSIFY(ciphertext, kem->length_ciphertext);
+		rc = OQS_KEM_decaps(kem, shared_secret_d, ciphertext, secret_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		OQS_TEST_CT_DECLASSIFY(shared_secret_e, kem->length_shared_secret);
+		OQS_TEST_CT_DECLASSIFY(shared_secret_d, kem->length_shared_secret);
+		if (rc != OQS_SUCCESS || memcmp(shared_secret_e, shared_secret_d, kem->length_shared_secret) != 0) {
+			fprintf(stderr, "ERROR: shared secrets from a pooled keypair are not equal\n");
+			goto err;
+		}
+	}
+	printf("shared secrets from pooled keypairs are equal\n");
+
+	ret = OQS_SUCCESS;
+	goto cleanup;
+
+err:
+	ret = OQS_ERROR;
+
+cleanup:
+	OQS_KEM_KEYPOOL_free(pool);
+	if (kem != NULL) {
+		OQS_MEM_secure_free(secret_key, kem->length_secret_key);
+		OQS_MEM_secure_free(shared_secret_e, kem->length_shared_secret);
+		OQS_MEM_secure_free(shared_secret_d, kem->length_shared_secret);
+	}
+	OQS_MEM_insecure_free(public_key);
+	OQS_MEM_insecure_free(previous_public_key);
+	OQS_MEM_insecure_free(ciphertext);
+	OQS_KEM_free(kem);
+
+	return ret;
+}
+
+static OQS_STATUS kem_test(const char *method_name) {
+	OQS_STATUS rc = kem_test_correctness(method_name);
+	if (rc == OQS_SUCCESS) {
+		rc = kem_test_batch(method_name);
+	}
+	if (rc == OQS_SUCCESS) {
+		rc = kem_test_keypair_batch(method_name);
+	}
+	if (rc == OQS_SUCCESS) {
+		rc = kem_test_expanded(method_name);
+	}
+	if (rc == OQS_SUCCESS) {
+		rc = kem_test_stream(method_name);
+	}
+	if (rc == OQS_SUCCESS) {
+		rc = kem_test_parallel_keypair(method_name);
+	}
+	if (rc == OQS_SUCCESS) {
+		rc = kem_test_keypool(method_name);
+	}
+	return rc;
+}
+
 #ifdef OQS_ENABLE_TEST_CONSTANT_TIME
 static void TEST_KEM_randombytes(uint8_t *random_array, size_t bytes_to_read) {
 	// We can't make direct calls to the system randombytes on some platforms,
@@ -205,7 +938,7 @@ struct thread_data {
 
 void *test_wrapper(void *arg) {
 	struct thread_data *td = arg;
-	td->rc = kem_test_correctness(td->alg_name);
+	td->rc = kem_test(td->alg_name);
 	return NULL;
 }
 #endif
@@ -269,10 +1002,10 @@ int main(int argc, char **argv) {
 		pthread_join(thread, NULL);
 		rc = td.rc;
 	} else {
-		rc = kem_test_correctness(alg_name);
+		rc = kem_test(alg_name);
 	}
 #else
-	rc = kem_test_correctness(alg_name);
+	rc = kem_test(alg_name);
 #endif
 	if (rc != OQS_SUCCESS) {
 		OQS_destroy();
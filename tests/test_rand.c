@@ -0,0 +1,239 @@
+// SPDX-License-Identifier: MIT
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <oqs/oqs.h>
+
+#if OQS_USE_PTHREADS
+#include <pthread.h>
+#endif
+
+#include "system_info.c"
+
+/* The buffered generator refills every 4 KiB and reseeds every 1 MiB, so each
+ * draw crosses refills and a draw of this size crosses a reseed as well */
+#define DRAW_BYTES (1024 * 1024 + 3 * 4096 + 123)
+#define BLOCK_BYTES 16
+#define SMALL_DRAW_BYTES 64
+
+static int compare_blocks(const void *a, const void *b) {
+	return memcmp(a, b, BLOCK_BYTES);
+}
+
+/* Two large draws must differ, and no 16-byte block may repeat within or across them */
+static int test_large_draws(void) {
+	size_t blocks = 2 * (DRAW_BYTES / BLOCK_BYTES);
+	uint8_t *draws = OQS_MEM_malloc(2 * DRAW_BYTES);
+	uint8_t *sorted = OQS_MEM_malloc(blocks * BLOCK_BYTES);
+	int ret = EXIT_FAILURE;
+
+	if (draws == NULL || sorted == NULL) {
+		printf("test_large_draws: OQS_MEM_malloc failed\n");
+		goto cleanup;
+	}
+	OQS_randombytes(draws, DRAW_BYTES);
+	OQS_randombytes(draws + DRAW_BYTES, DRAW_BYTES);
+	if (memcmp(draws, draws + DRAW_BYTES, DRAW_BYTES) == 0) {
+		printf("test_large_draws: two draws are identical\n");
+		goto cleanup;
+	}
+
+	memcpy(sorted, draws, blocks / 2 * BLOCK_BYTES);
+	memcpy(sorted + blocks / 2 * BLOCK_BYTES, draws + DRAW_BYTES, blocks / 2 * BLOCK_BYTES);
+	qsort(sorted, blocks, BLOCK_BYTES, compare_blocks);
+	for (size_t i = 1; i < blocks; i++) {
+		if (memcmp(sorted + (i - 1) * BLOCK_BYTES, sorted + i * BLOCK_BYTES, BLOCK_BYTES) == 0) {
+			printf("test_large_draws: a %d-byte block was returned twice\n", BLOCK_BYTES);
+			goto cleanup;
+		}
+	}
+	ret = EXIT_SUCCESS;
+
+cleanup:
+	OQS_MEM_insecure_free(draws);
+	OQS_MEM_insecure_free(sorted);
+	return ret;
+}
+
+/* A forked child must not return the bytes the parent returns next */
+static int test_fork(void) {
+	uint8_t parent[SMALL_DRAW_BYTES], child[SMALL_DRAW_BYTES];
+	int fds[2];
+	pid_t pid;
+	int status;
+	ssize_t n;
+
+	/* make sure the parent has buffered bytes that the child inherits */
+	OQS_randombytes(parent, sizeof(parent));
+	if (pipe(fds) != 0) {
+		printf("test_fork: pipe failed\n");
+		return EXIT_FAILURE;
+	}
+	pid = fork();
+	if (pid < 0) {
+		printf("test_fork: fork failed\n");
+		return EXIT_FAILURE;
+	}
+	if (pid == 0) {
+		close(fds[0]);
+		OQS_randombytes(child, sizeof(child));
+		n = write(fds[1], child, sizeof(child));
+		close(fds[1]);
+		_exit(n == (ssize_t)sizeof(child) ? EXIT_SUCCESS : EXIT_FAILURE);
+	}
+	close(fds[1]);
+	OQS_randombytes(parent, sizeof(parent));
+	n = read(fds[0], child, sizeof(child));
+	close(fds[0]);
+	if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS || n != (ssize_t)sizeof(child)) {
+		printf("test_fork: the child failed\n");
+		return EXIT_FAILURE;
+	}
+	if (memcmp(parent, child, sizeof(parent)) == 0) {
+		printf("test_fork: the child returned the same bytes as the parent\n");
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+#if OQS_USE_PTHREADS
+static void *draw_in_thread(void *arg) {
+	OQS_randombytes(arg, SMALL_DRAW_BYTES);
+	return NULL;
+}
+
+/* Every thread has its own generator, which must not repeat another's output */
+static int test_threads(void) {
+	uint8_t first[SMALL_DRAW_BYTES], second[SMALL_DRAW_BYTES];
+	pthread_t thread;
+
+	if (pthread_create(&thread, NULL, draw_in_thread, first) != 0) {
+		printf("test_threads: pthread_create failed\n");
+		return EXIT_FAILURE;
+	}
+	pthread_join(thread, NULL);
+	if (pthread_create(&thread, NULL, draw_in_thread, second) != 0) {
+		printf("test_threads: pthread_create failed\n");
+		return EXIT_FAILURE;
+	}
+	pthread_join(thread, NULL);
+	if (memcmp(first, second, sizeof(first)) == 0) {
+		printf("test_threads: two threads returned the same bytes\n");
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+#endif
+
+/* Round-trips the first enabled KEM with keys and randomness from the generator */
+static int test_kem_round_trip(void) {
+	OQS_KEM *kem = NULL;
+	uint8_t *public_key = NULL, *secret_key = NULL, *ciphertext = NULL;
+	uint8_t *shared_secret_e = NULL, *shared_secret_d = NULL;
+	int ret = EXIT_FAILURE;
+
+	for (size_t i = 0; i < OQS_KEM_algs_length && kem == NULL; i++) {
+		kem = OQS_KEM_new(OQS_KEM_alg_identifier(i));
+	}
+	if (kem == NULL) {
+		printf("test_kem_round_trip: no KEM enabled, skipping\n");
+		return EXIT_SUCCESS;
+	}
+	public_key = OQS_MEM_malloc(kem->length_public_key);
+	secret_key = OQS_MEM_malloc(kem->length_secret_key);
+	ciphertext = OQS_MEM_malloc(kem->length_ciphertext);
+	shared_secret_e = OQS_MEM_malloc(kem->length_shared_secret);
+	shared_secret_d = OQS_MEM_malloc(kem->length_shared_secret);
+	if (public_key == NULL || secret_key == NULL || ciphertext == NULL || shared_secret_e == NULL || shared_secret_d == NULL) {
+		printf("test_kem_round_trip: OQS_MEM_malloc failed\n");
+		goto cleanup;
+	}
+	if (OQS_KEM_keypair(kem, public_key, secret_key) != OQS_SUCCESS ||
+	        OQS_KEM_encaps(kem, ciphertext, shared_secret_e, public_key) != OQS_SUCCESS ||
+	        OQS_KEM_decaps(kem, shared_secret_d, ciphertext, secret_key) != OQS_SUCCESS ||
+	        memcmp(shared_secret_e, shared_secret_d, kem->length_shared_secret) != 0) {
+		printf("test_kem_round_trip: %s failed\n", kem->method_name);
+		goto cleanup;
+	}
+	ret = EXIT_SUCCESS;
+
+cleanup:
+	OQS_MEM_secure_free(secret_key, kem->length_secret_key);
+	OQS_MEM_secure_free(shared_secret_e, kem->length_shared_secret);
+	OQS_MEM_secure_free(shared_secret_d, kem->length_shared_secret);
+	OQS_MEM_insecure_free(public_key);
+	OQS_MEM_insecure_free(ciphertext);
+	OQS_KEM_free(kem);
+	return ret;
+}
+
+/* Signs and verifies with the first enabled signature scheme */
+static int test_sig_round_trip(void) {
+	static const uint8_t message[] = "test_rand";
+	OQS_SIG *sig = NULL;
+	uint8_t *public_key = NULL, *secret_key = NULL, *signature = NULL;
+	size_t signature_len;
+	int ret = EXIT_FAILURE;
+
+	for (size_t i = 0; i < OQS_SIG_algs_length && sig == NULL; i++) {
+		sig = OQS_SIG_new(OQS_SIG_alg_identifier(i));
+	}
+	if (sig == NULL) {
+		printf("test_sig_round_trip: no signature scheme enabled, skipping\n");
+		return EXIT_SUCCESS;
+	}
+	public_key = OQS_MEM_malloc(sig->length_public_key);
+	secret_key = OQS_MEM_malloc(sig->length_secret_key);
+	signature = OQS_MEM_malloc(sig->length_signature);
+	if (public_key == NULL || secret_key == NULL || signature == NULL) {
+		printf("test_sig_round_trip: OQS_MEM_malloc failed\n");
+		goto cleanup;
+	}
+	if (OQS_SIG_keypair(sig, public_key, secret_key) != OQS_SUCCESS ||
+	        OQS_SIG_sign(sig, signature, &signature_len, message, sizeof(message), secret_key) != OQS_SUCCESS ||
+	        OQS_SIG_verify(sig, message, sizeof(message), signature, signature_len, public_key) != OQS_SUCCESS) {
+		printf("test_sig_round_trip: %s failed\n", sig->method_name);
+		goto cleanup;
+	}
+	ret = EXIT_SUCCESS;
+
+cleanup:
+	OQS_MEM_secure_free(secret_key, sig->length_secret_key);
+	OQS_MEM_insecure_free(public_key);
+	OQS_MEM_insecure_free(signature);
+	OQS_SIG_free(sig);
+	return ret;
+}
+
+int main(void) {
+	OQS_init();
+	print_system_info();
+
+	printf("=== test_rand %s ===\n", OQS_RAND_alg_buffered);
+	if (OQS_randombytes_switch_algorithm(OQS_RAND_alg_buffered) != OQS_SUCCESS) {
+		printf("OQS_randombytes_switch_algorithm(%s) failed\n", OQS_RAND_alg_buffered);
+		OQS_destroy();
+		return EXIT_FAILURE;
+	}
+	if (test_large_draws() != EXIT_SUCCESS ||
+	        test_fork() != EXIT_SUCCESS ||
+#if OQS_USE_PTHREADS
+	        test_threads() != EXIT_SUCCESS ||
+#endif
+	        test_kem_round_trip() != EXIT_SUCCESS ||
+	        test_sig_round_trip() != EXIT_SUCCESS) {
+		OQS_destroy();
+		return EXIT_FAILURE;
+	}
+
+	printf("Tests passed.\n\n");
+	OQS_destroy();
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,16 @@
+# SPDX-License-Identifier: MIT
+
+import helpers
+import pytest
+import sys
+
+@helpers.filtered_test
+@pytest.mark.skipif(sys.platform.startswith("win"), reason="Not supported on Windows")
+def test_rand_buffered():
+    helpers.run_subprocess(
+        [helpers.path_to_executable('test_rand')],
+    )
+
+if __name__ == "__main__":
+    import sys
+    pytest.main(sys.argv)
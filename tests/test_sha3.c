@@ -525,6 +525,25 @@ int shake_128_kat_test(void) {
 	OQS_SHA3_shake128_inc_squeeze(hash, sizeof(hash), &state);
 	OQS_SHA3_shake128_inc_ctx_release(&state);
 
+	if (are_equal8(hash, exp1600, 512) == EXIT_FAILURE) {
+		status = EXIT_FAILURE;
+	}
+	/* Test in-place init, including clone into and out of caller storage */
+	OQS_SHA3_inc_storage storage, storage2;
+
+	clear8(hash, sizeof(hash));
+	OQS_SHA3_shake128_inc_init_inplace(&state, &storage);
+	OQS_SHA3_shake128_inc_absorb(&state, msg1600, sizeof(msg1600));
+	OQS_SHA3_shake128_inc_finalize(&state);
+	OQS_SHA3_shake128_inc_init(&state2);
+	OQS_SHA3_shake128_inc_ctx_clone(&state2, &state);
+	OQS_SHA3_shake128_inc_ctx_release(&state);
+	OQS_SHA3_shake128_inc_init_inplace(&state, &storage2);
+	OQS_SHA3_shake128_inc_ctx_clone(&state, &state2);
+	OQS_SHA3_shake128_inc_ctx_release(&state2);
+	OQS_SHA3_shake128_inc_squeeze(hash, sizeof(hash), &state);
+	OQS_SHA3_shake128_inc_ctx_release(&state);
+
 	if (are_equal8(hash, exp1600, 512) == EXIT_FAILURE) {
 		status = EXIT_FAILURE;
 	}
@@ -718,6 +737,25 @@ int shake_256_kat_test(void) {
 	OQS_SHA3_shake256_inc_squeeze(hash, sizeof(hash), &state);
 	OQS_SHA3_shake256_inc_ctx_release(&state);
 
+	if (are_equal8(hash, exp1600, 512) == EXIT_FAILURE) {
+		status = EXIT_FAILURE;
+	}
+	/* Test in-place init, including clone into and out of caller storage */
+	OQS_SHA3_inc_storage storage, storage2;
+
+	clear8(hash, sizeof(hash));
+	OQS_SHA3_shake256_inc_init_inplace(&state, &storage);
+	OQS_SHA3_shake256_inc_absorb(&state, msg1600, sizeof(msg1600));
+	OQS_SHA3_shake256_inc_finalize(&state);
+	OQS_SHA3_shake256_inc_init(&state2);
+	OQS_SHA3_shake256_inc_ctx_clone(&state2, &state);
+	OQS_SHA3_shake256_inc_ctx_release(&state);
+	OQS_SHA3_shake256_inc_init_inplace(&state, &storage2);
+	OQS_SHA3_shake256_inc_ctx_clone(&state, &state2);
+	OQS_SHA3_shake256_inc_ctx_release(&state2);
+	OQS_SHA3_shake256_inc_squeeze(hash, sizeof(hash), &state);
+	OQS_SHA3_shake256_inc_ctx_release(&state);
+
 	if (are_equal8(hash, exp1600, 512) == EXIT_FAILURE) {
 		status = EXIT_FAILURE;
 	}
@@ -879,6 +917,25 @@ int shake_128_x4_kat_test(void) {
 		status = EXIT_FAILURE;
 	}
 
+	/* test in-place init */
+	clear8(output0, 512);
+	clear8(output1, 512);
+	clear8(output2, 512);
+	clear8(output3, 512);
+	OQS_SHA3_x4_inc_storage storage;
+	OQS_SHA3_shake128_x4_inc_init_inplace(&state, &storage);
+	OQS_SHA3_shake128_x4_inc_absorb(&state, msg1600, msg1600, msg1600, msg1600, 200);
+	OQS_SHA3_shake128_x4_inc_finalize(&state);
+	OQS_SHA3_shake128_x4_inc_squeeze(output0, output1, output2, output3, 512, &state);
+	OQS_SHA3_shake128_x4_inc_ctx_release(&state);
+
+	if (are_equal8(output0, exp1600, 512) == EXIT_FAILURE
+	        || are_equal8(output1, exp1600, 512) == EXIT_FAILURE
+	        || are_equal8(output2, exp1600, 512) == EXIT_FAILURE
+	        || are_equal8(output3, exp1600, 512) == EXIT_FAILURE) {
+		status = EXIT_FAILURE;
+	}
+
 	return status;
 }
 
@@ -1037,6 +1094,117 @@ int shake_256_x4_kat_test(void) {
 		status = EXIT_FAILURE;
 	}
 
+	/* test in-place init */
+	clear8(output0, 512);
+	clear8(output1, 512);
+	clear8(output2, 512);
+	clear8(output3, 512);
+	OQS_SHA3_x4_inc_storage storage;
+	OQS_SHA3_shake256_x4_inc_init_inplace(&state, &storage);
+	OQS_SHA3_shake256_x4_inc_absorb(&state, msg1600, msg1600, msg1600, msg1600, 200);
+	OQS_SHA3_shake256_x4_inc_finalize(&state);
+	OQS_SHA3_shake256_x4_inc_squeeze(output0, output1, output2, output3, 512, &state);
+	OQS_SHA3_shake256_x4_inc_ctx_release(&state);
+
+	if (are_equal8(output0, exp1600, 512) == EXIT_FAILURE
+	        || are_equal8(output1, exp1600, 512) == EXIT_FAILURE
+	        || are_equal8(output2, exp1600, 512) == EXIT_FAILURE
+	        || are_equal8(output3, exp1600, 512) == EXIT_FAILURE) {
+		status = EXIT_FAILURE;
+	}
+
+	return status;
+}
+
+/**
+* \brief Tests the eight-way parallel SHAKE API, one-shot and incremental, against single SHAKE-128 and SHAKE-256,
+* over input and output lengths around the rate boundaries, with a distinct message
+* in every lane.
+*
+* \return Returns 0 for success, 1 for failure
+*/
+int shake_x8_test(void) {
+	static const size_t lengths[] = {0, 1, 135, 136, 137, 167, 168, 169, 337, 1000};
+	uint8_t msg[8][1000];
+	uint8_t out[8][1000];
+	uint8_t exp[1000];
+	int status = EXIT_SUCCESS;
+
+	for (size_t j = 0; j < 8; j++) {
+		for (size_t k = 0; k < sizeof(msg[j]); k++) {
+			msg[j][k] = (uint8_t)(k * 13 + j * 101 + 7);
+		}
+	}
+
+	for (size_t a = 0; a < sizeof(lengths) / sizeof(lengths[0]); a++) {
+		size_t inlen = lengths[a];
+		size_t outlen = lengths[sizeof(lengths) / sizeof(lengths[0]) - 1 - a];
+		if (outlen == 0) {
+			outlen = 32;
+		}
+
+		OQS_SHA3_shake128_x8(out[0], out[1], out[2], out[3], out[4], out[5], out[6], out[7], outlen,
+		                     msg[0], msg[1], msg[2], msg[3], msg[4], msg[5], msg[6], msg[7], inlen);
+		for (size_t j = 0; j < 8; j++) {
+			OQS_SHA3_shake128(exp, outlen, msg[j], inlen);
+			if (are_equal8(out[j], exp, outlen) == EXIT_FAILURE) {
+				status = EXIT_FAILURE;
+			}
+		}
+
+		OQS_SHA3_shake256_x8(out[0], out[1], out[2], out[3], out[4], out[5], out[6], out[7], outlen,
+		                     msg[0], msg[1], msg[2], msg[3], msg[4], msg[5], msg[6], msg[7], inlen);
+		for (size_t j = 0; j < 8; j++) {
+			OQS_SHA3_shake256(exp, outlen, msg[j], inlen);
+			if (are_equal8(out[j], exp, outlen) == EXIT_FAILURE) {
+				status = EXIT_FAILURE;
+			}
+		}
+
+		/* incremental API: absorb and squeeze in two uneven pieces, on a
+		 * state that has been reset after absorbing other input */
+		size_t in_split = inlen / 3, out_split = outlen / 3;
+		OQS_SHA3_shake128_x8_inc_ctx state128;
+		OQS_SHA3_shake128_x8_inc_init(&state128);
+		OQS_SHA3_shake128_x8_inc_absorb(&state128, msg[7], msg[6], msg[5], msg[4], msg[3], msg[2], msg[1], msg[0], 200);
+		OQS_SHA3_shake128_x8_inc_ctx_reset(&state128);
+		OQS_SHA3_shake128_x8_inc_absorb(&state128, msg[0], msg[1], msg[2], msg[3], msg[4], msg[5], msg[6], msg[7], in_split);
+		OQS_SHA3_shake128_x8_inc_absorb(&state128, msg[0] + in_split, msg[1] + in_split, msg[2] + in_split, msg[3] + in_split,
+		                                msg[4] + in_split, msg[5] + in_split, msg[6] + in_split, msg[7] + in_split, inlen - in_split);
+		OQS_SHA3_shake128_x8_inc_finalize(&state128);
+		OQS_SHA3_shake128_x8_inc_squeeze(out[0], out[1], out[2], out[3], out[4], out[5], out[6], out[7], out_split, &state128);
+		OQS_SHA3_shake128_x8_inc_squeeze(out[0] + out_split, out[1] + out_split, out[2] + out_split, out[3] + out_split,
+		                                 out[4] + out_split, out[5] + out_split, out[6] + out_split, out[7] + out_split, outlen - out_split, &state128);
+		OQS_SHA3_shake128_x8_inc_ctx_release(&state128);
+		for (size_t j = 0; j < 8; j++) {
+			OQS_SHA3_shake128(exp, outlen, msg[j], inlen);
+			if (are_equal8(out[j], exp, outlen) == EXIT_FAILURE) {
+				status = EXIT_FAILURE;
+			}
+		}
+
+		/* incremental API: squeeze from a clone of the absorbed state */
+		OQS_SHA3_shake256_x8_inc_ctx state256, clone256;
+		OQS_SHA3_shake256_x8_inc_init(&state256);
+		OQS_SHA3_shake256_x8_inc_init(&clone256);
+		OQS_SHA3_shake256_x8_inc_absorb(&state256, msg[0], msg[1], msg[2], msg[3], msg[4], msg[5], msg[6], msg[7], in_split);
+		OQS_SHA3_shake256_x8_inc_absorb(&state256, msg[0] + in_split, msg[1] + in_split, msg[2] + in_split, msg[3] + in_split,
+		                                msg[4] + in_split, msg[5] + in_split, msg[6] + in_split, msg[7] + in_split, inlen - in_split);
+		OQS_SHA3_shake256_x8_inc_ctx_clone(&clone256, &state256);
+		OQS_SHA3_shake256_x8_inc_ctx_release(&state256);
+		OQS_SHA3_shake256_x8_inc_finalize(&clone256);
+		OQS_SHA3_shake256_x8_inc_squeeze(out[0], out[1], out[2], out[3], out[4], out[5], out[6], out[7], out_split, &clone256);
+		OQS_SHA3_shake256_x8_inc_squeeze(out[0] + out_split, out[1] + out_split, out[2] + out_split, out[3] + out_split,
+		                                 out[4] + out_split, out[5] + out_split, out[6] + out_split, out[7] + out_split, outlen - out_split, &clone256);
+		OQS_SHA3_shake256_x8_inc_ctx_release(&clone256);
+		for (size_t j = 0; j < 8; j++) {
+			OQS_SHA3_shake256(exp, outlen, msg[j], inlen);
+			if (are_equal8(out[j], exp, outlen) == EXIT_FAILURE) {
+				status = EXIT_FAILURE;
+			}
+		}
+	}
+
 	return status;
 }
 
@@ -1115,6 +1283,38 @@ int main(UNUSED int argc, UNUSED char **argv) {
 		ret = EXIT_FAILURE;
 	}
 
+	if (shake_x8_test() == EXIT_SUCCESS) {
+		printf("Success! passed eight-way parallel shake tests \n");
+	} else {
+		printf("Failure! failed eight-way parallel shake tests \n");
+		ret = EXIT_FAILURE;
+	}
+
+	/* again with a provider that implements none of the eight-way functions */
+	sha3_x4_callbacks.SHA3_shake128_x8 = NULL;
+	sha3_x4_callbacks.SHA3_shake256_x8 = NULL;
+	sha3_x4_callbacks.SHA3_shake128_x8_inc_init = NULL;
+	sha3_x4_callbacks.SHA3_shake128_x8_inc_absorb = NULL;
+	sha3_x4_callbacks.SHA3_shake128_x8_inc_finalize = NULL;
+	sha3_x4_callbacks.SHA3_shake128_x8_inc_squeeze = NULL;
+	sha3_x4_callbacks.SHA3_shake128_x8_inc_ctx_release = NULL;
+	sha3_x4_callbacks.SHA3_shake128_x8_inc_ctx_clone = NULL;
+	sha3_x4_callbacks.SHA3_shake128_x8_inc_ctx_reset = NULL;
+	sha3_x4_callbacks.SHA3_shake256_x8_inc_init = NULL;
+	sha3_x4_callbacks.SHA3_shake256_x8_inc_absorb = NULL;
+	sha3_x4_callbacks.SHA3_shake256_x8_inc_finalize = NULL;
+	sha3_x4_callbacks.SHA3_shake256_x8_inc_squeeze = NULL;
+	sha3_x4_callbacks.SHA3_shake256_x8_inc_ctx_release = NULL;
+	sha3_x4_callbacks.SHA3_shake256_x8_inc_ctx_clone = NULL;
+	sha3_x4_callbacks.SHA3_shake256_x8_inc_ctx_reset = NULL;
+
+	if (shake_x8_test() == EXIT_SUCCESS) {
+		printf("Success! passed eight-way parallel shake tests on four-way callbacks \n");
+	} else {
+		printf("Failure! failed eight-way parallel shake tests on four-way callbacks \n");
+		ret = EXIT_FAILURE;
+	}
+
 	if (!sha3_callback_called) {
 		printf("Failure! SHA3 callback was not called\n");
 		ret = EXIT_FAILURE;
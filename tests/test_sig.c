@@ -159,6 +159,419 @@ cleanup:
 	return ret;
 }
 
+static OQS_STATUS sig_test_expanded(const char *method_name) {
+
+	OQS_SIG *sig = NULL;
+	OQS_SIG_expanded_public_key *expanded_public_key = NULL;
+	OQS_SIG_expanded_secret_key *expanded_secret_key = NULL;
+	uint8_t *public_key = NULL;
+	uint8_t *secret_key = NULL;
+	uint8_t *message = NULL;
+	size_t message_len = 100;
+	uint8_t *signature = NULL;
+	size_t signature_len;
+	OQS_STATUS rc, ret = OQS_ERROR;
+
+	sig = OQS_SIG_new(method_name);
+	if (sig == NULL) {
+		fprintf(stderr, "ERROR: OQS_SIG_new failed\n");
+		goto err;
+	}
+
+	public_key = OQS_MEM_malloc(sig->length_public_key);
+	secret_key = OQS_MEM_malloc(sig->length_secret_key);
+	message = OQS_MEM_malloc(message_len);
+	signature = OQS_MEM_malloc(sig->length_signature);
+	if ((public_key == NULL) || (secret_key == NULL) || (message == NULL) || (signature == NULL)) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		goto err;
+	}
+
+	rc = OQS_SIG_keypair(sig, public_key, secret_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_keypair failed\n");
+		goto err;
+	}
+
+	OQS_TEST_CT_DECLASSIFY(public_key, sig->length_public_key);
+	expanded_public_key = OQS_SIG_public_key_expand(sig, public_key);
+	if (expanded_public_key == NULL) {
+		fprintf(stderr, "ERROR: OQS_SIG_public_key_expand failed\n");
+		goto err;
+	}
+
+	// the expanded key must be reusable
+	for (int i = 0; i < 2; i++) {
+		OQS_randombytes(message, message_len);
+		OQS_TEST_CT_DECLASSIFY(message, message_len);
+		rc = OQS_SIG_sign(sig, signature, &signature_len, message, message_len, secret_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_sign failed\n");
+			goto err;
+		}
+
+		OQS_TEST_CT_DECLASSIFY(signature, signature_len);
+		rc = OQS_SIG_verify_expanded(sig, message, message_len, signature, signature_len, expanded_public_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_verify_expanded failed\n");
+			goto err;
+		}
+	}
+
+	/* modify the message to invalidate the signature */
+	message[0] ^= 1;
+	rc = OQS_SIG_verify_expanded(sig, message, message_len, signature, signature_len, expanded_public_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_ERROR) {
+		fprintf(stderr, "ERROR: OQS_SIG_verify_expanded should have failed!\n");
+		goto err;
+	}
+	printf("verification against expanded public key passes as expected\n");
+
+	expanded_secret_key = OQS_SIG_secret_key_expand(sig, secret_key);
+	if (expanded_secret_key == NULL) {
+		fprintf(stderr, "ERROR: OQS_SIG_secret_key_expand failed\n");
+		goto err;
+	}
+
+	// the expanded key must be reusable
+	for (int i = 0; i < 2; i++) {
+		OQS_randombytes(message, message_len);
+		OQS_TEST_CT_DECLASSIFY(message, message_len);
+		rc = OQS_SIG_sign_expanded(sig, signature, &signature_len, message, message_len, expanded_secret_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_sign_expanded failed\n");
+			goto err;
+		}
+
+		OQS_TEST_CT_DECLASSIFY(signature, signature_len);
+		rc = OQS_SIG_verify(sig, message, message_len, signature, signature_len, public_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: signature from expanded secret key does not verify\n");
+			goto err;
+		}
+	}
+	printf("signatures from expanded secret key verify as expected\n");
+
+	ret = OQS_SUCCESS;
+	goto cleanup;
+
+err:
+	ret = OQS_ERROR;
+
+cleanup:
+	OQS_SIG_expanded_public_key_free(expanded_public_key);
+	OQS_SIG_expanded_secret_key_free(expanded_secret_key);
+	if (sig != NULL) {
+		OQS_MEM_secure_free(secret_key, sig->length_secret_key);
+	}
+	OQS_MEM_insecure_free(public_key);
+	OQS_MEM_insecure_free(message);
+	OQS_MEM_insecure_free(signature);
+	OQS_SIG_free(sig);
+
+	return ret;
+}
+
+/* feed the message in uneven chunks, including an empty one */
+static OQS_STATUS sig_test_stream_update(OQS_SIG_STREAM *stream, const uint8_t *message, size_t message_len) {
+	size_t offset = 0;
+	size_t chunk_len = 0;
+	while (offset < message_len) {
+		if (chunk_len > message_len - offset) {
+			chunk_len = message_len - offset;
+		}
+		if (OQS_SIG_STREAM_update(stream, message + offset, chunk_len) != OQS_SUCCESS) {
+			return OQS_ERROR;
+		}
+		offset += chunk_len;
+		chunk_len = 2 * chunk_len + 1;
+	}
+	return OQS_SUCCESS;
+}
+
+static OQS_STATUS sig_test_stream(const char *method_name) {
+
+	OQS_SIG *sig = NULL;
+	OQS_SIG_STREAM *stream = NULL;
+	uint8_t *public_key = NULL;
+	uint8_t *secret_key = NULL;
+	uint8_t *message = NULL;
+	size_t message_len = 1000;
+	uint8_t *signature = NULL;
+	size_t signature_len;
+	OQS_STATUS rc, ret = OQS_ERROR;
+
+	sig = OQS_SIG_new(method_name);
+	if (sig == NULL) {
+		fprintf(stderr, "ERROR: OQS_SIG_new failed\n");
+		goto err;
+	}
+
+	if (!OQS_SIG_STREAM_supported(sig, false)) {
+		printf("streaming is not supported\n");
+		ret = OQS_SUCCESS;
+		goto cleanup;
+	}
+
+	public_key = OQS_MEM_malloc(sig->length_public_key);
+	secret_key = OQS_MEM_malloc(sig->length_secret_key);
+	message = OQS_MEM_malloc(message_len);
+	signature = OQS_MEM_malloc(sig->length_signature);
+	if ((public_key == NULL) || (secret_key == NULL) || (message == NULL) || (signature == NULL)) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		goto err;
+	}
+
+	rc = OQS_SIG_keypair(sig, public_key, secret_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_keypair failed\n");
+		goto err;
+	}
+	OQS_TEST_CT_DECLASSIFY(public_key, sig->length_public_key);
+
+	OQS_randombytes(message, message_len);
+	OQS_TEST_CT_DECLASSIFY(message, message_len);
+	rc = OQS_SIG_sign(sig, signature, &signature_len, message, message_len, secret_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_sign failed\n");
+		goto err;
+	}
+	OQS_TEST_CT_DECLASSIFY(signature, signature_len);
+
+	stream = OQS_SIG_STREAM_verify_init(sig, signature, signature_len, public_key);
+	if (stream == NULL || sig_test_stream_update(stream, message, message_len) != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: streaming verification setup failed\n");
+		goto err;
+	}
+	rc = OQS_SIG_STREAM_verify_final(stream);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_STREAM_verify_final failed\n");
+		goto err;
+	}
+	OQS_SIG_STREAM_free(stream);
+
+	/* modify the message to invalidate the signature */
+	message[message_len - 1] ^= 1;
+	stream = OQS_SIG_STREAM_verify_init(sig, signature, signature_len, public_key);
+	if (stream == NULL || sig_test_stream_update(stream, message, message_len) != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: streaming verification setup failed\n");
+		goto err;
+	}
+	rc = OQS_SIG_STREAM_verify_final(stream);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_ERROR) {
+		fprintf(stderr, "ERROR: OQS_SIG_STREAM_verify_final should have failed!\n");
+		goto err;
+	}
+	OQS_SIG_STREAM_free(stream);
+	stream = NULL;
+	printf("streaming verification passes as expected\n");
+
+	if (OQS_SIG_STREAM_supported(sig, true)) {
+		stream = OQS_SIG_STREAM_sign_init(sig, secret_key);
+		if (stream == NULL || sig_test_stream_update(stream, message, message_len) != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: streaming signing setup failed\n");
+			goto err;
+		}
+		rc = OQS_SIG_STREAM_sign_final(stream, signature, &signature_len);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_STREAM_sign_final failed\n");
+			goto err;
+		}
+
+		OQS_TEST_CT_DECLASSIFY(signature, signature_len);
+		rc = OQS_SIG_verify(sig, message, message_len, signature, signature_len, public_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: streamed signature does not verify\n");
+			goto err;
+		}
+		printf("streamed signatures verify as expected\n");
+	}
+
+	ret = OQS_SUCCESS;
+	goto cleanup;
+
+err:
+	ret = OQS_ERROR;
+
+cleanup:
+	OQS_SIG_STREAM_free(stream);
+	if (sig != NULL) {
+		OQS_MEM_secure_free(secret_key, sig->length_secret_key);
+	}
+	OQS_MEM_insecure_free(public_key);
+	OQS_MEM_insecure_free(message);
+	OQS_MEM_insecure_free(signature);
+	OQS_SIG_free(sig);
+
+	return ret;
+}
+
+#ifdef OQS_ENABLE_TEST_CONSTANT_TIME
+static void TEST_SIG_randombytes(uint8_t *random_array, size_t bytes_to_read);
+#endif
+
+/* Fixed "randomness", so that two signatures on the same message are identical */
+static void sig_test_fixed_randombytes(uint8_t *random_array, size_t bytes_to_read) {
+	memset(random_array, 0xa5, bytes_to_read);
+}
+
+static void sig_test_restore_randombytes(void) {
+#ifdef OQS_ENABLE_TEST_CONSTANT_TIME
+	OQS_randombytes_custom_algorithm(&TEST_SIG_randombytes);
+#else
+	OQS_randombytes_switch_algorithm("system");
+#endif
+}
+
+/* Runs the tasks in reverse order, to check algorithms do not depend on the order */
+static void sig_test_reverse_executor(void *context, OQS_THREADPOOL_task task, void *arg, size_t count) {
+	size_t *calls = context;
+	for (size_t i = count; i > 0; i--) {
+		task(arg, i - 1);
+		(*calls)++;
+	}
+}
+
+static OQS_STATUS sig_test_parallel(const char *method_name) {
+
+	OQS_SIG *sig = NULL;
+	uint8_t *public_key = NULL;
+	uint8_t *secret_key = NULL;
+	uint8_t *message = NULL;
+	size_t message_len = 100;
+	uint8_t *signature = NULL;
+	uint8_t *signature_parallel = NULL;
+	uint8_t *signature_custom = NULL;
+	size_t signature_len;
+	size_t signature_parallel_len;
+	size_t signature_custom_len;
+	OQS_THREADPOOL *pool = NULL;
+	OQS_THREADPOOL *custom_pool = NULL;
+	size_t custom_calls = 0;
+	OQS_STATUS rc, rc_parallel, rc_custom, ret = OQS_ERROR;
+
+	sig = OQS_SIG_new(method_name);
+	if (sig == NULL) {
+		fprintf(stderr, "ERROR: OQS_SIG_new failed\n");
+		goto err;
+	}
+
+	if (sig->sign_parallel == NULL) {
+		printf("parallel signing is not supported\n");
+		ret = OQS_SUCCESS;
+		goto cleanup;
+	}
+
+	public_key = OQS_MEM_malloc(sig->length_public_key);
+	secret_key = OQS_MEM_malloc(sig->length_secret_key);
+	message = OQS_MEM_malloc(message_len);
+	signature = OQS_MEM_malloc(sig->length_signature);
+	signature_parallel = OQS_MEM_malloc(sig->length_signature);
+	signature_custom = OQS_MEM_malloc(sig->length_signature);
+	if ((public_key == NULL) || (secret_key == NULL) || (message == NULL) || (signature == NULL) || (signature_parallel == NULL) || (signature_custom == NULL)) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		goto err;
+	}
+
+	pool = OQS_THREADPOOL_new(4);
+	custom_pool = OQS_THREADPOOL_new_custom(&sig_test_reverse_executor, &custom_calls, 2);
+	if ((pool == NULL) || (custom_pool == NULL)) {
+		fprintf(stderr, "ERROR: OQS_THREADPOOL_new failed\n");
+		goto err;
+	}
+
+	rc = OQS_SIG_keypair(sig, public_key, secret_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_keypair failed\n");
+		goto err;
+	}
+	OQS_TEST_CT_DECLASSIFY(public_key, sig->length_public_key);
+
+	OQS_randombytes(message, message_len);
+	OQS_TEST_CT_DECLASSIFY(message, message_len);
+
+	OQS_randombytes_custom_algorithm(&sig_test_fixed_randombytes);
+	rc = OQS_SIG_sign(sig, signature, &signature_len, message, message_len, secret_key);
+	rc_parallel = OQS_SIG_sign_parallel(sig, signature_parallel, &signature_parallel_len, message, message_len, secret_key, pool);
+	rc_custom = OQS_SIG_sign_parallel(sig, signature_custom, &signature_custom_len, message, message_len, secret_key, custom_pool);
+	sig_test_restore_randombytes();
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	OQS_TEST_CT_DECLASSIFY(&rc_parallel, sizeof rc_parallel);
+	OQS_TEST_CT_DECLASSIFY(&rc_custom, sizeof rc_custom);
+	if (rc != OQS_SUCCESS || rc_parallel != OQS_SUCCESS || rc_custom != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_sign or OQS_SIG_sign_parallel failed\n");
+		goto err;
+	}
+	OQS_TEST_CT_DECLASSIFY(signature, signature_len);
+	OQS_TEST_CT_DECLASSIFY(signature_parallel, signature_parallel_len);
+	OQS_TEST_CT_DECLASSIFY(signature_custom, signature_custom_len);
+
+	if (signature_parallel_len != signature_len || memcmp(signature_parallel, signature, signature_len) != 0) {
+		fprintf(stderr, "ERROR: parallel signature differs from the sequential one\n");
+		goto err;
+	}
+	if (custom_calls == 0 || signature_custom_len != signature_len || memcmp(signature_custom, signature, signature_len) != 0) {
+		fprintf(stderr, "ERROR: signature from a custom thread pool differs from the sequential one\n");
+		goto err;
+	}
+
+	rc = OQS_SIG_verify(sig, message, message_len, signature_parallel, signature_parallel_len, public_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: parallel signature does not verify\n");
+		goto err;
+	}
+	printf("parallel signatures match sequential ones as expected\n");
+
+	ret = OQS_SUCCESS;
+	goto cleanup;
+
+err:
+	ret = OQS_ERROR;
+
+cleanup:
+	if (sig != NULL) {
+		OQS_MEM_secure_free(secret_key, sig->length_secret_key);
+	}
+	OQS_MEM_insecure_free(public_key);
+	OQS_MEM_insecure_free(message);
+	OQS_MEM_insecure_free(signature);
+	OQS_MEM_insecure_free(signature_parallel);
+	OQS_MEM_insecure_free(signature_custom);
+	OQS_THREADPOOL_free(pool);
+	OQS_THREADPOOL_free(custom_pool);
+	OQS_SIG_free(sig);
+
+	return ret;
+}
+
+static OQS_STATUS sig_test(const char *method_name) {
+	OQS_STATUS rc = sig_test_correctness(method_name);
+	if (rc == OQS_SUCCESS) {
+		rc = sig_test_expanded(method_name);
+	}
+	if (rc == OQS_SUCCESS) {
+		rc = sig_test_stream(method_name);
+	}
+	if (rc == OQS_SUCCESS) {
+		rc = sig_test_parallel(method_name);
+	}
+	return rc;
+}
+
 #ifdef OQS_ENABLE_TEST_CONSTANT_TIME
 static void TEST_SIG_randombytes(uint8_t *random_array, size_t bytes_to_read) {
 	// We can't make direct calls to the system randombytes on some platforms,
@@ -182,7 +595,7 @@ struct thread_data {
 
 void *test_wrapper(void *arg) {
 	struct thread_data *td = arg;
-	td->rc = sig_test_correctness(td->alg_name);
+	td->rc = sig_test(td->alg_name);
 	return NULL;
 }
 #endif
@@ -246,10 +659,10 @@ int main(int argc, char **argv) {
 		pthread_join(thread, NULL);
 		rc = td.rc;
 	} else {
-		rc = sig_test_correctness(alg_name);
+		rc = sig_test(alg_name);
 	}
 #else
-	rc = sig_test_correctness(alg_name);
+	rc = sig_test(alg_name);
 #endif
 	if (rc != OQS_SUCCESS) {
 		OQS_destroy();
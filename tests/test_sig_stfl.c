@@ -160,6 +160,103 @@ static OQS_STATUS save_secret_key(uint8_t *key_buf, size_t buf_len, void *contex
 	return OQS_ERROR;
 }
 
+/* In-memory log filled by the store callback in delta store mode. */
+typedef struct {
+	uint8_t *buf;
+	size_t len;
+	size_t records;
+	size_t snapshots;
+} store_log_t;
+
+static OQS_STATUS append_store_record(uint8_t *record, size_t record_len, void *context) {
+	store_log_t *log = context;
+	uint8_t *grown;
+
+	if (record == NULL || record_len == 0 || log == NULL) {
+		return OQS_ERROR;
+	}
+	grown = realloc(log->buf, log->len + record_len);
+	if (grown == NULL) {
+		return OQS_ERROR;
+	}
+	log->buf = grown;
+	memcpy(log->buf + log->len, record, record_len);
+	log->len += record_len;
+	log->records++;
+	if (record[0] == OQS_SIG_STFL_STORE_RECORD_SNAPSHOT) {
+		log->snapshots++;
+	}
+	return OQS_SUCCESS;
+}
+
+/*
+ * Sign a few messages with the store callback in delta store mode, then rebuild
+ * the key from the resulting log and check that it matches the live key.
+ */
+static OQS_STATUS sig_stfl_test_delta_store(const OQS_SIG_STFL *sig, OQS_SIG_STFL_SECRET_KEY *sk) {
+	const unsigned int compact_interval = 3;
+	const size_t num_sigs = compact_interval + 2;
+	uint8_t message[] = "delta store";
+	store_log_t log = {NULL, 0, 0, 0};
+	OQS_SIG_STFL_SECRET_KEY *sk_replayed = NULL;
+	uint8_t *signature = NULL;
+	uint8_t *sk_buf = NULL, *replayed_buf = NULL;
+	size_t signature_len = 0, sk_buf_len = 0, replayed_len = 0;
+	OQS_STATUS rc = OQS_ERROR;
+
+	signature = OQS_MEM_malloc(sig->length_signature);
+	if (signature == NULL) {
+		goto cleanup;
+	}
+
+	OQS_SIG_STFL_SECRET_KEY_SET_store_cb(sk, append_store_record, &log);
+	if (OQS_SIG_STFL_SECRET_KEY_SET_delta_store(sk, compact_interval) != OQS_SUCCESS) {
+		goto cleanup;
+	}
+	for (size_t i = 0; i < num_sigs; i++) {
+		if (OQS_SIG_STFL_sign(sig, signature, &signature_len, message, sizeof(message), sk) != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_STFL_sign failed in delta store mode\n");
+			goto cleanup;
+		}
+	}
+	/* snapshot, compact_interval deltas, snapshot, ... */
+	if (log.records != num_sigs || log.snapshots != 2) {
+		fprintf(stderr, "ERROR: delta store wrote %zu records with %zu snapshots\n", log.records, log.snapshots);
+		goto cleanup;
+	}
+
+	sk_replayed = OQS_SIG_STFL_SECRET_KEY_new(sig->method_name);
+	if (sk_replayed == NULL || OQS_SIG_STFL_SECRET_KEY_replay(sk_replayed, log.buf, log.len, NULL) != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_STFL_SECRET_KEY_replay failed\n");
+		goto cleanup;
+	}
+	/* A log cut inside a record must be rejected. */
+	if (OQS_SIG_STFL_SECRET_KEY_replay(sk_replayed, log.buf, log.len - 1, NULL) == OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_STFL_SECRET_KEY_replay accepted a truncated log\n");
+		goto cleanup;
+	}
+
+	if (OQS_SIG_STFL_SECRET_KEY_serialize(&sk_buf, &sk_buf_len, sk) != OQS_SUCCESS ||
+	        OQS_SIG_STFL_SECRET_KEY_serialize(&replayed_buf, &replayed_len, sk_replayed) != OQS_SUCCESS) {
+		goto cleanup;
+	}
+	if (sk_buf_len != replayed_len || memcmp(sk_buf, replayed_buf, sk_buf_len)) {
+		fprintf(stderr, "ERROR: key replayed from the delta log differs from the live key\n");
+		goto cleanup;
+	}
+	printf("Delta store: %zu records, %zu bytes for a %zu-byte key\n", log.records, log.len, sk_buf_len);
+	rc = OQS_SUCCESS;
+
+cleanup:
+	OQS_SIG_STFL_SECRET_KEY_SET_delta_store(sk, 0);
+	OQS_SIG_STFL_SECRET_KEY_free(sk_replayed);
+	OQS_MEM_secure_free(sk_buf, sk_buf_len);
+	OQS_MEM_secure_free(replayed_buf, replayed_len);
+	OQS_MEM_insecure_free(signature);
+	free(log.buf);
+	return rc;
+}
+
 #if OQS_USE_PTHREADS_IN_TESTS
 
 static OQS_SIG_STFL_SECRET_KEY *lock_test_sk = NULL;
@@ -414,6 +511,7 @@ static OQS_STATUS sig_stfl_test_correctness(const char *method_name, const char
 	uint8_t *public_key = NULL;
 	OQS_SIG_STFL_SECRET_KEY *secret_key = NULL;
 	OQS_SIG_STFL_SECRET_KEY *secret_key_rd = NULL;
+	OQS_THREADPOOL *pool = NULL;
 	uint8_t *message = NULL;
 	size_t message_len = 100;
 	uint8_t *signature = NULL;
@@ -449,6 +547,9 @@ static OQS_STATUS sig_stfl_test_correctness(const char *method_name, const char
 
 	OQS_SIG_STFL_SECRET_KEY_SET_lock(secret_key, lock_sk_key);
 	OQS_SIG_STFL_SECRET_KEY_SET_unlock(secret_key, unlock_sk_key);
+	/* exercise multi-threaded tree building where the build supports it */
+	pool = OQS_THREADPOOL_new(4);
+	OQS_SIG_STFL_SECRET_KEY_SET_threadpool(secret_key, pool);
 
 	file_store = convert_method_name_to_file_name(sig->method_name);
 	if (file_store == NULL) {
@@ -573,6 +674,7 @@ err:
 cleanup:
 	OQS_SIG_STFL_SECRET_KEY_free(secret_key);
 	OQS_SIG_STFL_SECRET_KEY_free(secret_key_rd);
+	OQS_THREADPOOL_free(pool);
 	if (public_key) {
 		OQS_MEM_insecure_free(public_key - sizeof(magic_t));
 	}
@@ -705,6 +807,11 @@ static OQS_STATUS sig_stfl_test_secret_key(const char *method_name, const char *
 		goto err;
 	}
 
+	rc = sig_stfl_test_delta_store(sig_obj, sk);
+	if (rc != OQS_SUCCESS) {
+		goto err;
+	}
+
 	rc = OQS_SUCCESS;
 	goto cleanup;
 